@@ -38,7 +38,7 @@ typedef struct BddscoutStubs {
     Biddy_String (*biddy_About) (); /* 3 */
     int (*biddy_Managed_GetManagerType) (Biddy_Manager MNG); /* 4 */
     Biddy_String (*biddy_Managed_GetManagerName) (Biddy_Manager MNG); /* 5 */
-    void (*biddy_Managed_SetManagerParameters) (Biddy_Manager MNG, float gcr, float gcrF, float gcrX, float rr, float rrF, float rrX, float st, float cst); /* 6 */
+    void (*biddy_Managed_SetManagerParameters) (Biddy_Manager MNG, float gcr, float gcrF, float gcrX, float rr, float rrF, float rrX, float st, float cst, float cr); /* 6 */
     Biddy_Edge (*biddy_GetThen) (Biddy_Edge f); /* 7 */
     Biddy_Edge (*biddy_GetElse) (Biddy_Edge f); /* 8 */
     Biddy_Variable (*biddy_GetTopVariable) (Biddy_Edge f); /* 9 */
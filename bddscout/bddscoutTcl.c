@@ -1986,6 +1986,9 @@ BddscoutListFormulaeByMintermNumberCmd(ClientData clientData,
 
   list = strdup("NULL"); /* required! */
 
+  /* fill count cache, MyMintermNumber will then only look up the results */
+  Biddy_Managed_CountFormulaeMinterms(Bddscout_GetActiveManager(),0);
+
   BddscoutListFormulaByFloatParameter(&list,MyMintermNumber);
 
   Tcl_SetResult(interp, list, TCL_VOLATILE);
@@ -0,0 +1,82 @@
+module ACC16(a0,b0,a1,b1,a2,b2,a3,b3,a4,b4,a5,b5,a6,b6,a7,b7,a8,b8,a9,b9,a10,b10,a11,b11,a12,b12,a13,b13,a14,b14,a15,b15,a0_next,a1_next,a2_next,a3_next,a4_next,a5_next,a6_next,a7_next,a8_next,a9_next,a10_next,a11_next,a12_next,a13_next,a14_next,a15_next);
+input a0,b0,a1,b1,a2,b2,a3,b3,a4,b4,a5,b5,a6,b6,a7,b7,a8,b8,a9,b9,a10,b10,a11,b11,a12,b12,a13,b13,a14,b14,a15,b15;
+output a0_next,a1_next,a2_next,a3_next,a4_next,a5_next,a6_next,a7_next,a8_next,a9_next,a10_next,a11_next,a12_next,a13_next,a14_next,a15_next;
+wire p0,c1,p1,c2,g1,h1,p2,c3,g2,h2,p3,c4,g3,h3,p4,c5,g4,h4,p5,c6,g5,h5,p6,c7,g6,h6,p7,c8,g7,h7,p8,c9,g8,h8,p9,c10,g9,h9,p10,c11,g10,h10,p11,c12,g11,h11,p12,c13,g12,h12,p13,c14,g13,h13,p14,c15,g14,h14,p15;
+
+xor XOR2_0(p0,a0,b0);
+buf BUF_0(a0_next,p0);
+and AND2_0(c1,a0,b0);
+xor XOR2_1(p1,a1,b1);
+xor XOR2_2(a1_next,p1,c1);
+and AND2_1(g1,a1,b1);
+and AND2_2(h1,p1,c1);
+or OR2_0(c2,g1,h1);
+xor XOR2_3(p2,a2,b2);
+xor XOR2_4(a2_next,p2,c2);
+and AND2_3(g2,a2,b2);
+and AND2_4(h2,p2,c2);
+or OR2_1(c3,g2,h2);
+xor XOR2_5(p3,a3,b3);
+xor XOR2_6(a3_next,p3,c3);
+and AND2_5(g3,a3,b3);
+and AND2_6(h3,p3,c3);
+or OR2_2(c4,g3,h3);
+xor XOR2_7(p4,a4,b4);
+xor XOR2_8(a4_next,p4,c4);
+and AND2_7(g4,a4,b4);
+and AND2_8(h4,p4,c4);
+or OR2_3(c5,g4,h4);
+xor XOR2_9(p5,a5,b5);
+xor XOR2_10(a5_next,p5,c5);
+and AND2_9(g5,a5,b5);
+and AND2_10(h5,p5,c5);
+or OR2_4(c6,g5,h5);
+xor XOR2_11(p6,a6,b6);
+xor XOR2_12(a6_next,p6,c6);
+and AND2_11(g6,a6,b6);
+and AND2_12(h6,p6,c6);
+or OR2_5(c7,g6,h6);
+xor XOR2_13(p7,a7,b7);
+xor XOR2_14(a7_next,p7,c7);
+and AND2_13(g7,a7,b7);
+and AND2_14(h7,p7,c7);
+or OR2_6(c8,g7,h7);
+xor XOR2_15(p8,a8,b8);
+xor XOR2_16(a8_next,p8,c8);
+and AND2_15(g8,a8,b8);
+and AND2_16(h8,p8,c8);
+or OR2_7(c9,g8,h8);
+xor XOR2_17(p9,a9,b9);
+xor XOR2_18(a9_next,p9,c9);
+and AND2_17(g9,a9,b9);
+and AND2_18(h9,p9,c9);
+or OR2_8(c10,g9,h9);
+xor XOR2_19(p10,a10,b10);
+xor XOR2_20(a10_next,p10,c10);
+and AND2_19(g10,a10,b10);
+and AND2_20(h10,p10,c10);
+or OR2_9(c11,g10,h10);
+xor XOR2_21(p11,a11,b11);
+xor XOR2_22(a11_next,p11,c11);
+and AND2_21(g11,a11,b11);
+and AND2_22(h11,p11,c11);
+or OR2_10(c12,g11,h11);
+xor XOR2_23(p12,a12,b12);
+xor XOR2_24(a12_next,p12,c12);
+and AND2_23(g12,a12,b12);
+and AND2_24(h12,p12,c12);
+or OR2_11(c13,g12,h12);
+xor XOR2_25(p13,a13,b13);
+xor XOR2_26(a13_next,p13,c13);
+and AND2_25(g13,a13,b13);
+and AND2_26(h13,p13,c13);
+or OR2_12(c14,g13,h13);
+xor XOR2_27(p14,a14,b14);
+xor XOR2_28(a14_next,p14,c14);
+and AND2_27(g14,a14,b14);
+and AND2_28(h14,p14,c14);
+or OR2_13(c15,g14,h14);
+xor XOR2_29(p15,a15,b15);
+xor XOR2_30(a15_next,p15,c15);
+
+endmodule
@@ -15,7 +15,7 @@
 /* gcc -DNOREPORT -DEVENTLOG_NONE -DCUDD -DOBDDC -O2 -o cudd-example-8queens-obddc biddy-example-8queens.c -I ../cudd/include/ -L ../cudd/lib/ -lcudd -lm */
 /* gcc -DNOREPORT -DEVENTLOG_NONE -DCUDD -DZBDDC -O2 -o cudd-example-8queens-zbddc biddy-example-8queens.c -I ../cudd/include/ -L ../cudd/lib/ -lcudd -lm */
 
-/* for stats with more details, use BIDDYEXTENDEDSTATS_YES in biddyInt.h and use -lm for linking */
+/* for stats with more details, call Biddy_SetExtendedStats(TRUE) after the manager is initialized */
 
 /* default size, this can be overriden via argument */
 #define SIZE 9
@@ -25,9 +25,17 @@
 /* NOT_USE_SIFTING, USE_SIFTING, USE_SIFTING_R */
 #define NOT_USE_SIFTING
 
-/* there are 5 variants possible */
-/* NOT_POSTPONE, POSTPONE_FIFO, POSTPONE_LIFO, POSTPONE_REVERSE_FIFO, POSTPONE_REVERSE_LIFO */
+/* there are 6 variants possible */
+/* NOT_POSTPONE, POSTPONE_FIFO, POSTPONE_LIFO, POSTPONE_REVERSE_FIFO, POSTPONE_REVERSE_LIFO, */
+/* POSTPONE_ANDN (for BIDDY, only, the schedule is given by ANDN_SCHEDULE) */
+#if !defined(POSTPONE_FIFO) && !defined(POSTPONE_LIFO) && \
+    !defined(POSTPONE_REVERSE_FIFO) && !defined(POSTPONE_REVERSE_LIFO) && \
+    !defined(POSTPONE_ANDN)
 #define NOT_POSTPONE
+#endif
+#ifndef ANDN_SCHEDULE
+#define ANDN_SCHEDULE BIDDYSCHEDULESUPPORT
+#endif
 
 /* event log (EVENTLOG_TIME, EVENTLOG_SIZE, or EVENTLOG_RESULT) */
 #ifdef EVENTLOG_TIME
@@ -129,7 +137,7 @@ int main(int argc, char** argv) {
 
 #ifdef BIDDY
   if ((argc == 1) || (argc == 2)) {
-    Biddy_SetManagerParameters(-1,-1,-1,-1,-1,-1,-1,-1);
+    Biddy_SetManagerParameters(-1,-1,-1,-1,-1,-1,-1,-1,-1);
   }
   else if (argc == 8) {
     int gcr,gcrF,gcrX;
@@ -140,7 +148,7 @@ int main(int argc, char** argv) {
     sscanf(argv[5],"%d",&rr);
     sscanf(argv[6],"%d",&rrF);
     sscanf(argv[7],"%d",&rrX);
-    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,-1,-1);
+    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,-1,-1,-1);
     printf("%d, %d, %d, %d, %d, %d, ",gcr,gcrF,gcrX,rr,rrF,rrX);
   }
   else if (argc == 11) {
@@ -155,7 +163,7 @@ int main(int argc, char** argv) {
     sscanf(argv[7],"%d",&rrX);
     sscanf(argv[8],"%d",&st);
     sscanf(argv[9],"%d",&cst);
-    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,st/100.0,cst/100.0);
+    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,st/100.0,cst/100.0,-1);
     printf("%d, %d, %d, %d, %d, %d, ",gcr,gcrF,gcrX,rr,rrF,rrX);
   }
   else {
@@ -805,6 +813,17 @@ int main(int argc, char** argv) {
   r = *(LP1);
 #endif
 
+/* POSTPONE And OPERATIONS, ALL ARE CALCULATED BY Biddy_AndN */
+#if defined(POSTPONE_ANDN) && defined(BIDDY)
+#ifdef REPORT
+  printf("\nPOSTPONED And OPERATIONS USING Biddy_AndN\n");
+#endif
+  DEREF(r);
+  ZF_LOGI("P_ANDN");
+  r = Biddy_AndN(fifo1,(unsigned int) (LP1 - fifo1 + 1),ANDN_SCHEDULE);
+  REF(r);
+#endif
+
   free(fifo1);
   free(fifo2);
 
@@ -0,0 +1,175 @@
+/* $Revision$ */
+/* $Date$ */
+/* This file (biddy-example-deep.c) is a C file */
+/* Author: Robert Meolic (robert@meolic.com) */
+/* This file has been released into the public domain by the author. */
+
+/* This example is compatible with Biddy v2.5 and laters */
+
+/* COMPILE WITH (ADD -lgmp IF USING STATIC BIDDY LIBRARY): */
+/* gcc -DUNIX -O2 -o biddy-example-deep biddy-example-deep.c -I. -L./bin -lbiddy */
+
+/* this example is a stress test for the iterative apply kernels */
+/* chain BDDs with one node per variable are combined with ITE, And, Xor, */
+/* and ExistAndAbstract, the depth of each operation equals the number */
+/* of variables, results are checked by comparing canonical edges */
+/* afterwards, recursive and iterative kernels are timed on random functions */
+/* usage: biddy-example-deep [number of variables] [r|i] [number of steps] */
+/* the number of variables is limited by BIDDYVARMAX (for 100000 variables */
+/* use PLAIN build and compile this example with -DPLAIN, too), with 'r' */
+/* the recursive kernels are used for the deep operations, which may */
+/* overflow the system stack */
+
+#include "biddy.h"
+#include <time.h>
+
+#define NUMVARIABLES 16
+
+static unsigned int
+nextRandom(unsigned int *seed)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return (*seed >> 16) & 0x7fff;
+}
+
+/* for OBDDs, new variables are added below all others, thus */
+/* chains are built bottom-up and each step is a shallow operation */
+static Biddy_Edge
+buildChain(Biddy_Manager MNG, unsigned int n, unsigned int first, unsigned int step, Biddy_Boolean parity)
+{
+  Biddy_Edge r;
+  int i;
+
+  r = parity ? Biddy_Managed_GetConstantZero(MNG) : Biddy_Managed_GetConstantOne(MNG);
+  for (i = n - ((n - first) % step); i >= (int) first; i -= step) {
+    if (parity) {
+      r = Biddy_Managed_Xor(MNG,Biddy_Managed_GetVariableEdge(MNG,i),r);
+    } else {
+      r = Biddy_Managed_And(MNG,Biddy_Managed_GetVariableEdge(MNG,i),r);
+    }
+  }
+
+  return r;
+}
+
+static unsigned int
+deepTest(int bddtype, unsigned int n, Biddy_Boolean iterative)
+{
+  Biddy_Manager MNG;
+  Biddy_Edge all,odd,even,cube,r;
+  unsigned int i,errors;
+
+  Biddy_InitMNG(&MNG,bddtype);
+  for (i=0; i<n; i++) {
+    Biddy_Managed_AddVariable(MNG);
+  }
+
+  /* chains are built with recursive kernels, they are shallow */
+  all = buildChain(MNG,n,1,1,TRUE);
+  odd = buildChain(MNG,n,1,2,TRUE);
+  even = buildChain(MNG,n,2,2,TRUE);
+  cube = buildChain(MNG,n,1,2,FALSE);
+
+  Biddy_Managed_SetIterativeApply(MNG,iterative);
+  errors = 0;
+
+  /* x1 ^ x2 ^ ... ^ xn = odd ^ even */
+  r = Biddy_Managed_Xor(MNG,odd,even);
+  if (r != all) errors++;
+
+  /* all & odd = !even & odd */
+  r = Biddy_Managed_And(MNG,all,odd);
+  if (r != Biddy_Managed_ITE(MNG,even,Biddy_Managed_GetConstantZero(MNG),odd)) errors++;
+
+  /* ITE(odd,!all,all) = odd ^ all = even */
+  r = Biddy_Managed_ITE(MNG,odd,Biddy_Managed_Not(MNG,all),all);
+  if (r != even) errors++;
+
+  /* E odd variables . (all & odd) = !even */
+  r = Biddy_Managed_ExistAndAbstract(MNG,all,odd,cube);
+  if (r != Biddy_Managed_Not(MNG,even)) errors++;
+
+  Biddy_ExitMNG(&MNG);
+
+  return errors;
+}
+
+/* the same sequence of operations is used for both kernels */
+static double
+throughputTest(int bddtype, unsigned int steps, Biddy_Boolean iterative, unsigned int *nodes)
+{
+  Biddy_Manager MNG;
+  Biddy_Edge r,f,g,h,x[NUMVARIABLES];
+  unsigned int i,seed;
+  clock_t start;
+
+  Biddy_InitMNG(&MNG,bddtype);
+  Biddy_Managed_SetIterativeApply(MNG,iterative);
+  for (i=0; i<NUMVARIABLES; i++) {
+    Biddy_Managed_AddVariable(MNG);
+  }
+  for (i=0; i<NUMVARIABLES; i++) {
+    x[i] = Biddy_Managed_GetVariableEdge(MNG,i+1);
+  }
+
+  start = clock();
+  seed = 1;
+  r = Biddy_Managed_GetConstantZero(MNG);
+  for (i=0; i<steps; i++) {
+    f = Biddy_Managed_Or(MNG,x[nextRandom(&seed) % NUMVARIABLES],r);
+    g = Biddy_Managed_Xor(MNG,x[nextRandom(&seed) % NUMVARIABLES],r);
+    h = x[nextRandom(&seed) % NUMVARIABLES];
+    f = Biddy_Managed_ITE(MNG,h,f,g);
+    f = Biddy_Managed_And(MNG,f,Biddy_Managed_Not(MNG,x[nextRandom(&seed) % NUMVARIABLES]));
+    if (Biddy_Managed_CountNodes(MNG,f) > 2000) {
+      f = Biddy_Managed_ExistAndAbstract(MNG,f,r,Biddy_Managed_And(MNG,h,x[nextRandom(&seed) % NUMVARIABLES]));
+    }
+    r = (i % 2) ? Biddy_Managed_Or(MNG,r,f) : Biddy_Managed_Xor(MNG,r,f);
+    Biddy_Managed_KeepFormula(MNG,r); /* r is preserved for the next cleaning */
+    Biddy_Managed_Clean(MNG);
+  }
+  *nodes = Biddy_Managed_CountNodes(MNG,r);
+
+  Biddy_ExitMNG(&MNG);
+
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]) {
+  int bddtype[] = {BIDDYTYPEOBDD,BIDDYTYPEOBDDC};
+  unsigned int i,n,steps,errors,nodes1,nodes2;
+  Biddy_Boolean iterative;
+  double t1,t2;
+
+  n = 10000;
+  iterative = TRUE;
+  steps = 2000;
+  if (argc > 1) sscanf(argv[1],"%u",&n);
+  if ((argc > 2) && (argv[2][0] == 'r')) iterative = FALSE;
+  if (argc > 3) sscanf(argv[3],"%u",&steps);
+  if (n < 2) n = 2;
+
+  errors = 0;
+  for (i=0; i<2; i++) {
+    if (deepTest(bddtype[i],n,iterative)) {
+      printf("ERROR: %s: deep operations on %u variables\n",(i==0)?"OBDD":"OBDDC",n);
+      errors++;
+    } else {
+      printf("%s: deep operations on %u variables (%s): OK\n",
+             (i==0)?"OBDD":"OBDDC",n,iterative?"iterative":"recursive");
+    }
+  }
+
+  for (i=0; i<2; i++) {
+    t1 = throughputTest(bddtype[i],steps,FALSE,&nodes1);
+    t2 = throughputTest(bddtype[i],steps,TRUE,&nodes2);
+    if (nodes1 != nodes2) {
+      printf("ERROR: %s: %u nodes (recursive), %u nodes (iterative)\n",(i==0)?"OBDD":"OBDDC",nodes1,nodes2);
+      errors++;
+    }
+    printf("%s: %u steps, %u nodes, recursive %.2fs, iterative %.2fs\n",
+           (i==0)?"OBDD":"OBDDC",steps,nodes1,t1,t2);
+  }
+
+  return errors ? 1 : 0;
+}
@@ -21,6 +21,7 @@
 /* gcc -DREPORT -DUNIX -DBIDDY -DZBDD -O2 -o biddy-example-hanoi-zbdd biddy-example-hanoi.c -I. -L./bin -lbiddy */
 /* gcc -DREPORT -DUNIX -DBIDDY -DZBDDC -O2 -o biddy-example-hanoi-zbddc biddy-example-hanoi.c -I. -L./bin -lbiddy */
 /* gcc -DREPORT -DUNIX -DBIDDY -DTZBDD -O2 -o biddy-example-hanoi-tzbdd biddy-example-hanoi.c -I. -L./bin -lbiddy */
+/* gcc -DREPORT -DUNIX -DBIDDY -DOBDD -DPARTITIONED -O2 -o biddy-example-hanoi-obdd-partitioned biddy-example-hanoi.c -I. -L./bin -lbiddy */
 /* gcc -DREPORT -DCUDD -DOBDDC -O2 -o cudd-example-hanoi-obddc biddy-example-hanoi.c -I ../cudd/include/ -L ../cudd/lib/ -lcudd -lm */
 
 /* Here are the original comments */
@@ -49,6 +50,10 @@ repeat till you hit the initial state.
 #define MAXSIZE 16
 #define SIZE 10
 
+/* for PARTITIONED, each move is given as a conjunction of partitions */
+/* and the reachable states are calculated by Biddy_Reachable */
+#define CLUSTERSIZE 1000
+
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
@@ -62,6 +67,10 @@ Biddy_Edge v2[MAXSIZE][3];  /* the next state */
 /* v[i][j] = 1 means that disk i is in tower j */
 
 Biddy_Edge make_a_move(unsigned int size, unsigned int i, unsigned int j, unsigned int k);
+#ifdef PARTITIONED
+unsigned int make_a_move_partitioned(unsigned int size, unsigned int i, unsigned int j, unsigned int k, Biddy_Edge *part);
+Biddy_Variable get_variable(unsigned int size, unsigned int i, unsigned int j, Biddy_Boolean next);
+#endif
 Biddy_Edge compute_image(unsigned int size, Biddy_Edge R, Biddy_Edge T, Biddy_Edge cube);
 
 int main(int argc, char** argv) {
@@ -267,6 +276,45 @@ int main(int argc, char** argv) {
   MARK(NOT_E);
   SWEEP();
 
+#ifdef PARTITIONED
+  {
+  Biddy_Relation rel[6*MAXSIZE];
+  Biddy_Edge part[3*MAXSIZE+1];
+  Biddy_Variable cur[3*MAXSIZE],next[3*MAXSIZE];
+  unsigned int n,steps;
+
+  for(i=0;i<size;i++) {
+    for(j=0;j<3;j++) {
+      cur[3*i+j] = get_variable(size,i,j,FALSE);
+      next[3*i+j] = get_variable(size,i,j,TRUE);
+    }
+  }
+
+  /* the transition relation is the disjunction of all possible moves */
+  /* partitions are not preserved, relations keep their own copies */
+
+  for(i=0;i<size;i++) {
+    for(j=0;j<3;j++) {
+      n = make_a_move_partitioned(size,i,j,(j+1)%3,part);
+      rel[6*i+2*j] = Biddy_CreateRelation(part,n,cur,next,3*size,CLUSTERSIZE);
+      n = make_a_move_partitioned(size,i,j,(j+2)%3,part);
+      rel[6*i+2*j+1] = Biddy_CreateRelation(part,n,cur,next,3*size,CLUSTERSIZE);
+      MARK(I);
+      MARK(NOT_E);
+      SWEEP();
+    }
+  }
+
+  /* fixed point computation, it stops when the goal state is reached */
+  R = Biddy_Reachable(rel,6*size,I,Biddy_Not(NOT_E),&steps);
+  num_steps = steps;
+  found = (Biddy_Or(NOT_E,R) != NOT_E);
+
+  for(i=0;i<6*size;i++) {
+    Biddy_DeleteRelation(rel[i]);
+  }
+  }
+#else
   /* the transition relation is the disjunction of all possible moves */
 
   T = Biddy_GetConstantZero();
@@ -403,6 +451,7 @@ int main(int argc, char** argv) {
     R = tmp1;
 
   }
+#endif
 
 #ifdef REPORT
   printf(
@@ -432,13 +481,18 @@ int main(int argc, char** argv) {
 #endif
 
   fprintf(stderr,"clock() TIME = %.2f\n",elapsedtime/(1.0*CLOCKS_PER_SEC));
+#ifdef BIDDY
+  fprintf(stderr,"PEAK NODES = %u\n",Biddy_NodeTableMax());
+#endif
 
   /* EXIT */
 
   DEREF(I);
   DEREF(NOT_E);
+#ifndef PARTITIONED
   DEREF(T);
   DEREF(cube);
+#endif
   DEREF(R);
   for(i=0;i<size;i++) {
     for(j=0;j<3;j++) {
@@ -520,6 +574,55 @@ Biddy_Edge make_a_move(unsigned int size, unsigned int i, unsigned int j,
   return result;
 }
 
+#ifdef PARTITIONED
+/* stores partitions representing move of disk i from tower j to tower k */
+/* and returns the number of partitions, the move is their conjunction */
+unsigned int make_a_move_partitioned(unsigned int size, unsigned int i,
+                                     unsigned int j, unsigned int k,
+                                     Biddy_Edge *part)
+{
+  unsigned int l,m,n;
+  Biddy_Edge tmp1;
+
+  /* disk i is in tower j and there is no smaller disk in tower j or tower k */
+  tmp1 = v1[i][j];
+  for(l=0;l<i;l++) {
+    tmp1 = Biddy_And(tmp1,Biddy_Not(v1[l][j]));
+    tmp1 = Biddy_And(tmp1,Biddy_Not(v1[l][k]));
+  }
+  part[0] = tmp1;
+
+  /* move the current disk to tower k */
+  part[1] = v2[i][k];
+  part[2] = Biddy_Not(v2[i][(k+1)%3]);
+  part[3] = Biddy_Not(v2[i][(k+2)%3]);
+  n = 4;
+
+  /* the other disks stay where they are */
+  for(l=0;l<size;l++) {
+    if (l!=i) {
+      for(m=0;m<3;m++) {
+        part[n++] = Biddy_Xnor(v1[l][m],v2[l][m]);
+      }
+    }
+  }
+
+  return n;
+}
+
+/* returns the index of the current (next = FALSE) or the next (next = TRUE) */
+/* state variable for disk i in tower j, see compute_image for the order */
+Biddy_Variable get_variable(unsigned int size, unsigned int i, unsigned int j,
+                            Biddy_Boolean next)
+{
+  if ((Biddy_GetManagerType() == BIDDYTYPEOBDD) || (Biddy_GetManagerType() == BIDDYTYPEOBDDC)) {
+    return 2*(i*3+j)+(next?2:1);
+  } else {
+    return 2*(size*3-(i*3+j))-(next?1:0);
+  }
+}
+#endif
+
 /* given a set of states R and a transition relation T, returns the BDD */
 /* for the states that can be reached in one step from R following T */
 Biddy_Edge compute_image(unsigned int size, Biddy_Edge R, Biddy_Edge T,
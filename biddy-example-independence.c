@@ -98,7 +98,7 @@ int main(int argc, char** argv) {
 
 #ifdef BIDDY
   if (argc == 1) {
-    Biddy_SetManagerParameters(-1,-1,-1,-1,-1,-1,-1,-1);
+    Biddy_SetManagerParameters(-1,-1,-1,-1,-1,-1,-1,-1,-1);
   }
   else if (argc == 7) {
     int gcr,gcrF,gcrX;
@@ -109,7 +109,7 @@ int main(int argc, char** argv) {
     sscanf(argv[4],"%d",&rr);
     sscanf(argv[5],"%d",&rrF);
     sscanf(argv[6],"%d",&rrX);
-    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,-1,-1);
+    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,-1,-1,-1);
     printf("%d, %d, %d, %d, %d, %d, ",gcr,gcrF,gcrX,rr,rrF,rrX);
   }
   else if (argc == 10) {
@@ -124,7 +124,7 @@ int main(int argc, char** argv) {
     sscanf(argv[6],"%d",&rrX);
     sscanf(argv[7],"%d",&st);
     sscanf(argv[8],"%d",&cst);
-    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,st/100.0,cst/100.0);
+    Biddy_SetManagerParameters(gcr/100.0,gcrF/100.0,gcrX/100.0,rr/100.0,rrF/100.0,rrX/100.0,st/100.0,cst/100.0,-1);
     printf("%d, %d, %d, %d, %d, %d, ",gcr,gcrF,gcrX,rr,rrF,rrX);
   }
   else {
@@ -0,0 +1,108 @@
+/* $Revision$ */
+/* $Date$ */
+/* This file (biddy-example-nodealloc.c) is a C file */
+/* Author: Robert Meolic (robert@meolic.com) */
+/* This file has been released into the public domain by the author. */
+
+/* This example is compatible with Biddy v2.5 and laters */
+
+/* COMPILE WITH (ADD -lgmp IF USING STATIC BIDDY LIBRARY): */
+/* gcc -DUNIX -O2 -o biddy-example-nodealloc biddy-example-nodealloc.c -I. -L./bin -lbiddy */
+
+/* this example measures node creation rate with different allocators */
+/* for memory blocks of nodes, see Biddy_SetNodeAllocator */
+/* usage: biddy-example-nodealloc [number of nodes in millions] */
+
+#include "biddy.h"
+#include <time.h>
+
+#define NUMVARIABLES 64
+
+/* user's allocator, memory blocks are aligned to 2MB (the size of a huge page) */
+#if defined(UNIX) || defined(MACOSX)
+static void *
+userAlloc(size_t size)
+{
+  void *block;
+  if (posix_memalign(&block,2*1024*1024,size)) return NULL;
+  return block;
+}
+#else
+static void *
+userAlloc(size_t size)
+{
+  return malloc(size);
+}
+#endif
+
+static void
+userFree(void *block, size_t size)
+{
+  (void)(size);
+  free(block);
+}
+
+/* nodes for variable v are created from randomly chosen nodes which have */
+/* been created for the variables below v, all nodes remain fresh */
+static double
+createNodes(int allocator, const char *name, unsigned int n)
+{
+  Biddy_Manager MNG;
+  Biddy_Edge *pool;
+  Biddy_Variable v;
+  unsigned int i,num,low,perlevel;
+  Biddy_Edge f,t;
+  clock_t elapsedtime;
+  double rate;
+
+  Biddy_InitMNG(&MNG,BIDDYTYPEOBDD);
+  Biddy_Managed_SetNodeAllocator(MNG,allocator,userAlloc,userFree);
+
+  for (v=0; v<NUMVARIABLES; v++) {
+    Biddy_Managed_AddVariable(MNG);
+  }
+
+  pool = (Biddy_Edge *) malloc((n+2) * sizeof(Biddy_Edge));
+  pool[0] = Biddy_Managed_GetConstantZero(MNG);
+  pool[1] = Biddy_Managed_GetConstantOne(MNG);
+  num = 2;
+  perlevel = n / NUMVARIABLES;
+
+  srand(1);
+  elapsedtime = clock();
+  for (v=NUMVARIABLES; v>0; v--) {
+    low = num;
+    for (i=0; i<perlevel; i++) {
+      f = pool[rand()%low];
+      do {
+        t = pool[rand()%low];
+      } while (t == f);
+      pool[num++] = Biddy_Managed_FoaNode(MNG,v,f,t,TRUE);
+    }
+  }
+  elapsedtime = clock() - elapsedtime;
+
+  rate = Biddy_Managed_NodeTableNum(MNG) / (elapsedtime / (1.0 * CLOCKS_PER_SEC)) / 1000000.0;
+  printf("%-8s %u nodes, %u memory blocks, %.3fs, %.2f Mnodes/s\n",name,
+         Biddy_Managed_NodeTableNum(MNG),Biddy_Managed_NodeTableBlockNumber(MNG),
+         elapsedtime / (1.0 * CLOCKS_PER_SEC),rate);
+
+  free(pool);
+  Biddy_ExitMNG(&MNG);
+
+  return rate;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int n;
+
+  n = 4;
+  if (argc > 1) sscanf(argv[1],"%u",&n);
+  n = n * 1000000;
+
+  createNodes(BIDDYALLOCMALLOC,"malloc",n);
+  createNodes(BIDDYALLOCMMAP,"mmap",n);
+  createNodes(BIDDYALLOCUSER,"user",n);
+
+  return 0;
+}
@@ -0,0 +1,168 @@
+/* $Revision$ */
+/* $Date$ */
+/* This file (biddy-example-philosophers.c) is a C file */
+/* Author: Robert Meolic (robert@meolic.com) */
+/* This file has been released into the public domain by the author. */
+
+/* This example is compatible with Biddy v2.5 and laters */
+
+/* COMPILE WITH (ADD -lgmp IF USING STATIC BIDDY LIBRARY): */
+/* gcc -DUNIX -O2 -o biddy-example-philosophers biddy-example-philosophers.c -I. -L./bin -lbiddy */
+
+/* this example calculates reachable states of dining philosophers */
+/* philosopher i uses fork i (left) and fork i+1 (right), */
+/* state variables L[i] and R[i] tell if philosopher i holds left/right fork */
+/* each philosopher has three events: take left fork, take right fork, */
+/* and release both forks after eating */
+/* saturation (Biddy_Saturate) is compared with breadth-first traversal */
+/* (Biddy_Reachable), where each event is a monolithic relation */
+/* usage: biddy-example-philosophers [number of philosophers] [s|b] */
+/* with 's' only saturation is used, with 'b' only breadth-first traversal */
+/* four variables are used for each philosopher, thus the number of */
+/* philosophers is limited by BIDDYVARMAX */
+
+#include "biddy.h"
+#include <time.h>
+
+#define PHILOSOPHERS 100
+
+/* variables are added in the order L[0],L'[0],R[0],R'[0],L[1],... */
+static void
+createVariables(Biddy_Manager MNG, unsigned int n, Biddy_Variable *cur, Biddy_Variable *next)
+{
+  unsigned int i;
+
+  for (i=0; i<2*n; i++) {
+    cur[i] = Biddy_Managed_AddVariable(MNG);
+    next[i] = Biddy_Managed_AddVariable(MNG);
+  }
+}
+
+/* events are given without frame, i.e. only changed variables are constrained */
+static void
+createEvents(Biddy_Manager MNG, unsigned int n, Biddy_Variable *cur, Biddy_Variable *next, Biddy_Edge *T)
+{
+  Biddy_Edge L,R,Ln,Rn,nextL,prevR;
+  unsigned int i;
+
+  for (i=0; i<n; i++) {
+    L = Biddy_Managed_GetVariableEdge(MNG,cur[2*i]);
+    R = Biddy_Managed_GetVariableEdge(MNG,cur[2*i+1]);
+    Ln = Biddy_Managed_GetVariableEdge(MNG,next[2*i]);
+    Rn = Biddy_Managed_GetVariableEdge(MNG,next[2*i+1]);
+    nextL = Biddy_Managed_GetVariableEdge(MNG,cur[2*((i+1)%n)]);
+    prevR = Biddy_Managed_GetVariableEdge(MNG,cur[2*((i+n-1)%n)+1]);
+
+    /* take left fork if it is not held by the left neighbour */
+    T[3*i] = Biddy_Managed_And(MNG,Biddy_Managed_Not(MNG,L),Biddy_Managed_Not(MNG,prevR));
+    T[3*i] = Biddy_Managed_And(MNG,T[3*i],Ln);
+
+    /* take right fork if it is not held by the right neighbour */
+    T[3*i+1] = Biddy_Managed_And(MNG,Biddy_Managed_Not(MNG,R),Biddy_Managed_Not(MNG,nextL));
+    T[3*i+1] = Biddy_Managed_And(MNG,T[3*i+1],Rn);
+
+    /* eat and release both forks */
+    T[3*i+2] = Biddy_Managed_And(MNG,L,R);
+    T[3*i+2] = Biddy_Managed_And(MNG,T[3*i+2],Biddy_Managed_Not(MNG,Ln));
+    T[3*i+2] = Biddy_Managed_And(MNG,T[3*i+2],Biddy_Managed_Not(MNG,Rn));
+  }
+}
+
+/* in the initial state, nobody holds any fork */
+static Biddy_Edge
+initialState(Biddy_Manager MNG, unsigned int n, Biddy_Variable *cur)
+{
+  Biddy_Edge I;
+  unsigned int i;
+
+  I = Biddy_Managed_GetConstantOne(MNG);
+  for (i=2*n; i>0; i--) {
+    I = Biddy_Managed_And(MNG,I,Biddy_Managed_Not(MNG,Biddy_Managed_GetVariableEdge(MNG,cur[i-1])));
+  }
+
+  return I;
+}
+
+static void
+reachable(unsigned int n, Biddy_Boolean saturation)
+{
+  Biddy_Manager MNG;
+  Biddy_Variable *cur,*next;
+  Biddy_Edge *T,I,frame,r;
+  Biddy_Relation *rel;
+  unsigned int i,j,steps;
+  clock_t start;
+
+  cur = (Biddy_Variable *) malloc(2 * n * sizeof(Biddy_Variable));
+  next = (Biddy_Variable *) malloc(2 * n * sizeof(Biddy_Variable));
+  T = (Biddy_Edge *) malloc(3 * n * sizeof(Biddy_Edge));
+
+  Biddy_InitMNG(&MNG,BIDDYTYPEOBDDC);
+  createVariables(MNG,n,cur,next);
+  createEvents(MNG,n,cur,next,T);
+  I = initialState(MNG,n,cur);
+
+  start = clock();
+  steps = 0;
+  if (saturation) {
+    r = Biddy_Managed_Saturate(MNG,T,3*n,cur,next,2*n,I);
+  } else {
+    /* for breadth-first traversal, the frame is added to each event */
+    rel = (Biddy_Relation *) malloc(3 * n * sizeof(Biddy_Relation));
+    for (i=0; i<3*n; i++) {
+      frame = Biddy_Managed_GetConstantOne(MNG);
+      for (j=2*n; j>0; j--) {
+        if ((j-1 != 2*(i/3)) && (j-1 != 2*(i/3)+1)) {
+          frame = Biddy_Managed_And(MNG,frame,
+                    Biddy_Managed_Xnor(MNG,Biddy_Managed_GetVariableEdge(MNG,cur[j-1]),
+                                           Biddy_Managed_GetVariableEdge(MNG,next[j-1])));
+        }
+      }
+      if ((i%3) == 0) {
+        /* take left fork does not change R[i] */
+        frame = Biddy_Managed_And(MNG,frame,
+                  Biddy_Managed_Xnor(MNG,Biddy_Managed_GetVariableEdge(MNG,cur[2*(i/3)+1]),
+                                         Biddy_Managed_GetVariableEdge(MNG,next[2*(i/3)+1])));
+      }
+      if ((i%3) == 1) {
+        /* take right fork does not change L[i] */
+        frame = Biddy_Managed_And(MNG,frame,
+                  Biddy_Managed_Xnor(MNG,Biddy_Managed_GetVariableEdge(MNG,cur[2*(i/3)]),
+                                         Biddy_Managed_GetVariableEdge(MNG,next[2*(i/3)])));
+      }
+      T[i] = Biddy_Managed_And(MNG,T[i],frame);
+      rel[i] = Biddy_Managed_CreateRelation(MNG,&T[i],1,cur,next,2*n,0);
+    }
+    r = Biddy_Managed_Reachable(MNG,rel,3*n,I,NULL,&steps);
+    for (i=0; i<3*n; i++) {
+      Biddy_Managed_DeleteRelation(MNG,rel[i]);
+    }
+    free(rel);
+  }
+
+  printf("%s: %u philosophers, %.0f states, %u nodes",
+         saturation?"saturation":"breadth-first",n,
+         Biddy_Managed_CountMinterms(MNG,r,2*n),Biddy_Managed_CountNodes(MNG,r));
+  if (!saturation) printf(", %u steps",steps);
+  printf(", peak %u nodes, %.2fs\n",
+         Biddy_Managed_NodeTableMax(MNG),(double)(clock() - start) / CLOCKS_PER_SEC);
+
+  Biddy_ExitMNG(&MNG);
+
+  free(cur);
+  free(next);
+  free(T);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int n;
+
+  n = PHILOSOPHERS;
+  if (argc > 1) sscanf(argv[1],"%u",&n);
+  if (n < 2) n = 2;
+
+  if ((argc < 3) || (argv[2][0] != 'b')) reachable(n,TRUE);
+  if ((argc < 3) || (argv[2][0] != 's')) reachable(n,FALSE);
+
+  return 0;
+}
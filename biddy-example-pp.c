@@ -219,6 +219,10 @@
 /* choose VARIANTA (from the older reference), VARIANTB (the most efficient, used for our paper), or VARIANTC (mixed) */
 #define VARIANTB
 
+/* NUMBER OF CUBES AND MAX NUMBER OF LITERALS IN A CUBE - used for RESTRICTCUBE, only */
+#define RCCUBES 1000
+#define RCLITERALS 50
+
 /* define LIMITSINGLE if you want to limit calculation to a single process, used for analyze */
 /* define LIMITSINGLE and LIMITDOUBLE if you want to limit calculation to two processes, used for analyze */
 /* example: -DLIMITSINGLE=3 -DLIMITDOUBLE=6 */
@@ -314,6 +318,8 @@ Biddy_Boolean FEASIBLEONLY = FALSE;
 Biddy_Boolean MAXFACTORYONLY = FALSE;
 Biddy_Boolean FULLSTATESPACE = FALSE;
 Biddy_Boolean SIFTING = FALSE;
+Biddy_Boolean COPYFORMULAE = FALSE;
+Biddy_Boolean RESTRICTCUBE = FALSE;
 unsigned int MAKESPANLIMIT = 0;
 unsigned int TIMEBOUND = 0;
 
@@ -2389,6 +2395,101 @@ check(Biddy_Edge X)
   }
 }
 
+/* ************************************************************************** */
+/* MICROBENCHMARK FOR COFACTORS BY CUBES */
+/* ************************************************************************** */
+
+/* cofactors of X are calculated with Biddy_RestrictCube and with repeated */
+/* Biddy_Restrict, literals are taken from the support of X and their values */
+/* are chosen such that the cofactor is not empty */
+/* cofactors used to choose the values are calculated in the reverse order */
+/* and they are removed by GC before the measurement starts */
+void
+benchmarkRestrictCube(Biddy_Edge X)
+{
+  Biddy_Variable *dep,*lit;
+  Biddy_Boolean *value;
+  Biddy_Edge *cube,*r,f;
+  unsigned int i,j,k,n,*num,errors;
+  clock_t start;
+  double t1,t2;
+
+  Biddy_KeepFormulaUntilPurge(X);
+
+  dep = (Biddy_Variable *) malloc(Biddy_VariableTableNum() * sizeof(Biddy_Variable));
+  n = 0;
+  for (i = 1; i < Biddy_VariableTableNum(); i++) {
+    if (Biddy_Restrict(X,i,FALSE) != Biddy_Restrict(X,i,TRUE)) dep[n++] = i;
+  }
+
+  lit = (Biddy_Variable *) malloc(RCCUBES * RCLITERALS * sizeof(Biddy_Variable));
+  value = (Biddy_Boolean *) malloc(RCCUBES * RCLITERALS * sizeof(Biddy_Boolean));
+  num = (unsigned int *) malloc(RCCUBES * sizeof(unsigned int));
+  cube = (Biddy_Edge *) malloc(RCCUBES * sizeof(Biddy_Edge));
+  r = (Biddy_Edge *) malloc(RCCUBES * sizeof(Biddy_Edge));
+
+  srand(1);
+  for (i = 0; i < RCCUBES; i++) {
+    /* choose variables in the order of the variable table */
+    num[i] = 0;
+    for (j = 0; (j < n) && (num[i] < RCLITERALS); j++) {
+      if ((unsigned int) (rand() % n) < 2 * RCLITERALS) lit[i*RCLITERALS+num[i]++] = dep[j];
+    }
+    f = X;
+    cube[i] = Biddy_GetConstantOne();
+    for (k = num[i]; k > 0; k--) {
+      value[i*RCLITERALS+k-1] = (rand() % 2);
+      if (Biddy_Restrict(f,lit[i*RCLITERALS+k-1],value[i*RCLITERALS+k-1]) == Biddy_GetConstantZero()) {
+        value[i*RCLITERALS+k-1] = !value[i*RCLITERALS+k-1];
+      }
+      f = Biddy_Restrict(f,lit[i*RCLITERALS+k-1],value[i*RCLITERALS+k-1]);
+      /* variable edges are not created for ZBDDs, thus VarSubset is used */
+      cube[i] = Biddy_VarSubset(cube[i],lit[i*RCLITERALS+k-1],value[i*RCLITERALS+k-1]);
+    }
+    Biddy_KeepFormulaUntilPurge(cube[i]);
+  }
+  Biddy_Clean();
+  Biddy_ForceGC();
+
+  start = clock();
+  for (i = 0; i < RCCUBES; i++) {
+    f = X;
+    for (k = 0; k < num[i]; k++) {
+      f = Biddy_Restrict(f,lit[i*RCLITERALS+k],value[i*RCLITERALS+k]);
+    }
+    r[i] = f;
+  }
+  t1 = (clock()-start)/(1.0*CLOCKS_PER_SEC);
+
+  for (i = 0; i < RCCUBES; i++) {
+    Biddy_KeepFormula(r[i]); /* r[i] is preserved for the next cleaning */
+  }
+  Biddy_Clean();
+  Biddy_ForceGC(); /* nodes from r[i] are not removed */
+
+  start = clock();
+  for (i = 0; i < RCCUBES; i++) {
+    f = Biddy_RestrictCube(X,cube[i]);
+  }
+  t2 = (clock()-start)/(1.0*CLOCKS_PER_SEC);
+
+  errors = 0;
+  for (i = 0; i < RCCUBES; i++) {
+    if (Biddy_RestrictCube(X,cube[i]) != r[i]) errors++;
+  }
+
+  printf("\nRESTRICTCUBE: %u CUBES WITH UP TO %u LITERALS FROM %u VARIABLES\n",RCCUBES,RCLITERALS,n);
+  printf("REPEATED Restrict: %.2fs, RestrictCube: %.2fs\n",t1,t2);
+  if (errors) printf("ERROR: %u DIFFERENT RESULTS\n",errors);
+
+  free(dep);
+  free(lit);
+  free(value);
+  free(num);
+  free(cube);
+  free(r);
+}
+
 /* ************************************************************************** */
 /* NEEDED FOR GANTT CHART  */
 /* ************************************************************************** */
@@ -4551,6 +4652,8 @@ int main(int argc, char **argv) {
       printf("[ -LIMIT        | -L ]\n");
       printf("[ -LIMIT+       | -L+ ] makespan_interval\n");
       printf("[ -SIFTING      | -S ]\n");
+      printf("[ -COPY         | -C ]\n");
+      printf("[ -RESTRICTCUBE | -R ]\n");
       printf("\n");
       printf("You can adjust the amount of generated results with the following parameters:\n");
       printf("[ -thoroughly   | -t ]\n");
@@ -4681,6 +4784,14 @@ int main(int argc, char **argv) {
       SIFTING = TRUE;
     }
 
+    if (!strcmp(argv[i],"-C") || !strcmp(argv[i],"-COPY")) {
+      COPYFORMULAE = TRUE;
+    }
+
+    if (!strcmp(argv[i],"-R") || !strcmp(argv[i],"-RESTRICTCUBE")) {
+      RESTRICTCUBE = TRUE;
+    }
+
     i++;
   }
 
@@ -4930,6 +5041,15 @@ int main(int argc, char **argv) {
   PRINTCOMBINATIONS(X);
 #endif
 
+  if (RESTRICTCUBE) {
+    benchmarkRestrictCube(X);
+    printf("\n");
+    if (VERBOSE) Biddy_PrintInfo(NULL);
+    deleteSystem();
+    Biddy_Exit();
+    return 0;
+  }
+
   if (FEASIBLEONLY) {
     /*
     reportOrdering();
@@ -5198,6 +5318,24 @@ int main(int argc, char **argv) {
   }
   /**/
 
+  /* COPY ALL FORMULAE INTO ANOTHER MANAGER */
+  /* the second pass uses the results of the first pass from Copy cache */
+  if (COPYFORMULAE) {
+    Biddy_Manager MNGARCHIVE;
+    Biddy_InitMNG(&MNGARCHIVE,BDDTYPE);
+    for (k=1; k<=2; k++) {
+      elapsedtime = clock();
+      for (i=0; i<Biddy_FormulaTableNum(); i++) {
+        f = Biddy_GetIthFormula(i); /* deleted formulae are copied, too */
+        if (f) Biddy_Copy(MNGARCHIVE,f);
+      }
+      printf("\nCOPY %u FORMULAE (PASS %u): clock() TIME = %.2f\n",
+             (unsigned int) Biddy_FormulaTableNum(),k,(clock()-elapsedtime)/(1.0*CLOCKS_PER_SEC));
+    }
+    printf("%s (ARCHIVE) has %u nodes\n",Biddy_Managed_GetManagerName(MNGARCHIVE),Biddy_Managed_NodeTableNum(MNGARCHIVE));
+    Biddy_ExitMNG(&MNGARCHIVE);
+  }
+
   /* DELETE SYSTEM */
   deleteSystem();
 
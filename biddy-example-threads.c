@@ -0,0 +1,142 @@
+/* $Revision$ */
+/* $Date$ */
+/* This file (biddy-example-threads.c) is a C file */
+/* Author: Robert Meolic (robert@meolic.com) */
+/* This file has been released into the public domain by the author. */
+
+/* This example is compatible with Biddy v2.5 and laters */
+
+/* COMPILE WITH (ADD -lgmp IF USING STATIC BIDDY LIBRARY): */
+/* gcc -DUNIX -O2 -o biddy-example-threads biddy-example-threads.c -I. -L./bin -lbiddy -lpthread */
+
+/* this example is a stress test for independent managers used concurrently */
+/* each thread creates its own manager and builds the same functions, */
+/* the results are cross-checked with the results obtained sequentially */
+/* usage: biddy-example-threads [number of threads] [number of steps] */
+
+#include "biddy.h"
+#include <pthread.h>
+
+#define NUMVARIABLES 16
+#define MAXTHREADS 64
+
+typedef struct {
+  int bddtype;
+  unsigned int steps;
+  double minterms;
+  unsigned int nodes;
+} Task;
+
+/* each thread has its own random generator, rand() is not used */
+static unsigned int
+nextRandom(unsigned int *seed)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return (*seed >> 16) & 0x7fff;
+}
+
+/* the same sequence of operations is performed for each BDD type */
+/* operations are mixed to use all the caches and GC */
+static void
+buildFunction(Task *task)
+{
+  Biddy_Manager MNG;
+  Biddy_Edge r,f,g,h,x[NUMVARIABLES];
+  unsigned int i,seed;
+
+  Biddy_InitMNG(&MNG,task->bddtype);
+
+  /* for ZBDDs, variable edges must be taken after all variables are added */
+  for (i=0; i<NUMVARIABLES; i++) {
+    Biddy_Managed_AddVariable(MNG);
+  }
+  for (i=0; i<NUMVARIABLES; i++) {
+    x[i] = Biddy_Managed_GetVariableEdge(MNG,i+1);
+  }
+
+  seed = 1;
+  r = Biddy_Managed_GetConstantZero(MNG);
+  for (i=0; i<task->steps; i++) {
+    f = x[nextRandom(&seed) % NUMVARIABLES];
+    g = x[nextRandom(&seed) % NUMVARIABLES];
+    h = x[nextRandom(&seed) % NUMVARIABLES];
+    switch (nextRandom(&seed) % 4) {
+      case 0: f = Biddy_Managed_ITE(MNG,f,g,h); break;
+      case 1: f = Biddy_Managed_Xor(MNG,f,Biddy_Managed_Not(MNG,g)); break;
+      case 2: f = Biddy_Managed_Leq(MNG,f,Biddy_Managed_And(MNG,g,h)); break;
+      default: f = Biddy_Managed_Gt(MNG,Biddy_Managed_Or(MNG,f,g),h);
+    }
+    g = x[nextRandom(&seed) % NUMVARIABLES];
+    f = Biddy_Managed_And(MNG,f,g);
+    if (i % 2) {
+      r = Biddy_Managed_Or(MNG,r,f);
+    } else {
+      r = Biddy_Managed_Xor(MNG,r,f);
+    }
+    Biddy_Managed_KeepFormula(MNG,r); /* r is preserved for the next cleaning */
+    Biddy_Managed_Clean(MNG);
+  }
+
+  task->minterms = Biddy_Managed_CountMinterms(MNG,r,NUMVARIABLES);
+  task->nodes = Biddy_Managed_CountNodes(MNG,r);
+
+  Biddy_ExitMNG(&MNG);
+}
+
+static void *
+worker(void *arg)
+{
+  buildFunction((Task *) arg);
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  int bddtype[] = {BIDDYTYPEOBDD,BIDDYTYPEOBDDC,BIDDYTYPEZBDD,BIDDYTYPEZBDDC,BIDDYTYPETZBDD};
+  Task expected[5];
+  Task task[MAXTHREADS];
+  pthread_t thread[MAXTHREADS];
+  unsigned int i,n,steps,errors;
+
+  n = 8;
+  steps = 2000;
+  if (argc > 1) sscanf(argv[1],"%u",&n);
+  if (argc > 2) sscanf(argv[2],"%u",&steps);
+  if (n > MAXTHREADS) n = MAXTHREADS;
+
+  /* sequential run */
+  for (i=0; i<5; i++) {
+    expected[i].bddtype = bddtype[i];
+    expected[i].steps = steps;
+    buildFunction(&expected[i]);
+    printf("%s: %.0f minterms, %u nodes\n",
+           (i==0)?"OBDD":(i==1)?"OBDDC":(i==2)?"ZBDD":(i==3)?"ZBDDC":"TZBDD",
+           expected[i].minterms,expected[i].nodes);
+  }
+
+  /* concurrent run, each thread has its own manager */
+  for (i=0; i<n; i++) {
+    task[i].bddtype = bddtype[i%5];
+    task[i].steps = steps;
+    if (pthread_create(&thread[i],NULL,worker,&task[i])) {
+      printf("ERROR: cannot create thread %u\n",i);
+      return 1;
+    }
+  }
+  for (i=0; i<n; i++) {
+    pthread_join(thread[i],NULL);
+  }
+
+  errors = 0;
+  for (i=0; i<n; i++) {
+    if ((task[i].minterms != expected[i%5].minterms) ||
+        (task[i].nodes != expected[i%5].nodes) ||
+        (task[i].minterms != expected[0].minterms))
+    {
+      printf("ERROR: thread %u: %.0f minterms, %u nodes\n",i,task[i].minterms,task[i].nodes);
+      errors++;
+    }
+  }
+  printf("%u threads, %u steps: %s\n",n,steps,errors?"FAILED":"OK");
+
+  return errors ? 1 : 0;
+}
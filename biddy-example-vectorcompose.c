@@ -0,0 +1,158 @@
+/* $Revision$ */
+/* $Date$ */
+/* This file (biddy-example-vectorcompose.c) is a C file */
+/* Author: Robert Meolic (robert@meolic.com) */
+/* This file has been released into the public domain by the author. */
+
+/* This example is compatible with Biddy v2.5 and laters */
+
+/* COMPILE WITH (ADD -lgmp IF USING STATIC BIDDY LIBRARY): */
+/* gcc -DUNIX -O2 -o biddy-example-vectorcompose biddy-example-vectorcompose.c -I. -L./bin -lbiddy */
+
+/* this example reads a sequential circuit from Verilog file and */
+/* calculates next-state functions after the given number of steps */
+/* primary input X is a state variable if there is a primary output */
+/* named X_next, this output is the next-state function of X, */
+/* all other primary inputs are free inputs */
+/* in each step, next-state functions are substituted for all state */
+/* variables at once, this is done with Biddy_VectorCompose and with */
+/* chained Biddy_Compose, where state variables are first renamed to */
+/* temporary variables (they are added below the state variables) */
+/* usage: biddy-example-vectorcompose [verilog file] [number of steps] */
+
+#include "biddy.h"
+#include <string.h>
+#include <time.h>
+
+#define STEPS 8
+
+/* state variables and their next-state functions are given in v and g */
+static unsigned int
+readCircuit(Biddy_Manager MNG, const char *filename, Biddy_Variable **v, Biddy_Edge **g)
+{
+  Biddy_Variable i,num;
+  Biddy_String name;
+  unsigned int n,idx;
+  char next[256];
+
+  Biddy_Managed_ReadVerilogFile(MNG,filename,NULL);
+
+  num = Biddy_Managed_SystemStat(MNG,BIDDYSTATVARIABLETABLENUM);
+  *v = (Biddy_Variable *) malloc(num * sizeof(Biddy_Variable));
+  *g = (Biddy_Edge *) malloc(num * sizeof(Biddy_Edge));
+
+  n = 0;
+  for (i = 1; i < num; i++) {
+    name = Biddy_Managed_GetVariableName(MNG,i);
+    if (strlen(name) + 6 > sizeof(next)) continue;
+    sprintf(next,"%s_next",name);
+    if (Biddy_Managed_FindFormula(MNG,next,&idx,&(*g)[n])) {
+      (*v)[n++] = i;
+    }
+  }
+
+  return n;
+}
+
+static unsigned int
+nextState(const char *filename, unsigned int steps, Biddy_Boolean vector,
+          unsigned int *nodes, unsigned int *peak)
+{
+  Biddy_Manager MNG;
+  Biddy_Variable *v,*y;
+  Biddy_Edge *g,*f,*ye,t;
+  unsigned int i,j,k,n,size;
+
+  Biddy_InitMNG(&MNG,BIDDYTYPEOBDDC);
+  n = readCircuit(MNG,filename,&v,&g);
+
+  y = (Biddy_Variable *) malloc((n+1) * sizeof(Biddy_Variable));
+  f = (Biddy_Edge *) malloc((n+1) * sizeof(Biddy_Edge));
+  ye = (Biddy_Edge *) malloc((n+1) * sizeof(Biddy_Edge));
+
+  if (!vector) {
+    for (i = 0; i < n; i++) {
+      ye[i] = Biddy_Managed_AddVariableBelow(MNG,v[i]);
+      y[i] = Biddy_Managed_GetTopVariable(MNG,ye[i]);
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    f[i] = g[i];
+  }
+  *peak = 0;
+  for (j = 1; j < steps; j++) {
+    for (i = 0; i < n; i++) {
+      if (vector) {
+        f[i] = Biddy_Managed_VectorCompose(MNG,f[i],v,g,n);
+      } else {
+        t = f[i];
+        for (k = 0; k < n; k++) {
+          t = Biddy_Managed_Compose(MNG,t,ye[k],v[k]);
+        }
+        for (k = 0; k < n; k++) {
+          t = Biddy_Managed_Compose(MNG,t,g[k],y[k]);
+          if ((size = Biddy_Managed_CountNodes(MNG,t)) > *peak) *peak = size;
+        }
+        f[i] = t;
+      }
+    }
+    for (i = 0; i < n; i++) {
+      Biddy_Managed_KeepFormula(MNG,f[i]); /* f[i] is preserved for the next cleaning */
+      Biddy_Managed_KeepFormula(MNG,g[i]); /* formulae from Verilog file are not persistent */
+    }
+    Biddy_Managed_Clean(MNG);
+  }
+
+  *nodes = 0;
+  for (i = 0; i < n; i++) {
+    *nodes += Biddy_Managed_CountNodes(MNG,f[i]);
+    if (Biddy_Managed_CountNodes(MNG,f[i]) > *peak) *peak = Biddy_Managed_CountNodes(MNG,f[i]);
+  }
+
+  Biddy_ExitMNG(&MNG);
+
+  free(v);
+  free(y);
+  free(g);
+  free(f);
+  free(ye);
+
+  return n;
+}
+
+int main(int argc, char *argv[]) {
+  const char *filename;
+  unsigned int n,steps,nodes1,nodes2,peak1,peak2;
+  clock_t start;
+  double t1,t2;
+
+  filename = "./benchmarks/acc16.v";
+  steps = STEPS;
+  if (argc > 1) filename = argv[1];
+  if (argc > 2) sscanf(argv[2],"%u",&steps);
+  if (steps < 1) steps = 1;
+
+  start = clock();
+  n = nextState(filename,steps,TRUE,&nodes1,&peak1);
+  t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  if (!n) {
+    printf("%s: there are no state variables\n",filename);
+    return 1;
+  }
+
+  start = clock();
+  nextState(filename,steps,FALSE,&nodes2,&peak2);
+  t2 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  printf("%s: %u state variables, %u steps\n",filename,n,steps);
+  printf("VectorCompose: %u nodes, largest function %u nodes, %.2fs\n",nodes1,peak1,t1);
+  printf("Compose: %u nodes, largest intermediate function %u nodes, %.2fs\n",nodes2,peak2,t2);
+  if (nodes1 != nodes2) {
+    printf("ERROR: results are not equal\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -71,6 +71,38 @@ See also: biddy.h
 /* define ESTPROJECT to use optimal settings for EST */
 #define NOESTPROJECT
 
+/* define ARENA for variant where all nodes are allocated in one contiguous arena */
+/* and the links in Node table chains are 32-bit indices into this arena */
+/* on 64-bit systems, BiddyNode is then 40B instead of 48B */
+#define NOARENA
+
+/* define COMPACTCACHE for variant where entries in OP, EA, and RC cache */
+/* store 32-bit references to nodes in the arena instead of edges, */
+/* on 64-bit systems, an entry is then 16B instead of 32B, it requires ARENA */
+#define NOCOMPACTCACHE
+
+/* define PARALLELGC for variant where garbage collection may use multiple */
+/* threads (see Biddy_SetGCThreads), it is supported on UNIX and MACOSX, only */
+/* if PARALLELGC is defined then you have to use -lpthread for linking */
+#define NOPARALLELGC
+
+/* define PARALLELAPPLY for variant where And, Or, Xor, ITE, and ExistAndAbstract */
+/* may use multiple threads (see Biddy_SetApplyThreads), it is supported on */
+/* UNIX and MACOSX, only, if PARALLELAPPLY is defined then you have to use */
+/* -lpthread for linking */
+#define NOPARALLELAPPLY
+
+/* define LAZYCACHE for variant where GC does not check cache tables, */
+/* each entry in OP, EA, RC, and Replace cache stores the epoch in which it */
+/* has been added, GC starts a new epoch and older entries are ignored */
+#define NOLAZYCACHE
+
+/* define ITERATIVEAPPLY for variant where And, Or, Xor, ITE, Not, and */
+/* ExistAndAbstract on OBDDs and OBDDCs use an explicit stack instead of */
+/* recursion, this is only the default and it can be changed for each */
+/* manager at runtime (see Biddy_SetIterativeApply) */
+#define NOITERATIVEAPPLY
+
 /* EST project */
 #ifdef ESTPROJECT
 #ifndef COMPACT
@@ -91,7 +123,9 @@ See also: biddy.h
 #endif
 
 /* extended stats (YES or NO) */
-/* if YES then you have to use -lm for linking */
+/* extended stats are always compiled in and they are enabled at runtime */
+/* (see Biddy_SetExtendedStats), if YES then they are enabled by default */
+/* and you have to use -lm for linking */
 #define BIDDYEXTENDEDSTATS_NO
 
 /* event log (YES or NO) */
@@ -116,6 +150,15 @@ See also: biddy.h
 /* TO DO: check if sifting and BDD copying is correctly implemented */
 #define REFRESH_VARIANT_A
 
+/* node table engine (CHAINING, OPENADDRESSING, or SUBTABLES) */
+/* CHAINING: a hash table with ordered doubly-linked chains */
+/* OPENADDRESSING: linear probing, a short fingerprint of each node is stored */
+/*   in the unused bits of the pointer, fields prev and next are not needed */
+/*   and BiddyNode is 32B instead of 48B on 64-bit systems */
+/* SUBTABLES: chaining, but each variable has its own independently sized */
+/*   hash table (as in CUDD), variable swapping touches only two subtables */
+#define NODETABLE_CHAINING
+
 /* use twodimensional variable ordering matrix (YES or NO) */
 /* twodimensional variable ordering matrix was the only option until 2.0.2 */
 /* in 2.1.1 and later, it is optional and for experimental usage, only */
@@ -130,6 +173,40 @@ See also: biddy.h
 #include <string.h>
 #include <ctype.h>
 
+/* ARENA is useful on 64-bit architectures, only */
+#if defined(ARENA) && (UINTPTR_MAX != 0xffffffffffffffff)
+#undef ARENA
+#endif
+
+/* COMPACTCACHE is useful with ARENA, only */
+#if defined(COMPACTCACHE) && !defined(ARENA)
+#undef COMPACTCACHE
+#endif
+
+/* NODETABLE_OPENADDRESSING is supported on 64-bit architectures, only */
+#if defined(NODETABLE_OPENADDRESSING) && (UINTPTR_MAX != 0xffffffffffffffff)
+#undef NODETABLE_OPENADDRESSING
+#endif
+
+/* NODETABLE_OPENADDRESSING and NODETABLE_SUBTABLES cannot be combined */
+#if defined(NODETABLE_OPENADDRESSING) && defined(NODETABLE_SUBTABLES)
+#undef NODETABLE_SUBTABLES
+#endif
+
+/* PARALLELGC uses POSIX threads */
+#if defined(PARALLELGC) && !defined(UNIX) && !defined(MACOSX)
+#undef PARALLELGC
+#endif
+
+/* PARALLELAPPLY uses POSIX threads */
+#if defined(PARALLELAPPLY) && !defined(UNIX) && !defined(MACOSX)
+#undef PARALLELAPPLY
+#endif
+
+#ifdef PARALLELAPPLY
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* Constant declarations                                                      */
 /*----------------------------------------------------------------------------*/
@@ -215,6 +292,9 @@ See also: biddy.h
 #define BIDDYEACACHESIZE SMALL_SIZE
 #define BIDDYRCCACHESIZE SMALL_SIZE
 #define BIDDYREPLACECACHESIZE SMALL_SIZE
+#define BIDDYCOUNTCACHESIZE TINY_SIZE
+#define BIDDYCOPYCACHESIZE SMALL_SIZE
+#define BIDDYCACHELIMITSIZE SMALL_SIZE
 #elif defined(COMPREHENSIVE)
 /* THESE ARE SIZES FOR LARGER PROBLEMS, E.G. DICTIONARY EXAMPLE, PP EXAMPLE */
 #define BIDDYVARIABLETABLESIZE BIDDYVARMAX
@@ -226,6 +306,9 @@ See also: biddy.h
 #define BIDDYEACACHESIZE LARGE_SIZE
 #define BIDDYRCCACHESIZE LARGE_SIZE
 #define BIDDYREPLACECACHESIZE SMALL_SIZE
+#define BIDDYCOUNTCACHESIZE TINY_SIZE
+#define BIDDYCOPYCACHESIZE SMALL_SIZE
+#define BIDDYCACHELIMITSIZE XXXLARGE_SIZE
 #elif defined(ESTPROJECT)
 /* THESE ARE SIZES IN EST PROJECT */
 #define BIDDYVARIABLETABLESIZE BIDDYVARMAX
@@ -237,6 +320,9 @@ See also: biddy.h
 #define BIDDYEACACHESIZE MEDIUM_SIZE
 #define BIDDYRCCACHESIZE MEDIUM_SIZE
 #define BIDDYREPLACECACHESIZE SMALL_SIZE
+#define BIDDYCOUNTCACHESIZE TINY_SIZE
+#define BIDDYCOPYCACHESIZE SMALL_SIZE
+#define BIDDYCACHELIMITSIZE XXLARGE_SIZE
 #else
 /* THESE ARE DEFAULT SIZES */
 #define BIDDYVARIABLETABLESIZE BIDDYVARMAX
@@ -248,7 +334,25 @@ See also: biddy.h
 #define BIDDYEACACHESIZE SMALL_SIZE
 #define BIDDYRCCACHESIZE SMALL_SIZE
 #define BIDDYREPLACECACHESIZE SMALL_SIZE
+#define BIDDYCOUNTCACHESIZE TINY_SIZE
+#define BIDDYCOPYCACHESIZE SMALL_SIZE
+#define BIDDYCACHELIMITSIZE XXLARGE_SIZE
+#endif
+
+/* ARENA: the maximal number of nodes, it must be smaller than 2^32 */
+/* on UNIX, only address space is reserved, memory pages are used on demand */
+/* 268435456 nodes is 10.0 GB of address space (BiddyNode is 40B) */
+/* for COMPACTCACHE, 10*BIDDYARENASIZE must be smaller than 2^32 */
+#ifndef BIDDYARENASIZE
+#define BIDDYARENASIZE 268435456
+#endif
+
+/* NODETABLE_SUBTABLES: the initial size of each subtable, */
+/* subtable is doubled when it has more than BIDDYNODESUBTABLELOAD nodes per chain */
+#ifndef BIDDYNODESUBTABLEINITSIZE
+#define BIDDYNODESUBTABLEINITSIZE 255
 #endif
+#define BIDDYNODESUBTABLELOAD 2
 
 /* THE FOLLOWING TRESHOLDS ARE float */
 /* all values are experimentally determined */
@@ -262,6 +366,67 @@ See also: biddy.h
 #define BIDDYNODETABLERESIZERATIOF 0.89
 #define BIDDYNODETABLERESIZERATIOX 0.91
 
+/* cache tables are resized during GC, a cache table is doubled if more than */
+/* the given part of look-ups since the previous check were hits and it is */
+/* smaller than the peak number of nodes, it is halved if there were only a */
+/* few look-ups and it is much larger than the peak number of nodes, */
+/* a cache table is never smaller than its initial size */
+#define BIDDYCACHERESIZERATIO 0.10
+
+/* generational GC: the next GC is a major one if more than the given */
+/* part of nodes created since the previous GC survived a minor GC */
+/* minor GC is used only if there are less new nodes than older nodes */
+#define BIDDYNODETABLEGCSURVIVAL 0.5
+
+/* PARALLELGC: the maximal number of threads used for garbage collection */
+/* and the minimal number of visited nodes or cache entries which justifies */
+/* starting the threads, smaller tasks are performed by the calling thread */
+#define BIDDYGCTHREADSMAX 64
+#define BIDDYGCPARALLELMIN 65536
+
+/* PARALLELAPPLY: the maximal number of threads used for operations, */
+/* a recursive call is given to another thread only if there are less than */
+/* the given number of waiting tasks per thread, the number of locks which */
+/* protect cache tables (must be a power of 2), and the stack size of threads */
+#define BIDDYAPPLYTHREADSMAX 64
+#define BIDDYAPPLYTASKSPERTHREAD 2
+#define BIDDYAPPLYCACHELOCKS 1024
+#define BIDDYAPPLYSTACKSIZE (64*1024*1024)
+
+/* OP, EA, and RC cache: the default and the maximal number of entries in */
+/* a set (see Biddy_SetCacheWays), it must be a power of 2, a set is aligned */
+/* to BIDDYCACHELINESIZE bytes */
+#define BIDDYCACHEWAYS 1
+#define BIDDYCACHEWAYSMAX 4
+#define BIDDYCACHELINESIZE 64
+
+/* extended stats: the default for each new manager */
+#ifdef BIDDYEXTENDEDSTATS_YES
+#define BIDDYEXTENDEDSTATS TRUE
+#else
+#define BIDDYEXTENDEDSTATS FALSE
+#endif
+
+/* iterative apply: the default for each new manager */
+/* and the initial number of frames in its explicit stack */
+#ifdef ITERATIVEAPPLY
+#define BIDDYITERATIVEAPPLY TRUE
+#else
+#define BIDDYITERATIVEAPPLY FALSE
+#endif
+#define BIDDYAPPLYFRAMES 1024
+
+/* breadth-first apply: the initial number of requests (see Biddy_AndBF) */
+#define BIDDYBFREQUESTS 4096
+
+/* saturation: the size of cache used in one call (see Biddy_Saturate) */
+/* this must be 2^N-1 */
+#define BIDDYSATCACHESIZE 262143
+
+/* ZBDD And and Gt: the default strategy used when top variables differ */
+/* (see Biddy_SetZBDDSkip) */
+#define BIDDYZBDDSKIP BIDDYZBDDSKIPJUMP
+
 /* THE FOLLOWING TRESHOLDS ARE float */
 /* all values are experimentally determined */
 /* st=0.95, cst=1.01, sf=3.14 */ /* used in v1.7.1 - v2.1.1 */
@@ -384,6 +549,37 @@ See also: biddy.h
 
 #define BiddyV(fun) (BiddyN(fun)->v)
 
+/* BiddyNodeTableEntry returns the first node in the chain with the given hash value */
+/* BiddyNextInChain returns the next node in the chain of Node table */
+/* for variant ARENA, BiddyArenaIndex and BiddyArenaNode convert between nodes and indices */
+/* for NODETABLE_OPENADDRESSING, each chain has at most one node, */
+/* i.e. the node stored at the given position (without its fingerprint) */
+/* BiddyChainTable and BiddyChainSize return the hash table used for nodes with */
+/* the given variable, for NODETABLE_SUBTABLES this is the variable's subtable */
+/* manager MNG is assumed */
+#ifdef ARENA
+#define BiddyArenaIndex(node) ((unsigned int) ((BiddyNode *)(node) - biddyNodeTable.arena))
+#define BiddyArenaNode(i) (&biddyNodeTable.arena[i])
+#endif
+#if defined(NODETABLE_OPENADDRESSING)
+#define BiddyNodeTableEntry(i) ((BiddyNode *)((uintptr_t) biddyNodeTable.table[i] & 0x0000ffffffffffff))
+#define BiddyNodeTableFingerprint(i) ((unsigned int)((uintptr_t) biddyNodeTable.table[i] >> 48))
+#define BiddyNextInChain(node) ((BiddyNode *) NULL)
+#elif defined(ARENA)
+#define BiddyNodeTableEntry(i) (biddyNodeTable.table[i])
+#define BiddyNextInChain(node) ((node)->next ? BiddyArenaNode((node)->next) : NULL)
+#else
+#define BiddyNodeTableEntry(i) (biddyNodeTable.table[i])
+#define BiddyNextInChain(node) ((node)->next)
+#endif
+#ifdef NODETABLE_SUBTABLES
+#define BiddyChainTable(v) (biddyVariableTable.table[v].subtable)
+#define BiddyChainSize(v) (biddyVariableTable.table[v].subtablesize)
+#else
+#define BiddyChainTable(v) (biddyNodeTable.table)
+#define BiddyChainSize(v) (biddyNodeTable.size)
+#endif
+
 /* orderingtable[X,Y]==1 iff variabe X is smaller than variable Y */
 /* in the BDD, smaller variables are above greater ones */
 /* GET_ORDER check if variabe X is smaller (topmore) than variable Y */
@@ -510,6 +706,26 @@ See also: biddy.h
 #define biddySelect1 (*((unsigned short int*)(MNG1[16])))
 #define biddySelect2 (*((unsigned short int*)(MNG2[16])))
 
+/* Local Info table in manager MNG, since Biddy v2.5 */
+/* this is typecasted to (BiddyLocalInfo**) and dereferenced */
+#define biddyLocalInfo (*((BiddyLocalInfo**)(MNG[17])))
+
+/* Threads used by operations in manager MNG, since Biddy v2.5 */
+/* this is typecasted to (BiddyApplyPool*), it is NULL if operations are not parallel */
+#ifdef PARALLELAPPLY
+#define biddyApplyPool ((BiddyApplyPool*)(MNG[18]))
+#endif
+
+/* Count Cache in manager MNG, since Biddy v2.5 */
+/* this is typecasted to (BiddyCountCacheTable*) and dereferenced */
+#define biddyCountCache (*((BiddyCountCacheTable*)(MNG[19])))
+
+/* Copy Cache in manager MNG, since Biddy v2.5 */
+/* this is typecasted to (BiddyCopyCacheTable*) and dereferenced */
+#define biddyCopyCache (*((BiddyCopyCacheTable*)(MNG[20])))
+#define biddyCopyCache1 (*((BiddyCopyCacheTable*)(MNG1[20])))
+#define biddyCopyCache2 (*((BiddyCopyCacheTable*)(MNG2[20])))
+
 /* BiddyProlongOne prolonges top node of the given function, since Biddy v1.6 */
 #define BiddyProlongOne(f,c) if((!(c))||(BiddyN(f)->expiry&&(BiddyN(f)->expiry<(c))))BiddyN(f)->expiry=(c)
 
@@ -549,7 +765,48 @@ See also: biddy.h
 /*----------------------------------------------------------------------------*/
 
 /* NODE TABLE (UNIQUE TABLE) = a fixed-size hash table with chaining */
-#ifdef PLAIN
+/* for NODETABLE_OPENADDRESSING, it is a hash table with linear probing */
+/* for NODETABLE_SUBTABLES, chains are in the subtables of variables, */
+/* table[0] is the terminal node and size is the total size of all subtables */
+#if defined(NODETABLE_OPENADDRESSING) && defined(PLAIN)
+/* THE SIZE OF BiddyNode on 64-bit systems is 32 Bytes */
+typedef struct BiddyNode {
+  void *list; /* list of nodes (various purposes) */
+  unsigned short int expiry; /* expiry value */
+  unsigned short int select; /* used to select node */
+  Biddy_Variable v; /* index in variable table */
+  Biddy_Edge f, t; /* f = left = else, t = right = then, !!!MUST BE THIRD AND FOURTH POINTER */
+} BiddyNode;
+#elif defined(NODETABLE_OPENADDRESSING)
+/* THE SIZE OF BiddyNode on 64-bit systems is 32 Bytes */
+typedef struct BiddyNode {
+  void *list; /* list of nodes (various purposes) */
+  unsigned int expiry; /* expiry value */
+  unsigned short int select; /* used to select node */
+  Biddy_Variable v; /* index in variable table */
+  Biddy_Edge f, t; /* f = left = else, t = right = then, !!!MUST BE THIRD AND FOURTH POINTER */
+} BiddyNode;
+#elif defined(ARENA) && defined(PLAIN)
+/* THE SIZE OF BiddyNode on 64-bit systems is 40 Bytes */
+typedef struct BiddyNode {
+  unsigned int prev, next; /* indices in the arena, 0 = no node, !!!MUST BE FIRST AND SECOND */
+  void *list; /* list of nodes (various purposes) */
+  Biddy_Edge f, t; /* f = left = else, t = right = then, !!!MUST BE THIRD AND FOURTH POINTER */
+  unsigned short int expiry; /* expiry value */
+  unsigned short int select; /* used to select node */
+  Biddy_Variable v; /* index in variable table */
+} BiddyNode;
+#elif defined(ARENA)
+/* THE SIZE OF BiddyNode on 64-bit systems is 40 Bytes */
+typedef struct BiddyNode {
+  unsigned int prev, next; /* indices in the arena, 0 = no node, !!!MUST BE FIRST AND SECOND */
+  void *list; /* list of nodes (various purposes) */
+  Biddy_Edge f, t; /* f = left = else, t = right = then, !!!MUST BE THIRD AND FOURTH POINTER */
+  unsigned int expiry; /* expiry value */
+  unsigned short int select; /* used to select node */
+  Biddy_Variable v; /* index in variable table */
+} BiddyNode;
+#elif defined(PLAIN)
 /* THE SIZE OF BiddyNode on 64-bit systems is 48 Bytes */
 typedef struct BiddyNode {
   struct BiddyNode *prev, *next; /* !!!MUST BE FIRST AND SECOND */
@@ -571,9 +828,105 @@ typedef struct BiddyNode {
 } BiddyNode;
 #endif
 
+/* FRAME IN THE EXPLICIT STACK USED BY ITERATIVE APPLY */
+/* (see Biddy_SetIterativeApply) */
+typedef struct {
+  Biddy_Edge f,g,h; /* arguments, for ExistAndAbstract h is the cube */
+  Biddy_Edge Fv,Gv,Hv; /* arguments for the then successor */
+  Biddy_Edge FF,GG,HH; /* the key used for cache lookup */
+  Biddy_Edge E; /* the result for the else successor */
+  unsigned int cindex; /* cache index returned by the lookup */
+  Biddy_Variable v; /* top variable of the result */
+  unsigned char op; /* operation */
+  unsigned char state; /* which successor is being calculated */
+  Biddy_Boolean NN; /* TRUE iff the complemented result is cached */
+  Biddy_Boolean inv; /* TRUE iff the result must be complemented */
+} BiddyApplyFrame;
+
+/* REQUEST USED BY BREADTH-FIRST APPLY (see Biddy_AndBF) */
+/* a successor is given by an edge or by the index of another request */
+typedef struct {
+  Biddy_Edge f,g; /* arguments */
+  Biddy_Edge E,T; /* results for the successors, valid if e or t is 0 */
+  Biddy_Edge r; /* the result, valid after the request has been reduced */
+  unsigned int e,t; /* requests for the successors, 0 if not needed */
+  unsigned int next; /* the next request with the same top variable */
+  unsigned int hnext; /* the next request in the same hash chain */
+  unsigned int cindex; /* cache index returned by the lookup */
+} BiddyBFRequest;
+
+/* ALL REQUESTS OF ONE CALL OF BREADTH-FIRST APPLY */
+/* request 0 is not used, index 0 means no request */
+typedef struct {
+  BiddyBFRequest *table;
+  unsigned int size; /* the number of allocated requests */
+  unsigned int num; /* the number of requests, inc. request 0 */
+  unsigned int *hash; /* the first request in each hash chain */
+  unsigned int hashsize; /* the size of hash table - 1 */
+  unsigned int *first; /* the first request for each variable */
+  unsigned int *last; /* the last request for each variable */
+} BiddyBFQueue;
+
+/* SCHEDULE FOR IMAGE COMPUTATION WITH A PARTITIONED TRANSITION RELATION */
+/* qvar[qstart[i]] ... qvar[qstart[i+1]-1] are quantified in the i-th step */
+typedef struct {
+  unsigned int *order; /* the order of clusters */
+  unsigned int *qstart; /* the first quantified variable for each step */
+  Biddy_Variable *qvar; /* quantified variables */
+} BiddyRelationSchedule;
+
+/* PARTITIONED TRANSITION RELATION */
+typedef struct {
+  Biddy_Edge *cluster; /* clusters, their conjunction is the relation */
+  Biddy_String name; /* prefix of formulae used to preserve clusters */
+  unsigned int n; /* the number of clusters */
+  Biddy_Variable *cur; /* current state variables */
+  Biddy_Variable *next; /* next state variables */
+  unsigned int m; /* the number of state variables */
+  BiddyRelationSchedule image; /* schedule for forward image */
+  BiddyRelationSchedule preimage; /* schedule for backward image */
+} BiddyRelation;
+
+/* EVENT USED BY SATURATION (see Biddy_Saturate) */
+typedef struct {
+  Biddy_Edge rel; /* the relation of the event */
+  Biddy_Edge cube; /* variables quantified in the image */
+  unsigned int *write; /* state variables changed by the event */
+  unsigned int wnum; /* the number of state variables changed by the event */
+  Biddy_String keyword; /* keyword used for Replace */
+  unsigned int next; /* the next event with the same top level */
+} BiddySatEvent;
+
+typedef struct {
+  Biddy_Edge f; /* the argument, biddyNull = not valid record! */
+  unsigned int k; /* the level */
+  Biddy_Edge r; /* the result */
+} BiddySatCache;
+
+/* ALL EVENTS AND THE CACHE OF ONE CALL OF SATURATION */
+/* event 0 is not used, index 0 means no event */
+typedef struct {
+  BiddySatEvent *event;
+  unsigned int *first; /* the first event for each level */
+  Biddy_Variable *cur; /* current state variables */
+  Biddy_Variable *next; /* next state variables */
+  Biddy_Variable *level; /* current state variable for each level */
+  unsigned int m; /* the number of levels */
+  unsigned int last; /* no events below this level */
+  BiddySatCache *cache;
+} BiddySaturation;
+
 typedef struct {
   BiddyNode **table;
   BiddyNode **blocktable; /* table of allocated memory blocks */
+  unsigned int *blocksizetable; /* number of nodes in each memory block */
+  BiddyNode *unused; /* the first node in the last memory block which has never been used */
+  unsigned int unusednum; /* the number of nodes in the last memory block which have never been used */
+  Biddy_AllocFunction blockalloc; /* allocator for memory blocks except the first one */
+  Biddy_FreeFunction blockfree; /* deallocator for memory blocks except the first one */
+#ifdef ARENA
+  BiddyNode *arena; /* all memory blocks are consecutive parts of the arena */
+#endif
   unsigned int initsize; /* initial size of Node table */
   unsigned int size; /* current size of Node table */
   unsigned int limitsize; /* limit for the size of Node table */
@@ -585,14 +938,30 @@ typedef struct {
   unsigned int max; /* maximal (peek) number of nodes in node table */
   unsigned int num; /* number of nodes currently in node table */
   unsigned int garbage; /* number of garbage collections */
+  unsigned int gcminor; /* number of minor garbage collections (generational GC) */
+  Biddy_Boolean generational; /* if TRUE, GC may consider only nodes created since the previous GC */
+  Biddy_Boolean nurseryok; /* TRUE iff lastOldNode is valid for all variables */
+  Biddy_Boolean nurseryfull; /* TRUE iff the next GC should be a major one */
+  int zbddskip; /* strategy for ZBDD And and Gt when top variables differ */
+  Biddy_Boolean iterative; /* if TRUE, OBDD and OBDDC operations use iterative apply */
+  BiddyApplyFrame *applystack; /* explicit stack used by iterative apply */
+  unsigned int applystacksize; /* the number of frames allocated for applystack */
+  unsigned int applystacktop; /* the number of frames in use */
+  unsigned int oldnum; /* number of nodes in node table after the previous GC */
   unsigned int swap; /* number of performed variable swapping */
   unsigned int sifting; /* number of performed dynamic reordering */
   unsigned int nodetableresize; /* number of performed node table resizing */
+  unsigned int compaction; /* number of performed compactions */
   unsigned int funite; /* number of calls of function Biddy_ITE */
   unsigned int funandor; /* number of calls of function Biddy_And and Biddy_Or */
   unsigned int funxor; /* number of calls of function Xor */
   clock_t gctime; /* total time spent for garbage collections */
+  clock_t gcminortime; /* total time spent for minor garbage collections */
+  clock_t gcwalltime; /* total wall clock time spent for garbage collections */
+  unsigned int gcthreads; /* number of threads used for garbage collection */
   clock_t drtime; /* total time spent for dynamic reordering */
+  clock_t compacttime; /* total time spent for compactions */
+  unsigned long long int compactfreed; /* memory released by compactions (in bytes) */
   float gcratio; /* do not delete nodes if the effect is to small */
   float gcratioF; /* do not delete nodes if the effect is to small */
   float gcratioX; /* do not delete nodes if the effect is to small */
@@ -602,8 +971,9 @@ typedef struct {
   float siftingtreshold; /* stop sifting if the size of the system grows to much */
   float convergesiftingtreshold;  /* stop one step of converging sifting if the size of the system grows to much */
   float siftingfactor; /* sifting heuristics */
+  float cacheratio; /* resize cache tables if there are enough hits, 0.0 = fixed size */
 
-#ifdef BIDDYEXTENDEDSTATS_YES
+  Biddy_Boolean extendedstats; /* TRUE iff the following counters are updated */
   unsigned long long int foa; /* number of calls to Biddy_FoaNode */
   unsigned long long int find; /* number of calls to findNodeTable */
   unsigned long long int compare; /* num of compared nodes in findNodeTable */
@@ -612,7 +982,6 @@ typedef struct {
   unsigned long long int andorrecursive; /*  number of calls to BiddyAnd and BiddyOr (direct and recursive) */
   unsigned long long int xorrecursive; /*  number of calls to BiddyXor (direct and recursive) */
   unsigned long long int *gcobsolete; /* number of obsolete nodes removed by GC */
-#endif
 } BiddyNodeTable;
 
 /* VARIABLE TABLE (SYMBOL TREE) = dynamicaly allocated table */
@@ -629,6 +998,7 @@ typedef struct {
   unsigned int numobsolete; /* used to count obsolete nodes with this variable */
   BiddyNode *firstNode;
   BiddyNode *lastNode;
+  BiddyNode *lastOldNode; /* nodes after this one have been created since the previous GC */
   Biddy_Variable prev; /* previous variable in the global ordering (lower, topmore) */
   Biddy_Variable next; /* next variable in the global ordering (higher, bottommore) */
   Biddy_Edge variable; /* bdd representing a single positive variable */
@@ -636,6 +1006,10 @@ typedef struct {
   Biddy_Edge value; /* value: biddyZero = 0, biddyOne = 1, reused in some algorithms */
   Biddy_Boolean selected; /* used to count variables */
   void *data; /* can be used to associate various user data with every variable */
+#ifdef NODETABLE_SUBTABLES
+  BiddyNode **subtable; /* hash table for nodes with this variable, indices are from [1] to [subtablesize+1] */
+  unsigned int subtablesize; /* current size of subtable */
+#endif
 } BiddyVariable;
 
 typedef struct {
@@ -685,6 +1059,58 @@ typedef struct {
   Biddy_String deletedName; /* used to report deleted formulae */
 } BiddyFormulaTable;
 
+/* PARALLELGC: a part [lo,hi) of the task, t is the index of the thread */
+typedef void (*BiddyParallelFunction)(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+
+/* PARALLELGC: a thread performs parts of the task until all are done */
+typedef struct {
+  Biddy_Manager MNG;
+  BiddyParallelFunction fn;
+  void *data;
+  unsigned int t; /* index of the thread */
+  unsigned int n; /* the task is [0,n) */
+  unsigned int grain; /* size of the parts */
+  unsigned int *next; /* the first part not taken yet, shared by all threads */
+} BiddyParallelTask;
+
+/* PARALLELGC: nodes removed by one thread, linked with field list */
+typedef struct {
+  BiddyNode *first;
+  BiddyNode *last;
+  unsigned int removed;
+} BiddyGCSweep;
+
+#ifdef PARALLELAPPLY
+
+/* PARALLELAPPLY: a recursive call of And, Or, Xor, ITE, or ExistAndAbstract */
+typedef Biddy_Edge (*BiddyApplyFunction)(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+
+/* PARALLELAPPLY: a recursive call which may be taken by another thread */
+typedef struct {
+  BiddyApplyFunction fn;
+  Biddy_Edge f,g,h;
+  Biddy_Edge r;
+  unsigned int state; /* 0 = waiting, 1 = taken, 2 = done */
+} BiddyApplyTask;
+
+/* PARALLELAPPLY: threads and locks used by the operations */
+/* waiting tasks are ordered, the oldest (i.e. the largest) ones are taken first */
+typedef struct {
+  Biddy_Manager MNG;
+  pthread_mutex_t nodelock; /* protects Node table, free nodes, and lists of nodes */
+  pthread_mutex_t cachelock[BIDDYAPPLYCACHELOCKS]; /* protect entries of cache tables */
+  pthread_mutex_t lock; /* protects the waiting tasks */
+  pthread_cond_t cond; /* signals new tasks and finished tasks */
+  pthread_t thread[BIDDYAPPLYTHREADSMAX];
+  BiddyApplyTask *task[BIDDYAPPLYTASKSPERTHREAD * BIDDYAPPLYTHREADSMAX];
+  unsigned int waiting; /* number of waiting tasks */
+  unsigned int busy; /* number of waiting and running tasks */
+  unsigned int threads; /* number of threads including the calling one */
+  Biddy_Boolean stop;
+} BiddyApplyPool;
+
+#endif
+
 /* CACHE LIST = unidirectional list */
 typedef struct BiddyCacheList {
   struct BiddyCacheList *next;
@@ -701,13 +1127,12 @@ typedef struct {
   BiddyOp1Cache *table;
   unsigned int size;
   Biddy_Boolean disabled;
+  Biddy_Boolean stats; /* TRUE iff extended stats are enabled */
   Biddy_Boolean notusedyet;
   unsigned long long int *search;
   unsigned long long int *find;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  unsigned long long int *insert;
-  unsigned long long int *overwrite;
-#endif
+  unsigned long long int *insert; /* counted only if stats == TRUE */
+  unsigned long long int *overwrite; /* counted only if stats == TRUE */
 } BiddyOp1CacheTable;
 
 /* OP2 Cache = a fixed-size cache table for two-arguments operations */
@@ -720,31 +1145,65 @@ typedef struct {
   BiddyOp2Cache *table;
   unsigned int size;
   Biddy_Boolean disabled;
+  Biddy_Boolean stats; /* TRUE iff extended stats are enabled */
   Biddy_Boolean notusedyet;
   unsigned long long int *search;
   unsigned long long int *find;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  unsigned long long int *insert;
-  unsigned long long int *overwrite;
-#endif
+  unsigned long long int *insert; /* counted only if stats == TRUE */
+  unsigned long long int *overwrite; /* counted only if stats == TRUE */
 } BiddyOp2CacheTable;
 
 /* OP3 Cache = a fixed-size cache table for three-arguments operations */
+#ifdef COMPACTCACHE
+/* reference to the node in the arena is (offset+8)/4+complement, 0 = biddyNull, */
+/* where offset is the distance in bytes (a multiple of 8) from the start of the arena */
+/* thus, 32-bit references are enough for BIDDYARENASIZE nodes */
+/* tags of edges are stored in a separate table, it exists for TZBDDs, only */
+typedef unsigned int BiddyCacheReference;
+typedef struct {
+  BiddyCacheReference result; /* 0 = not valid record! */
+  BiddyCacheReference f,g,h;
+#ifdef LAZYCACHE
+  unsigned int epoch; /* entry is valid only in the epoch in which it was added */
+#endif
+} BiddyOp3Cache;
+
+typedef struct {
+  Biddy_Variable result,f,g,h;
+} BiddyOp3CacheTags;
+#else
 typedef struct {
   Biddy_Edge result; /* biddy_null = not valid record! */
   Biddy_Edge f,g,h;
+#ifdef LAZYCACHE
+  unsigned int epoch; /* entry is valid only in the epoch in which it was added */
+#endif
 } BiddyOp3Cache;
+#endif
 
 typedef struct {
   BiddyOp3Cache *table;
+#ifdef COMPACTCACHE
+  BiddyOp3CacheTags *tags; /* NULL if edges are not tagged */
+  BiddyNode *arena; /* references in the entries are relative to the arena */
+#endif
   unsigned int size;
+  unsigned int initsize; /* the size of the table created in Biddy_InitMNG */
+  unsigned int ways; /* the number of entries in a set, 1 = direct-mapped */
   Biddy_Boolean disabled;
+  Biddy_Boolean stats; /* TRUE iff extended stats are enabled */
+#ifdef LAZYCACHE
+  unsigned int epoch; /* the current epoch, it is increased by GC */
+#endif
   Biddy_Boolean *notusedyet;
   unsigned long long int *search;
   unsigned long long int *find;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  unsigned long long int *insert;
-  unsigned long long int *overwrite;
+  unsigned long long int lastsearch; /* look-ups before the previous resizing check */
+  unsigned long long int lastfind; /* hits before the previous resizing check */
+  unsigned long long int *insert; /* counted only if stats == TRUE */
+  unsigned long long int *overwrite; /* counted only if stats == TRUE */
+#ifdef PARALLELAPPLY
+  pthread_mutex_t *lock; /* NULL if operations are not parallel */
 #endif
 } BiddyOp3CacheTable;
 
@@ -756,11 +1215,14 @@ typedef struct {
 
 /* Keyword Cache = a fixed-size cache table for one-argument operations */
 /* Since Biddy v1.7, KeywordCache is used for Biddy_ReplaceByKeyword */
-/* TO DO: use it also for other functions, e.g. copyBDD */
+/* Since Biddy v2.5, KeywordCache entries are used also in Copy cache */
 typedef struct {
   Biddy_Edge result; /* biddy_null = not valid record! */
   Biddy_Edge f;
   unsigned int keyword;
+#ifdef LAZYCACHE
+  unsigned int epoch; /* entry is valid only in the epoch in which it was added */
+#endif
 } BiddyKeywordCache;
 
 typedef struct {
@@ -770,16 +1232,92 @@ typedef struct {
   unsigned int keywordNum;
   unsigned int keyNum;
   unsigned int size;
+  unsigned int initsize; /* the size of the table created in Biddy_InitMNG */
   Biddy_Boolean disabled;
+  Biddy_Boolean stats; /* TRUE iff extended stats are enabled */
+#ifdef LAZYCACHE
+  unsigned int epoch; /* the current epoch, it is increased by GC */
+#endif
   Biddy_Boolean *notusedyet;
   unsigned long long int *search;
   unsigned long long int *find;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  unsigned long long int *insert;
-  unsigned long long int *overwrite;
-#endif
+  unsigned long long int lastsearch; /* look-ups before the previous resizing check */
+  unsigned long long int lastfind; /* hits before the previous resizing check */
+  unsigned long long int *insert; /* counted only if stats == TRUE */
+  unsigned long long int *overwrite; /* counted only if stats == TRUE */
 } BiddyKeywordCacheTable;
 
+/* BiddyCacheRef and BiddyCacheEdge convert between edges and references */
+/* stored in OP, EA, and RC cache, BiddyCacheN returns the referenced node */
+/* for variant COMPACTCACHE, tag t is given separately */
+#ifdef COMPACTCACHE
+#define BiddyCacheNull 0
+#define BiddyCacheIsNull(r) (!(r))
+#define BiddyCacheRef(cache,e) (BiddyIsNull(e) ? 0 : ((BiddyCacheReference)(((uintptr_t) BiddyN(e) - (uintptr_t) (cache).arena + 8) >> 2) | (BiddyCacheReference) BiddyGetMark(e)))
+#define BiddyCacheN(cache,r) ((BiddyNode *)((uintptr_t) (cache).arena + ((uintptr_t)((r) & ~1U) << 2) - 8))
+#define BiddyCacheEdge(cache,r,t) ((r) ? ((Biddy_Edge) ((uintptr_t) BiddyCacheN(cache,r) | ((r) & 1) | ((uintptr_t) (t) << 48))) : biddyNull)
+#else
+#define BiddyCacheNull biddyNull
+#define BiddyCacheIsNull(r) BiddyIsNull(r)
+#define BiddyCacheN(cache,r) BiddyN(r)
+#endif
+
+/* Count Cache = a fixed-size cache table for results of counting functions */
+/* Since Biddy v2.5, it is used for Biddy_CountMinterms and Biddy_CountPaths */
+/* nvars is the requested number of variables (-1 is resolved before), */
+/* BIDDYCOUNTPATHS is used for the number of 1-paths */
+#define BIDDYCOUNTPATHS -2
+typedef struct {
+  Biddy_Edge f; /* biddy_null = not valid record! */
+  int nvars;
+  union {
+    double minterms;
+    unsigned long long int paths;
+  } result;
+} BiddyCountCache;
+
+typedef struct {
+  BiddyCountCache *table;
+  unsigned int size;
+  unsigned long long int search;
+  unsigned long long int find;
+} BiddyCountCacheTable;
+
+/* Copy Cache = a fixed-size cache table for copying BDDs into other managers */
+/* Since Biddy v2.5, it is a Keyword Cache in the source manager, */
+/* keyword is given to the target manager and it is changed if GC, swapping, */
+/* compaction or adding variables could invalidate the results */
+/* Biddy_Copy uses keyword, BiddyConvertDirect uses keyword+1 */
+typedef struct {
+  Biddy_Manager MNG; /* target manager */
+  unsigned int serial; /* target manager is identified also by its serial */
+  unsigned int garbage; /* the number of GC in target manager */
+  unsigned int swap; /* the number of swaps in target manager */
+  unsigned int compaction; /* the number of compactions in target manager */
+  Biddy_Variable num1; /* the number of variables in source manager */
+  Biddy_Variable num2; /* the number of variables in target manager */
+  unsigned int keyword;
+} BiddyCopyTarget;
+
+typedef struct {
+  BiddyKeywordCache *table; /* allocated on the first copy */
+  BiddyCopyTarget *targetList;
+  unsigned int targetNum;
+  unsigned int keyNum; /* the last used keyword */
+  unsigned int size;
+  unsigned int serial; /* identifies this manager if it is a target */
+  unsigned long long int search;
+  unsigned long long int find;
+} BiddyCopyCacheTable;
+
+/* entry in OP, EA, RC, or Replace cache is valid if it has a result */
+/* in LAZYCACHE variant, it must also be added in the current epoch */
+#ifdef LAZYCACHE
+#define BiddyCacheEntryValid(cache,c) (!BiddyCacheIsNull((c)->result) && ((c)->epoch == (cache).epoch))
+#else
+#define BiddyCacheEntryValid(cache,c) (!BiddyCacheIsNull((c)->result))
+#endif
+
 /* Manager = configuration of a BDD system, since Biddy v1.4 */
 /* All fields in BiddyManager must be pointers or arrays */
 /* Anonymous manager (i.e. anonymous namespace) is created by Biddy_Init */
@@ -807,6 +1345,10 @@ typedef struct {
   void *ordering; /* this is typecasted to (BiddyOrderingTable*) */
   void *age; /* this is typecasted to (unsigned int*) */
   void *selector; /* this is typecasted to (unsigned short int*) */
+  void *localInfo; /* this is typecasted to (BiddyLocalInfo**) */
+  void *applyPool; /* this is typecasted to (BiddyApplyPool*) */
+  void *COUNTcache; /* this is typecasted to (BiddyCountCacheTable*) */
+  void *COPYcache; /* this is typecasted to (BiddyCopyCacheTable*) */
 } BiddyManager;
 
 /* LocalInfo = a table for additional info about nodes, since Biddy v1.4 */
@@ -940,8 +1482,6 @@ typedef struct {
 
 extern Biddy_Manager biddyAnonymousManager; /* anonymous manager */
 
-extern BiddyLocalInfo *biddyLocalInfo; /* reference to Local Info */
-
 /*----------------------------------------------------------------------------*/
 /* Prototypes for internal functions defined in biddyMain.c                   */
 /*----------------------------------------------------------------------------*/
@@ -954,7 +1494,15 @@ extern Biddy_String BiddyAbout();
 extern Biddy_Boolean BiddyManagedIsOK(Biddy_Manager MNG, Biddy_Edge f); /* TO DO: replace with macro */
 extern int BiddyManagedGetManagerType(Biddy_Manager MNG);
 extern Biddy_String BiddyManagedGetManagerName(Biddy_Manager MNG);
-extern void BiddyManagedSetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF, float gcrX, float rr, float rrF, float rrX, float st, float cst);
+extern void BiddyManagedSetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF, float gcrX, float rr, float rrF, float rrX, float st, float cst, float cr);
+extern void BiddyManagedSetNodeAllocator(Biddy_Manager MNG, int allocator, Biddy_AllocFunction alloc, Biddy_FreeFunction free);
+extern void BiddyManagedSetGenerationalGC(Biddy_Manager MNG, Biddy_Boolean generational);
+extern void BiddyManagedSetGCThreads(Biddy_Manager MNG, unsigned int threads);
+extern void BiddyManagedSetApplyThreads(Biddy_Manager MNG, unsigned int threads);
+extern void BiddyManagedSetCacheWays(Biddy_Manager MNG, unsigned int ways);
+extern void BiddyManagedSetZBDDSkip(Biddy_Manager MNG, int skip);
+extern void BiddyManagedSetExtendedStats(Biddy_Manager MNG, Biddy_Boolean stats);
+extern void BiddyManagedSetIterativeApply(Biddy_Manager MNG, Biddy_Boolean iterative);
 extern Biddy_Edge BiddyManagedGetBaseSet(Biddy_Manager MNG);
 extern Biddy_Edge BiddyManagedTransferMark(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean mark,Biddy_Boolean leftright);
 extern Biddy_Boolean BiddyManagedIsEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2, Biddy_Edge f2);
@@ -1001,7 +1549,19 @@ extern void BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT, Biddy_Var
 extern void BiddyManagedClean(Biddy_Manager MNG);
 extern void BiddyManagedPurge(Biddy_Manager MNG);
 extern void BiddyManagedPurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge);
+extern void BiddyManagedPurgeAndCompact(Biddy_Manager MNG);
 extern void BiddyManagedAddCache(Biddy_Manager MNG, Biddy_GCFunction gc);
+extern void *BiddyAllocCacheTable(size_t size);
+extern void BiddyParallelFor(Biddy_Manager MNG, BiddyParallelFunction fn, void *data, unsigned int n, unsigned int work);
+#ifdef PARALLELAPPLY
+extern void BiddyParallelApply(Biddy_Manager MNG, BiddyApplyFunction fn, Biddy_Edge f1, Biddy_Edge g1, Biddy_Edge h1, Biddy_Edge *r1, Biddy_Edge f2, Biddy_Edge g2, Biddy_Edge h2, Biddy_Edge *r2);
+#define BiddyApplySpawn(MNG) (biddyApplyPool && (__atomic_load_n(&biddyApplyPool->waiting,__ATOMIC_RELAXED) < BIDDYAPPLYTASKSPERTHREAD * biddyApplyPool->threads))
+#endif
+#ifdef PARALLELAPPLY
+#define BiddyIterativeApply(MNG) (biddyNodeTable.iterative && !biddyApplyPool && ((biddyManagerType == BIDDYTYPEOBDD) || (biddyManagerType == BIDDYTYPEOBDDC)))
+#else
+#define BiddyIterativeApply(MNG) (biddyNodeTable.iterative && ((biddyManagerType == BIDDYTYPEOBDD) || (biddyManagerType == BIDDYTYPEOBDDC)))
+#endif
 extern unsigned int BiddyManagedAddFormula(Biddy_Manager MNG, Biddy_String x, Biddy_Edge f, int c);
 #define BiddyManagedAddTmpFormula(MNG,x,f) BiddyManagedAddFormula(MNG,x,f,-1)
 #define BiddyManagedAddPersistentFormula(MNG,x,f) BiddyManagedAddFormula(MNG,x,f,0)
@@ -1067,6 +1627,8 @@ extern Biddy_Edge BiddyCopyOBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Ed
 extern Biddy_Edge BiddyCopyZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f);
 extern Biddy_Edge BiddyCopyTZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f);
 extern Biddy_Edge BiddyConvertDirect(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f);
+extern void BiddyCopyGarbage(Biddy_Manager MNG);
+extern void BiddyCopyGarbageDeleteAll(Biddy_Manager MNG);
 extern void BiddyConstructBDD(Biddy_Manager MNG, int numN, BiddyNodeList *tableN, int numF, BiddyFormulaList *tableF);
 
 
@@ -1142,6 +1704,17 @@ extern Biddy_Edge BiddyManagedRandomFunction(Biddy_Manager MNG, Biddy_Edge suppo
 extern Biddy_Edge BiddyManagedRandomSet(Biddy_Manager MNG, Biddy_Edge unit, double ratio);
 extern Biddy_Edge BiddyManagedExtractMinterm(Biddy_Manager MNG, Biddy_Edge support, Biddy_Edge f);
 extern Biddy_Edge BiddyManagedDual(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean neg);
+extern Biddy_Edge BiddyManagedAndN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule);
+extern Biddy_Edge BiddyManagedOrN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule);
+extern Biddy_Edge BiddyManagedAndBF(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g);
+extern Biddy_Relation BiddyManagedCreateRelation(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n, Biddy_Variable *cur, Biddy_Variable *next, unsigned int m, unsigned int clustersize);
+extern void BiddyManagedDeleteRelation(Biddy_Manager MNG, Biddy_Relation rel);
+extern Biddy_Edge BiddyManagedImage(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k, Biddy_Edge R);
+extern Biddy_Edge BiddyManagedPreImage(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k, Biddy_Edge R);
+extern Biddy_Edge BiddyManagedReachable(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k, Biddy_Edge I, Biddy_Edge target, unsigned int *steps);
+extern Biddy_Edge BiddyManagedSaturate(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n, Biddy_Variable *cur, Biddy_Variable *next, unsigned int m, Biddy_Edge I);
+extern Biddy_Edge BiddyManagedVectorCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable *v, Biddy_Edge *g, unsigned int n);
+extern Biddy_Edge BiddyManagedRestrictCube(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube);
 
 /*----------------------------------------------------------------------------*/
 /* Prototypes for internal functions defined in biddyStat.c                   */
@@ -1190,6 +1763,7 @@ extern unsigned int BiddyManagedCountComplementedEdges(Biddy_Manager MNG, Biddy_
 extern unsigned long long int BiddyManagedCountPaths(Biddy_Manager MNG, Biddy_Edge f);
 extern double BiddyManagedCountMinterms(Biddy_Manager MNG, Biddy_Edge f, int nvars);
 #define BiddyManagedCountCombinations(MNG,f,nvars) BiddyManagedCountMinterms(MNG,f,nvars)
+extern unsigned int BiddyManagedCountFormulaeMinterms(Biddy_Manager MNG, int nvars);
 extern double BiddyManagedDensityOfFunction(Biddy_Manager MNG, Biddy_Edge f, unsigned int nvars);
 extern double BiddyManagedDensityOfBDD(Biddy_Manager MNG, Biddy_Edge f, unsigned int nvars);
 extern unsigned int BiddyManagedMinNodes(Biddy_Manager MNG, Biddy_Edge f);
@@ -1200,6 +1774,8 @@ extern void BiddyManagedPrintInfo(Biddy_Manager MNG, FILE *f);
 extern void BiddyNodeNumber(Biddy_Manager MNG, Biddy_Edge f, unsigned int *n);
 extern void BiddyComplementedEdgeNumber(Biddy_Manager MNG, Biddy_Edge f, unsigned int *n);
 extern void BiddyNodeVarNumber(Biddy_Manager MNG, Biddy_Edge f, unsigned int *n);
+extern void BiddyCountGarbage(Biddy_Manager MNG);
+extern void BiddyCountGarbageDeleteAll(Biddy_Manager MNG);
 
 /*----------------------------------------------------------------------------*/
 /* Prototypes for internal functions defined in biddyInOut.c                  */
@@ -54,6 +54,15 @@ See also: biddy.h, biddyInt.h
 #include <malloc.h> /* experimental */
 #endif
 
+#if defined(UNIX) || defined(MACOSX)
+#include <sys/mman.h> /* used for mmap() and madvise(), UNIX and MACOSX only */
+#include <unistd.h> /* used for sysconf(), UNIX and MACOSX only */
+#endif
+
+#ifdef PARALLELGC
+#include <pthread.h> /* used for parallel garbage collection, UNIX and MACOSX only */
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* Constant declarations                                                      */
 /*----------------------------------------------------------------------------*/
@@ -112,8 +121,8 @@ extern "C" {
 Biddy_Manager biddyAnonymousManager /* anonymous manager */
        = NULL;
 
-BiddyLocalInfo *biddyLocalInfo /* local info table */
-       = NULL;
+unsigned int biddyManagerSerial /* the last given serial of the manager */
+       = 0;
 
 /* Biddy_Edge debug_edge = NULL; */ /* debugging, only */
 /* Biddy_Boolean biddySiftingActive = FALSE; */ /* debugging, only */
@@ -127,8 +136,44 @@ static BiddyLocalInfo * createLocalInfo(Biddy_Manager MNG, Biddy_Edge f, BiddyLo
 static void deleteLocalInfo(Biddy_Manager MNG, Biddy_Edge f);
 static inline unsigned int nodeTableHash(Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt, unsigned int size);
 static inline void addNodeTable(Biddy_Manager MNG, unsigned int hash, BiddyNode *node, BiddyNode *sup1);
+static inline void removeNodeTable(Biddy_Manager MNG, BiddyNode *node);
+#ifdef NODETABLE_OPENADDRESSING
+static inline unsigned int nodeTableFingerprint(Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt);
+static void nodeTableEnlarge(Biddy_Manager MNG);
+#endif
+#ifdef NODETABLE_SUBTABLES
+static void nodeSubtableCreate(Biddy_Manager MNG, Biddy_Variable v);
+static void nodeSubtableEnlarge(Biddy_Manager MNG, Biddy_Variable v);
+#endif
 static inline BiddyNode *findNodeTable(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt, BiddyNode **thesup);
+static inline unsigned int nodeBlockNumber(Biddy_Manager MNG, BiddyNode *node);
+static inline Biddy_Edge relocatedEdge(Biddy_Manager MNG, Biddy_Edge f, unsigned int k);
+static void nodeTableCompact(Biddy_Manager MNG);
+static void *nodeBlockMalloc(size_t size);
+static void nodeBlockFree(void *block, size_t size);
+static void *nodeBlockMmap(size_t size);
+static void nodeBlockMunmap(void *block, size_t size);
+#ifdef ARENA
+static BiddyNode *arenaReserve(size_t size);
+static void arenaRelease(BiddyNode *arena, size_t size);
+static void arenaDiscard(BiddyNode *from, size_t size);
+#endif
+static clock_t wallClock();
+#ifdef PARALLELGC
+static void *parallelWorker(void *arg);
+#ifndef NODETABLE_OPENADDRESSING
+static void gcSweepChains(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+static void gcSweepVariables(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+#endif
+#endif
+#ifdef PARALLELAPPLY
+static void *applyWorker(void *arg);
+static void performApplyTask(BiddyApplyPool *pool);
+#endif
 static void addVariableElement(Biddy_Manager MNG, Biddy_String x, Biddy_Boolean varelem, Biddy_Boolean complete);
+static unsigned int copyKeyword(Biddy_Manager MNG1, Biddy_Manager MNG2);
+static inline Biddy_Boolean findCopyCache(Biddy_Manager MNG1, Biddy_Edge f, unsigned int k, Biddy_Edge *r);
+static inline void addCopyCache(Biddy_Manager MNG1, Biddy_Edge f, unsigned int k, Biddy_Edge r);
 static void evalProbability(Biddy_Manager MNG, Biddy_Edge f,  double *c1, double *c0, Biddy_Boolean *leftmost);
 static Biddy_Boolean checkFunctionOrdering(Biddy_Manager MNG, Biddy_Edge f);
 static Biddy_Variable getGlobalOrdering(Biddy_Manager MNG, Biddy_Variable v);
@@ -885,7 +930,9 @@ Biddy_Managed_GetManagerName(Biddy_Manager MNG)
     biddyNodeTable.convergesiftingtreshold (stop one step of converging sifting
                                      if the size of the system grows to much),
     biddyNodeTable.fconvergesiftingtreshold (stop one step of converging sifting
-                                     if the size of the function grows to much).
+                                     if the size of the function grows to much),
+    biddyNodeTable.cacheratio (resize cache tables if there are enough hits,
+                               if 0.0 then cache tables have fixed size).
 ### Side effects
     Initial values are given in Biddy_InitMNG.
 ### More info
@@ -899,7 +946,7 @@ extern "C" {
 
 void
 Biddy_Managed_SetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF,
-  float gcrX, float rr, float rrF, float rrX, float st, float cst)
+  float gcrX, float rr, float rrF, float rrX, float st, float cst, float cr)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -925,7 +972,7 @@ Biddy_Managed_SetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF,
     return;
   }
 
-  BiddyManagedSetManagerParameters(MNG,gcr,gcrF,gcrX,rr,rrF,rrX,st,cst);
+  BiddyManagedSetManagerParameters(MNG,gcr,gcrF,gcrX,rr,rrF,rrX,st,cst,cr);
 }
 
 #ifdef __cplusplus
@@ -933,61 +980,60 @@ Biddy_Managed_SetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetBaseSet returns set containing only a null
-       combination, i.e. it returns {{}}.
+\brief Function Biddy_Managed_SetNodeAllocator selects the allocator used
+       for memory blocks of nodes.
 
 ### Description
+    Supported allocators are BIDDYALLOCMALLOC (malloc, default),
+    BIDDYALLOCMMAP (anonymous mmap with MADV_HUGEPAGE, i.e. transparent
+    huge pages are used if they are enabled in the system), and
+    BIDDYALLOCUSER (user's functions alloc and free are used, free is
+    called with the pointer and the size of the memory block).
+    Parameters alloc and free are used for BIDDYALLOCUSER, only.
 ### Side effects
+    The first memory block is allocated in Biddy_InitMNG, it is always
+    allocated with malloc. The allocator can be changed only if no other
+    memory block has been allocated, yet. BIDDYALLOCMMAP is the same as
+    BIDDYALLOCMALLOC if system is not UNIX or MACOSX. For variant ARENA,
+    memory blocks are parts of the arena and the allocator is not used.
 ### More info
-    Macro Biddy_GetBaseSet() is defined for use with anonymous manager.
+    Macro Biddy_SetNodeAllocator(allocator,alloc,free) is defined for use
+    with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_GetBaseSet(Biddy_Manager MNG)
+void
+Biddy_Managed_SetNodeAllocator(Biddy_Manager MNG, int allocator,
+  Biddy_AllocFunction alloc, Biddy_FreeFunction free)
 {
-  Biddy_Edge r;
-
   if (!MNG) MNG = biddyAnonymousManager;
 
-  r = biddyNull;
-
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedGetBaseSet(MNG);
-    BiddyRefresh(r); /* not always refreshed by BiddyManagedGetBaseSet */
   }
   else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
-    r = BiddyManagedGetBaseSet(MNG);
-    BiddyRefresh(r); /* not always refreshed by BiddyManagedGetBaseSet */
   }
 #ifndef COMPACT
   else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedGetBaseSet(MNG);
-    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
   else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
-    r = BiddyManagedGetBaseSet(MNG);
-    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
   else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedGetBaseSet(MNG);
-    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetBaseSet: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_SetNodeAllocator: Unsupported BDD type!\n");
+    return;
   }
 
-  return r;
+  BiddyManagedSetNodeAllocator(MNG,allocator,alloc,free);
 }
 
 #ifdef __cplusplus
@@ -995,27 +1041,33 @@ Biddy_Managed_GetBaseSet(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_TransferMark returns edge with inverted
-       complement bit iff the second parameter is TRUE and normalization
-       rules require this.
+\brief Function Biddy_Managed_SetGenerationalGC enables or disables
+       generational garbage collection.
 
 ### Description
-    Parameter leftright should be TRUE for left and FALSE for right.
-    For OBDDC, it is better to use macro Biddy_InvCond.
-    For OBDDC, parameter leftright is ignored.
+    If generational GC is enabled then automatic GC is usually a minor one,
+    it considers only nodes created since the previous GC (nursery). Nodes
+    are never changed, thus older nodes cannot point to nodes from the
+    nursery and only nodes from the nursery have to be checked. Obsolete
+    older nodes are removed by a major GC, which considers all nodes.
+    A major GC is used if there are more new nodes than older nodes, if too
+    many nodes have survived the previous minor GC (which also happens if
+    the previous minor GC was not useful), if Node table should be resized,
+    after dynamic reordering, and for Biddy_Purge.
+    By default, generational GC is disabled.
 ### Side effects
-    TO DO: swap the meaning of parameter leftright (left should be FALSE)
+    Minor GC never resizes Node table.
 ### More info
-    Macro Biddy_TransferMark() is defined for use with anonymous manager.
+    Macro Biddy_SetGenerationalGC(generational) is defined for use with
+    anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_TransferMark(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean mark,
-                           Biddy_Boolean leftright)
+void
+Biddy_Managed_SetGenerationalGC(Biddy_Manager MNG, Biddy_Boolean generational)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1037,11 +1089,11 @@ Biddy_Managed_TransferMark(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean mark,
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_TransferMark: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_SetGenerationalGC: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedTransferMark(MNG,f,mark,leftright);
+  BiddyManagedSetGenerationalGC(MNG,generational);
 }
 
 #ifdef __cplusplus
@@ -1049,70 +1101,61 @@ Biddy_Managed_TransferMark(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean mark,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_IsEqv returns TRUE iff two BDDs are equal.
+\brief Function Biddy_Managed_SetGCThreads sets the number of threads used
+       for garbage collection.
 
 ### Description
-    It is assumed that f1 and f2 have the same ordering.
+    If more than one thread is used then the obsolete nodes are removed from
+    Node table and from the lists of nodes in parallel (chains of Node table
+    are shared by the threads, lists of nodes are shared by variables) and
+    each thread collects its own list of free nodes which are merged at the
+    end. Cache tables are also checked in parallel. Small tasks, minor GC,
+    GC with resizing of Node table, and GC during sifting are performed by
+    the calling thread. If threads == 0 then the number of online
+    processors is used. By default, one thread is used.
 ### Side effects
+    Parallel GC is available in variant PARALLELGC, only (you have to use
+    -lpthread for linking). For NODETABLE_OPENADDRESSING, only cache tables
+    are checked in parallel. Node table statistic for GC time reports the
+    processor time used by all threads, the wall clock time is reported by
+    Biddy_NodeTableGCWallTime.
 ### More info
-    Macro Biddy_IsEqv(f1,MNG2,f2) is defined for use with anonymous manager.
+    Macro Biddy_SetGCThreads(threads) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_IsEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2,
-                    Biddy_Edge f2)
+void
+Biddy_Managed_SetGCThreads(Biddy_Manager MNG, unsigned int threads)
 {
-  if (!MNG1) MNG1 = biddyAnonymousManager;
-
-  if (biddyManagerType1 == BIDDYTYPEOBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
-    /* IMPLEMENTED */
-  }
-#ifndef COMPACT
-  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
-    /* IMPLEMENTED */
-  }
-#endif
-  else {
-    fprintf(stderr,"Biddy_Managed_IsEqv: Unsupported BDD type!\n");
-    return 0;
-  }
+  if (!MNG) MNG = biddyAnonymousManager;
 
-  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+  if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_IsEqv: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_SetGCThreads: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedIsEqv(MNG1,f1,MNG2,f2);
+  BiddyManagedSetGCThreads(MNG,threads);
 }
 
 #ifdef __cplusplus
@@ -1120,13 +1163,29 @@ Biddy_Managed_IsEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SelectNode selects the top node of the given
-       function.
+\brief Function Biddy_Managed_SetApplyThreads sets the number of threads used
+       by And, Or, Xor, ITE, and ExistAndAbstract.
 
 ### Description
+    If more than one thread is used then the two recursive calls of these
+    operations may be performed concurrently. The second recursive call is
+    given to another thread only if some thread is idle (there are only
+    a few waiting tasks), otherwise, the calling thread performs both calls.
+    A thread waiting for its task to be finished performs other waiting
+    tasks. Node table is protected by a single lock and cache tables are
+    protected by many locks, each covering a part of the table. If
+    threads == 0 then the number of online processors is used. By default,
+    one thread is used. The function should be called immediately after
+    Biddy_InitMNG and it must not be called during an operation.
 ### Side effects
+    Parallel operations are available in variant PARALLELAPPLY, only (you
+    have to use -lpthread for linking). During a parallel operation,
+    garbage collection is not started, new blocks of nodes are allocated
+    instead. Extended statistics are not exact if more than one thread
+    is used.
 ### More info
-    Macro Biddy_SelectNode(f) is defined for use with anonymous manager.
+    Macro Biddy_SetApplyThreads(threads) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -1134,7 +1193,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_SelectNode(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Managed_SetApplyThreads(Biddy_Manager MNG, unsigned int threads)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1156,11 +1215,11 @@ Biddy_Managed_SelectNode(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SelectNode: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_SetApplyThreads: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedSelectNode(MNG,f);
+  BiddyManagedSetApplyThreads(MNG,threads);
 }
 
 #ifdef __cplusplus
@@ -1168,13 +1227,22 @@ Biddy_Managed_SelectNode(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_DeselectNode deselects the top node of the given
-       function.
+\brief Function Biddy_Managed_SetCacheWays sets the associativity of OP, EA,
+       and RC cache.
 
 ### Description
+    Cache tables are organized in sets of the given number of entries
+    (ways = 1, 2, or 4). A result is looked for in all entries of the set
+    selected by the hash function. The entries in a set are ordered from the
+    most recently used to the least recently used one. A new entry is placed
+    at the beginning of the set and the least recently used entry (or the
+    first empty one) is dropped. If ways == 1 then cache tables are
+    direct-mapped. By default, BIDDYCACHEWAYS is used.
 ### Side effects
+    All entries in OP, EA, and RC cache are deleted.
 ### More info
-    Macro Biddy_DeselectNode(f) is defined for use with anonymous manager.
+    Macro Biddy_SetCacheWays(ways) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -1182,7 +1250,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_DeselectNode(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Managed_SetCacheWays(Biddy_Manager MNG, unsigned int ways)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1204,11 +1272,11 @@ Biddy_Managed_DeselectNode(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_DeselectNode: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_SetCacheWays: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedDeselectNode(MNG,f);
+  BiddyManagedSetCacheWays(MNG,ways);
 }
 
 #ifdef __cplusplus
@@ -1216,21 +1284,35 @@ Biddy_Managed_DeselectNode(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_IsSelected returns TRUE iff the top node of the
-       given function is selected.
+\brief Function Biddy_Managed_SetZBDDSkip selects how ZBDD And and Gt
+       handle arguments with different top variables.
 
 ### Description
+    For ZBDDs and ZBDDs with complemented edges, And(f,g) and Gt(f,g) skip
+    the else edges of the argument with the smaller top variable until
+    it reaches the top variable of the other argument (for Gt, only the
+    second argument is skipped). Supported strategies are:
+    BIDDYZBDDSKIPRECURSIVE - one recursive call for each skipped node,
+    results are not cached (the original implementation);
+    BIDDYZBDDSKIPJUMP - all skipped nodes are passed in a loop and
+    only the call with equal top variables is cached;
+    BIDDYZBDDSKIPCACHE - one recursive call for each skipped node and
+    the results are stored in OP cache.
+    By default, BIDDYZBDDSKIP is used. For other BDD types, this setting
+    has no effect.
 ### Side effects
+    Results already stored in OP cache remain valid.
 ### More info
-    Macro Biddy_IsSelected(f) is defined for use with anonymous manager.
+    Macro Biddy_SetZBDDSkip(skip) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_IsSelected(Biddy_Manager MNG, Biddy_Edge f)
+void
+Biddy_Managed_SetZBDDSkip(Biddy_Manager MNG, int skip)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1252,11 +1334,11 @@ Biddy_Managed_IsSelected(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_IsSelected: Unsupported BDD type!\n");
-    return FALSE;
+    fprintf(stderr,"Biddy_Managed_SetZBDDSkip: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedIsSelected(MNG,f);
+  BiddyManagedSetZBDDSkip(MNG,skip);
 }
 
 #ifdef __cplusplus
@@ -1264,14 +1346,24 @@ Biddy_Managed_IsSelected(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SelectFunction recursively selects all nodes of a
-       given function.
+\brief Function Biddy_Managed_SetExtendedStats enables or disables
+       extended statistics.
 
 ### Description
+    Extended statistics are the number of foa, find, compare and add
+    operations on the node table, the number of recursive calls in ITE,
+    And/Or and Xor, the number of insertions and overwrites in OP, EA,
+    RC, and Replace cache, and the number of obsolete nodes found by
+    each garbage collection. If disabled, these counters are not updated
+    and each counting site costs only a test of the manager's flag.
+    By default, extended statistics are enabled only if Biddy is compiled
+    with BIDDYEXTENDEDSTATS_YES. Counters are not reset.
 ### Side effects
-    Terminal node must be selected before starting this function!
+    Under PARALLELAPPLY, counters are not updated atomically and thus
+    they are only approximate.
 ### More info
-    Macro Biddy_SelectFunction(f) is defined for use with anonymous manager.
+    Macro Biddy_SetExtendedStats(stats) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -1279,7 +1371,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_SelectFunction(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Managed_SetExtendedStats(Biddy_Manager MNG, Biddy_Boolean stats)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1301,11 +1393,11 @@ Biddy_Managed_SelectFunction(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SelectFunction: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_SetExtendedStats: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedSelectFunction(MNG,f);
+  BiddyManagedSetExtendedStats(MNG,stats);
 }
 
 #ifdef __cplusplus
@@ -1313,13 +1405,26 @@ Biddy_Managed_SelectFunction(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_DeselectAll deselects all nodes.
+\brief Function Biddy_Managed_SetIterativeApply selects between recursive
+       and iterative implementation of the basic operations.
 
 ### Description
-    Deselect all nodes.
+    If iterative apply is enabled, And, Or, Xor, ITE, Not, and
+    ExistAndAbstract on OBDDs and OBDDCs are calculated by a loop over an
+    explicit stack of frames allocated on the heap. The depth of the
+    calculation is then not limited by the size of the thread's stack.
+    Results are the same and OP and EA cache are shared with the recursive
+    implementation. For other BDD types, this setting has no effect. By
+    default, iterative apply is enabled only if Biddy is compiled with
+    ITERATIVEAPPLY.
 ### Side effects
+    The explicit stack grows as needed and it is released together with
+    the manager.
+    If parallel apply is enabled (see Biddy_SetApplyThreads), the
+    recursive implementation is used.
 ### More info
-    Macro Biddy_DeselectAll() is defined for use with anonymous manager.
+    Macro Biddy_SetIterativeApply(iterative) is defined for use with
+    anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -1327,7 +1432,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_DeselectAll(Biddy_Manager MNG)
+Biddy_Managed_SetIterativeApply(Biddy_Manager MNG, Biddy_Boolean iterative)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1349,11 +1454,11 @@ Biddy_Managed_DeselectAll(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_DeselectAll: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_SetIterativeApply: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedDeselectAll(MNG);
+  BiddyManagedSetIterativeApply(MNG,iterative);
 }
 
 #ifdef __cplusplus
@@ -1361,48 +1466,61 @@ Biddy_Managed_DeselectAll(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetVariable returns variable with the given
-       name.
+\brief Function Biddy_Managed_GetBaseSet returns set containing only a null
+       combination, i.e. it returns {{}}.
 
 ### Description
 ### Side effects
-    If variable is not found function returns 0!
 ### More info
-    Macro Biddy_GetVariable(x) is defined for use with anonymous manager.
+    Macro Biddy_GetBaseSet() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_GetVariable(Biddy_Manager MNG, Biddy_String x)
+Biddy_Edge
+Biddy_Managed_GetBaseSet(Biddy_Manager MNG)
 {
+  Biddy_Edge r;
+
   if (!MNG) MNG = biddyAnonymousManager;
 
+  r = biddyNull;
+
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
+    r = BiddyManagedGetBaseSet(MNG);
+    BiddyRefresh(r); /* not always refreshed by BiddyManagedGetBaseSet */
   }
   else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
+    r = BiddyManagedGetBaseSet(MNG);
+    BiddyRefresh(r); /* not always refreshed by BiddyManagedGetBaseSet */
   }
 #ifndef COMPACT
   else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
+    r = BiddyManagedGetBaseSet(MNG);
+    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
   else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
+    r = BiddyManagedGetBaseSet(MNG);
+    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
   else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
+    r = BiddyManagedGetBaseSet(MNG);
+    /* BiddyRefresh() */ /* not needed, because terminal node is returned */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetVariable: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_GetBaseSet: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedGetVariable(MNG,x);
+  return r;
 }
 
 #ifdef __cplusplus
@@ -1410,22 +1528,27 @@ Biddy_Managed_GetVariable(Biddy_Manager MNG, Biddy_String x)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetLowestVariable returns the lowest variable
-        in the current ordering.
+\brief Function Biddy_Managed_TransferMark returns edge with inverted
+       complement bit iff the second parameter is TRUE and normalization
+       rules require this.
 
 ### Description
-    The lowest variable is the tompost variable.
+    Parameter leftright should be TRUE for left and FALSE for right.
+    For OBDDC, it is better to use macro Biddy_InvCond.
+    For OBDDC, parameter leftright is ignored.
 ### Side effects
+    TO DO: swap the meaning of parameter leftright (left should be FALSE)
 ### More info
-    Macro Biddy_GetLowestVariable(x) is defined for use with anonymous manager.
+    Macro Biddy_TransferMark() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_GetLowestVariable(Biddy_Manager MNG)
+Biddy_Edge
+Biddy_Managed_TransferMark(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean mark,
+                           Biddy_Boolean leftright)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1447,11 +1570,11 @@ Biddy_Managed_GetLowestVariable(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetLowestVariable: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_TransferMark: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedGetLowestVariable(MNG);
+  return BiddyManagedTransferMark(MNG,f,mark,leftright);
 }
 
 #ifdef __cplusplus
@@ -1459,52 +1582,70 @@ Biddy_Managed_GetLowestVariable(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetIthVariable returns ith variable
-        in the current global ordering.
+\brief Function Biddy_Managed_IsEqv returns TRUE iff two BDDs are equal.
 
 ### Description
-    The lowest (topmost) variable has global ordering 1.
-    The highest (bottommost) variable is '1' and has global ordering equal
-    to numUsedVariables.
+    It is assumed that f1 and f2 have the same ordering.
 ### Side effects
-    If argument is 0, function returns 0.
-    If argument is larger than the number of variables, function returns 0.
 ### More info
-    Macro Biddy_GetIthVariable(x) is defined for use with anonymous manager.
+    Macro Biddy_IsEqv(f1,MNG2,f2) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_GetIthVariable(Biddy_Manager MNG, Biddy_Variable i)
+Biddy_Boolean
+Biddy_Managed_IsEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2,
+                    Biddy_Edge f2)
 {
-  if (!MNG) MNG = biddyAnonymousManager;
+  if (!MNG1) MNG1 = biddyAnonymousManager;
 
-  if (biddyManagerType == BIDDYTYPEOBDD) {
+  if (biddyManagerType1 == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if (biddyManagerType == BIDDYTYPEZBDD) {
+  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
+  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetIthVariable: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_IsEqv: Unsupported BDD type!\n");
     return 0;
   }
 
-  return BiddyManagedGetIthVariable(MNG,i);
+  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+  }
+#ifndef COMPACT
+  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
+#endif
+  else {
+    fprintf(stderr,"Biddy_Managed_IsEqv: Unsupported BDD type!\n");
+    return 0;
+  }
+
+  return BiddyManagedIsEqv(MNG1,f1,MNG2,f2);
 }
 
 #ifdef __cplusplus
@@ -1512,21 +1653,21 @@ Biddy_Managed_GetIthVariable(Biddy_Manager MNG, Biddy_Variable i)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetPrevVariable returns previous variable in
-       the global ordering (lower, topmore).
+\brief Function Biddy_Managed_SelectNode selects the top node of the given
+       function.
 
 ### Description
 ### Side effects
 ### More info
-    Macro Biddy_GetPrevVariable(v) is defined for use with anonymous manager.
+    Macro Biddy_SelectNode(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_GetPrevVariable(Biddy_Manager MNG, Biddy_Variable v)
+void
+Biddy_Managed_SelectNode(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1548,11 +1689,11 @@ Biddy_Managed_GetPrevVariable(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetPrevVariable: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_SelectNode: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetPrevVariable(MNG,v);
+  BiddyManagedSelectNode(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -1560,21 +1701,21 @@ Biddy_Managed_GetPrevVariable(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetNextVariable returns next variable in
-       the global ordering (higher, bottommore).
+\brief Function Biddy_Managed_DeselectNode deselects the top node of the given
+       function.
 
 ### Description
 ### Side effects
 ### More info
-    Macro Biddy_GetNextVariable(v) is defined for use with anonymous manager.
+    Macro Biddy_DeselectNode(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_GetNextVariable(Biddy_Manager MNG, Biddy_Variable v)
+void
+Biddy_Managed_DeselectNode(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1596,11 +1737,11 @@ Biddy_Managed_GetNextVariable(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetNextVariable: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_DeselectNode: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetNextVariable(MNG,v);
+  BiddyManagedDeselectNode(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -1608,20 +1749,21 @@ Biddy_Managed_GetNextVariable(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetVariableEdge returns variable's edge.
+\brief Function Biddy_Managed_IsSelected returns TRUE iff the top node of the
+       given function is selected.
 
 ### Description
 ### Side effects
 ### More info
-    Macro Biddy_GetVariableEdge(v) is defined for use with anonymous manager.
+    Macro Biddy_IsSelected(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_GetVariableEdge(Biddy_Manager MNG, Biddy_Variable v)
+Biddy_Boolean
+Biddy_Managed_IsSelected(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1643,11 +1785,11 @@ Biddy_Managed_GetVariableEdge(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetVariableEdge: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_IsSelected: Unsupported BDD type!\n");
+    return FALSE;
   }
 
-  return BiddyManagedGetVariableEdge(MNG,v);
+  return BiddyManagedIsSelected(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -1655,20 +1797,22 @@ Biddy_Managed_GetVariableEdge(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetElementEdge returns element's edge.
+\brief Function Biddy_Managed_SelectFunction recursively selects all nodes of a
+       given function.
 
 ### Description
 ### Side effects
+    Terminal node must be selected before starting this function!
 ### More info
-    Macro Biddy_GetElementEdge(v) is defined for use with anonymous manager.
+    Macro Biddy_SelectFunction(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_GetElementEdge(Biddy_Manager MNG, Biddy_Variable v)
+void
+Biddy_Managed_SelectFunction(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1690,11 +1834,11 @@ Biddy_Managed_GetElementEdge(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetElementEdge: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_SelectFunction: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetElementEdge(MNG,v);
+  BiddyManagedSelectFunction(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -1702,20 +1846,21 @@ Biddy_Managed_GetElementEdge(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetVariableName returns the name of a variable.
+\brief Function Biddy_Managed_DeselectAll deselects all nodes.
 
 ### Description
+    Deselect all nodes.
 ### Side effects
 ### More info
-    Macro Biddy_GetVariableName(v) is defined for use with anonymous manager.
+    Macro Biddy_DeselectAll() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_String
-Biddy_Managed_GetVariableName(Biddy_Manager MNG, Biddy_Variable v)
+void
+Biddy_Managed_DeselectAll(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1737,11 +1882,11 @@ Biddy_Managed_GetVariableName(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetVariableName: Unsupported BDD type!\n");
-    return NULL;
+    fprintf(stderr,"Biddy_Managed_DeselectAll: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetVariableName(MNG,v);
+  BiddyManagedDeselectAll(MNG);
 }
 
 #ifdef __cplusplus
@@ -1749,23 +1894,22 @@ Biddy_Managed_GetVariableName(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetTopVariableEdge returns variable's edge of
-       top variable.
+\brief Function Biddy_Managed_GetVariable returns variable with the given
+       name.
 
 ### Description
 ### Side effects
-    TO DO: For ZBDDs, element edge is sometimes preffered over variable edge.
+    If variable is not found function returns 0!
 ### More info
-    Macro Biddy_GetTopVariableEdge(f) is defined for use with anonymous
-    manager.
+    Macro Biddy_GetVariable(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_GetTopVariableEdge(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Variable
+Biddy_Managed_GetVariable(Biddy_Manager MNG, Biddy_String x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1787,11 +1931,11 @@ Biddy_Managed_GetTopVariableEdge(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetTopVariableEdge: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_GetVariable: Unsupported BDD type!\n");
+    return 0;
   }
 
-  return BiddyManagedGetTopVariableEdge(MNG,f);
+  return BiddyManagedGetVariable(MNG,x);
 }
 
 #ifdef __cplusplus
@@ -1799,21 +1943,22 @@ Biddy_Managed_GetTopVariableEdge(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetTopVariableName returns the name of top
-       variable.
+\brief Function Biddy_Managed_GetLowestVariable returns the lowest variable
+        in the current ordering.
 
 ### Description
+    The lowest variable is the tompost variable.
 ### Side effects
 ### More info
-    Macro Biddy_GetTopVariableName(f) is defined for use with anonymous manager.
+    Macro Biddy_GetLowestVariable(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_String
-Biddy_Managed_GetTopVariableName(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Variable
+Biddy_Managed_GetLowestVariable(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1835,11 +1980,11 @@ Biddy_Managed_GetTopVariableName(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetTopVariableName: Unsupported BDD type!\n");
-    return NULL;
+    fprintf(stderr,"Biddy_Managed_GetLowestVariable: Unsupported BDD type!\n");
+    return 0;
   }
 
-  return BiddyManagedGetTopVariableName(MNG,f);
+  return BiddyManagedGetLowestVariable(MNG);
 }
 
 #ifdef __cplusplus
@@ -1847,21 +1992,26 @@ Biddy_Managed_GetTopVariableName(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetTopVariableChar returns the first character in
-       the name of top variable.
+\brief Function Biddy_Managed_GetIthVariable returns ith variable
+        in the current global ordering.
 
 ### Description
+    The lowest (topmost) variable has global ordering 1.
+    The highest (bottommost) variable is '1' and has global ordering equal
+    to numUsedVariables.
 ### Side effects
+    If argument is 0, function returns 0.
+    If argument is larger than the number of variables, function returns 0.
 ### More info
-    Macro Biddy_GetTopVariableChar(f) is defined for use with anonymous manager.
+    Macro Biddy_GetIthVariable(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-char
-Biddy_Managed_GetTopVariableChar(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Variable
+Biddy_Managed_GetIthVariable(Biddy_Manager MNG, Biddy_Variable i)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1883,11 +2033,11 @@ Biddy_Managed_GetTopVariableChar(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetTopVariableChar: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_GetIthVariable: Unsupported BDD type!\n");
     return 0;
   }
 
-  return BiddyManagedGetTopVariableChar(MNG,f);
+  return BiddyManagedGetIthVariable(MNG,i);
 }
 
 #ifdef __cplusplus
@@ -1895,22 +2045,21 @@ Biddy_Managed_GetTopVariableChar(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_ResetVariablesValue sets all variable's value to
-       biddyZero.
+\brief Function Biddy_Managed_GetPrevVariable returns previous variable in
+       the global ordering (lower, topmore).
 
 ### Description
 ### Side effects
-    Only active (used) variables are reinitialized.
 ### More info
-    Macro Biddy_ResetVariablesValue() is defined for use with anonymous manager.
+    Macro Biddy_GetPrevVariable(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_ResetVariablesValue(Biddy_Manager MNG)
+Biddy_Variable
+Biddy_Managed_GetPrevVariable(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1932,11 +2081,11 @@ Biddy_Managed_ResetVariablesValue(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_ResetVariablesValue: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetPrevVariable: Unsupported BDD type!\n");
+    return 0;
   }
 
-  BiddyManagedResetVariablesValue(MNG);
+  return BiddyManagedGetPrevVariable(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -1944,21 +2093,21 @@ Biddy_Managed_ResetVariablesValue(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SetVariableValue sets variable's value.
+\brief Function Biddy_Managed_GetNextVariable returns next variable in
+       the global ordering (higher, bottommore).
 
 ### Description
 ### Side effects
-    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_SetVariableValue(v,f) is defined for use with anonymous manager.
+    Macro Biddy_GetNextVariable(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_SetVariableValue(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge f)
+Biddy_Variable
+Biddy_Managed_GetNextVariable(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -1980,11 +2129,11 @@ Biddy_Managed_SetVariableValue(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge f
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SetVariableValue: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetNextVariable: Unsupported BDD type!\n");
+    return 0;
   }
 
-  BiddyManagedSetVariableValue(MNG,v,f);
+  return BiddyManagedGetNextVariable(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -1992,13 +2141,12 @@ Biddy_Managed_SetVariableValue(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge f
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetVariableValue gets variable's value.
+\brief Function Biddy_Managed_GetVariableEdge returns variable's edge.
 
 ### Description
 ### Side effects
-    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_GetVariableValue(v) is defined for use with anonymous manager.
+    Macro Biddy_GetVariableEdge(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -2006,7 +2154,7 @@ extern "C" {
 #endif
 
 Biddy_Edge
-Biddy_Managed_GetVariableValue(Biddy_Manager MNG, Biddy_Variable v)
+Biddy_Managed_GetVariableEdge(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2028,11 +2176,11 @@ Biddy_Managed_GetVariableValue(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetVariableValue: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_GetVariableEdge: Unsupported BDD type!\n");
     return biddyNull;
   }
 
-  return BiddyManagedGetVariableValue(MNG,v);
+  return BiddyManagedGetVariableEdge(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -2040,22 +2188,20 @@ Biddy_Managed_GetVariableValue(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_ClearVariablesData free memory used for all
-        variable's data.
+\brief Function Biddy_Managed_GetElementEdge returns element's edge.
 
 ### Description
 ### Side effects
-    Only active (used) variables are considered.
 ### More info
-    Macro Biddy_ClearVariablesData() is defined for use with anonymous manager.
+    Macro Biddy_GetElementEdge(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_ClearVariablesData(Biddy_Manager MNG)
+Biddy_Edge
+Biddy_Managed_GetElementEdge(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2077,11 +2223,11 @@ Biddy_Managed_ClearVariablesData(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_ClearVariablesData: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetElementEdge: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  BiddyManagedClearVariablesData(MNG);
+  return BiddyManagedGetElementEdge(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -2089,21 +2235,20 @@ Biddy_Managed_ClearVariablesData(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SetVariableData sets variable's data.
+\brief Function Biddy_Managed_GetVariableName returns the name of a variable.
 
 ### Description
 ### Side effects
-    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_SetVariableData(v,x) is defined for use with anonymous manager.
+    Macro Biddy_GetVariableName(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_SetVariableData(Biddy_Manager MNG, Biddy_Variable v, void *x)
+Biddy_String
+Biddy_Managed_GetVariableName(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2125,11 +2270,11 @@ Biddy_Managed_SetVariableData(Biddy_Manager MNG, Biddy_Variable v, void *x)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SetVariableData: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetVariableName: Unsupported BDD type!\n");
+    return NULL;
   }
 
-  BiddyManagedSetVariableData(MNG,v,x);
+  return BiddyManagedGetVariableName(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -2137,21 +2282,23 @@ Biddy_Managed_SetVariableData(Biddy_Manager MNG, Biddy_Variable v, void *x)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetVariableData gets variable's data.
+\brief Function Biddy_Managed_GetTopVariableEdge returns variable's edge of
+       top variable.
 
 ### Description
 ### Side effects
-    It is not checked that the given variable is valid.
+    TO DO: For ZBDDs, element edge is sometimes preffered over variable edge.
 ### More info
-    Macro Biddy_GetVariableData(v) is defined for use with anonymous manager.
+    Macro Biddy_GetTopVariableEdge(f) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void *
-Biddy_Managed_GetVariableData(Biddy_Manager MNG, Biddy_Variable v)
+Biddy_Edge
+Biddy_Managed_GetTopVariableEdge(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2173,11 +2320,11 @@ Biddy_Managed_GetVariableData(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetVariableData: Unsupported BDD type!\n");
-    return NULL;
+    fprintf(stderr,"Biddy_Managed_GetTopVariableEdge: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedGetVariableData(MNG,v);
+  return BiddyManagedGetTopVariableEdge(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -2185,24 +2332,21 @@ Biddy_Managed_GetVariableData(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_Eval returns the value of a Boolean function
-       for a given variable assignment.
+\brief Function Biddy_Managed_GetTopVariableName returns the name of top
+       variable.
 
 ### Description
 ### Side effects
-    Variables must have values assigned. Variable is considered to be
-    FALSE iff variable.value == biddyZero, otherwise it is considered
-    to be TRUE.
 ### More info
-    Macro Biddy_Eval(f) is defined for use with anonymous manager.
+    Macro Biddy_GetTopVariableName(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_Eval(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_String
+Biddy_Managed_GetTopVariableName(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2224,11 +2368,11 @@ Biddy_Managed_Eval(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_Eval: Unsupported BDD type!\n");
-    return FALSE;
+    fprintf(stderr,"Biddy_Managed_GetTopVariableName: Unsupported BDD type!\n");
+    return NULL;
   }
 
-  return BiddyManagedEval(MNG,f);
+  return BiddyManagedGetTopVariableName(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -2236,24 +2380,21 @@ Biddy_Managed_Eval(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_EvalProbability evaluates BDD.
+\brief Function Biddy_Managed_GetTopVariableChar returns the first character in
+       the name of top variable.
 
 ### Description
-    Each variable should be associated with a probability q (0-1) via
-    data element in BiddyVariable. For each 1-path a product of variable's
-    probability is calculated (q for 'then' successor and (1-q) for 'else'
-    successor). The result of the function is the sum of all such products.
 ### Side effects
 ### More info
-    Macro Biddy_EvalProbability(f) is defined for use with anonymous manager.
+    Macro Biddy_GetTopVariableChar(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-double
-Biddy_Managed_EvalProbability(Biddy_Manager MNG, Biddy_Edge f)
+char
+Biddy_Managed_GetTopVariableChar(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2275,11 +2416,11 @@ Biddy_Managed_EvalProbability(Biddy_Manager MNG, Biddy_Edge f)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_EvalProbability: Unsupported BDD type!\n");
-    return 0.0;
+    fprintf(stderr,"Biddy_Managed_GetTopVariableChar: Unsupported BDD type!\n");
+    return 0;
   }
 
-  return BiddyManagedEvalProbability(MNG,f);
+  return BiddyManagedGetTopVariableChar(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -2287,49 +2428,22 @@ Biddy_Managed_EvalProbability(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_FoaVariable finds variable/element or adds
-       new variable (i.e. Boolean function f = x) and new element (i.e. it
-       creates set {{x}}).
-
+\brief Function Biddy_Managed_ResetVariablesValue sets all variable's value to
+       biddyZero.
+
 ### Description
-    If variable/element already exists, function returns the existing one.
-    If x == NULL then numbered variable/element is added. Numbered
-    variables/elements have only digits in its name. The current number of
-    numbered variables/elements is stored in numnum. If numbered
-    variable/element is requested then function increments numnum and creates
-    a new (non-existing) variable/element.
-    Parameter varelem is used to determine how to adapt the existing BDD base
-    to keep the current formula valid (use varelem = TRUE if formulae represent
-    Boolean functions and varelem = FALSE if they represent combination sets).
-    The ordering of the new variable/element is determined in Biddy_InitMNG.
-    Function always returns variable.
 ### Side effects
-    This function calls BiddyManagedFoaVariable with complete = TRUE.
-    Use Biddy_Managed_AddVariableByName or Biddy_Managed_AddElementByName if
-    you want to use more efficient variant with complete = FALSE (you can use
-    x = NULL despite the name of these functions).
-    Adding new variable/element may change the meaning of the existing BDDs.
-    The meaning of variables and elements is always automatically repaired.
-    The meaning of formulae are repaired with regards to the parameter varelem.
-    BDDs without external references are not repaired.
-    For OBDDs, OFDDs, TZBDDS, and TZFDDs, it is safe to add new variables
-    without repairing if BDDs are used to represent Boolean functions.
-    For ZBDDs and ZFDDs, it is safe to add new elements without
-    repairing if BDDs are used to represent combination sets.
-    User should not add numbered variables/elements with some other function.
-    TO DO: Formulae in user's formula tables are not repaired, yet!
-    TO DO: Variables cannot be deleted, yet!
+    Only active (used) variables are reinitialized.
 ### More info
-    Macro Biddy_FoaVariable(x) is defined for use with anonymous manager.
+    Macro Biddy_ResetVariablesValue() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_FoaVariable(Biddy_Manager MNG, Biddy_String x,
-                          Biddy_Boolean varelem)
+void
+Biddy_Managed_ResetVariablesValue(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2351,11 +2465,11 @@ Biddy_Managed_FoaVariable(Biddy_Manager MNG, Biddy_String x,
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_FoaVariable: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_ResetVariablesValue: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedFoaVariable(MNG,x,varelem,TRUE);
+  BiddyManagedResetVariablesValue(MNG);
 }
 
 #ifdef __cplusplus
@@ -2363,16 +2477,13 @@ Biddy_Managed_FoaVariable(Biddy_Manager MNG, Biddy_String x,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_ChangeVariableName set new name to the given
-        variable/element.
+\brief Function Biddy_Managed_SetVariableValue sets variable's value.
 
 ### Description
 ### Side effects
-    The variable with (name == x) should not already exist.
-    The ordering of the variable is not changed.
+    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_ChangeVariableName(v,x) is defined for use with anonymous
-    manager.
+    Macro Biddy_SetVariableValue(v,f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -2380,7 +2491,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_ChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_String x)
+Biddy_Managed_SetVariableValue(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2402,11 +2513,11 @@ Biddy_Managed_ChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_Stri
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_ChangeVariableName: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_SetVariableValue: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedChangeVariableName(MNG,v,x);
+  BiddyManagedSetVariableValue(MNG,v,f);
 }
 
 #ifdef __cplusplus
@@ -2414,26 +2525,21 @@ Biddy_Managed_ChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_Stri
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddVariableByName adds variable.
+\brief Function Biddy_Managed_GetVariableValue gets variable's value.
 
 ### Description
-    Biddy_Managed_AddVariableByName adds variable. Function returns variable
-    edge. If variable already exists, function returns the existing variable
-    edge. Element is not created.
 ### Side effects
-    See Biddy_Managed_FoaVariable.
+    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_AddVariableByName(x) is defined for use with anonymous manager.
-    Macros Biddy_Managed_AddVariable(MNG) and Biddy_AddVariable() are defined
-    for creating numbered variables.
+    Macro Biddy_GetVariableValue(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_AddVariableByName(Biddy_Manager MNG, Biddy_String x)
+Biddy_Edge
+Biddy_Managed_GetVariableValue(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2455,11 +2561,11 @@ Biddy_Managed_AddVariableByName(Biddy_Manager MNG, Biddy_String x)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddVariableByName: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_GetVariableValue: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedAddVariableByName(MNG,x);
+  return BiddyManagedGetVariableValue(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -2467,26 +2573,22 @@ Biddy_Managed_AddVariableByName(Biddy_Manager MNG, Biddy_String x)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddElementByName adds element.
+\brief Function Biddy_Managed_ClearVariablesData free memory used for all
+        variable's data.
 
 ### Description
-    Biddy_Managed_AddElementByName adds element. Function returns element edge.
-    If element already exists, function returns the existing element edge.
-    Variable is not created.
 ### Side effects
-    See Biddy_Managed_FoaVariable.
+    Only active (used) variables are considered.
 ### More info
-    Macro Biddy_AddElementByName(x) is defined for use with anonymous manager.
-    Macros Biddy_Managed_AddElement(MNG) and Biddy_AddElement() are defined for
-    creating numbered elements.
+    Macro Biddy_ClearVariablesData() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_AddElementByName(Biddy_Manager MNG, Biddy_String x)
+void
+Biddy_Managed_ClearVariablesData(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2508,11 +2610,11 @@ Biddy_Managed_AddElementByName(Biddy_Manager MNG, Biddy_String x)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddElementByName: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_ClearVariablesData: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedAddElementByName(MNG,x);
+  BiddyManagedClearVariablesData(MNG);
 }
 
 #ifdef __cplusplus
@@ -2520,24 +2622,21 @@ Biddy_Managed_AddElementByName(Biddy_Manager MNG, Biddy_String x)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddVariableBelow adds variable.
+\brief Function Biddy_Managed_SetVariableData sets variable's data.
 
 ### Description
-    Biddy_Managed_AddVariableBelow creates new numbered variable. Then, the
-    order of the new variable is changed to become immediately below the given
-    variable (below = next = bottommore in BDD).
-    Function does not create element and it returns variable edge.
 ### Side effects
+    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_AddVariableBelow(v) is defined for use with anonymous manager.
+    Macro Biddy_SetVariableData(v,x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_AddVariableBelow(Biddy_Manager MNG, Biddy_Variable v)
+void
+Biddy_Managed_SetVariableData(Biddy_Manager MNG, Biddy_Variable v, void *x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2559,11 +2658,11 @@ Biddy_Managed_AddVariableBelow(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddVariableBelow: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_SetVariableData: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedAddVariableBelow(MNG,v);
+  BiddyManagedSetVariableData(MNG,v,x);
 }
 
 #ifdef __cplusplus
@@ -2571,24 +2670,21 @@ Biddy_Managed_AddVariableBelow(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddVariableAbove adds variable.
+\brief Function Biddy_Managed_GetVariableData gets variable's data.
 
 ### Description
-    Biddy_Managed_AddVariableBelow creates new numbered variable. Then, the
-    order of the new variable is changed to become immediately above the given
-    variable (above = previous = topmore in BDD)
-    Function does not create element and it returns variable edge.
 ### Side effects
+    It is not checked that the given variable is valid.
 ### More info
-    Macro Biddy_AddVariableAbove(v) is defined for use with anonymous manager.
+    Macro Biddy_GetVariableData(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_AddVariableAbove(Biddy_Manager MNG, Biddy_Variable v)
+void *
+Biddy_Managed_GetVariableData(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2610,11 +2706,11 @@ Biddy_Managed_AddVariableAbove(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddVariableAbove: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_GetVariableData: Unsupported BDD type!\n");
+    return NULL;
   }
 
-  return BiddyManagedAddVariableAbove(MNG,v);
+  return BiddyManagedGetVariableData(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -2622,23 +2718,24 @@ Biddy_Managed_AddVariableAbove(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_IncTag returns edge with an incremented tag.
+\brief Function Biddy_Managed_Eval returns the value of a Boolean function
+       for a given variable assignment.
 
 ### Description
-    Used for TZBDDs and TZFDDs, only.
 ### Side effects
-    It is not checked, that the resulting tag is not greater than top variable.
-    Function may return non-fresh node even if f is fresh.
+    Variables must have values assigned. Variable is considered to be
+    FALSE iff variable.value == biddyZero, otherwise it is considered
+    to be TRUE.
 ### More info
-    Macro Biddy_IncTag() is defined for use with anonymous manager.
+    Macro Biddy_Eval(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_IncTag(Biddy_Manager MNG, Biddy_Edge f)
+Biddy_Boolean
+Biddy_Managed_Eval(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2658,18 +2755,13 @@ Biddy_Managed_IncTag(Biddy_Manager MNG, Biddy_Edge f)
   else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType == BIDDYTYPETZBDDC) {
-    /* NOT IMPLEMENTED, YET */
-    fprintf(stderr,"Biddy_Managed_IncTag: this BDD type is not supported, yet!\n");
-    return biddyNull;
-  }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_IncTag: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_Eval: Unsupported BDD type!\n");
+    return FALSE;
   }
 
-  return BiddyManagedIncTag(MNG,f);
+  return BiddyManagedEval(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -2677,85 +2769,50 @@ Biddy_Managed_IncTag(Biddy_Manager MNG, Biddy_Edge f)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_TaggedFoaNode finds or adds new node with the
-       given variable and successors.
+\brief Function Biddy_Managed_EvalProbability evaluates BDD.
 
 ### Description
-    If such node already exists, function returns it and does not create the
-    new one.  For OBDDs, ZBDDs, OFDDs, and ZFDDs, the returned edge is not
-    tagged (i.e. tag == 0). For TZBDDs and TZFDDs, the returned edge is
-    tagged with the given ptag. There are two special cases:
-    1. If (pf == pt == NULL) then new variable (for OBDDs, OFDDs, TZBDDs,
-    and TZFDDs) or new element (for ZBDDs and ZFDDs) is created.
-    2. (If ptag == 0) then the reduction rule and the normalization of
-    complemented edges is not used and the node is added exactly as
-    specified (be careful, this may create a wrong node!).
+    Each variable should be associated with a probability q (0-1) via
+    data element in BiddyVariable. For each 1-path a product of variable's
+    probability is calculated (q for 'then' successor and (1-q) for 'else'
+    successor). The result of the function is the sum of all such products.
 ### Side effects
-    This function should not be called directly to add new variables and
-    elements, you must use Biddy_Managed_FoaVariable,
-    Biddy_Managed_AddVariableByName, or Biddy_Managed_AddElementByName.
-    Using Biddy_Managed_TaggedFoaNode you can create node with an arbitrary
-    ordering. It is much more safe to use Boolean operators, e.g.
-    Biddy_Managed_ITE.
 ### More info
-    Macro Biddy_Managed_FoaNode(MNG,v,pf,pt,garbageAllowed) is defined for
-    use without tags.
-    Macros Biddy_TaggedFoaNode(v,pf,pt,tag,garbageAllowed) and
-    Biddy_FoaNode(v,pf,pt,garbageAllowed) are defined for use with
-    anonymous manager.
+    Macro Biddy_EvalProbability(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_TaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
-                            Biddy_Edge pt, Biddy_Variable ptag,
-                            Biddy_Boolean garbageAllowed)
+double
+Biddy_Managed_EvalProbability(Biddy_Manager MNG, Biddy_Edge f)
 {
-  Biddy_Edge r;
-
   if (!MNG) MNG = biddyAnonymousManager;
 
-  assert( (pf == NULL) || (BiddyIsOK(pf) == TRUE) );
-  assert( (pt == NULL) || (BiddyIsOK(pt) == TRUE) );
-
-  r = biddyNull;
-
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
-    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
-  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+  }
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
-    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
-    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
   }
 #ifndef COMPACT
   else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
-    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
-  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+  }
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
-    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
-    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
-  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
-    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
-    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
-  } else if (biddyManagerType == BIDDYTYPETZBDDC) {
-    fprintf(stderr,"Biddy_Managed_TaggedFoaNode: this BDD type is not supported, yet!\n");
-    return biddyNull;
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_TaggedFoaNode: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_EvalProbability: Unsupported BDD type!\n");
+    return 0.0;
   }
 
-  return r;
+  return BiddyManagedEvalProbability(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -2763,52 +2820,51 @@ Biddy_Managed_TaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GC performs garbage collection.
+\brief Function Biddy_Managed_FoaVariable finds variable/element or adds
+       new variable (i.e. Boolean function f = x) and new element (i.e. it
+       creates set {{x}}).
 
 ### Description
-    All obsolete nodes are deleted.
-    Parameter purge should not be true during automatic garbage collection.
-    Iff parameter purge is true then all formulae without name are deleted.
-    Iff parameter purge is true then all nodes which are not part of
-    non-obsolete non-deleted formulae are removed even if they are fresh or
-    fortified.
-    If parameter total is true than all unnecessary nodes are immediately
-    deleted, otherwise they are deleted only when there are enough of them.
-    If (targetLT != 0) then node table resizing is disabled.
-    If (targetLT != 0) then there should not exist obsolete formulae.
-    If (targetLT != 0) then there should not exist obsolete nodes which are not
-    part of any non-obsolete non-deleted formulae.
-    If (targetLT != 0) then there should not exist obsolete nodes with variable
-    equal or higher (bottom-more) than target and smaller (top-more) than
-    targetGEQ.
-### Side effects
-    The first element of each chain in a node table should have a special value
-    for its 'prev' element to allow tricky but efficient deleting. Moreover,
-    'prev' and 'next' should be the first and the second element in the
-    structure BiddyNode, respectively. Garbage collecion is reported by
-    biddyNodeTable.garbage only if some bad nodes are purged!
-    Parameters targetLT and targetGEQ are used during sifting, only,
-    in all other cases 0 is used.
+    If variable/element already exists, function returns the existing one.
+    If x == NULL then numbered variable/element is added. Numbered
+    variables/elements have only digits in its name. The current number of
+    numbered variables/elements is stored in numnum. If numbered
+    variable/element is requested then function increments numnum and creates
+    a new (non-existing) variable/element.
+    Parameter varelem is used to determine how to adapt the existing BDD base
+    to keep the current formula valid (use varelem = TRUE if formulae represent
+    Boolean functions and varelem = FALSE if they represent combination sets).
+    The ordering of the new variable/element is determined in Biddy_InitMNG.
+    Function always returns variable.
+### Side effects
+    This function calls BiddyManagedFoaVariable with complete = TRUE.
+    Use Biddy_Managed_AddVariableByName or Biddy_Managed_AddElementByName if
+    you want to use more efficient variant with complete = FALSE (you can use
+    x = NULL despite the name of these functions).
+    Adding new variable/element may change the meaning of the existing BDDs.
+    The meaning of variables and elements is always automatically repaired.
+    The meaning of formulae are repaired with regards to the parameter varelem.
+    BDDs without external references are not repaired.
+    For OBDDs, OFDDs, TZBDDS, and TZFDDs, it is safe to add new variables
+    without repairing if BDDs are used to represent Boolean functions.
+    For ZBDDs and ZFDDs, it is safe to add new elements without
+    repairing if BDDs are used to represent combination sets.
+    User should not add numbered variables/elements with some other function.
+    TO DO: Formulae in user's formula tables are not repaired, yet!
+    TO DO: Variables cannot be deleted, yet!
 ### More info
-    Macro Biddy_GC(targetLT,targetGEQ,purge,total) is defined for use with
-    anonymous manager.
-    Macros Biddy_Managed_AutoGC(MNG) and Biddy_AutoGC() are useful variants
-    with targetLT = targetGEQ = 0, purge = FALSE, and total = FALSE.
-    Macros Biddy_Managed_ForceGC(MNG) and Biddy_ForceGC() are useful variants
-    with targetLT = targetGEQ = 0, purge = FALSE, and total = TRUE.
+    Macro Biddy_FoaVariable(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_GC(Biddy_Manager MNG, Biddy_Variable targetLT,
-                 Biddy_Variable targetGEQ, Biddy_Boolean purge,
-                 Biddy_Boolean total)
+Biddy_Variable
+Biddy_Managed_FoaVariable(Biddy_Manager MNG, Biddy_String x,
+                          Biddy_Boolean varelem)
 {
   if (!MNG) MNG = biddyAnonymousManager;
-  ZF_LOGI("Biddy_GC");
 
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
@@ -2828,11 +2884,11 @@ Biddy_Managed_GC(Biddy_Manager MNG, Biddy_Variable targetLT,
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GC: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_FoaVariable: Unsupported BDD type!\n");
+    return 0;
   }
 
-  BiddyManagedGC(MNG,targetLT,targetGEQ,purge,total);
+  return BiddyManagedFoaVariable(MNG,x,varelem,TRUE);
 }
 
 #ifdef __cplusplus
@@ -2840,17 +2896,16 @@ Biddy_Managed_GC(Biddy_Manager MNG, Biddy_Variable targetLT,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_Clean performs cleaning.
+\brief Function Biddy_Managed_ChangeVariableName set new name to the given
+        variable/element.
 
 ### Description
-    Discard all nodes which are not preserved or which are not preserved
-    anymore. Obsolete nodes are not immediately removed, they will be removed
-    during the first garbage collection.
 ### Side effects
-    Field deleted is not considered and thus no fortified node and no
-    prolonged node is discarded.
+    The variable with (name == x) should not already exist.
+    The ordering of the variable is not changed.
 ### More info
-    Macro Biddy_Clean() is defined for use with anonymous manager.
+    Macro Biddy_ChangeVariableName(v,x) is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -2858,7 +2913,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_Clean(Biddy_Manager MNG)
+Biddy_Managed_ChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_String x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2880,11 +2935,11 @@ Biddy_Managed_Clean(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_Clean: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_ChangeVariableName: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedClean(MNG);
+  BiddyManagedChangeVariableName(MNG,v,x);
 }
 
 #ifdef __cplusplus
@@ -2892,29 +2947,26 @@ Biddy_Managed_Clean(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_Purge immediately removes all nodes which were
-       not preserved or which are not preserved anymore.
+\brief Function Biddy_Managed_AddVariableByName adds variable.
 
 ### Description
-    All formulae without name are deleted.
-    All deleted formulae (including prolonged/fortified formulae) are removed.
-    All fresh and obsolete nodes are immediatelly removed.
-    Moreover, all prolonged and fortified nodes are immediatelly removed if
-    they are not needed by some of the remaining formula.
-    Call to Biddy_Purge does not count as clearing and thus all preserved
-    formulae remains preserved for the same number of clearings.
+    Biddy_Managed_AddVariableByName adds variable. Function returns variable
+    edge. If variable already exists, function returns the existing variable
+    edge. Element is not created.
 ### Side effects
-    Removes all fresh nodes!
+    See Biddy_Managed_FoaVariable.
 ### More info
-    Macro Biddy_Purge(f) is defined for use with anonymous manager.
+    Macro Biddy_AddVariableByName(x) is defined for use with anonymous manager.
+    Macros Biddy_Managed_AddVariable(MNG) and Biddy_AddVariable() are defined
+    for creating numbered variables.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_Purge(Biddy_Manager MNG)
+Biddy_Variable
+Biddy_Managed_AddVariableByName(Biddy_Manager MNG, Biddy_String x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2936,11 +2988,11 @@ Biddy_Managed_Purge(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_Purge: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_AddVariableByName: Unsupported BDD type!\n");
+    return 0;
   }
 
-  BiddyManagedPurge(MNG);
+  return BiddyManagedAddVariableByName(MNG,x);
 }
 
 #ifdef __cplusplus
@@ -2948,30 +3000,26 @@ Biddy_Managed_Purge(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_PurgeAndReorder immediately removes non-preserved
-       nodes and triggers reordering on function.
+\brief Function Biddy_Managed_AddElementByName adds element.
 
 ### Description
-    All obsolete nodes are immediatelly removed. Moreover, nodes from deleted
-    prolonged formulae and nodes from deleted fortified formulae are removed
-    if they are not needed by other formulae.
-    If BDD is given (f != NULL), reordering on function is used.
-    Otherwise (f == NULL) global reordering is used.
-    Call to Biddy_PurgeAndReorder does not count as clearing and thus all
-    preserved formulae remains preserved for the same number of clearings.
+    Biddy_Managed_AddElementByName adds element. Function returns element edge.
+    If element already exists, function returns the existing element edge.
+    Variable is not created.
 ### Side effects
-    Removes all fresh nodes.
+    See Biddy_Managed_FoaVariable.
 ### More info
-    Macro Biddy_PurgeAndReorder(f) is defined for use with anonymous manager.
+    Macro Biddy_AddElementByName(x) is defined for use with anonymous manager.
+    Macros Biddy_Managed_AddElement(MNG) and Biddy_AddElement() are defined for
+    creating numbered elements.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_PurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f,
-                              Biddy_Boolean converge)
+Biddy_Variable
+Biddy_Managed_AddElementByName(Biddy_Manager MNG, Biddy_String x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -2993,11 +3041,11 @@ Biddy_Managed_PurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f,
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_PurgeAndReorder: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_AddElementByName: Unsupported BDD type!\n");
+    return 0;
   }
 
-  BiddyManagedPurgeAndReorder(MNG,f,converge);
+  return BiddyManagedAddElementByName(MNG,x);
 }
 
 #ifdef __cplusplus
@@ -3005,21 +3053,24 @@ Biddy_Managed_PurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddCache adds cache to the end of Cache list.
+\brief Function Biddy_Managed_AddVariableBelow adds variable.
 
 ### Description
-    If Cache list does not exist, function creates it.
+    Biddy_Managed_AddVariableBelow creates new numbered variable. Then, the
+    order of the new variable is changed to become immediately below the given
+    variable (below = next = bottommore in BDD).
+    Function does not create element and it returns variable edge.
 ### Side effects
 ### More info
-    Macro Biddy_AddCache(gc) is defined for use with anonymous manager.
+    Macro Biddy_AddVariableBelow(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_AddCache(Biddy_Manager MNG, Biddy_GCFunction gc)
+Biddy_Edge
+Biddy_Managed_AddVariableBelow(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3041,11 +3092,11 @@ Biddy_Managed_AddCache(Biddy_Manager MNG, Biddy_GCFunction gc)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddCache: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_AddVariableBelow: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  BiddyManagedAddCache(MNG,gc);
+  return BiddyManagedAddVariableBelow(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -3053,46 +3104,24 @@ Biddy_Managed_AddCache(Biddy_Manager MNG, Biddy_GCFunction gc)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_AddFormula adds formula to Formula table.
+\brief Function Biddy_Managed_AddVariableAbove adds variable.
 
 ### Description
-    Given BDD becomes a formula. If (x != NULL) then formula is accessible by
-    its name. If (x != NULL) then index of the formula in the Formulae Table
-    is returned, otherwise function returns 0.
-    Nodes of the given BDD will be preserved for the given number of clearings.
-    If (c == -1) then formula is refreshed but not preserved.
-    If (c == 0) then formula is persistently preserved.
-    You have to use Biddy_DeleteFormula and Biddy_Purge to remove nodes
-    of persistently preserved formulae.
-    There are five macros defined to simplify formulae management:
-    Biddy_Managed_AddTmpFormula(mng,name,bdd)
-      := Biddy_Managed_AddFormula(mng,name,bdd,-1)
-    Biddy_Managed_AddPersistentFormula(mng,name,bdd)
-      := Biddy_Managed_AddFormula(mng,name,bdd,0)
-    Biddy_Managed_KeepFormula(mng,bdd)
-      := Biddy_Managed_AddFormula(mng,NULL,bdd,1)
-    Biddy_Managed_KeepFormulaProlonged(mng,bdd,c)
-      := Biddy_Managed_AddFormula(mng,NULL,bdd,c)
-    Biddy_Managed_KeepFormulaUntilPurge(mng,bdd)
-      := Biddy_Managed_AddFormula(mng,NULL,bdd,0)
+    Biddy_Managed_AddVariableBelow creates new numbered variable. Then, the
+    order of the new variable is changed to become immediately above the given
+    variable (above = previous = topmore in BDD)
+    Function does not create element and it returns variable edge.
 ### Side effects
-    Function is prolonged or fortified. Formulae with name are ordered by name.
-    If formula with the same name already exists, it will be overwritten -
-    preserved (i.e. not obsolete and not fresh) and persistently preserved
-    formulae will be deleted at the original index and recreated at new index!
 ### More info
-    Macros Biddy_AddFormula(x,f,c), Biddy_AddTmpFormula(x,f),
-    Biddy_AddPersistentFormula(x,f),  Biddy_KeepFormula(f),
-    Biddy_KeepFormulaProlonged(f,c), and Biddy_KeepFormulaUntilPurge(f)
-    are defined for use with anonymous manager.
+    Macro Biddy_AddVariableAbove(v) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-unsigned int
-Biddy_Managed_AddFormula(Biddy_Manager MNG, Biddy_String x, Biddy_Edge f, int c)
+Biddy_Edge
+Biddy_Managed_AddVariableAbove(Biddy_Manager MNG, Biddy_Variable v)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3114,11 +3143,11 @@ Biddy_Managed_AddFormula(Biddy_Manager MNG, Biddy_String x, Biddy_Edge f, int c)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_AddFormula: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_AddVariableAbove: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedAddFormula(MNG,x,f,c);
+  return BiddyManagedAddVariableAbove(MNG,v);
 }
 
 #ifdef __cplusplus
@@ -3126,25 +3155,23 @@ Biddy_Managed_AddFormula(Biddy_Manager MNG, Biddy_String x, Biddy_Edge f, int c)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_FindFormula find formula in Formula table.
+\brief Function Biddy_Managed_IncTag returns edge with an incremented tag.
 
 ### Description
-    Return TRUE/FALSE, index, and the formula.
-    If formula is constant or variable then idx = 0 and f != biddyNull.
-    If formula is not found then idx is a position where the formulae should
-    exist and f == biddyNull.
+    Used for TZBDDs and TZFDDs, only.
 ### Side effects
+    It is not checked, that the resulting tag is not greater than top variable.
+    Function may return non-fresh node even if f is fresh.
 ### More info
-    Macro Biddy_FindFormula(x,f) is defined for use with anonymous manager.
+    Macro Biddy_IncTag() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_FindFormula(Biddy_Manager MNG, Biddy_String x,
-                          unsigned int *idx, Biddy_Edge *f)
+Biddy_Edge
+Biddy_Managed_IncTag(Biddy_Manager MNG, Biddy_Edge f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3164,13 +3191,18 @@ Biddy_Managed_FindFormula(Biddy_Manager MNG, Biddy_String x,
   else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
+  else if (biddyManagerType == BIDDYTYPETZBDDC) {
+    /* NOT IMPLEMENTED, YET */
+    fprintf(stderr,"Biddy_Managed_IncTag: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_FindFormula: Unsupported BDD type!\n");
-    return FALSE;
+    fprintf(stderr,"Biddy_Managed_IncTag: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedFindFormula(MNG,x,idx,f);
+  return BiddyManagedIncTag(MNG,f);
 }
 
 #ifdef __cplusplus
@@ -3178,51 +3210,85 @@ Biddy_Managed_FindFormula(Biddy_Manager MNG, Biddy_String x,
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_DeleteFormula delete formula from Formula table.
+\brief Function Biddy_Managed_TaggedFoaNode finds or adds new node with the
+       given variable and successors.
 
 ### Description
-    Formula is labelled but not immediately removed.
-    Nodes of the given formula are not immediately removed.
-    Nodes of the given formula remains fresh or preserved.
+    If such node already exists, function returns it and does not create the
+    new one.  For OBDDs, ZBDDs, OFDDs, and ZFDDs, the returned edge is not
+    tagged (i.e. tag == 0). For TZBDDs and TZFDDs, the returned edge is
+    tagged with the given ptag. There are two special cases:
+    1. If (pf == pt == NULL) then new variable (for OBDDs, OFDDs, TZBDDs,
+    and TZFDDs) or new element (for ZBDDs and ZFDDs) is created.
+    2. (If ptag == 0) then the reduction rule and the normalization of
+    complemented edges is not used and the node is added exactly as
+    specified (be careful, this may create a wrong node!).
 ### Side effects
-    Formula is not accessible by its name anymore.
-    Formulae representing constants and variables will not be deleted.
+    This function should not be called directly to add new variables and
+    elements, you must use Biddy_Managed_FoaVariable,
+    Biddy_Managed_AddVariableByName, or Biddy_Managed_AddElementByName.
+    Using Biddy_Managed_TaggedFoaNode you can create node with an arbitrary
+    ordering. It is much more safe to use Boolean operators, e.g.
+    Biddy_Managed_ITE.
 ### More info
-    Macro Biddy_DeleteFormula(x) is defined for use with anonymous manager.
+    Macro Biddy_Managed_FoaNode(MNG,v,pf,pt,garbageAllowed) is defined for
+    use without tags.
+    Macros Biddy_TaggedFoaNode(v,pf,pt,tag,garbageAllowed) and
+    Biddy_FoaNode(v,pf,pt,garbageAllowed) are defined for use with
+    anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_DeleteFormula(Biddy_Manager MNG, Biddy_String x)
+Biddy_Edge
+Biddy_Managed_TaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
+                            Biddy_Edge pt, Biddy_Variable ptag,
+                            Biddy_Boolean garbageAllowed)
 {
+  Biddy_Edge r;
+
   if (!MNG) MNG = biddyAnonymousManager;
 
+  assert( (pf == NULL) || (BiddyIsOK(pf) == TRUE) );
+  assert( (pt == NULL) || (BiddyIsOK(pt) == TRUE) );
+
+  r = biddyNull;
+
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
-  }
-  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
+    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
+    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
+    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
   }
 #ifndef COMPACT
   else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
-  }
-  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
+    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
+    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
+    r = BiddyManagedTaggedFoaNode(MNG,v,pf,pt,ptag,garbageAllowed);
+    BiddyRefresh(r); /* BiddyManagedTaggedFoaNode returns an obsolete node! */
+  } else if (biddyManagerType == BIDDYTYPETZBDDC) {
+    fprintf(stderr,"Biddy_Managed_TaggedFoaNode: this BDD type is not supported, yet!\n");
+    return biddyNull;
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_DeleteFormula: Unsupported BDD type!\n");
-    return FALSE;
+    fprintf(stderr,"Biddy_Managed_TaggedFoaNode: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  return BiddyManagedDeleteFormula(MNG,x);
+  return r;
 }
 
 #ifdef __cplusplus
@@ -3230,28 +3296,52 @@ Biddy_Managed_DeleteFormula(Biddy_Manager MNG, Biddy_String x)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_DeleteIthFormula deletes formula from the table.
+\brief Function Biddy_Managed_GC performs garbage collection.
 
 ### Description
-    Formula is labelled but not immediately removed.
-    Nodes of the given formula are not immediately removed.
-    Nodes of the given formula remains fresh or preserved.
+    All obsolete nodes are deleted.
+    Parameter purge should not be true during automatic garbage collection.
+    Iff parameter purge is true then all formulae without name are deleted.
+    Iff parameter purge is true then all nodes which are not part of
+    non-obsolete non-deleted formulae are removed even if they are fresh or
+    fortified.
+    If parameter total is true than all unnecessary nodes are immediately
+    deleted, otherwise they are deleted only when there are enough of them.
+    If (targetLT != 0) then node table resizing is disabled.
+    If (targetLT != 0) then there should not exist obsolete formulae.
+    If (targetLT != 0) then there should not exist obsolete nodes which are not
+    part of any non-obsolete non-deleted formulae.
+    If (targetLT != 0) then there should not exist obsolete nodes with variable
+    equal or higher (bottom-more) than target and smaller (top-more) than
+    targetGEQ.
 ### Side effects
-    Formula is not accessible by its name anymore.
-    The first two formulae ("0" and "1") will not be deleted.
-    Formulae representing variables will not be deleted.
+    The first element of each chain in a node table should have a special value
+    for its 'prev' element to allow tricky but efficient deleting. Moreover,
+    'prev' and 'next' should be the first and the second element in the
+    structure BiddyNode, respectively. Garbage collecion is reported by
+    biddyNodeTable.garbage only if some bad nodes are purged!
+    Parameters targetLT and targetGEQ are used during sifting, only,
+    in all other cases 0 is used.
 ### More info
-    Macro Biddy_DeleteIthFormula(x) is defined for use with anonymous manager.
+    Macro Biddy_GC(targetLT,targetGEQ,purge,total) is defined for use with
+    anonymous manager.
+    Macros Biddy_Managed_AutoGC(MNG) and Biddy_AutoGC() are useful variants
+    with targetLT = targetGEQ = 0, purge = FALSE, and total = FALSE.
+    Macros Biddy_Managed_ForceGC(MNG) and Biddy_ForceGC() are useful variants
+    with targetLT = targetGEQ = 0, purge = FALSE, and total = TRUE.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Boolean
-Biddy_Managed_DeleteIthFormula(Biddy_Manager MNG, unsigned int i)
+void
+Biddy_Managed_GC(Biddy_Manager MNG, Biddy_Variable targetLT,
+                 Biddy_Variable targetGEQ, Biddy_Boolean purge,
+                 Biddy_Boolean total)
 {
   if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_GC");
 
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
@@ -3271,11 +3361,11 @@ Biddy_Managed_DeleteIthFormula(Biddy_Manager MNG, unsigned int i)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_DeleteIthFormula: Unsupported BDD type!\n");
-    return FALSE;
+    fprintf(stderr,"Biddy_Managed_GC: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedDeleteIthFormula(MNG,i);
+  BiddyManagedGC(MNG,targetLT,targetGEQ,purge,total);
 }
 
 #ifdef __cplusplus
@@ -3283,23 +3373,25 @@ Biddy_Managed_DeleteIthFormula(Biddy_Manager MNG, unsigned int i)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetIthFormula returns ith formula in a Formula
-       table.
+\brief Function Biddy_Managed_Clean performs cleaning.
 
 ### Description
-    Return biddyNull if ith formulae does not exist.
+    Discard all nodes which are not preserved or which are not preserved
+    anymore. Obsolete nodes are not immediately removed, they will be removed
+    during the first garbage collection.
 ### Side effects
-    After addding new formula the index of others may change!
+    Field deleted is not considered and thus no fortified node and no
+    prolonged node is discarded.
 ### More info
-    Macro Biddy_GetIthFormula(i) is defined for use with anonymous manager.
+    Macro Biddy_Clean() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_GetIthFormula(Biddy_Manager MNG, unsigned int i)
+void
+Biddy_Managed_Clean(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3321,11 +3413,11 @@ Biddy_Managed_GetIthFormula(Biddy_Manager MNG, unsigned int i)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetIthFormula: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_Clean: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetIthFormula(MNG,i);
+  BiddyManagedClean(MNG);
 }
 
 #ifdef __cplusplus
@@ -3333,23 +3425,29 @@ Biddy_Managed_GetIthFormula(Biddy_Manager MNG, unsigned int i)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_GetIthFormulaName returns name of the ith formula
-       in a Formula table.
+\brief Function Biddy_Managed_Purge immediately removes all nodes which were
+       not preserved or which are not preserved anymore.
 
 ### Description
-    Return NULL if ith formulae does not exist.
+    All formulae without name are deleted.
+    All deleted formulae (including prolonged/fortified formulae) are removed.
+    All fresh and obsolete nodes are immediatelly removed.
+    Moreover, all prolonged and fortified nodes are immediatelly removed if
+    they are not needed by some of the remaining formula.
+    Call to Biddy_Purge does not count as clearing and thus all preserved
+    formulae remains preserved for the same number of clearings.
 ### Side effects
-    After addding new formula the index of others may change!
+    Removes all fresh nodes!
 ### More info
-    Macro Biddy_GetIthFormulaName(i) is defined for use with anonymous manager.
+    Macro Biddy_Purge(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_String
-Biddy_Managed_GetIthFormulaName(Biddy_Manager MNG, unsigned int i)
+void
+Biddy_Managed_Purge(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3371,34 +3469,42 @@ Biddy_Managed_GetIthFormulaName(Biddy_Manager MNG, unsigned int i)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetIthFormulaName: Unsupported BDD type!\n");
-    return NULL;
+    fprintf(stderr,"Biddy_Managed_Purge: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetIthFormulaName(MNG,i);
+  BiddyManagedPurge(MNG);
 }
 
 #ifdef __cplusplus
 }
 #endif
 
-/*******************************************************************************
-\brief Function Biddy_Managed_GetOrdering creates a string with a list of
-       variables ordered according to the active ordering.
+/***************************************************************************//*!
+\brief Function Biddy_Managed_PurgeAndReorder immediately removes non-preserved
+       nodes and triggers reordering on function.
 
 ### Description
+    All obsolete nodes are immediatelly removed. Moreover, nodes from deleted
+    prolonged formulae and nodes from deleted fortified formulae are removed
+    if they are not needed by other formulae.
+    If BDD is given (f != NULL), reordering on function is used.
+    Otherwise (f == NULL) global reordering is used.
+    Call to Biddy_PurgeAndReorder does not count as clearing and thus all
+    preserved formulae remains preserved for the same number of clearings.
 ### Side effects
-    User should free memory for the created string.
+    Removes all fresh nodes.
 ### More info
-    Macro Biddy_GetOrdering() is defined for use with anonymous manager.
+    Macro Biddy_PurgeAndReorder(f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_String
-Biddy_Managed_GetOrdering(Biddy_Manager MNG)
+void
+Biddy_Managed_PurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f,
+                              Biddy_Boolean converge)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3420,11 +3526,11 @@ Biddy_Managed_GetOrdering(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_GetOrdering: Unsupported BDD type!\n");
-    return NULL;
+    fprintf(stderr,"Biddy_Managed_PurgeAndReorder: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedGetOrdering(MNG);
+  BiddyManagedPurgeAndReorder(MNG,f,converge);
 }
 
 #ifdef __cplusplus
@@ -3432,17 +3538,25 @@ Biddy_Managed_GetOrdering(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SetOrdering use variable swapping
-        to create the ordering given by string.
+\brief Function Biddy_Managed_PurgeAndCompact immediately removes
+       non-preserved nodes and returns unused memory blocks to the system.
 
 ### Description
-    Non-existing variables included in the string are simply ignored.
-    Not all variables need to be given.
+    The same as Biddy_Managed_Purge but afterwards, the remaining nodes are
+    relocated into the first memory blocks (the ones allocated first)
+    and the memory blocks which become empty are released.
+    Formulae, variables, and elements are updated, results in cache tables
+    which refer to the relocated nodes are deleted.
+    The number of compactions, the time spent for them, and the number of
+    released bytes are reported by Biddy_Managed_NodeTableCompactNumber,
+    Biddy_Managed_NodeTableCompactTime, and
+    Biddy_Managed_SystemLongStat(MNG,BIDDYLONGSTATNODETABLECOMPACTFREED).
 ### Side effects
-    String should be formated in the same way as returned by Biddy_GetOrdering.
-    It should not be prefixed with spaces.
+    Removes all fresh nodes. Relocated nodes get new addresses and thus
+    all edges held outside Formula table (and outside Variable table) become
+    invalid - use Biddy_Managed_FindFormula to get them again.
 ### More info
-    Macro Biddy_SetOrdering(ordering) is defined for use with anonymous manager.
+    Macro Biddy_PurgeAndCompact() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -3450,7 +3564,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_SetOrdering(Biddy_Manager MNG, Biddy_String ordering)
+Biddy_Managed_PurgeAndCompact(Biddy_Manager MNG)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3472,11 +3586,11 @@ Biddy_Managed_SetOrdering(Biddy_Manager MNG, Biddy_String ordering)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SetOrdering: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_PurgeAndCompact: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedSetOrdering(MNG,ordering);
+  BiddyManagedPurgeAndCompact(MNG);
 }
 
 #ifdef __cplusplus
@@ -3484,17 +3598,13 @@ Biddy_Managed_SetOrdering(Biddy_Manager MNG, Biddy_String ordering)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SetAlphabeticOrdering use variable swapping
-        to create the alphabetic ordering.
+\brief Function Biddy_Managed_AddCache adds cache to the end of Cache list.
 
 ### Description
-    Named variables are ordered according to their names. Numbered variables
-    are ordered according to their numbers and are always smaller (topmore) as
-    any named variable.
+    If Cache list does not exist, function creates it.
 ### Side effects
 ### More info
-    Macro Biddy_SetAlphabeticOrdering() is defined for use with anonymous
-    manager.
+    Macro Biddy_AddCache(gc) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -3502,7 +3612,7 @@ extern "C" {
 #endif
 
 void
-Biddy_Managed_SetAlphabeticOrdering(Biddy_Manager MNG)
+Biddy_Managed_AddCache(Biddy_Manager MNG, Biddy_GCFunction gc)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3524,11 +3634,11 @@ Biddy_Managed_SetAlphabeticOrdering(Biddy_Manager MNG)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SetAlphabeticOrdering: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_AddCache: Unsupported BDD type!\n");
     return;
   }
 
-  BiddyManagedSetAlphabeticOrdering(MNG);
+  BiddyManagedAddCache(MNG,gc);
 }
 
 #ifdef __cplusplus
@@ -3536,25 +3646,46 @@ Biddy_Managed_SetAlphabeticOrdering(Biddy_Manager MNG)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SwapWithHigher swaps two adjacent variables.
+\brief Function Biddy_Managed_AddFormula adds formula to Formula table.
 
 ### Description
-    Higher (greater) variable is the bottommore one!
-    The highest variable is constant variable "1".
-    Global ordering is number of zeros in corresponding line of orderingTable.
-    Constant variable '1' has global ordering greater than all others.
+    Given BDD becomes a formula. If (x != NULL) then formula is accessible by
+    its name. If (x != NULL) then index of the formula in the Formulae Table
+    is returned, otherwise function returns 0.
+    Nodes of the given BDD will be preserved for the given number of clearings.
+    If (c == -1) then formula is refreshed but not preserved.
+    If (c == 0) then formula is persistently preserved.
+    You have to use Biddy_DeleteFormula and Biddy_Purge to remove nodes
+    of persistently preserved formulae.
+    There are five macros defined to simplify formulae management:
+    Biddy_Managed_AddTmpFormula(mng,name,bdd)
+      := Biddy_Managed_AddFormula(mng,name,bdd,-1)
+    Biddy_Managed_AddPersistentFormula(mng,name,bdd)
+      := Biddy_Managed_AddFormula(mng,name,bdd,0)
+    Biddy_Managed_KeepFormula(mng,bdd)
+      := Biddy_Managed_AddFormula(mng,NULL,bdd,1)
+    Biddy_Managed_KeepFormulaProlonged(mng,bdd,c)
+      := Biddy_Managed_AddFormula(mng,NULL,bdd,c)
+    Biddy_Managed_KeepFormulaUntilPurge(mng,bdd)
+      := Biddy_Managed_AddFormula(mng,NULL,bdd,0)
 ### Side effects
-    All obsolete nodes will be removed.
+    Function is prolonged or fortified. Formulae with name are ordered by name.
+    If formula with the same name already exists, it will be overwritten -
+    preserved (i.e. not obsolete and not fresh) and persistently preserved
+    formulae will be deleted at the original index and recreated at new index!
 ### More info
-    Macro Biddy_SwapWithHigher(v) is defined for use with anonymous manager.
+    Macros Biddy_AddFormula(x,f,c), Biddy_AddTmpFormula(x,f),
+    Biddy_AddPersistentFormula(x,f),  Biddy_KeepFormula(f),
+    Biddy_KeepFormulaProlonged(f,c), and Biddy_KeepFormulaUntilPurge(f)
+    are defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_SwapWithHigher(Biddy_Manager MNG, Biddy_Variable v)
+unsigned int
+Biddy_Managed_AddFormula(Biddy_Manager MNG, Biddy_String x, Biddy_Edge f, int c)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3576,11 +3707,11 @@ Biddy_Managed_SwapWithHigher(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SwapWithHigher: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_AddFormula: Unsupported BDD type!\n");
     return 0;
   }
 
-  return BiddyManagedSwapWithHigher(MNG,v);
+  return BiddyManagedAddFormula(MNG,x,f,c);
 }
 
 #ifdef __cplusplus
@@ -3588,25 +3719,25 @@ Biddy_Managed_SwapWithHigher(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_SwapWithLower swaps two adjacent variables.
+\brief Function Biddy_Managed_FindFormula find formula in Formula table.
 
 ### Description
-    Lower (smaller) variable is the topmore one!
-    The lowest (topmost) element is not fixed.
-    Topmost variable has global ordering 1 (smaller than all except itself).
-    Global ordering is the number of zeros in corresponding line of orderingTable.
+    Return TRUE/FALSE, index, and the formula.
+    If formula is constant or variable then idx = 0 and f != biddyNull.
+    If formula is not found then idx is a position where the formulae should
+    exist and f == biddyNull.
 ### Side effects
-    All obsolete nodes will be removed.
 ### More info
-    Macro Biddy_SwapWithLower(v) is defined for use with anonymous manager.
+    Macro Biddy_FindFormula(x,f) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Variable
-Biddy_Managed_SwapWithLower(Biddy_Manager MNG, Biddy_Variable v)
+Biddy_Boolean
+Biddy_Managed_FindFormula(Biddy_Manager MNG, Biddy_String x,
+                          unsigned int *idx, Biddy_Edge *f)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3628,11 +3759,11 @@ Biddy_Managed_SwapWithLower(Biddy_Manager MNG, Biddy_Variable v)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_SwapWithLower: Unsupported BDD type!\n");
-    return 0;
+    fprintf(stderr,"Biddy_Managed_FindFormula: Unsupported BDD type!\n");
+    return FALSE;
   }
 
-  return BiddyManagedSwapWithLower(MNG,v);
+  return BiddyManagedFindFormula(MNG,x,idx,f);
 }
 
 #ifdef __cplusplus
@@ -3640,21 +3771,17 @@ Biddy_Managed_SwapWithLower(Biddy_Manager MNG, Biddy_Variable v)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_Sifting reorders variables to minimize node number
-       using Rudell's sifting algorithm for the whole system (if f = NULL) or
-       for the given function (if f != NULL) .
+\brief Function Biddy_Managed_DeleteFormula delete formula from Formula table.
 
 ### Description
-    Variables are reordered globally.
-    All obsolete nodes will be removed.
+    Formula is labelled but not immediately removed.
+    Nodes of the given formula are not immediately removed.
+    Nodes of the given formula remains fresh or preserved.
 ### Side effects
-    For TZBDD, all unreferenced nodes (not part of registered formulae)
-    will be removed. For TZBDD, sifting may change top edge or even
-    a top node of any function/formula - this is a problem, because functions
-    referenced by local variables only may become wrong. Consequently, for
-    TZBDDs, sifting is not safe to start automatically!
+    Formula is not accessible by its name anymore.
+    Formulae representing constants and variables will not be deleted.
 ### More info
-    Macro Biddy_Sifting(f) is defined for use with anonymous manager.
+    Macro Biddy_DeleteFormula(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
@@ -3662,10 +3789,9 @@ extern "C" {
 #endif
 
 Biddy_Boolean
-Biddy_Managed_Sifting(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge)
+Biddy_Managed_DeleteFormula(Biddy_Manager MNG, Biddy_String x)
 {
   if (!MNG) MNG = biddyAnonymousManager;
-  ZF_LOGI("Biddy_Sifting");
 
   if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
@@ -3685,11 +3811,11 @@ Biddy_Managed_Sifting(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_Sifting: Unsupported BDD type!\n");
+    fprintf(stderr,"Biddy_Managed_DeleteFormula: Unsupported BDD type!\n");
     return FALSE;
   }
 
-  return BiddyManagedSifting(MNG,f,converge);
+  return BiddyManagedDeleteFormula(MNG,x);
 }
 
 #ifdef __cplusplus
@@ -3697,32 +3823,26 @@ Biddy_Managed_Sifting(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_MinimizeBDD reorders variables to minimize
-        the node number of the given formula using an exhaustive search
-        over all possible orderings.
+\brief Function Biddy_Managed_DeleteIthFormula deletes formula from the table.
 
 ### Description
-    Steinhaus–Johnson–Trotter algorithm is used to generate all possible
-    permutations. An optimized version of Bubble Sort is used to
-    setup the final ordering. Variables are reordered globally. All obsolete
-    nodes will be removed.
+    Formula is labelled but not immediately removed.
+    Nodes of the given formula are not immediately removed.
+    Nodes of the given formula remains fresh or preserved.
 ### Side effects
-    Indeed, this function may take a lot of time!
-    For TZBDD, all unreferenced nodes (not part of registered formulae)
-    will be removed. For TZBDD, this function may change top edge or even
-    a top node of any function/formula - this is a problem, because functions
-    referenced by local variables only may become wrong. Consequently, for
-    TZBDDs, sifting is not safe to start automatically!
+    Formula is not accessible by its name anymore.
+    The first two formulae ("0" and "1") will not be deleted.
+    Formulae representing variables will not be deleted.
 ### More info
-    Macro Biddy_MinimizeBDD(f) is defined for use with anonymous manager.
+    Macro Biddy_DeleteIthFormula(x) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_MinimizeBDD(Biddy_Manager MNG, Biddy_String name)
+Biddy_Boolean
+Biddy_Managed_DeleteIthFormula(Biddy_Manager MNG, unsigned int i)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3744,11 +3864,11 @@ Biddy_Managed_MinimizeBDD(Biddy_Manager MNG, Biddy_String name)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_MinimizeBDD: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_DeleteIthFormula: Unsupported BDD type!\n");
+    return FALSE;
   }
 
-  BiddyManagedMinimizeBDD(MNG,name);
+  return BiddyManagedDeleteIthFormula(MNG,i);
 }
 
 #ifdef __cplusplus
@@ -3756,32 +3876,23 @@ Biddy_Managed_MinimizeBDD(Biddy_Manager MNG, Biddy_String name)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_MaximizeBDD reorders variables to maximize
-        the node number of the given function using an exhaustive search
-        over all possible orderings.
+\brief Function Biddy_Managed_GetIthFormula returns ith formula in a Formula
+       table.
 
 ### Description
-    Steinhaus–Johnson–Trotter algorithm is used to generate all possible
-    permutations. An optimized version of Bubble Sort is used to
-    setup the final ordering. Variables are reordered globally. All obsolete
-    nodes will be removed.
+    Return biddyNull if ith formulae does not exist.
 ### Side effects
-    Indeed, this function may take a lot of time!
-    For TZBDD, all unreferenced nodes (not part of registered formulae)
-    will be removed. For TZBDD, this function may change top edge or even
-    a top node of any function/formula - this is a problem, because functions
-    referenced by local variables only may become wrong. Consequently, for
-    TZBDDs, sifting is not safe to start automatically!
+    After addding new formula the index of others may change!
 ### More info
-    Macro Biddy_MaximizeBDD(f) is defined for use with anonymous manager.
+    Macro Biddy_GetIthFormula(i) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_MaximizeBDD(Biddy_Manager MNG, Biddy_String name)
+Biddy_Edge
+Biddy_Managed_GetIthFormula(Biddy_Manager MNG, unsigned int i)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -3803,11 +3914,11 @@ Biddy_Managed_MaximizeBDD(Biddy_Manager MNG, Biddy_String name)
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_MaximizeBDD: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetIthFormula: Unsupported BDD type!\n");
+    return biddyNull;
   }
 
-  BiddyManagedMaximizeBDD(MNG,name);
+  return BiddyManagedGetIthFormula(MNG,i);
 }
 
 #ifdef __cplusplus
@@ -3815,160 +3926,98 @@ Biddy_Managed_MaximizeBDD(Biddy_Manager MNG, Biddy_String name)
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_Copy copies a graph from one manager to
-       another manager which can use the same or different BDD type.
+\brief Function Biddy_Managed_GetIthFormulaName returns name of the ith formula
+       in a Formula table.
 
 ### Description
-    The function takes a graph from source manager MNG1 and creates the same
-    graph in target manager MNG2. If the managers do not use the same BDD type
-    then a graph is converted. The resulting graph will represent the same
-    Boolean function assuming the domain from the target manager.
-    If (f == biddyZero) then only the domain (all variables) is copied.
+    Return NULL if ith formulae does not exist.
 ### Side effects
-    If source and target manager are the same then function does nothing.
-    The variable ordering of the created BDD is trying to follow the original
-    ordering, but if some variables already exist in the target manager then
-    the final ordering is adapted to the target manager.
-    Please note, that indices of variables in the target manager may not be
-    the same as in the source manager (for example, if source managet does not
-    use initial ordering the indices in the target manager will follow the
-    variable's ordering and not variable's original indices)
+    After addding new formula the index of others may change!
 ### More info
-    Macros Biddy_Copy(MNG2,f) and Biddy_CopyFrom(MNG1,f) are defined for use
-    with anonymous manager.
+    Macro Biddy_GetIthFormulaName(i) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_Copy(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+Biddy_String
+Biddy_Managed_GetIthFormulaName(Biddy_Manager MNG, unsigned int i)
 {
-  if (!MNG1) MNG1 = biddyAnonymousManager;
-  ZF_LOGI("Biddy_Copy");
-
-  if (biddyManagerType1 == BIDDYTYPEOBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
-    /* IMPLEMENTED */
-  }
-#ifndef COMPACT
-  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
-    /* IMPLEMENTED */
-  }
-#endif
-  else {
-    fprintf(stderr,"Biddy_Managed_Copy: Unsupported BDD type!\n");
-    return biddyNull;
-  }
+  if (!MNG) MNG = biddyAnonymousManager;
 
-  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+  if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_Copy: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_GetIthFormulaName: Unsupported BDD type!\n");
+    return NULL;
   }
 
-  return BiddyManagedCopy(MNG1,MNG2,f,TRUE);
+  return BiddyManagedGetIthFormulaName(MNG,i);
 }
 
 #ifdef __cplusplus
 }
 #endif
 
-/***************************************************************************//*!
-\brief Function Biddy_Managed_CopyFormula uses Biddy_Managed_Copy to copy a
-       graph from one manager to another manager which can use the same or
-       different BDD type.
+/*******************************************************************************
+\brief Function Biddy_Managed_GetOrdering creates a string with a list of
+       variables ordered according to the active ordering.
 
 ### Description
-    See Biddy_Managed_Copy.
 ### Side effects
-    If source and target manager are the same then function does nothing.
-    The variable ordering of created BDD is adapted to the target manager.
-    The created formula is refreshed but not preserved.
+    User should free memory for the created string.
 ### More info
-    Macros Biddy_CopyFormulaTo(MNG2,x) and Biddy_CopyFormulaFrom(MNG1,f) are
-    defined for use with anonymous manager.
+    Macro Biddy_GetOrdering() is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void
-Biddy_Managed_CopyFormula(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_String x)
+Biddy_String
+Biddy_Managed_GetOrdering(Biddy_Manager MNG)
 {
-  if (!MNG1) MNG1 = biddyAnonymousManager;
-
-  if (biddyManagerType1 == BIDDYTYPEOBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
-    /* IMPLEMENTED */
-  }
-#ifndef COMPACT
-  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
-    /* IMPLEMENTED */
-  }
-  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
-    /* IMPLEMENTED */
-  }
-#endif
-  else {
-    fprintf(stderr,"Biddy_Managed_CopyFormula: Unsupported BDD type!\n");
-    return;
-  }
+  if (!MNG) MNG = biddyAnonymousManager;
 
-  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+  if (biddyManagerType == BIDDYTYPEOBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
     /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
     /* IMPLEMENTED */
   }
-  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
     /* IMPLEMENTED */
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_CopyFormula: Unsupported BDD type!\n");
-    return;
+    fprintf(stderr,"Biddy_Managed_GetOrdering: Unsupported BDD type!\n");
+    return NULL;
   }
 
-  BiddyManagedCopyFormula(MNG1,MNG2,x);
+  return BiddyManagedGetOrdering(MNG);
 }
 
 #ifdef __cplusplus
@@ -3976,47 +4025,25 @@ Biddy_Managed_CopyFormula(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_String x
 #endif
 
 /***************************************************************************//*!
-\brief Function Biddy_Managed_ConstructBDD constructs BDD from lists of
-       nodes and edges.
+\brief Function Biddy_Managed_SetOrdering use variable swapping
+        to create the ordering given by string.
 
 ### Description
-    In both lists, elements are separated with spaces. Multiple labels
-    are supported, the function returns only one BDD, the corresponding
-    one for the label specified as the first element in nodelist.
-    TO DO: return an array of BDDs
-    Elements of node list has the following format:
-    terminal node zero = (type=0,l=-1,r=-1),
-    terminal node one = (type=1,l=-1,r=-1),
-    regular label = (type=2,r=-1),
-    complemented label = (type=3,r=-1),
-    regular node = (type=4),
-    node with complemented successor(s) = (type=5)
-    An example node list is:
-    'Biddy 0 Biddy 2 1 -1 1 B 4 2 3 2 0 0 -1 -1 3 i 4 4 9
-    4 d 4 5 6 5 0 0 -1 -1 6 y 4 7 8 7 0 0 -1 -1 8 1 1 -1 -1 9
-    d 4 6 10 10 1 1 -1 -1' which is constructed as: '{Biddy}
-    {0 Biddy 2 1 -1} {1 B 4 2 3} {2 0 0 -1 -1} {3 i 4 4 9}
-    {4 d 4 5 6} {5 0 0 -1 -1} {6 y 4 7 8} {7 0 0 -1 -1}
-    {8 1 1 -1 -1} {9 d 4 6 10} {10 1 1 -1 -1}'.
+    Non-existing variables included in the string are simply ignored.
+    Not all variables need to be given.
 ### Side effects
-    If variable ordering in the file is not compatible with the active ordering
-    then the result will be wrong!
-    If new variables are added then for OBDDs and TZBDDs the existing
-    formulae are repaired regarding the Boolen functions they represent.
-    If new variables are added then for ZBDDs the existing
-    formulae are repaired regarding the combination sets they represent.
+    String should be formated in the same way as returned by Biddy_GetOrdering.
+    It should not be prefixed with spaces.
 ### More info
-    Macro Biddy_ConstructBDD(MNG,numV,varlist,numN,nodelist) is defined
-    for use with anonymous manager.
+    Macro Biddy_SetOrdering(ordering) is defined for use with anonymous manager.
 *******************************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-Biddy_Edge
-Biddy_Managed_ConstructBDD(Biddy_Manager MNG, int numV, Biddy_String varlist, int numN,
-                           Biddy_String nodelist)
+void
+Biddy_Managed_SetOrdering(Biddy_Manager MNG, Biddy_String ordering)
 {
   if (!MNG) MNG = biddyAnonymousManager;
 
@@ -4038,652 +4065,737 @@ Biddy_Managed_ConstructBDD(Biddy_Manager MNG, int numV, Biddy_String varlist, in
   }
 #endif
   else {
-    fprintf(stderr,"Biddy_Managed_ConstructBDD: Unsupported BDD type!\n");
-    return biddyNull;
+    fprintf(stderr,"Biddy_Managed_SetOrdering: Unsupported BDD type!\n");
+    return;
   }
 
-  return BiddyManagedConstructBDD(MNG,numV,varlist,numN,nodelist);
+  BiddyManagedSetOrdering(MNG,ordering);
 }
 
 #ifdef __cplusplus
 }
 #endif
 
-/*----------------------------------------------------------------------------*/
-/* Definition of internal functions used to implement external functions      */
-/*----------------------------------------------------------------------------*/
-
 /***************************************************************************//*!
-\brief Function BiddyInitMNG.
+\brief Function Biddy_Managed_SetAlphabeticOrdering use variable swapping
+        to create the alphabetic ordering.
 
 ### Description
+    Named variables are ordered according to their names. Numbered variables
+    are ordered according to their numbers and are always smaller (topmore) as
+    any named variable.
 ### Side effects
 ### More info
-    See Biddy_InitMNG.
+    Macro Biddy_SetAlphabeticOrdering() is defined for use with anonymous
+    manager.
 *******************************************************************************/
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 void
-BiddyInitMNG(Biddy_Manager *mng, int bddtype)
+Biddy_Managed_SetAlphabeticOrdering(Biddy_Manager MNG)
 {
-  Biddy_Manager MNG;
-  unsigned int i;
-#ifdef VARIABLEORDERINGMATRIX_YES
-  unsigned int j;
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
 #endif
+  else {
+    fprintf(stderr,"Biddy_Managed_SetAlphabeticOrdering: Unsupported BDD type!\n");
+    return;
+  }
 
-#ifdef UNIX
-  struct timeval tv;
-  struct rlimit rl;
+  BiddyManagedSetAlphabeticOrdering(MNG);
+}
+
+#ifdef __cplusplus
+}
 #endif
 
-#ifdef PLAIN
-  if ((bddtype == BIDDYTYPETZBDDC) || (bddtype == BIDDYTYPETZBDD) ||
-      (bddtype == BIDDYTYPETZFDDC) || (bddtype == BIDDYTYPETZFDD))
-  {
-    fprintf(stderr,"This instance of Biddy library was compiled with -DPLAIN.\n");
-    fprintf(stderr,"Tagged binary decision diagrams are not supported.\n");
-    exit(1);
-  }
+/***************************************************************************//*!
+\brief Function Biddy_Managed_SwapWithHigher swaps two adjacent variables.
+
+### Description
+    Higher (greater) variable is the bottommore one!
+    The highest variable is constant variable "1".
+    Global ordering is number of zeros in corresponding line of orderingTable.
+    Constant variable '1' has global ordering greater than all others.
+### Side effects
+    All obsolete nodes will be removed.
+### More info
+    Macro Biddy_SwapWithHigher(v) is defined for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
 #endif
 
-#ifdef UNIX
-  /* printf("The page size for this system is %ld bytes.\n", sysconf(_SC_PAGESIZE)); */
-  rl.rlim_max  = rl.rlim_cur = RLIM_INFINITY;
-  if (setrlimit(RLIMIT_STACK, &rl)) {
-    fprintf(stderr,"ERROR: setrlimit\n");
-    perror("setrlimit");
-    exit(1);
+Biddy_Variable
+Biddy_Managed_SwapWithHigher(Biddy_Manager MNG, Biddy_Variable v)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
 #endif
+  else {
+    fprintf(stderr,"Biddy_Managed_SwapWithHigher: Unsupported BDD type!\n");
+    return 0;
+  }
 
-#ifdef UNIXXX
-  mallopt(M_MMAP_MAX,0);
-  mallopt(M_TRIM_THRESHOLD,-1);
-#endif
+  return BiddyManagedSwapWithHigher(MNG,v);
+}
 
-  /* RANDOM NUMBERS GENERATOR */
-#ifdef UNIX
-  gettimeofday(&tv,0);
-  srand(tv.tv_usec);
-#else
-  srand((unsigned int) time(NULL));
+#ifdef __cplusplus
+}
 #endif
 
-  if (!mng) {
-    if (!(biddyAnonymousManager = (Biddy_Manager) malloc(sizeof(BiddyManager)))) {
-      fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-      exit(1);
-    }
-    MNG = biddyAnonymousManager;
-  } else {
-    if (!(*mng = (Biddy_Manager) malloc(sizeof(BiddyManager)))) {
-      fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-      exit(1);
-    }
-    MNG = *mng;
-  }
+/***************************************************************************//*!
+\brief Function Biddy_Managed_SwapWithLower swaps two adjacent variables.
 
-  /* DEBUGGING */
-  /*
-  printf("DEBUG (BiddyInitMNG): BiddyInitMNG STARTED\n");
-  printf("DEBUG (BiddyInitMNG): mng = %p\n",mng);
-  printf("DEBUG (BiddyInitMNG): bddtype = %d\n",bddtype);
-  printf("DEBUG (BiddyInitMNG): MNG = %p\n",MNG);
-  */
+### Description
+    Lower (smaller) variable is the topmore one!
+    The lowest (topmost) element is not fixed.
+    Topmost variable has global ordering 1 (smaller than all except itself).
+    Global ordering is the number of zeros in corresponding line of orderingTable.
+### Side effects
+    All obsolete nodes will be removed.
+### More info
+    Macro Biddy_SwapWithLower(v) is defined for use with anonymous manager.
+*******************************************************************************/
 
-  /* CREATION OF MANAGER'S STRUCTURES - VALUES ARE NOT INITIALIZED HERE */
-  MNG[0] = NULL; /* biddyManagerName */
-  if (!(MNG[1] = (short int *) malloc(sizeof(short int)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
-  }
-  biddyManagerType = 0;
-  MNG[2] = NULL; /* biddyTerminal */
-  MNG[3] = NULL; /* biddyZero */
-  MNG[4] = NULL; /* biddyOne */
-  if (!(MNG[5] = (BiddyNodeTable *) malloc(sizeof(BiddyNodeTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
-  }
-  biddyNodeTable.table = NULL;
-  biddyNodeTable.blocktable = NULL;
-  biddyNodeTable.initsize = 0;
-  biddyNodeTable.size = 0;
-  biddyNodeTable.limitsize = 0;
-  biddyNodeTable.blocknumber = 0;
-  biddyNodeTable.initblocksize = 0;
-  biddyNodeTable.blocksize = 0;
-  biddyNodeTable.limitblocksize = 0;
-  biddyNodeTable.generated = 0;
-  biddyNodeTable.max = 0;
-  biddyNodeTable.num = 0;
-  biddyNodeTable.garbage = 0;
-  biddyNodeTable.swap = 0;
-  biddyNodeTable.sifting = 0;
-  biddyNodeTable.nodetableresize = 0;
-  biddyNodeTable.funite = 0;
-  biddyNodeTable.funandor = 0;
-  biddyNodeTable.funxor = 0;
-  biddyNodeTable.gctime = 0;
-  biddyNodeTable.drtime = 0;
-  biddyNodeTable.gcratio = 0.0;
-  biddyNodeTable.gcratioF = 0.0;
-  biddyNodeTable.gcratioX = 0.0;
-  biddyNodeTable.resizeratio = 0.0;
-  biddyNodeTable.resizeratioF = 0.0;
-  biddyNodeTable.resizeratioX = 0.0;
-  biddyNodeTable.siftingtreshold = 0.0;
-  biddyNodeTable.convergesiftingtreshold = 0.0;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.foa = 0;
-  biddyNodeTable.find = 0;
-  biddyNodeTable.compare = 0;
-  biddyNodeTable.add = 0;
-  biddyNodeTable.iterecursive = 0;
-  biddyNodeTable.andorrecursive = 0;
-  biddyNodeTable.xorrecursive = 0;
-  biddyNodeTable.gcobsolete = NULL;
+#ifdef __cplusplus
+extern "C" {
 #endif
-  if (!(MNG[6] = (BiddyVariableTable *) malloc(sizeof(BiddyVariableTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+
+Biddy_Variable
+Biddy_Managed_SwapWithLower(Biddy_Manager MNG, Biddy_Variable v)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  biddyVariableTable.table = NULL;
-  biddyVariableTable.lookup = NULL;
-  biddyVariableTable.size = 0;
-  biddyVariableTable.num = 0;
-  biddyVariableTable.numnum = 0;
-  if (!(MNG[7] = (BiddyFormulaTable *) malloc(sizeof(BiddyFormulaTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  biddyFormulaTable.table = NULL;
-  biddyFormulaTable.size = 0;
-  biddyFormulaTable.numOrdered = 0;
-  biddyFormulaTable.deletedName = NULL;
-  if (!(MNG[8] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  biddyOPCache.table = NULL;
-  biddyOPCache.size = 0;
-  biddyOPCache.disabled = FALSE;
-  if (!(biddyOPCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
   }
-  *(biddyOPCache.notusedyet) = FALSE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!(biddyOPCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyOPCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
-  }
-  if (!(biddyOPCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
-  }
-  if (!(biddyOPCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
-  }
-  *(biddyOPCache.search) = 0;
-  *(biddyOPCache.find) = 0;
-  *(biddyOPCache.insert) = 0;
-  *(biddyOPCache.overwrite) = 0;
 #endif
-  if (!(MNG[9] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else {
+    fprintf(stderr,"Biddy_Managed_SwapWithLower: Unsupported BDD type!\n");
+    return 0;
   }
-  biddyEACache.table = NULL;
-  biddyEACache.size = 0;
-  biddyEACache.disabled = FALSE;
-  if (!(biddyEACache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+
+  return BiddyManagedSwapWithLower(MNG,v);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/***************************************************************************//*!
+\brief Function Biddy_Managed_Sifting reorders variables to minimize node number
+       using Rudell's sifting algorithm for the whole system (if f = NULL) or
+       for the given function (if f != NULL) .
+
+### Description
+    Variables are reordered globally.
+    All obsolete nodes will be removed.
+### Side effects
+    For TZBDD, all unreferenced nodes (not part of registered formulae)
+    will be removed. For TZBDD, sifting may change top edge or even
+    a top node of any function/formula - this is a problem, because functions
+    referenced by local variables only may become wrong. Consequently, for
+    TZBDDs, sifting is not safe to start automatically!
+### More info
+    Macro Biddy_Sifting(f) is defined for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+Biddy_Boolean
+Biddy_Managed_Sifting(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_Sifting");
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyEACache.notusedyet) = FALSE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!(biddyEACache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyEACache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyEACache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyEACache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyEACache.search) = 0;
-  *(biddyEACache.find) = 0;
-  *(biddyEACache.insert) = 0;
-  *(biddyEACache.overwrite) = 0;
 #endif
-  if (!(MNG[10] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else {
+    fprintf(stderr,"Biddy_Managed_Sifting: Unsupported BDD type!\n");
+    return FALSE;
   }
-  biddyRCCache.table = NULL;
-  biddyRCCache.size = 0;
-  biddyRCCache.disabled = FALSE;
-  if (!(biddyRCCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+
+  return BiddyManagedSifting(MNG,f,converge);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/***************************************************************************//*!
+\brief Function Biddy_Managed_MinimizeBDD reorders variables to minimize
+        the node number of the given formula using an exhaustive search
+        over all possible orderings.
+
+### Description
+    Steinhaus–Johnson–Trotter algorithm is used to generate all possible
+    permutations. An optimized version of Bubble Sort is used to
+    setup the final ordering. Variables are reordered globally. All obsolete
+    nodes will be removed.
+### Side effects
+    Indeed, this function may take a lot of time!
+    For TZBDD, all unreferenced nodes (not part of registered formulae)
+    will be removed. For TZBDD, this function may change top edge or even
+    a top node of any function/formula - this is a problem, because functions
+    referenced by local variables only may become wrong. Consequently, for
+    TZBDDs, sifting is not safe to start automatically!
+### More info
+    Macro Biddy_MinimizeBDD(f) is defined for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void
+Biddy_Managed_MinimizeBDD(Biddy_Manager MNG, Biddy_String name)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyRCCache.notusedyet) = FALSE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!(biddyRCCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyRCCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyRCCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyRCCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyRCCache.search) = 0;
-  *(biddyRCCache.find) = 0;
-  *(biddyRCCache.insert) = 0;
-  *(biddyRCCache.overwrite) = 0;
 #endif
-  if (!(MNG[11] = (BiddyKeywordCacheTable *) malloc(sizeof(BiddyKeywordCacheTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else {
+    fprintf(stderr,"Biddy_Managed_MinimizeBDD: Unsupported BDD type!\n");
+    return;
   }
-  biddyReplaceCache.table = NULL;
-  biddyReplaceCache.size = 0;
-  biddyReplaceCache.keywordList = NULL;
-  biddyReplaceCache.keyList = NULL;
-  biddyReplaceCache.keyNum = 0;
-  biddyReplaceCache.keywordNum = 0;
-  biddyReplaceCache.disabled = FALSE;
-  if (!(biddyReplaceCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+
+  BiddyManagedMinimizeBDD(MNG,name);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/***************************************************************************//*!
+\brief Function Biddy_Managed_MaximizeBDD reorders variables to maximize
+        the node number of the given function using an exhaustive search
+        over all possible orderings.
+
+### Description
+    Steinhaus–Johnson–Trotter algorithm is used to generate all possible
+    permutations. An optimized version of Bubble Sort is used to
+    setup the final ordering. Variables are reordered globally. All obsolete
+    nodes will be removed.
+### Side effects
+    Indeed, this function may take a lot of time!
+    For TZBDD, all unreferenced nodes (not part of registered formulae)
+    will be removed. For TZBDD, this function may change top edge or even
+    a top node of any function/formula - this is a problem, because functions
+    referenced by local variables only may become wrong. Consequently, for
+    TZBDDs, sifting is not safe to start automatically!
+### More info
+    Macro Biddy_MaximizeBDD(f) is defined for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void
+Biddy_Managed_MaximizeBDD(Biddy_Manager MNG, Biddy_String name)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyReplaceCache.notusedyet) = FALSE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!(biddyReplaceCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyReplaceCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyReplaceCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyReplaceCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
-    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
-  *(biddyReplaceCache.search) = 0;
-  *(biddyReplaceCache.find) = 0;
-  *(biddyReplaceCache.insert) = 0;
-  *(biddyReplaceCache.overwrite) = 0;
 #endif
-  if (!(MNG[12] = (BiddyCacheList* *) malloc(sizeof(BiddyCacheList*)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else {
+    fprintf(stderr,"Biddy_Managed_MaximizeBDD: Unsupported BDD type!\n");
+    return;
   }
-  biddyCacheList = NULL;
-  if (!(MNG[13] = (BiddyNode* *) malloc(sizeof(BiddyNode*)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+
+  BiddyManagedMaximizeBDD(MNG,name);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/***************************************************************************//*!
+\brief Function Biddy_Managed_Copy copies a graph from one manager to
+       another manager which can use the same or different BDD type.
+
+### Description
+    The function takes a graph from source manager MNG1 and creates the same
+    graph in target manager MNG2. If the managers do not use the same BDD type
+    then a graph is converted. The resulting graph will represent the same
+    Boolean function assuming the domain from the target manager.
+    If (f == biddyZero) then only the domain (all variables) is copied.
+### Side effects
+    If source and target manager are the same then function does nothing.
+    The variable ordering of the created BDD is trying to follow the original
+    ordering, but if some variables already exist in the target manager then
+    the final ordering is adapted to the target manager.
+    Please note, that indices of variables in the target manager may not be
+    the same as in the source manager (for example, if source managet does not
+    use initial ordering the indices in the target manager will follow the
+    variable's ordering and not variable's original indices)
+    Copies of nodes are kept in the Copy cache of the source manager, thus
+    repeated copies into the same target manager reuse the already copied
+    subgraphs until GC, swapping, or adding variables in the target manager.
+### More info
+    Macros Biddy_Copy(MNG2,f) and Biddy_CopyFrom(MNG1,f) are defined for use
+    with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+Biddy_Edge
+Biddy_Managed_Copy(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+{
+  if (!MNG1) MNG1 = biddyAnonymousManager;
+  ZF_LOGI("Biddy_Copy");
+
+  if (biddyManagerType1 == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  biddyFreeNodes = NULL;
-  if (!(MNG[14] = (BiddyOrderingTable *) malloc(sizeof(BiddyOrderingTable)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  if (!(MNG[15] = (unsigned int *) malloc(sizeof(unsigned int)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+#ifndef COMPACT
+  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  biddySystemAge = 0;
-  if (!(MNG[16] = (unsigned short int *) malloc(sizeof(unsigned short int)))) {
-    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
+#endif
+  else {
+    fprintf(stderr,"Biddy_Managed_Copy: Unsupported BDD type!\n");
+    return biddyNull;
   }
-  biddySelect = 0;
 
-  /* INITIALIZATION OF MANAGER'S STRUCTURES  - VALUES ARE NOW INITIALIZED */
-  if (bddtype == BIDDYTYPEOBDD) {
-    MNG[0] = strdup(BIDDYTYPENAMEOBDD); /* biddyManagerName */
-  } else if (bddtype == BIDDYTYPEOBDDC) {
-    MNG[0] = strdup(BIDDYTYPENAMEOBDDC); /* biddyManagerName */
+  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if (bddtype == BIDDYTYPEZBDD) {
-    MNG[0] = strdup(BIDDYTYPENAMEZBDD); /* biddyManagerName */
-  } else if (bddtype == BIDDYTYPEZBDDC) {
-    MNG[0] = strdup(BIDDYTYPENAMEZBDDC); /* biddyManagerName */
-  } else if (bddtype == BIDDYTYPETZBDD) {
-#if UINTPTR_MAX == 0xffffffffffffffff
-#else
-    fprintf(stderr,"BiddyInitMNG: TZBDDs are supported on 64-bit architecture, only!\n");
-    exit(1);
-#endif
-    MNG[0] = strdup(BIDDYTYPENAMETZBDD); /* biddyManagerName */
-  } else if (bddtype == BIDDYTYPETZBDDC) {
-#if UINTPTR_MAX == 0xffffffffffffffff
-#else
-    fprintf(stderr,"BiddyInitMNG: TZBDDs are supported on 64-bit architecture, only!\n");
-    exit(1);
-#endif
-    MNG[0] = strdup(BIDDYTYPENAMETZBDDC); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZBDDC);
-    exit(1);
-  } else if (bddtype == BIDDYTYPEOFDD) {
-    MNG[0] = strdup(BIDDYTYPENAMEOFDD); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEOFDD);
-    exit(1);
-  } else if (bddtype == BIDDYTYPEOFDDC) {
-    MNG[0] = strdup(BIDDYTYPENAMEOFDDC); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEOFDDC);
-    exit(1);
-  } else if (bddtype == BIDDYTYPEZFDD) {
-    MNG[0] = strdup(BIDDYTYPENAMEZFDD); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEZFDD);
-    exit(1);
-  } else if (bddtype == BIDDYTYPEZFDDC) {
-    MNG[0] = strdup(BIDDYTYPENAMEZFDDC); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEZFDDC);
-    exit(1);
-  } else if (bddtype == BIDDYTYPETZFDD) {
-#if UINTPTR_MAX == 0xffffffffffffffff
-#else
-    fprintf(stderr,"BiddyInitMNG: TZFDDs are supported on 64-bit architecture, only!\n");
-    exit(1);
-#endif
-    MNG[0] = strdup(BIDDYTYPENAMETZFDD); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZFDD);
-    exit(1);
-  } else if (bddtype == BIDDYTYPETZFDDC) {
-#if UINTPTR_MAX == 0xffffffffffffffff
-#else
-    fprintf(stderr,"BiddyInitMNG: TZFDDs are supported on 64-bit architecture, only!\n");
-    exit(1);
-#endif
-    MNG[0] = strdup(BIDDYTYPENAMETZFDDC); /* biddyManagerName */
-    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZFDDC);
-    exit(1);
-  } else {
-    fprintf(stderr,"BiddyInitMNG: Unsupported BDD type!\n");
-    exit(1);
+  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-#else
+  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
+#endif
   else {
-    fprintf(stderr,"BiddyInitMNG: This variant of Biddy library supports ROBDD, only!\n");
-    exit(1);
+    fprintf(stderr,"Biddy_Managed_Copy: Unsupported BDD type!\n");
+    return biddyNull;
   }
+
+  return BiddyManagedCopy(MNG1,MNG2,f,TRUE);
+}
+
+#ifdef __cplusplus
+}
 #endif
 
-  /* THESE ARE MAIN SETTINGS FOR MEMORY MANAGEMENT AND GC */
-  biddyManagerType = bddtype;
-  biddyVariableTable.size = BIDDYVARIABLETABLESIZE;
-  biddyNodeTable.initblocksize = BIDDYNODETABLEINITBLOCKSIZE;
-  biddyNodeTable.limitblocksize = BIDDYNODETABLELIMITBLOCKSIZE;
-  biddyNodeTable.initsize = BIDDYNODETABLEINITSIZE;
-  biddyNodeTable.limitsize = BIDDYNODETABLELIMITSIZE;
-  biddyOPCache.size = BIDDYOPCACHESIZE;
-  biddyEACache.size = BIDDYEACACHESIZE;
-  biddyRCCache.size = BIDDYRCCACHESIZE;
-  biddyReplaceCache.size = BIDDYREPLACECACHESIZE;
-  biddyNodeTable.gcratio = (float) BIDDYNODETABLEGCRATIO; /* do not delete nodes if the effect is to small, gcratio */
-  biddyNodeTable.gcratioF = (float) BIDDYNODETABLEGCRATIOF; /* do not delete nodes if the effect is to small, gcratio */
-  biddyNodeTable.gcratioX = (float) BIDDYNODETABLEGCRATIOX; /* do not delete nodes if the effect is to small, gcratio */
-  biddyNodeTable.resizeratio = (float) BIDDYNODETABLERESIZERATIO; /* resize Node table if there are to many nodes */
-  biddyNodeTable.resizeratioF = (float) BIDDYNODETABLERESIZERATIOF; /* resize Node table if there are to many nodes */
-  biddyNodeTable.resizeratioX = (float) BIDDYNODETABLERESIZERATIOX; /* resize Node table if there are to many nodes */
-  biddyNodeTable.siftingtreshold = (float) BIDDYNODETABLESIFTINGTRESHOLD;  /* stop sifting if the size of the system grows to much */
-  biddyNodeTable.convergesiftingtreshold = (float) BIDDYNODETABLECONVERGESIFTINGTRESHOLD;  /* stop one step of converging sifting if the size of the system grows to much */
-  biddyNodeTable.siftingfactor = (float) BIDDYNODETABLESIFTINGFACTOR;  /* sifting heuristics */
+/***************************************************************************//*!
+\brief Function Biddy_Managed_CopyFormula uses Biddy_Managed_Copy to copy a
+       graph from one manager to another manager which can use the same or
+       different BDD type.
 
-  /* CREATE AND INITIALIZE NODE TABLE */
-  /* THE ACTUAL SIZE OF NODE TABLE IS biddyNodeTable.size+2 */
-  /* BECAUSE OF USED TRICKS, HASH FUNCTION MUST NEVER RETURN ZERO! */
-  /* USEFUL INDICES ARE FROM [1] TO [biddyNodeTable.size+1] */
-  biddyNodeTable.size = biddyNodeTable.initsize;
-  if (!(biddyNodeTable.table = (BiddyNode **)
-  calloc((biddyNodeTable.size+2),sizeof(BiddyNode *)))) {
-    fprintf(stderr,"BiddyInitMNG (node table): Out of memoy!\n");
-    exit(1);
-  }
-  /* for (i=0;i<=biddyNodeTable.size+1;i++) biddyNodeTable.table[i] = NULL; */
+### Description
+    See Biddy_Managed_Copy.
+### Side effects
+    If source and target manager are the same then function does nothing.
+    The variable ordering of created BDD is adapted to the target manager.
+    The created formula is refreshed but not preserved.
+### More info
+    Macros Biddy_CopyFormulaTo(MNG2,x) and Biddy_CopyFormulaFrom(MNG1,f) are
+    defined for use with anonymous manager.
+*******************************************************************************/
 
-  /* CREATE AND INITIALIZE VARIABLE TABLE */
-  /* VARIABLE "1" HAS INDEX = 0 and global order = size-1 */
-  /* VARIABLES ARE ORDERED BY INDEX IN THE VARIABLE TABLE */
-  /* IN THE BDD, SMALLER (PREV) VARIABLES ARE ABOVE THE GREATER (NEXT) ONES */
-  /* VARIABLE "1" MUST ALWAYS HAVE MAX GLOBAL ORDER (IT IS BOTTOMMOST) */
-  /* THIS PART OF CODE DETERMINES DEFAULT ORDERING FOR NEW VARIABLES: */
-  /* ORDER FOR OBDDs AND OFDDs: [1] < [2] < ... < [size-1] < [0] */
-  /* ORDER FOR ZBDDs, ZFDDs, TZBDDs, AND TZFDDs: [size-1] < [size-2] < ... < [1] < [0] */
-  /* FOR OBDDs AND OFDDs: the topmost variable always has prev=biddyVariableTable.size */
-  /* FOR ZBDDs, ZFDDs, TZBDDs, AND TZFDDs: the topmost variable always has prev=biddyVariableTable.num */
-  biddyVariableTable.table = (BiddyVariable *)
-                malloc(biddyVariableTable.size * sizeof(BiddyVariable));
-  biddyVariableTable.table[0].name = strdup("1");
-  biddyVariableTable.table[0].num = 1;
-  biddyVariableTable.table[0].firstNode = NULL;
-  biddyVariableTable.table[0].lastNode = NULL;
-  biddyVariableTable.table[0].variable = biddyNull;
-  biddyVariableTable.table[0].element = biddyNull;
-  biddyVariableTable.table[0].selected = FALSE;
-  biddyVariableTable.table[0].data = NULL;
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD))
-  {
-    biddyVariableTable.table[0].prev = biddyVariableTable.size;
-    biddyVariableTable.table[0].next = 0; /* fixed */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void
+Biddy_Managed_CopyFormula(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_String x)
+{
+  if (!MNG1) MNG1 = biddyAnonymousManager;
+
+  if (biddyManagerType1 == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType1 == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
 #ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
-  {
-    biddyVariableTable.table[0].prev = biddyVariableTable.size;
-    biddyVariableTable.table[0].next = 0; /* fixed */
+  else if (biddyManagerType1 == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
   }
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD) ||
-           (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
-           (biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
-           (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
-  {
-    biddyVariableTable.table[0].prev = 1;
-    biddyVariableTable.table[0].next = 0; /* fixed */
+  else if (biddyManagerType1 == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType1 == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
   }
 #endif
-  nullOrdering(biddyOrderingTable);
-#ifndef VARIABLEORDERINGMATRIX_YES
-  biddyOrderingTable[0] = biddyVariableTable.size-1;
-#endif
-  for (i=1; i<biddyVariableTable.size; i++) {
-    biddyVariableTable.table[i].name = NULL;
-    biddyVariableTable.table[i].num = 0;
-    biddyVariableTable.table[i].firstNode = NULL;
-    biddyVariableTable.table[i].lastNode = NULL;
-    biddyVariableTable.table[i].variable = biddyNull;
-    biddyVariableTable.table[i].element = biddyNull;
-    biddyVariableTable.table[i].selected = FALSE;
-    biddyVariableTable.table[i].data = NULL;
-#ifdef VARIABLEORDERINGMATRIX_YES
-    SET_ORDER(biddyOrderingTable,i,0);
-#endif
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD))
-    {
-      biddyVariableTable.table[i].prev = i-1;
-      biddyVariableTable.table[i].next = i+1;
-#ifdef VARIABLEORDERINGMATRIX_YES
-      for (j=i+1; j<biddyVariableTable.size; j++) {
-        SET_ORDER(biddyOrderingTable,i,j);
-      }
-#else
-      biddyOrderingTable[i] = i-1;
-#endif
-    }
+  else {
+    fprintf(stderr,"Biddy_Managed_CopyFormula: Unsupported BDD type!\n");
+    return;
+  }
+
+  if (biddyManagerType2 == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+  }
 #ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
-    {
-      biddyVariableTable.table[i].prev = i-1;
-      biddyVariableTable.table[i].next = i+1;
-#ifdef VARIABLEORDERINGMATRIX_YES
-      for (j=i+1; j<biddyVariableTable.size; j++) {
-        SET_ORDER(biddyOrderingTable,i,j);
-      }
-#else
-      biddyOrderingTable[i] = i-1;
-#endif
-    }
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD) ||
-             (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
-             (biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
-             (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
-    {
-      biddyVariableTable.table[i].prev = i+1;
-      biddyVariableTable.table[i].next = i-1;
-#ifdef VARIABLEORDERINGMATRIX_YES
-      for (j=1; j<i; j++) {
-        SET_ORDER(biddyOrderingTable,i,j);
-      }
-#else
-      biddyOrderingTable[i] = biddyVariableTable.size-i-1;
-#endif
-    }
+  else if (biddyManagerType2 == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType2 == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
 #endif
+  else {
+    fprintf(stderr,"Biddy_Managed_CopyFormula: Unsupported BDD type!\n");
+    return;
   }
-  biddyVariableTable.num = 1; /* ONLY VARIABLE '1' IS CREATED */
-  biddyVariableTable.numnum = 1; /* VARIABLE '1' IS A NUMBERED VARIABLE */
 
-  /* LOOKUP TABLE FOR FASTER SEARCHING OF VARIABLES */
-  /* THIS IS NOT FULLY IMPLEMENTED AND NOT USED, YET */
-  biddyVariableTable.lookup = (BiddyLookupVariable *)
-                malloc(biddyVariableTable.size * sizeof(BiddyLookupVariable));
-  biddyVariableTable.lookup[0].name = strdup("1");
-  biddyVariableTable.lookup[0].v = 0;
+  BiddyManagedCopyFormula(MNG1,MNG2,x);
+}
 
-  /* DEBUGGING */
-  /*
-  writeORDER(MNG);
-  */
+#ifdef __cplusplus
+}
+#endif
 
-  /* DEBUGGING */
-  /*
-  warshall(biddyOrderingTable,BiddyManagedVariableTableNum(MNG));
-  writeORDER(MNG);
-  */
+/***************************************************************************//*!
+\brief Function Biddy_Managed_ConstructBDD constructs BDD from lists of
+       nodes and edges.
 
-  /* INITIALIZATION OF MEMORY MANAGEMENT */
-  /* ALLOCATE FIRST CHUNK OF NODES */
-  biddyNodeTable.blocksize = biddyNodeTable.initblocksize;
-  if (!(biddyFreeNodes = (BiddyNode *)
-        malloc((biddyNodeTable.blocksize) * sizeof(BiddyNode)))) {
-    fprintf(stderr,"BiddyInitMNG (nodes): Out of memoy!\n");
-    exit(1);
+### Description
+    In both lists, elements are separated with spaces. Multiple labels
+    are supported, the function returns only one BDD, the corresponding
+    one for the label specified as the first element in nodelist.
+    TO DO: return an array of BDDs
+    Elements of node list has the following format:
+    terminal node zero = (type=0,l=-1,r=-1),
+    terminal node one = (type=1,l=-1,r=-1),
+    regular label = (type=2,r=-1),
+    complemented label = (type=3,r=-1),
+    regular node = (type=4),
+    node with complemented successor(s) = (type=5)
+    An example node list is:
+    'Biddy 0 Biddy 2 1 -1 1 B 4 2 3 2 0 0 -1 -1 3 i 4 4 9
+    4 d 4 5 6 5 0 0 -1 -1 6 y 4 7 8 7 0 0 -1 -1 8 1 1 -1 -1 9
+    d 4 6 10 10 1 1 -1 -1' which is constructed as: '{Biddy}
+    {0 Biddy 2 1 -1} {1 B 4 2 3} {2 0 0 -1 -1} {3 i 4 4 9}
+    {4 d 4 5 6} {5 0 0 -1 -1} {6 y 4 7 8} {7 0 0 -1 -1}
+    {8 1 1 -1 -1} {9 d 4 6 10} {10 1 1 -1 -1}'.
+### Side effects
+    If variable ordering in the file is not compatible with the active ordering
+    then the result will be wrong!
+    If new variables are added then for OBDDs and TZBDDs the existing
+    formulae are repaired regarding the Boolen functions they represent.
+    If new variables are added then for ZBDDs the existing
+    formulae are repaired regarding the combination sets they represent.
+### More info
+    Macro Biddy_ConstructBDD(MNG,numV,varlist,numN,nodelist) is defined
+    for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+Biddy_Edge
+Biddy_Managed_ConstructBDD(Biddy_Manager MNG, int numV, Biddy_String varlist, int numN,
+                           Biddy_String nodelist)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
   }
-  if (!(biddyNodeTable.blocktable = (BiddyNode **)malloc(sizeof(BiddyNode *)))) {
-    fprintf(stderr, "BiddyInitMNG (blocktable): Out of memoy!\n");
-    exit(1);
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
   }
-  biddyNodeTable.blocktable[0] = biddyFreeNodes;
-  biddyNodeTable.table[0] = biddyFreeNodes;
-  biddyFreeNodes = &biddyFreeNodes[1];
-  for (i=0; i<biddyNodeTable.blocksize-2; i++) {
-    biddyFreeNodes[i].list = (void *) &biddyFreeNodes[i+1];
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
+#endif
+  else {
+    fprintf(stderr,"Biddy_Managed_ConstructBDD: Unsupported BDD type!\n");
+    return biddyNull;
   }
-  biddyFreeNodes[biddyNodeTable.blocksize-2].list = NULL;
-  biddyNodeTable.generated = biddyNodeTable.blocksize;
-  biddyNodeTable.blocknumber = 1;
 
-  /* MAKE TERMINAL NODE "1" */
-  /* TERMINAL NODE IS "1" FOR ALL BDD TYPES AND IT IS AT INDEX [0] */
-  biddyNodeTable.table[0]->prev = NULL;
-  biddyNodeTable.table[0]->next = NULL;
-  biddyNodeTable.table[0]->list = NULL;
-  biddyNodeTable.table[0]->f = biddyNull;
-  biddyNodeTable.table[0]->t = biddyNull;
-  biddyNodeTable.table[0]->v = 0; /* terminal node is the only one with v = 0 */
-  biddyNodeTable.table[0]->expiry = 0; /* terminal node is fortified */
-  biddyNodeTable.table[0]->select = 0; /* initialy it is not selected */
+  return BiddyManagedConstructBDD(MNG,numV,varlist,numN,nodelist);
+}
 
-  /* MAKE TERMINAL EDGE AND EDGES REPRESENTING CONSTANTS */
-  /* FOR THE EMPTY DOMAIN, biddyZero AND biddyOne ARE THE SAME FOR ALL BDD TYPES */
-  /* biddyTerminal IS "1" FOR ALL BDD TYPES, INCLUDING OBDD, ZBDD, AND TZBDD */
-  /* biddyZero IS COMPLEMENTED FOR ALL BDD TYPES, INCLUDING OBDD, ZBDD, AND TZBDD */
-  MNG[2] = (void *) biddyNodeTable.table[0]; /* biddyTerminal */
-  MNG[3] = BiddyComplement(biddyTerminal); /* biddyZero */
-  MNG[4] = biddyTerminal; /* biddyOne */
+#ifdef __cplusplus
+}
+#endif
 
-  /* DEBUGGING */
-  /*
-  printf("DEBUG (BiddyInitMNG): biddyOne = %p\n",biddyOne);
-  printf("DEBUG (BiddyInitMNG): biddyZero = %p\n",biddyZero);
-  */
+/*----------------------------------------------------------------------------*/
+/* Definition of internal functions used to implement external functions      */
+/*----------------------------------------------------------------------------*/
 
-  /* INITIALIZATION OF VARIABLE'S VALUES */
-  biddyVariableTable.table[0].value = biddyZero;
-  for (i=1; i<biddyVariableTable.size; i++) {
-    biddyVariableTable.table[i].value = biddyZero;
-  }
+/***************************************************************************//*!
+\brief Function BiddyInitMNG.
 
-  /* INITIALIZATION OF NODE SELECTION */
-  biddySelect = 1;
+### Description
+### Side effects
+### More info
+    See Biddy_InitMNG.
+*******************************************************************************/
 
-  /* INITIALIZATION OF GARBAGE COLLECTION */
-  /* MINIMAL VALUE FOR biddySystemAge IS 2 (SEE IMPLEMENTATION OF SIFTING) */
-  biddySystemAge = 2;
+void
+BiddyInitMNG(Biddy_Manager *mng, int bddtype)
+{
+  Biddy_Manager MNG;
+  unsigned int i;
+#ifdef VARIABLEORDERINGMATRIX_YES
+  unsigned int j;
+#endif
 
-  /* INITIALIZE FORMULA TABLE */
-  /* first formula is 0, it is always a single terminal node */
-  /* second formula is 1, it could be a large graph, e.g. for ZBDD */
-  biddyFormulaTable.deletedName = strdup("BIDDY_DELETED_FORMULA");
-  biddyFormulaTable.size = 2;
-  biddyFormulaTable.numOrdered = 2;
-  if (!(biddyFormulaTable.table = (BiddyFormula *)
-        malloc(biddyFormulaTable.size*sizeof(BiddyFormula))))
-  {
-    fprintf(stderr,"BiddyInitMNG (formula table): Out of memoy!\n");
-    exit(1);
-  }
-  biddyFormulaTable.table[0].name = strdup("0");
-  biddyFormulaTable.table[0].f = biddyZero;
-  biddyFormulaTable.table[0].expiry = 0;
-  biddyFormulaTable.table[0].deleted = FALSE;
-  biddyFormulaTable.table[1].name = strdup("1");
-  biddyFormulaTable.table[1].f = biddyOne;
-  biddyFormulaTable.table[1].expiry = biddySystemAge;
-  biddyFormulaTable.table[1].deleted = FALSE;
+#ifdef UNIX
+  struct timeval tv;
+  struct rlimit rl;
+#endif
 
-  /* INITIALIZATION OF NODE TABLE */
-  biddyNodeTable.max = 1;
-  biddyNodeTable.num = 1;
+#ifdef PLAIN
+  if ((bddtype == BIDDYTYPETZBDDC) || (bddtype == BIDDYTYPETZBDD) ||
+      (bddtype == BIDDYTYPETZFDDC) || (bddtype == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"This instance of Biddy library was compiled with -DPLAIN.\n");
+    fprintf(stderr,"Tagged binary decision diagrams are not supported.\n");
+    exit(1);
+  }
+#endif
+
+#ifdef UNIX
+  /* printf("The page size for this system is %ld bytes.\n", sysconf(_SC_PAGESIZE)); */
+  rl.rlim_max  = rl.rlim_cur = RLIM_INFINITY;
+  if (setrlimit(RLIMIT_STACK, &rl)) {
+    fprintf(stderr,"ERROR: setrlimit\n");
+    perror("setrlimit");
+    exit(1);
+  }
+#endif
+
+#ifdef UNIXXX
+  mallopt(M_MMAP_MAX,0);
+  mallopt(M_TRIM_THRESHOLD,-1);
+#endif
+
+  /* RANDOM NUMBERS GENERATOR */
+#ifdef UNIX
+  gettimeofday(&tv,0);
+  srand(tv.tv_usec);
+#else
+  srand((unsigned int) time(NULL));
+#endif
+
+  if (!mng) {
+    if (!(biddyAnonymousManager = (Biddy_Manager) malloc(sizeof(BiddyManager)))) {
+      fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+      exit(1);
+    }
+    MNG = biddyAnonymousManager;
+  } else {
+    if (!(*mng = (Biddy_Manager) malloc(sizeof(BiddyManager)))) {
+      fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+      exit(1);
+    }
+    MNG = *mng;
+  }
+
+  /* DEBUGGING */
+  /*
+  printf("DEBUG (BiddyInitMNG): BiddyInitMNG STARTED\n");
+  printf("DEBUG (BiddyInitMNG): mng = %p\n",mng);
+  printf("DEBUG (BiddyInitMNG): bddtype = %d\n",bddtype);
+  printf("DEBUG (BiddyInitMNG): MNG = %p\n",MNG);
+  */
+
+  /* CREATION OF MANAGER'S STRUCTURES - VALUES ARE NOT INITIALIZED HERE */
+  MNG[0] = NULL; /* biddyManagerName */
+  if (!(MNG[1] = (short int *) malloc(sizeof(short int)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyManagerType = 0;
+  MNG[2] = NULL; /* biddyTerminal */
+  MNG[3] = NULL; /* biddyZero */
+  MNG[4] = NULL; /* biddyOne */
+  if (!(MNG[5] = (BiddyNodeTable *) malloc(sizeof(BiddyNodeTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyNodeTable.table = NULL;
+  biddyNodeTable.blocktable = NULL;
+  biddyNodeTable.blocksizetable = NULL;
+  biddyNodeTable.unused = NULL;
+  biddyNodeTable.unusednum = 0;
+  biddyNodeTable.blockalloc = nodeBlockMalloc;
+  biddyNodeTable.blockfree = nodeBlockFree;
+#ifdef ARENA
+  biddyNodeTable.arena = NULL;
+#endif
+  biddyNodeTable.initsize = 0;
+  biddyNodeTable.size = 0;
+  biddyNodeTable.limitsize = 0;
+  biddyNodeTable.blocknumber = 0;
+  biddyNodeTable.initblocksize = 0;
+  biddyNodeTable.blocksize = 0;
+  biddyNodeTable.limitblocksize = 0;
+  biddyNodeTable.generated = 0;
+  biddyNodeTable.max = 0;
+  biddyNodeTable.num = 0;
   biddyNodeTable.garbage = 0;
+  biddyNodeTable.gcminor = 0;
+  biddyNodeTable.generational = FALSE;
+  biddyNodeTable.zbddskip = BIDDYZBDDSKIP;
+  biddyNodeTable.iterative = BIDDYITERATIVEAPPLY;
+  biddyNodeTable.applystack = NULL;
+  biddyNodeTable.applystacksize = 0;
+  biddyNodeTable.applystacktop = 0;
+  biddyNodeTable.nurseryok = FALSE;
+  biddyNodeTable.nurseryfull = FALSE;
+  biddyNodeTable.oldnum = 0;
   biddyNodeTable.swap = 0;
   biddyNodeTable.sifting = 0;
   biddyNodeTable.nodetableresize = 0;
+  biddyNodeTable.compaction = 0;
   biddyNodeTable.funite = 0;
   biddyNodeTable.funandor = 0;
   biddyNodeTable.funxor = 0;
   biddyNodeTable.gctime = 0;
+  biddyNodeTable.gcminortime = 0;
+  biddyNodeTable.gcwalltime = 0;
+  biddyNodeTable.gcthreads = 1;
   biddyNodeTable.drtime = 0;
-#ifdef BIDDYEXTENDEDSTATS_YES
+  biddyNodeTable.compacttime = 0;
+  biddyNodeTable.compactfreed = 0;
+  biddyNodeTable.gcratio = 0.0;
+  biddyNodeTable.gcratioF = 0.0;
+  biddyNodeTable.gcratioX = 0.0;
+  biddyNodeTable.resizeratio = 0.0;
+  biddyNodeTable.resizeratioF = 0.0;
+  biddyNodeTable.resizeratioX = 0.0;
+  biddyNodeTable.siftingtreshold = 0.0;
+  biddyNodeTable.convergesiftingtreshold = 0.0;
+  biddyNodeTable.cacheratio = 0.0;
+  biddyNodeTable.extendedstats = BIDDYEXTENDEDSTATS;
   biddyNodeTable.foa = 0;
   biddyNodeTable.find = 0;
   biddyNodeTable.compare = 0;
@@ -4692,68 +4804,736 @@ BiddyInitMNG(Biddy_Manager *mng, int bddtype)
   biddyNodeTable.andorrecursive = 0;
   biddyNodeTable.xorrecursive = 0;
   biddyNodeTable.gcobsolete = NULL;
+  if (!(MNG[6] = (BiddyVariableTable *) malloc(sizeof(BiddyVariableTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyVariableTable.table = NULL;
+  biddyVariableTable.lookup = NULL;
+  biddyVariableTable.size = 0;
+  biddyVariableTable.num = 0;
+  biddyVariableTable.numnum = 0;
+  if (!(MNG[7] = (BiddyFormulaTable *) malloc(sizeof(BiddyFormulaTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyFormulaTable.table = NULL;
+  biddyFormulaTable.size = 0;
+  biddyFormulaTable.numOrdered = 0;
+  biddyFormulaTable.deletedName = NULL;
+  if (!(MNG[8] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyOPCache.table = NULL;
+#ifdef COMPACTCACHE
+  biddyOPCache.tags = NULL;
+  biddyOPCache.arena = NULL;
 #endif
-
-  /* INITIALIZATION OF CACHE LIST */
-  biddyCacheList = NULL;
-
-  /* INITIALIZATION OF DEFAULT OPERATION CACHE - USED FOR ITE AND OTHER BOOLEAN OPERATIONS */
+  biddyOPCache.size = 0;
+  biddyOPCache.ways = BIDDYCACHEWAYS;
   biddyOPCache.disabled = FALSE;
-  *(biddyOPCache.notusedyet) = TRUE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  *(biddyOPCache.search) = *(biddyOPCache.find) = 0;
-  *(biddyOPCache.insert) = *(biddyOPCache.overwrite) = 0;
+  biddyOPCache.stats = BIDDYEXTENDEDSTATS;
+#ifdef PARALLELAPPLY
+  biddyOPCache.lock = NULL;
 #endif
-  if (!(biddyOPCache.table = (BiddyOp3Cache *)
-  calloc((biddyOPCache.size+1),sizeof(BiddyOp3Cache)))) {
-    fprintf(stderr,"BiddyInitMNG (OP cache): Out of memoy!\n");
+  if (!(biddyOPCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
     exit(1);
   }
-  /* for (i=0;i<=biddyOPCache.size;i++) biddyOPCache.table[i].result = biddyNull; */
-  BiddyManagedAddCache(MNG,BiddyOPGarbage);
-
-  /* INITIALIZATION OF DEFAULT EA CACHE - USED FOR QUANTIFICATIONS */
+  *(biddyOPCache.notusedyet) = FALSE;
+  if (!(biddyOPCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyOPCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyOPCache.search) = 0;
+  *(biddyOPCache.find) = 0;
+  biddyOPCache.lastsearch = 0;
+  biddyOPCache.lastfind = 0;
+  if (!(biddyOPCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyOPCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyOPCache.insert) = 0;
+  *(biddyOPCache.overwrite) = 0;
+  if (!(MNG[9] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyEACache.table = NULL;
+#ifdef COMPACTCACHE
+  biddyEACache.tags = NULL;
+  biddyEACache.arena = NULL;
+#endif
+  biddyEACache.size = 0;
+  biddyEACache.ways = BIDDYCACHEWAYS;
   biddyEACache.disabled = FALSE;
-  *(biddyEACache.notusedyet) = TRUE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  *(biddyEACache.search) = *(biddyEACache.find) = 0;
-  *(biddyEACache.insert) = *(biddyEACache.overwrite) = 0;
+  biddyEACache.stats = BIDDYEXTENDEDSTATS;
+#ifdef PARALLELAPPLY
+  biddyEACache.lock = NULL;
 #endif
-  if (!(biddyEACache.table = (BiddyOp3Cache *)
-  calloc((biddyEACache.size+1),sizeof(BiddyOp3Cache)))) {
-    fprintf(stderr,"BiddyInitMNG (EA cache): Out of memoy!\n");
+  if (!(biddyEACache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
     exit(1);
   }
-  /* for (i=0;i<=biddyEACache.size;i++) biddyEACache.table[i].result = biddyNull; */
-  BiddyManagedAddCache(MNG,BiddyEAGarbage);
-
-  /* INITIALIZATION OF DEFAULT RC CACHE - USED FOR RESTRICT AND COMPOSE */
+  *(biddyEACache.notusedyet) = FALSE;
+  if (!(biddyEACache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyEACache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyEACache.search) = 0;
+  *(biddyEACache.find) = 0;
+  biddyEACache.lastsearch = 0;
+  biddyEACache.lastfind = 0;
+  if (!(biddyEACache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyEACache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyEACache.insert) = 0;
+  *(biddyEACache.overwrite) = 0;
+  if (!(MNG[10] = (BiddyOp3CacheTable *) malloc(sizeof(BiddyOp3CacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyRCCache.table = NULL;
+#ifdef COMPACTCACHE
+  biddyRCCache.tags = NULL;
+  biddyRCCache.arena = NULL;
+#endif
+  biddyRCCache.size = 0;
+  biddyRCCache.ways = BIDDYCACHEWAYS;
   biddyRCCache.disabled = FALSE;
-  *(biddyRCCache.notusedyet) = TRUE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  *(biddyRCCache.search) = *(biddyRCCache.find) = 0;
-  *(biddyRCCache.insert) = *(biddyRCCache.overwrite) = 0;
+  biddyRCCache.stats = BIDDYEXTENDEDSTATS;
+#ifdef PARALLELAPPLY
+  biddyRCCache.lock = NULL;
 #endif
-  if (!(biddyRCCache.table = (BiddyOp3Cache *)
-  calloc((biddyRCCache.size+1),sizeof(BiddyOp3Cache)))) {
-    fprintf(stderr,"BiddyInitMNG (RC cache): Out of memoy!\n");
+  if (!(biddyRCCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
     exit(1);
   }
-  /* for (i=0;i<=biddyRCCache.size;i++) biddyRCCache.table[i].result = biddyNull; */
-  BiddyManagedAddCache(MNG,BiddyRCGarbage);
-
-  /* INITIALIZATION OF DEFAULT REPLACE CACHE - USED FOR REPLACE */
+  *(biddyRCCache.notusedyet) = FALSE;
+  if (!(biddyRCCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyRCCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyRCCache.search) = 0;
+  *(biddyRCCache.find) = 0;
+  biddyRCCache.lastsearch = 0;
+  biddyRCCache.lastfind = 0;
+  if (!(biddyRCCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyRCCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyRCCache.insert) = 0;
+  *(biddyRCCache.overwrite) = 0;
+  if (!(MNG[11] = (BiddyKeywordCacheTable *) malloc(sizeof(BiddyKeywordCacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyReplaceCache.table = NULL;
+  biddyReplaceCache.size = 0;
   biddyReplaceCache.keywordList = NULL;
   biddyReplaceCache.keyList = NULL;
   biddyReplaceCache.keyNum = 0;
   biddyReplaceCache.keywordNum = 0;
   biddyReplaceCache.disabled = FALSE;
-  *(biddyReplaceCache.notusedyet) = TRUE;
-#ifdef BIDDYEXTENDEDSTATS_YES
-  *(biddyReplaceCache.search) = *(biddyReplaceCache.find) = 0;
-  *(biddyReplaceCache.insert) = *(biddyReplaceCache.overwrite) = 0;
-#endif
-  if (!(biddyReplaceCache.table = (BiddyKeywordCache *)
+  biddyReplaceCache.stats = BIDDYEXTENDEDSTATS;
+  if (!(biddyReplaceCache.notusedyet = (Biddy_Boolean *) malloc(sizeof(Biddy_Boolean)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyReplaceCache.notusedyet) = FALSE;
+  if (!(biddyReplaceCache.search = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyReplaceCache.find = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyReplaceCache.search) = 0;
+  *(biddyReplaceCache.find) = 0;
+  biddyReplaceCache.lastsearch = 0;
+  biddyReplaceCache.lastfind = 0;
+  if (!(biddyReplaceCache.insert = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyReplaceCache.overwrite = (unsigned long long int *) malloc(sizeof(unsigned long long int)))) {
+    fprintf(stderr, "BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  *(biddyReplaceCache.insert) = 0;
+  *(biddyReplaceCache.overwrite) = 0;
+  if (!(MNG[12] = (BiddyCacheList* *) malloc(sizeof(BiddyCacheList*)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyCacheList = NULL;
+  if (!(MNG[13] = (BiddyNode* *) malloc(sizeof(BiddyNode*)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyFreeNodes = NULL;
+  if (!(MNG[14] = (BiddyOrderingTable *) malloc(sizeof(BiddyOrderingTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  if (!(MNG[15] = (unsigned int *) malloc(sizeof(unsigned int)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddySystemAge = 0;
+  if (!(MNG[16] = (unsigned short int *) malloc(sizeof(unsigned short int)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddySelect = 0;
+  if (!(MNG[17] = (BiddyLocalInfo **) malloc(sizeof(BiddyLocalInfo *)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyLocalInfo = NULL;
+  MNG[18] = NULL; /* operations are not parallel */
+  if (!(MNG[19] = (BiddyCountCacheTable *) malloc(sizeof(BiddyCountCacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyCountCache.table = NULL;
+  biddyCountCache.size = 0;
+  biddyCountCache.search = biddyCountCache.find = 0;
+  if (!(MNG[20] = (BiddyCopyCacheTable *) malloc(sizeof(BiddyCopyCacheTable)))) {
+    fprintf(stderr,"BiddyInitMNG: Out of memoy!\n");
+    exit(1);
+  }
+  biddyCopyCache.table = NULL; /* it is created on the first copy */
+  biddyCopyCache.targetList = NULL;
+  biddyCopyCache.targetNum = 0;
+  biddyCopyCache.keyNum = 0;
+  biddyCopyCache.size = 0;
+#ifdef _MSC_VER
+  biddyCopyCache.serial = ++biddyManagerSerial;
+#else
+  biddyCopyCache.serial = __sync_add_and_fetch(&biddyManagerSerial,1); /* managers may be created concurrently */
+#endif
+  biddyCopyCache.search = biddyCopyCache.find = 0;
+
+  /* INITIALIZATION OF MANAGER'S STRUCTURES  - VALUES ARE NOW INITIALIZED */
+  if (bddtype == BIDDYTYPEOBDD) {
+    MNG[0] = strdup(BIDDYTYPENAMEOBDD); /* biddyManagerName */
+  } else if (bddtype == BIDDYTYPEOBDDC) {
+    MNG[0] = strdup(BIDDYTYPENAMEOBDDC); /* biddyManagerName */
+  }
+#ifndef COMPACT
+  else if (bddtype == BIDDYTYPEZBDD) {
+    MNG[0] = strdup(BIDDYTYPENAMEZBDD); /* biddyManagerName */
+  } else if (bddtype == BIDDYTYPEZBDDC) {
+    MNG[0] = strdup(BIDDYTYPENAMEZBDDC); /* biddyManagerName */
+  } else if (bddtype == BIDDYTYPETZBDD) {
+#if UINTPTR_MAX == 0xffffffffffffffff
+#else
+    fprintf(stderr,"BiddyInitMNG: TZBDDs are supported on 64-bit architecture, only!\n");
+    exit(1);
+#endif
+    MNG[0] = strdup(BIDDYTYPENAMETZBDD); /* biddyManagerName */
+  } else if (bddtype == BIDDYTYPETZBDDC) {
+#if UINTPTR_MAX == 0xffffffffffffffff
+#else
+    fprintf(stderr,"BiddyInitMNG: TZBDDs are supported on 64-bit architecture, only!\n");
+    exit(1);
+#endif
+    MNG[0] = strdup(BIDDYTYPENAMETZBDDC); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZBDDC);
+    exit(1);
+  } else if (bddtype == BIDDYTYPEOFDD) {
+    MNG[0] = strdup(BIDDYTYPENAMEOFDD); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEOFDD);
+    exit(1);
+  } else if (bddtype == BIDDYTYPEOFDDC) {
+    MNG[0] = strdup(BIDDYTYPENAMEOFDDC); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEOFDDC);
+    exit(1);
+  } else if (bddtype == BIDDYTYPEZFDD) {
+    MNG[0] = strdup(BIDDYTYPENAMEZFDD); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEZFDD);
+    exit(1);
+  } else if (bddtype == BIDDYTYPEZFDDC) {
+    MNG[0] = strdup(BIDDYTYPENAMEZFDDC); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMEZFDDC);
+    exit(1);
+  } else if (bddtype == BIDDYTYPETZFDD) {
+#if UINTPTR_MAX == 0xffffffffffffffff
+#else
+    fprintf(stderr,"BiddyInitMNG: TZFDDs are supported on 64-bit architecture, only!\n");
+    exit(1);
+#endif
+    MNG[0] = strdup(BIDDYTYPENAMETZFDD); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZFDD);
+    exit(1);
+  } else if (bddtype == BIDDYTYPETZFDDC) {
+#if UINTPTR_MAX == 0xffffffffffffffff
+#else
+    fprintf(stderr,"BiddyInitMNG: TZFDDs are supported on 64-bit architecture, only!\n");
+    exit(1);
+#endif
+    MNG[0] = strdup(BIDDYTYPENAMETZFDDC); /* biddyManagerName */
+    fprintf(stderr,"BiddyInitMNG: %s is not supported, yet!\n",BIDDYTYPENAMETZFDDC);
+    exit(1);
+  } else {
+    fprintf(stderr,"BiddyInitMNG: Unsupported BDD type!\n");
+    exit(1);
+  }
+#else
+  else {
+    fprintf(stderr,"BiddyInitMNG: This variant of Biddy library supports ROBDD, only!\n");
+    exit(1);
+  }
+#endif
+
+  /* THESE ARE MAIN SETTINGS FOR MEMORY MANAGEMENT AND GC */
+  biddyManagerType = bddtype;
+  biddyVariableTable.size = BIDDYVARIABLETABLESIZE;
+  biddyNodeTable.initblocksize = BIDDYNODETABLEINITBLOCKSIZE;
+  biddyNodeTable.limitblocksize = BIDDYNODETABLELIMITBLOCKSIZE;
+  biddyNodeTable.initsize = BIDDYNODETABLEINITSIZE;
+  biddyNodeTable.limitsize = BIDDYNODETABLELIMITSIZE;
+  biddyOPCache.size = BIDDYOPCACHESIZE;
+  biddyOPCache.initsize = biddyOPCache.size;
+  biddyEACache.size = BIDDYEACACHESIZE;
+  biddyEACache.initsize = biddyEACache.size;
+  biddyRCCache.size = BIDDYRCCACHESIZE;
+  biddyRCCache.initsize = biddyRCCache.size;
+  biddyReplaceCache.size = BIDDYREPLACECACHESIZE;
+  biddyReplaceCache.initsize = biddyReplaceCache.size;
+  biddyNodeTable.gcratio = (float) BIDDYNODETABLEGCRATIO; /* do not delete nodes if the effect is to small, gcratio */
+  biddyNodeTable.gcratioF = (float) BIDDYNODETABLEGCRATIOF; /* do not delete nodes if the effect is to small, gcratio */
+  biddyNodeTable.gcratioX = (float) BIDDYNODETABLEGCRATIOX; /* do not delete nodes if the effect is to small, gcratio */
+  biddyNodeTable.resizeratio = (float) BIDDYNODETABLERESIZERATIO; /* resize Node table if there are to many nodes */
+  biddyNodeTable.resizeratioF = (float) BIDDYNODETABLERESIZERATIOF; /* resize Node table if there are to many nodes */
+  biddyNodeTable.resizeratioX = (float) BIDDYNODETABLERESIZERATIOX; /* resize Node table if there are to many nodes */
+  biddyNodeTable.siftingtreshold = (float) BIDDYNODETABLESIFTINGTRESHOLD;  /* stop sifting if the size of the system grows to much */
+  biddyNodeTable.convergesiftingtreshold = (float) BIDDYNODETABLECONVERGESIFTINGTRESHOLD;  /* stop one step of converging sifting if the size of the system grows to much */
+  biddyNodeTable.siftingfactor = (float) BIDDYNODETABLESIFTINGFACTOR;  /* sifting heuristics */
+  biddyNodeTable.cacheratio = (float) BIDDYCACHERESIZERATIO;  /* resize cache tables if there are enough hits */
+
+  /* CREATE AND INITIALIZE NODE TABLE */
+  /* THE ACTUAL SIZE OF NODE TABLE IS biddyNodeTable.size+2 */
+  /* BECAUSE OF USED TRICKS, HASH FUNCTION MUST NEVER RETURN ZERO! */
+  /* USEFUL INDICES ARE FROM [1] TO [biddyNodeTable.size+1] */
+  /* FOR NODETABLE_SUBTABLES, ONLY [0] IS USED AND SUBTABLES ARE CREATED WITH VARIABLES */
+#ifdef NODETABLE_SUBTABLES
+  biddyNodeTable.size = 0;
+#else
+  biddyNodeTable.size = biddyNodeTable.initsize;
+#endif
+  if (!(biddyNodeTable.table = (BiddyNode **)
+  calloc((biddyNodeTable.size+2),sizeof(BiddyNode *)))) {
+    fprintf(stderr,"BiddyInitMNG (node table): Out of memoy!\n");
+    exit(1);
+  }
+  /* for (i=0;i<=biddyNodeTable.size+1;i++) biddyNodeTable.table[i] = NULL; */
+
+  /* CREATE AND INITIALIZE VARIABLE TABLE */
+  /* VARIABLE "1" HAS INDEX = 0 and global order = size-1 */
+  /* VARIABLES ARE ORDERED BY INDEX IN THE VARIABLE TABLE */
+  /* IN THE BDD, SMALLER (PREV) VARIABLES ARE ABOVE THE GREATER (NEXT) ONES */
+  /* VARIABLE "1" MUST ALWAYS HAVE MAX GLOBAL ORDER (IT IS BOTTOMMOST) */
+  /* THIS PART OF CODE DETERMINES DEFAULT ORDERING FOR NEW VARIABLES: */
+  /* ORDER FOR OBDDs AND OFDDs: [1] < [2] < ... < [size-1] < [0] */
+  /* ORDER FOR ZBDDs, ZFDDs, TZBDDs, AND TZFDDs: [size-1] < [size-2] < ... < [1] < [0] */
+  /* FOR OBDDs AND OFDDs: the topmost variable always has prev=biddyVariableTable.size */
+  /* FOR ZBDDs, ZFDDs, TZBDDs, AND TZFDDs: the topmost variable always has prev=biddyVariableTable.num */
+  biddyVariableTable.table = (BiddyVariable *)
+                malloc(biddyVariableTable.size * sizeof(BiddyVariable));
+  biddyVariableTable.table[0].name = strdup("1");
+  biddyVariableTable.table[0].num = 1;
+  biddyVariableTable.table[0].firstNode = NULL;
+  biddyVariableTable.table[0].lastNode = NULL;
+  biddyVariableTable.table[0].lastOldNode = NULL;
+  biddyVariableTable.table[0].variable = biddyNull;
+  biddyVariableTable.table[0].element = biddyNull;
+  biddyVariableTable.table[0].selected = FALSE;
+  biddyVariableTable.table[0].data = NULL;
+#ifdef NODETABLE_SUBTABLES
+  biddyVariableTable.table[0].subtable = NULL; /* terminal node is not stored in Node table */
+  biddyVariableTable.table[0].subtablesize = 0;
+#endif
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD))
+  {
+    biddyVariableTable.table[0].prev = biddyVariableTable.size;
+    biddyVariableTable.table[0].next = 0; /* fixed */
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
+  {
+    biddyVariableTable.table[0].prev = biddyVariableTable.size;
+    biddyVariableTable.table[0].next = 0; /* fixed */
+  }
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD) ||
+           (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+           (biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+           (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    biddyVariableTable.table[0].prev = 1;
+    biddyVariableTable.table[0].next = 0; /* fixed */
+  }
+#endif
+  nullOrdering(biddyOrderingTable);
+#ifndef VARIABLEORDERINGMATRIX_YES
+  biddyOrderingTable[0] = biddyVariableTable.size-1;
+#endif
+  for (i=1; i<biddyVariableTable.size; i++) {
+    biddyVariableTable.table[i].name = NULL;
+    biddyVariableTable.table[i].num = 0;
+    biddyVariableTable.table[i].firstNode = NULL;
+    biddyVariableTable.table[i].lastNode = NULL;
+    biddyVariableTable.table[i].lastOldNode = NULL;
+    biddyVariableTable.table[i].variable = biddyNull;
+    biddyVariableTable.table[i].element = biddyNull;
+    biddyVariableTable.table[i].selected = FALSE;
+    biddyVariableTable.table[i].data = NULL;
+#ifdef NODETABLE_SUBTABLES
+    biddyVariableTable.table[i].subtable = NULL;
+    biddyVariableTable.table[i].subtablesize = 0;
+#endif
+#ifdef VARIABLEORDERINGMATRIX_YES
+    SET_ORDER(biddyOrderingTable,i,0);
+#endif
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD))
+    {
+      biddyVariableTable.table[i].prev = i-1;
+      biddyVariableTable.table[i].next = i+1;
+#ifdef VARIABLEORDERINGMATRIX_YES
+      for (j=i+1; j<biddyVariableTable.size; j++) {
+        SET_ORDER(biddyOrderingTable,i,j);
+      }
+#else
+      biddyOrderingTable[i] = i-1;
+#endif
+    }
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
+    {
+      biddyVariableTable.table[i].prev = i-1;
+      biddyVariableTable.table[i].next = i+1;
+#ifdef VARIABLEORDERINGMATRIX_YES
+      for (j=i+1; j<biddyVariableTable.size; j++) {
+        SET_ORDER(biddyOrderingTable,i,j);
+      }
+#else
+      biddyOrderingTable[i] = i-1;
+#endif
+    }
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD) ||
+             (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+             (biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+             (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+    {
+      biddyVariableTable.table[i].prev = i+1;
+      biddyVariableTable.table[i].next = i-1;
+#ifdef VARIABLEORDERINGMATRIX_YES
+      for (j=1; j<i; j++) {
+        SET_ORDER(biddyOrderingTable,i,j);
+      }
+#else
+      biddyOrderingTable[i] = biddyVariableTable.size-i-1;
+#endif
+    }
+#endif
+  }
+  biddyVariableTable.num = 1; /* ONLY VARIABLE '1' IS CREATED */
+  biddyVariableTable.numnum = 1; /* VARIABLE '1' IS A NUMBERED VARIABLE */
+
+  /* LOOKUP TABLE FOR FASTER SEARCHING OF VARIABLES */
+  /* THIS IS NOT FULLY IMPLEMENTED AND NOT USED, YET */
+  biddyVariableTable.lookup = (BiddyLookupVariable *)
+                malloc(biddyVariableTable.size * sizeof(BiddyLookupVariable));
+  biddyVariableTable.lookup[0].name = strdup("1");
+  biddyVariableTable.lookup[0].v = 0;
+
+  /* DEBUGGING */
+  /*
+  writeORDER(MNG);
+  */
+
+  /* DEBUGGING */
+  /*
+  warshall(biddyOrderingTable,BiddyManagedVariableTableNum(MNG));
+  writeORDER(MNG);
+  */
+
+  /* INITIALIZATION OF MEMORY MANAGEMENT */
+  /* ALLOCATE FIRST CHUNK OF NODES */
+  biddyNodeTable.blocksize = biddyNodeTable.initblocksize;
+#ifdef ARENA
+  /* THE FIRST CHUNK OF NODES IS AT THE BEGINNING OF THE ARENA */
+  /* THE TERMINAL NODE HAS INDEX 0 AND THUS INDEX 0 IS NEVER USED IN THE CHAINS */
+  if (!(biddyNodeTable.arena = arenaReserve(BIDDYARENASIZE))) {
+    fprintf(stderr,"BiddyInitMNG (arena): Out of memoy!\n");
+    exit(1);
+  }
+  biddyFreeNodes = biddyNodeTable.arena;
+#else
+  if (!(biddyFreeNodes = (BiddyNode *)
+        malloc((biddyNodeTable.blocksize) * sizeof(BiddyNode)))) {
+    fprintf(stderr,"BiddyInitMNG (nodes): Out of memoy!\n");
+    exit(1);
+  }
+#endif
+  if (!(biddyNodeTable.blocktable = (BiddyNode **)malloc(sizeof(BiddyNode *)))) {
+    fprintf(stderr, "BiddyInitMNG (blocktable): Out of memoy!\n");
+    exit(1);
+  }
+  if (!(biddyNodeTable.blocksizetable = (unsigned int *)malloc(sizeof(unsigned int)))) {
+    fprintf(stderr, "BiddyInitMNG (blocksizetable): Out of memoy!\n");
+    exit(1);
+  }
+  biddyNodeTable.blocktable[0] = biddyFreeNodes;
+  biddyNodeTable.blocksizetable[0] = biddyNodeTable.blocksize;
+  biddyNodeTable.table[0] = biddyFreeNodes;
+  /* NODES ARE NOT LINKED INTO THE LIST OF FREE NODES, THEY ARE TAKEN ONE BY ONE */
+  biddyNodeTable.unused = &biddyFreeNodes[1];
+  biddyNodeTable.unusednum = biddyNodeTable.blocksize - 1;
+  biddyFreeNodes = NULL;
+  biddyNodeTable.generated = biddyNodeTable.blocksize;
+  biddyNodeTable.blocknumber = 1;
+
+  /* MAKE TERMINAL NODE "1" */
+  /* TERMINAL NODE IS "1" FOR ALL BDD TYPES AND IT IS AT INDEX [0] */
+#if defined(NODETABLE_OPENADDRESSING)
+  /* fields prev and next do not exist */
+#elif defined(ARENA)
+  biddyNodeTable.table[0]->prev = 0;
+  biddyNodeTable.table[0]->next = 0;
+#else
+  biddyNodeTable.table[0]->prev = NULL;
+  biddyNodeTable.table[0]->next = NULL;
+#endif
+  biddyNodeTable.table[0]->list = NULL;
+  biddyNodeTable.table[0]->f = biddyNull;
+  biddyNodeTable.table[0]->t = biddyNull;
+  biddyNodeTable.table[0]->v = 0; /* terminal node is the only one with v = 0 */
+  biddyNodeTable.table[0]->expiry = 0; /* terminal node is fortified */
+  biddyNodeTable.table[0]->select = 0; /* initialy it is not selected */
+
+  /* MAKE TERMINAL EDGE AND EDGES REPRESENTING CONSTANTS */
+  /* FOR THE EMPTY DOMAIN, biddyZero AND biddyOne ARE THE SAME FOR ALL BDD TYPES */
+  /* biddyTerminal IS "1" FOR ALL BDD TYPES, INCLUDING OBDD, ZBDD, AND TZBDD */
+  /* biddyZero IS COMPLEMENTED FOR ALL BDD TYPES, INCLUDING OBDD, ZBDD, AND TZBDD */
+  MNG[2] = (void *) biddyNodeTable.table[0]; /* biddyTerminal */
+  MNG[3] = BiddyComplement(biddyTerminal); /* biddyZero */
+  MNG[4] = biddyTerminal; /* biddyOne */
+
+  /* DEBUGGING */
+  /*
+  printf("DEBUG (BiddyInitMNG): biddyOne = %p\n",biddyOne);
+  printf("DEBUG (BiddyInitMNG): biddyZero = %p\n",biddyZero);
+  */
+
+  /* INITIALIZATION OF VARIABLE'S VALUES */
+  biddyVariableTable.table[0].value = biddyZero;
+  for (i=1; i<biddyVariableTable.size; i++) {
+    biddyVariableTable.table[i].value = biddyZero;
+  }
+
+  /* INITIALIZATION OF NODE SELECTION */
+  biddySelect = 1;
+
+  /* INITIALIZATION OF GARBAGE COLLECTION */
+  /* MINIMAL VALUE FOR biddySystemAge IS 2 (SEE IMPLEMENTATION OF SIFTING) */
+  biddySystemAge = 2;
+
+  /* INITIALIZE FORMULA TABLE */
+  /* first formula is 0, it is always a single terminal node */
+  /* second formula is 1, it could be a large graph, e.g. for ZBDD */
+  biddyFormulaTable.deletedName = strdup("BIDDY_DELETED_FORMULA");
+  biddyFormulaTable.size = 2;
+  biddyFormulaTable.numOrdered = 2;
+  if (!(biddyFormulaTable.table = (BiddyFormula *)
+        malloc(biddyFormulaTable.size*sizeof(BiddyFormula))))
+  {
+    fprintf(stderr,"BiddyInitMNG (formula table): Out of memoy!\n");
+    exit(1);
+  }
+  biddyFormulaTable.table[0].name = strdup("0");
+  biddyFormulaTable.table[0].f = biddyZero;
+  biddyFormulaTable.table[0].expiry = 0;
+  biddyFormulaTable.table[0].deleted = FALSE;
+  biddyFormulaTable.table[1].name = strdup("1");
+  biddyFormulaTable.table[1].f = biddyOne;
+  biddyFormulaTable.table[1].expiry = biddySystemAge;
+  biddyFormulaTable.table[1].deleted = FALSE;
+
+  /* INITIALIZATION OF NODE TABLE */
+  biddyNodeTable.max = 1;
+  biddyNodeTable.num = 1;
+  biddyNodeTable.garbage = 0;
+  biddyNodeTable.gcminor = 0;
+  biddyNodeTable.generational = FALSE;
+  biddyNodeTable.zbddskip = BIDDYZBDDSKIP;
+  biddyNodeTable.iterative = BIDDYITERATIVEAPPLY;
+  biddyNodeTable.applystack = NULL;
+  biddyNodeTable.applystacksize = 0;
+  biddyNodeTable.applystacktop = 0;
+  biddyNodeTable.nurseryok = FALSE;
+  biddyNodeTable.nurseryfull = FALSE;
+  biddyNodeTable.oldnum = 0;
+  biddyNodeTable.swap = 0;
+  biddyNodeTable.sifting = 0;
+  biddyNodeTable.nodetableresize = 0;
+  biddyNodeTable.compaction = 0;
+  biddyNodeTable.funite = 0;
+  biddyNodeTable.funandor = 0;
+  biddyNodeTable.funxor = 0;
+  biddyNodeTable.gctime = 0;
+  biddyNodeTable.gcminortime = 0;
+  biddyNodeTable.gcwalltime = 0;
+  biddyNodeTable.gcthreads = 1;
+  biddyNodeTable.drtime = 0;
+  biddyNodeTable.compacttime = 0;
+  biddyNodeTable.compactfreed = 0;
+  biddyNodeTable.extendedstats = BIDDYEXTENDEDSTATS;
+  biddyNodeTable.foa = 0;
+  biddyNodeTable.find = 0;
+  biddyNodeTable.compare = 0;
+  biddyNodeTable.add = 0;
+  biddyNodeTable.iterecursive = 0;
+  biddyNodeTable.andorrecursive = 0;
+  biddyNodeTable.xorrecursive = 0;
+  biddyNodeTable.gcobsolete = NULL;
+
+  /* INITIALIZATION OF CACHE LIST */
+  biddyCacheList = NULL;
+
+  /* INITIALIZATION OF DEFAULT OPERATION CACHE - USED FOR ITE AND OTHER BOOLEAN OPERATIONS */
+  biddyOPCache.disabled = FALSE;
+  biddyOPCache.stats = BIDDYEXTENDEDSTATS;
+  *(biddyOPCache.notusedyet) = TRUE;
+  *(biddyOPCache.search) = *(biddyOPCache.find) = 0;
+  biddyOPCache.lastsearch = biddyOPCache.lastfind = 0;
+#ifdef LAZYCACHE
+  biddyOPCache.epoch = 1; /* zeroed entries are not valid */
+#endif
+  *(biddyOPCache.insert) = *(biddyOPCache.overwrite) = 0;
+  if (!(biddyOPCache.table = (BiddyOp3Cache *)
+  BiddyAllocCacheTable((biddyOPCache.size+1)*sizeof(BiddyOp3Cache)))) {
+    fprintf(stderr,"BiddyInitMNG (OP cache): Out of memoy!\n");
+    exit(1);
+  }
+  /* for (i=0;i<=biddyOPCache.size;i++) biddyOPCache.table[i].result = biddyNull; */
+#ifdef COMPACTCACHE
+  biddyOPCache.arena = biddyNodeTable.arena;
+  if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+      (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    if (!(biddyOPCache.tags = (BiddyOp3CacheTags *)
+    BiddyAllocCacheTable((biddyOPCache.size+1)*sizeof(BiddyOp3CacheTags)))) {
+      fprintf(stderr,"BiddyInitMNG (OP cache): Out of memoy!\n");
+      exit(1);
+    }
+  }
+#endif
+  BiddyManagedAddCache(MNG,BiddyOPGarbage);
+
+  /* INITIALIZATION OF DEFAULT EA CACHE - USED FOR QUANTIFICATIONS */
+  biddyEACache.disabled = FALSE;
+  biddyEACache.stats = BIDDYEXTENDEDSTATS;
+  *(biddyEACache.notusedyet) = TRUE;
+  *(biddyEACache.search) = *(biddyEACache.find) = 0;
+  biddyEACache.lastsearch = biddyEACache.lastfind = 0;
+#ifdef LAZYCACHE
+  biddyEACache.epoch = 1; /* zeroed entries are not valid */
+#endif
+  *(biddyEACache.insert) = *(biddyEACache.overwrite) = 0;
+  if (!(biddyEACache.table = (BiddyOp3Cache *)
+  BiddyAllocCacheTable((biddyEACache.size+1)*sizeof(BiddyOp3Cache)))) {
+    fprintf(stderr,"BiddyInitMNG (EA cache): Out of memoy!\n");
+    exit(1);
+  }
+  /* for (i=0;i<=biddyEACache.size;i++) biddyEACache.table[i].result = biddyNull; */
+#ifdef COMPACTCACHE
+  biddyEACache.arena = biddyNodeTable.arena;
+  if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+      (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    if (!(biddyEACache.tags = (BiddyOp3CacheTags *)
+    BiddyAllocCacheTable((biddyEACache.size+1)*sizeof(BiddyOp3CacheTags)))) {
+      fprintf(stderr,"BiddyInitMNG (EA cache): Out of memoy!\n");
+      exit(1);
+    }
+  }
+#endif
+  BiddyManagedAddCache(MNG,BiddyEAGarbage);
+
+  /* INITIALIZATION OF DEFAULT RC CACHE - USED FOR RESTRICT AND COMPOSE */
+  biddyRCCache.disabled = FALSE;
+  biddyRCCache.stats = BIDDYEXTENDEDSTATS;
+  *(biddyRCCache.notusedyet) = TRUE;
+  *(biddyRCCache.search) = *(biddyRCCache.find) = 0;
+  biddyRCCache.lastsearch = biddyRCCache.lastfind = 0;
+#ifdef LAZYCACHE
+  biddyRCCache.epoch = 1; /* zeroed entries are not valid */
+#endif
+  *(biddyRCCache.insert) = *(biddyRCCache.overwrite) = 0;
+  if (!(biddyRCCache.table = (BiddyOp3Cache *)
+  BiddyAllocCacheTable((biddyRCCache.size+1)*sizeof(BiddyOp3Cache)))) {
+    fprintf(stderr,"BiddyInitMNG (RC cache): Out of memoy!\n");
+    exit(1);
+  }
+  /* for (i=0;i<=biddyRCCache.size;i++) biddyRCCache.table[i].result = biddyNull; */
+#ifdef COMPACTCACHE
+  biddyRCCache.arena = biddyNodeTable.arena;
+  if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+      (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    if (!(biddyRCCache.tags = (BiddyOp3CacheTags *)
+    BiddyAllocCacheTable((biddyRCCache.size+1)*sizeof(BiddyOp3CacheTags)))) {
+      fprintf(stderr,"BiddyInitMNG (RC cache): Out of memoy!\n");
+      exit(1);
+    }
+  }
+#endif
+  BiddyManagedAddCache(MNG,BiddyRCGarbage);
+
+  /* INITIALIZATION OF DEFAULT REPLACE CACHE - USED FOR REPLACE */
+  biddyReplaceCache.keywordList = NULL;
+  biddyReplaceCache.keyList = NULL;
+  biddyReplaceCache.keyNum = 0;
+  biddyReplaceCache.keywordNum = 0;
+  biddyReplaceCache.disabled = FALSE;
+  biddyReplaceCache.stats = BIDDYEXTENDEDSTATS;
+  *(biddyReplaceCache.notusedyet) = TRUE;
+  *(biddyReplaceCache.search) = *(biddyReplaceCache.find) = 0;
+  biddyReplaceCache.lastsearch = biddyReplaceCache.lastfind = 0;
+#ifdef LAZYCACHE
+  biddyReplaceCache.epoch = 1; /* zeroed entries are not valid */
+#endif
+  *(biddyReplaceCache.insert) = *(biddyReplaceCache.overwrite) = 0;
+  if (!(biddyReplaceCache.table = (BiddyKeywordCache *)
   calloc((biddyReplaceCache.size+1),sizeof(BiddyKeywordCache)))) {
     fprintf(stderr,"BiddyInitMNG (Replace cache): Out of memoy!\n");
     exit(1);
@@ -4761,6 +5541,18 @@ BiddyInitMNG(Biddy_Manager *mng, int bddtype)
   /* for (i=0;i<=biddyReplaceCache.size;i++) biddyReplaceCache.table[i].result = biddyNull; */
   BiddyManagedAddCache(MNG,BiddyReplaceGarbage);
 
+  /* INITIALIZATION OF COUNT CACHE */
+  biddyCountCache.size = BIDDYCOUNTCACHESIZE;
+  if (!(biddyCountCache.table = (BiddyCountCache *)
+  calloc((biddyCountCache.size+1),sizeof(BiddyCountCache)))) {
+    fprintf(stderr,"BiddyInitMNG (Count cache): Out of memoy!\n");
+    exit(1);
+  }
+  BiddyManagedAddCache(MNG,BiddyCountGarbage);
+
+  /* COPY CACHE IS CREATED ON THE FIRST COPY */
+  BiddyManagedAddCache(MNG,BiddyCopyGarbage);
+
   /* DEBUGGING */
   /*
   debugORDERING(MNG,biddyOrderingTable,biddyVariableTable.num);
@@ -4833,6 +5625,11 @@ BiddyExitMNG(Biddy_Manager *mng)
 #endif
   */
 
+  /*
+  printf("Stop threads used by operations...\n");
+  */
+  BiddyManagedSetApplyThreads(MNG,1);
+
   /*
   printf("Delete name and type...\n");
   */
@@ -4851,14 +5648,21 @@ BiddyExitMNG(Biddy_Manager *mng)
   printf("Delete nodes, block table, and node table...\n");
   */
   if ((BiddyNodeTable*)(MNG[5])) {
-    for (i = 0; i < biddyNodeTable.blocknumber; i++) {
-      free(biddyNodeTable.blocktable[i]);
+#ifdef ARENA
+    arenaRelease(biddyNodeTable.arena,BIDDYARENASIZE);
+#else
+    /* the first memory block is always allocated with malloc */
+    free(biddyNodeTable.blocktable[0]);
+    for (i = 1; i < biddyNodeTable.blocknumber; i++) {
+      biddyNodeTable.blockfree(biddyNodeTable.blocktable[i],
+        biddyNodeTable.blocksizetable[i] * sizeof(BiddyNode));
     }
+#endif
     free(biddyNodeTable.blocktable);
+    free(biddyNodeTable.blocksizetable);
     free(biddyNodeTable.table);
-#ifdef BIDDYEXTENDEDSTATS_YES
     free(biddyNodeTable.gcobsolete);
-#endif
+    free(biddyNodeTable.applystack);
     free((BiddyNodeTable*)(MNG[5]));
   }
 
@@ -4867,6 +5671,11 @@ BiddyExitMNG(Biddy_Manager *mng)
   printf("Delete variable table...\n");
   */
   if ((BiddyVariableTable*)(MNG[6])) {
+#ifdef NODETABLE_SUBTABLES
+    for (i = 1; i < biddyVariableTable.num; i++) {
+      free(biddyVariableTable.table[i].subtable);
+    }
+#endif
     free(biddyVariableTable.table);
     free(biddyVariableTable.lookup);
     free((BiddyVariableTable*)(MNG[6]));
@@ -4887,13 +5696,14 @@ BiddyExitMNG(Biddy_Manager *mng)
   */
   if ((BiddyOp3CacheTable*)(MNG[8])) {
     free(biddyOPCache.table);
+#ifdef COMPACTCACHE
+    free(biddyOPCache.tags);
+#endif
     free(biddyOPCache.notusedyet);
-#ifdef BIDDYEXTENDEDSTATS_YES
     free(biddyOPCache.search);
     free(biddyOPCache.find);
     free(biddyOPCache.insert);
     free(biddyOPCache.overwrite);
-#endif
     free((BiddyOp3CacheTable*)(MNG[8]));
   }
 
@@ -4902,13 +5712,14 @@ BiddyExitMNG(Biddy_Manager *mng)
   */
   if ((BiddyOp3CacheTable*)(MNG[9])) {
     free(biddyEACache.table);
+#ifdef COMPACTCACHE
+    free(biddyEACache.tags);
+#endif
     free(biddyEACache.notusedyet);
-#ifdef BIDDYEXTENDEDSTATS_YES
     free(biddyEACache.search);
     free(biddyEACache.find);
     free(biddyEACache.insert);
     free(biddyEACache.overwrite);
-#endif
     free((BiddyOp3CacheTable*)(MNG[9]));
   }
 
@@ -4917,13 +5728,14 @@ BiddyExitMNG(Biddy_Manager *mng)
   */
   if ((BiddyOp3CacheTable*)(MNG[10])) {
     free(biddyRCCache.table);
+#ifdef COMPACTCACHE
+    free(biddyRCCache.tags);
+#endif
     free(biddyRCCache.notusedyet);
-#ifdef BIDDYEXTENDEDSTATS_YES
     free(biddyRCCache.search);
     free(biddyRCCache.find);
     free(biddyRCCache.insert);
     free(biddyRCCache.overwrite);
-#endif
     free((BiddyOp3CacheTable*)(MNG[10]));
   }
 
@@ -4938,12 +5750,10 @@ BiddyExitMNG(Biddy_Manager *mng)
     free(biddyReplaceCache.keyList);
     free(biddyReplaceCache.table);
     free(biddyReplaceCache.notusedyet);
-#ifdef BIDDYEXTENDEDSTATS_YES
     free(biddyReplaceCache.search);
     free(biddyReplaceCache.find);
     free(biddyReplaceCache.insert);
     free(biddyReplaceCache.overwrite);
-#endif
     free((BiddyKeywordCacheTable*)(MNG[11]));
   }
 
@@ -4980,114 +5790,394 @@ BiddyExitMNG(Biddy_Manager *mng)
   */
   free((unsigned short int*)(MNG[16]));
 
+  /*
+  printf("Delete local info...\n");
+  */
+  free((BiddyLocalInfo**)(MNG[17]));
+
+  /*
+  printf("Delete Count cache...\n");
+  */
+  if ((BiddyCountCacheTable*)(MNG[19])) {
+    free(biddyCountCache.table);
+    free((BiddyCountCacheTable*)(MNG[19]));
+  }
+
+  /*
+  printf("Delete Copy cache...\n");
+  */
+  if ((BiddyCopyCacheTable*)(MNG[20])) {
+    free(biddyCopyCache.table);
+    free(biddyCopyCache.targetList);
+    free((BiddyCopyCacheTable*)(MNG[20]));
+  }
+
   /*
   printf("And finally, delete manager...\n");
   */
   free((BiddyManager*)MNG);
 
-  /* USER SHOULD DELETE HIS OWN CACHES */
+  /* USER SHOULD DELETE HIS OWN CACHES */
+}
+
+/***************************************************************************//*!
+\brief Function BiddyAbout.
+
+### Description
+### Side effects
+### More info
+    See Biddy_About.
+*******************************************************************************/
+
+Biddy_String
+BiddyAbout()
+{
+  return strdup(BIDDYVERSION);
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedIsOK.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_IsOK.
+*******************************************************************************/
+
+/* TO DO: replace with macro */
+Biddy_Boolean
+BiddyManagedIsOK(Biddy_Manager MNG, Biddy_Edge f)
+{
+  assert( MNG );
+
+  return (!(BiddyN(f)->expiry) || ((BiddyN(f)->expiry) >= biddySystemAge));
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedGetManagerType.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_GetManagerType.
+*******************************************************************************/
+
+int
+BiddyManagedGetManagerType(Biddy_Manager MNG)
+{
+  assert( MNG );
+
+  return biddyManagerType;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedGetManagerName.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_GetManagerName.
+*******************************************************************************/
+
+Biddy_String
+BiddyManagedGetManagerName(Biddy_Manager MNG)
+{
+  assert( MNG );
+
+  return biddyManagerName;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSetManagerParameters.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_SetManagerParameters.
+*******************************************************************************/
+
+void
+BiddyManagedSetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF,
+  float gcrX, float rr, float rrF, float rrX, float st, float cst, float cr)
+{
+  assert( MNG );
+
+  if (gcr > 0.0) biddyNodeTable.gcratio = gcr;
+  if (gcrF > 0.0) biddyNodeTable.gcratioF = gcrF;
+  if (gcrX > 0.0) biddyNodeTable.gcratioX = gcrX;
+  if (rr > 0.0) biddyNodeTable.resizeratio = rr;
+  if (rrF > 0.0) biddyNodeTable.resizeratioF = rrF;
+  if (rrX > 0.0) biddyNodeTable.resizeratioX = rrX;
+  if (st > 0.0) biddyNodeTable.siftingtreshold = st;
+  if (cst > 0.0) biddyNodeTable.convergesiftingtreshold = cst;
+  if (cr >= 0.0) biddyNodeTable.cacheratio = cr;
+
+  /* PROFILING */
+  /*
+  fprintf(stderr,"gcr=%.2f, ",biddyNodeTable.gcratio);
+  fprintf(stderr,"gcrF=%.2f, ",biddyNodeTable.gcratioF);
+  fprintf(stderr,"gcrX=%.2f, ",biddyNodeTable.gcratioX);
+  fprintf(stderr,"rr=%.2f, ",biddyNodeTable.resizeratio);
+  fprintf(stderr,"rrF=%.2f, ",biddyNodeTable.resizeratioF);
+  fprintf(stderr,"rrX=%.2f, ",biddyNodeTable.resizeratioX);
+  */
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSetNodeAllocator.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_SetNodeAllocator.
+*******************************************************************************/
+
+void
+BiddyManagedSetNodeAllocator(Biddy_Manager MNG, int allocator,
+  Biddy_AllocFunction alloc, Biddy_FreeFunction free)
+{
+  assert( MNG );
+
+  if (biddyNodeTable.blocknumber > 1) {
+    fprintf(stderr,"Biddy_SetNodeAllocator: Memory blocks have already been allocated!\n");
+    return;
+  }
+
+  if (allocator == BIDDYALLOCMALLOC) {
+    biddyNodeTable.blockalloc = nodeBlockMalloc;
+    biddyNodeTable.blockfree = nodeBlockFree;
+  }
+  else if (allocator == BIDDYALLOCMMAP) {
+    biddyNodeTable.blockalloc = nodeBlockMmap;
+    biddyNodeTable.blockfree = nodeBlockMunmap;
+  }
+  else if ((allocator == BIDDYALLOCUSER) && alloc && free) {
+    biddyNodeTable.blockalloc = alloc;
+    biddyNodeTable.blockfree = free;
+  }
+  else {
+    fprintf(stderr,"Biddy_SetNodeAllocator: Unsupported allocator!\n");
+  }
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSetGenerationalGC.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_SetGenerationalGC.
+*******************************************************************************/
+
+void
+BiddyManagedSetGenerationalGC(Biddy_Manager MNG, Biddy_Boolean generational)
+{
+  assert( MNG );
+
+  biddyNodeTable.generational = generational;
+  biddyNodeTable.nurseryfull = FALSE;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyAbout.
+\brief Function BiddyManagedSetGCThreads.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_About.
+    See Biddy_Managed_SetGCThreads.
 *******************************************************************************/
 
-Biddy_String
-BiddyAbout()
+void
+BiddyManagedSetGCThreads(Biddy_Manager MNG, unsigned int threads)
 {
-  return strdup(BIDDYVERSION);
+  assert( MNG );
+
+#ifdef PARALLELGC
+  if (threads == 0) {
+    threads = (sysconf(_SC_NPROCESSORS_ONLN) > 0) ? (unsigned int) sysconf(_SC_NPROCESSORS_ONLN) : 1;
+  }
+  if (threads > BIDDYGCTHREADSMAX) threads = BIDDYGCTHREADSMAX;
+  biddyNodeTable.gcthreads = threads;
+#else
+  if (threads != 1) {
+    fprintf(stderr,"Biddy_SetGCThreads: Parallel GC is not supported in this variant!\n");
+  }
+#endif
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedIsOK.
+\brief Function BiddyManagedSetApplyThreads.
 
 ### Description
+    Existing threads are stopped and new ones are started.
 ### Side effects
 ### More info
-    See Biddy_Managed_IsOK.
+    See Biddy_Managed_SetApplyThreads.
 *******************************************************************************/
 
-/* TO DO: replace with macro */
-Biddy_Boolean
-BiddyManagedIsOK(Biddy_Manager MNG, Biddy_Edge f)
+void
+BiddyManagedSetApplyThreads(Biddy_Manager MNG, unsigned int threads)
 {
+#ifdef PARALLELAPPLY
+  BiddyApplyPool *pool;
+  pthread_attr_t attr;
+  unsigned int i;
+#endif
+
   assert( MNG );
 
-  return (!(BiddyN(f)->expiry) || ((BiddyN(f)->expiry) >= biddySystemAge));
+#ifdef PARALLELAPPLY
+  if (threads == 0) {
+    threads = (sysconf(_SC_NPROCESSORS_ONLN) > 0) ? (unsigned int) sysconf(_SC_NPROCESSORS_ONLN) : 1;
+  }
+  if (threads > BIDDYAPPLYTHREADSMAX) threads = BIDDYAPPLYTHREADSMAX;
+
+  /* STOP EXISTING THREADS */
+  if ((pool = biddyApplyPool)) {
+    assert( pool->busy == 0 );
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = TRUE;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (i=1; i<pool->threads; i++) {
+      pthread_join(pool->thread[i],NULL);
+    }
+    biddyOPCache.lock = NULL;
+    biddyEACache.lock = NULL;
+    biddyRCCache.lock = NULL;
+    pthread_mutex_destroy(&pool->nodelock);
+    for (i=0; i<BIDDYAPPLYCACHELOCKS; i++) {
+      pthread_mutex_destroy(&pool->cachelock[i]);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->cond);
+    free(pool);
+    MNG[18] = NULL;
+  }
+
+  if (threads < 2) return;
+
+  /* START NEW THREADS, THE CALLING THREAD IS THE FIRST ONE */
+  if (!(pool = (BiddyApplyPool *) malloc(sizeof(BiddyApplyPool)))) {
+    fprintf(stderr,"BiddyManagedSetApplyThreads: Out of memoy!\n");
+    exit(1);
+  }
+  pool->MNG = MNG;
+  pthread_mutex_init(&pool->nodelock,NULL);
+  for (i=0; i<BIDDYAPPLYCACHELOCKS; i++) {
+    pthread_mutex_init(&pool->cachelock[i],NULL);
+  }
+  pthread_mutex_init(&pool->lock,NULL);
+  pthread_cond_init(&pool->cond,NULL);
+  pool->waiting = 0;
+  pool->busy = 0;
+  pool->stop = FALSE;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr,BIDDYAPPLYSTACKSIZE);
+  for (i=1; i<threads; i++) {
+    if (pthread_create(&pool->thread[i],&attr,applyWorker,pool)) break;
+  }
+  pthread_attr_destroy(&attr);
+  pool->threads = i;
+  biddyOPCache.lock = pool->cachelock;
+  biddyEACache.lock = pool->cachelock;
+  biddyRCCache.lock = pool->cachelock;
+  MNG[18] = pool;
+#else
+  if (threads != 1) {
+    fprintf(stderr,"Biddy_SetApplyThreads: Parallel operations are not supported in this variant!\n");
+  }
+#endif
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedGetManagerType.
+\brief Function BiddyManagedSetCacheWays.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_GetManagerType.
+    See Biddy_Managed_SetCacheWays.
 *******************************************************************************/
 
-int
-BiddyManagedGetManagerType(Biddy_Manager MNG)
+void
+BiddyManagedSetCacheWays(Biddy_Manager MNG, unsigned int ways)
 {
   assert( MNG );
 
-  return biddyManagerType;
+  if ((ways == 0) || (ways > BIDDYCACHEWAYSMAX) || (ways & (ways-1))) {
+    fprintf(stderr,"Biddy_SetCacheWays: Unsupported number of ways!\n");
+    return;
+  }
+
+  BiddyOPGarbageDeleteAll(MNG);
+  BiddyEAGarbageDeleteAll(MNG);
+  BiddyRCGarbageDeleteAll(MNG);
+
+  biddyOPCache.ways = ways;
+  biddyEACache.ways = ways;
+  biddyRCCache.ways = ways;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedGetManagerName.
+\brief Function BiddyManagedSetZBDDSkip.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_GetManagerName.
+    See Biddy_Managed_SetZBDDSkip.
 *******************************************************************************/
 
-Biddy_String
-BiddyManagedGetManagerName(Biddy_Manager MNG)
+void
+BiddyManagedSetZBDDSkip(Biddy_Manager MNG, int skip)
 {
   assert( MNG );
 
-  return biddyManagerName;
+  if ((skip != BIDDYZBDDSKIPRECURSIVE) && (skip != BIDDYZBDDSKIPJUMP) &&
+      (skip != BIDDYZBDDSKIPCACHE))
+  {
+    fprintf(stderr,"Biddy_SetZBDDSkip: Unsupported strategy!\n");
+    return;
+  }
+
+  biddyNodeTable.zbddskip = skip;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedSetManagerParameters.
+\brief Function BiddyManagedSetExtendedStats.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_SetManagerParameters.
+    See Biddy_Managed_SetExtendedStats.
 *******************************************************************************/
 
 void
-BiddyManagedSetManagerParameters(Biddy_Manager MNG, float gcr, float gcrF,
-  float gcrX, float rr, float rrF, float rrX, float st, float cst)
+BiddyManagedSetExtendedStats(Biddy_Manager MNG, Biddy_Boolean stats)
 {
   assert( MNG );
 
-  if (gcr > 0.0) biddyNodeTable.gcratio = gcr;
-  if (gcrF > 0.0) biddyNodeTable.gcratioF = gcrF;
-  if (gcrX > 0.0) biddyNodeTable.gcratioX = gcrX;
-  if (rr > 0.0) biddyNodeTable.resizeratio = rr;
-  if (rrF > 0.0) biddyNodeTable.resizeratioF = rrF;
-  if (rrX > 0.0) biddyNodeTable.resizeratioX = rrX;
-  if (st > 0.0) biddyNodeTable.siftingtreshold = st;
-  if (cst > 0.0) biddyNodeTable.convergesiftingtreshold = cst;
+  biddyNodeTable.extendedstats = stats;
+  biddyOPCache.stats = stats;
+  biddyEACache.stats = stats;
+  biddyRCCache.stats = stats;
+  biddyReplaceCache.stats = stats;
+}
 
-  /* PROFILING */
-  /*
-  fprintf(stderr,"gcr=%.2f, ",biddyNodeTable.gcratio);
-  fprintf(stderr,"gcrF=%.2f, ",biddyNodeTable.gcratioF);
-  fprintf(stderr,"gcrX=%.2f, ",biddyNodeTable.gcratioX);
-  fprintf(stderr,"rr=%.2f, ",biddyNodeTable.resizeratio);
-  fprintf(stderr,"rrF=%.2f, ",biddyNodeTable.resizeratioF);
-  fprintf(stderr,"rrX=%.2f, ",biddyNodeTable.resizeratioX);
-  */
+/***************************************************************************//*!
+\brief Function BiddyManagedSetIterativeApply.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_SetIterativeApply.
+*******************************************************************************/
+
+void
+BiddyManagedSetIterativeApply(Biddy_Manager MNG, Biddy_Boolean iterative)
+{
+  assert( MNG );
+
+  biddyNodeTable.iterative = iterative;
 }
 
 /***************************************************************************//*!
@@ -6347,7 +7437,7 @@ BiddyManagedFoaVariable(Biddy_Manager MNG, Biddy_String x,
 void
 BiddyManagedChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_String x)
 {
-  Biddy_Variable min,max,wold,wnew;
+  Biddy_Variable min,max,wold,wnew,n;
   Biddy_String tmp;
   Biddy_Boolean find;
   int cc;
@@ -6400,20 +7490,25 @@ BiddyManagedChangeVariableName(Biddy_Manager MNG, Biddy_Variable v, Biddy_String
   }
 
   /* IF NEW NAME LOOKS AS A NUMBER THEN ADAPT numnum TO AVOID PROBLEMS AFTER ADDING NUMBERED VARIABLES */
+  /* v MUST NOT BE CHANGED HERE AND tmp MUST BE LONG ENOUGH FOR ANY NUMBER */
   if (x) {
+    n = 0;
 #ifdef PLAIN
-    sscanf(x,"%u",&v);
+    sscanf(x,"%u",&n);
 #else
-    sscanf(x,"%hu",&v);
+    sscanf(x,"%hu",&n);
 #endif
-    tmp = strdup(x);
+    if (!(tmp = (Biddy_String) malloc(strlen(x)+16))) {
+      fprintf(stderr,"BiddyManagedChangeVariableName: Out of memoy!\n");
+      exit(1);
+    }
 #ifdef PLAIN
-    sprintf(tmp,"%u",v);
+    sprintf(tmp,"%u",n);
 #else
-    sprintf(tmp,"%hu",v);
+    sprintf(tmp,"%hu",n);
 #endif
     if (!strcmp(x,tmp)) {
-      if (biddyVariableTable.numnum < v) biddyVariableTable.numnum = v;
+      if (biddyVariableTable.numnum < n) biddyVariableTable.numnum = n;
     }
     free(tmp);
   }
@@ -6842,14 +7937,14 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
   Biddy_Edge edge;
   BiddyNode *sup, *sup1;
   Biddy_Boolean complementedResult;
-  unsigned int i;
   BiddyNode ** tmp;
+  unsigned int *tmpsize;
   Biddy_Boolean addNodeSpecial;
 #ifndef COMPACT
   Biddy_Variable tag;
 #endif
 
-  static BiddyNode *newFreeNodes;
+  BiddyNode *newFreeNodes;
 
   /* DEBUGGING */
   /*
@@ -6875,9 +7970,7 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
           (biddyManagerType == BIDDYTYPETZBDDC) ||
           (ptag != 0) );
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.foa++;
-#endif
+  if (biddyNodeTable.extendedstats) biddyNodeTable.foa++;
 
   /* DEBUGGING */
   /*
@@ -7079,12 +8172,21 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
   /* BECAUSE OF USED TRICKS, HASH FUNCTION MUST NEVER RETURN ZERO! */
   /* VARIABLES/ELEMENTS (v,0,1) ARE NOT HASHED IN THE USUAL WAY */
 
+#ifdef PARALLELAPPLY
+  /* NODE TABLE, FREE NODES, AND LISTS OF NODES ARE SHARED BY THE THREADS */
+  /* DURING A PARALLEL OPERATION, GC IS NOT STARTED */
+  if (biddyApplyPool) {
+    pthread_mutex_lock(&biddyApplyPool->nodelock);
+    if (__atomic_load_n(&biddyApplyPool->busy,__ATOMIC_RELAXED)) garbageAllowed = FALSE;
+  }
+#endif
+
   if (addNodeSpecial) {
     sup = sup1 = NULL;
     hash = 0;
   } else {
-    hash = nodeTableHash(v,pf,pt,biddyNodeTable.size);
-    sup = biddyNodeTable.table[hash];
+    hash = nodeTableHash(v,pf,pt,BiddyChainSize(v));
+    sup = BiddyChainTable(v)[hash];
     sup1 = findNodeTable(MNG,v,pf,pt,&sup);
   }
 
@@ -7093,7 +8195,7 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
     /* NEW NODE MUST BE ADDED */
 
     /* IF ALL GENERATED NODES ARE USED THEN TRY GARBAGE COLLECTION */
-    if (garbageAllowed && !biddyFreeNodes) {
+    if (garbageAllowed && !biddyFreeNodes && !biddyNodeTable.unusednum) {
 
       /* PROFILING */
       /*
@@ -7109,14 +8211,14 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
       */
 
       /* the table may be resized, thus the element must be rehashed */
-      hash = nodeTableHash(v, pf, pt, biddyNodeTable.size);
-      sup = biddyNodeTable.table[hash];
+      hash = nodeTableHash(v, pf, pt, BiddyChainSize(v));
+      sup = BiddyChainTable(v)[hash];
       sup1 = findNodeTable(MNG, v, pf, pt, &sup);
 
     }
 
     /* IF NO FREE NODES ARE FOUND THEN CREATE NEW BLOCK OF NODES */
-    if (!biddyFreeNodes) {
+    if (!biddyFreeNodes && !biddyNodeTable.unusednum) {
 
       /* the size of a memory block is increased until the limit is reached */
       if (biddyNodeTable.blocksize < biddyNodeTable.limitblocksize)
@@ -7140,13 +8242,23 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
       }
       */
 
+#ifdef ARENA
+      /* the new block is the next unused part of the arena */
+      if (biddyNodeTable.blocksize > BIDDYARENASIZE - biddyNodeTable.generated) {
+        fprintf(stderr, "\nBIDDY (BiddyManagedTaggedFoaNode): Arena is full!\n");
+        fprintf(stderr, "Currently, there exist %d nodes.\n", biddyNodeTable.num);
+        exit(1);
+      }
+      newFreeNodes = &biddyNodeTable.arena[biddyNodeTable.generated];
+#else
       if (!(newFreeNodes = (BiddyNode *)
-        malloc((biddyNodeTable.blocksize) * sizeof(BiddyNode))))
+        biddyNodeTable.blockalloc((biddyNodeTable.blocksize) * sizeof(BiddyNode))))
       {
         fprintf(stderr, "\nBIDDY (BiddyManagedTaggedFoaNode): Out of memory error!\n");
         fprintf(stderr, "Currently, there exist %d nodes.\n", biddyNodeTable.num);
         exit(1);
       }
+#endif
 
       biddyNodeTable.blocknumber++;
       if (!(tmp = (BiddyNode **)realloc(biddyNodeTable.blocktable,
@@ -7158,13 +8270,21 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
       }
       biddyNodeTable.blocktable = tmp;
       biddyNodeTable.blocktable[biddyNodeTable.blocknumber - 1] = newFreeNodes;
+      if (!(tmpsize = (unsigned int *)realloc(biddyNodeTable.blocksizetable,
+        biddyNodeTable.blocknumber * sizeof(unsigned int))))
+      {
+        fprintf(stderr, "\nBIDDY (BiddyManagedTaggedFoaNode): Out of memory error!\n");
+        fprintf(stderr, "Currently, there exist %d nodes.\n", biddyNodeTable.num);
+        exit(1);
+      }
+      biddyNodeTable.blocksizetable = tmpsize;
+      biddyNodeTable.blocksizetable[biddyNodeTable.blocknumber - 1] = biddyNodeTable.blocksize;
       biddyNodeTable.generated = biddyNodeTable.generated + biddyNodeTable.blocksize;
 
-      newFreeNodes[biddyNodeTable.blocksize - 1].list = biddyFreeNodes;
-      biddyFreeNodes = newFreeNodes;
-      for (i = 0; i < biddyNodeTable.blocksize - 1; i++) {
-        newFreeNodes = (BiddyNode*)(newFreeNodes->list = &newFreeNodes[1]);
-      }
+      /* nodes from the new block are not linked into the list of free nodes */
+      /* they are taken one by one when the list of free nodes is empty */
+      biddyNodeTable.unused = newFreeNodes;
+      biddyNodeTable.unusednum = biddyNodeTable.blocksize;
 
       /* PROFILING */
       /*
@@ -7179,8 +8299,13 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
     if (biddyNodeTable.num > biddyNodeTable.max) biddyNodeTable.max = biddyNodeTable.num;
     (biddyVariableTable.table[v].num)++;
 
-    sup = biddyFreeNodes;
-    biddyFreeNodes = (BiddyNode *)sup->list;
+    if (biddyFreeNodes) {
+      sup = biddyFreeNodes;
+      biddyFreeNodes = (BiddyNode *)sup->list;
+    } else {
+      sup = biddyNodeTable.unused++;
+      biddyNodeTable.unusednum--;
+    }
 
     /* DEBUGGING */
     /*
@@ -7207,6 +8332,23 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
     /* add new node to Node table */
     /* nodes (v,0,1) are not stored in Node table */
     if (!addNodeSpecial) {
+#ifdef NODETABLE_OPENADDRESSING
+      /* with open addressing, Node table must never be more than 3/4 full */
+      if (biddyNodeTable.num > biddyNodeTable.size - (biddyNodeTable.size >> 2)) {
+        nodeTableEnlarge(MNG);
+        hash = nodeTableHash(v, pf, pt, biddyNodeTable.size);
+      }
+#endif
+#ifdef NODETABLE_SUBTABLES
+      /* subtable is enlarged when its chains become too long */
+      if ((biddyVariableTable.table[v].num > BIDDYNODESUBTABLELOAD * BiddyChainSize(v)) &&
+          (BiddyChainSize(v) < biddyNodeTable.limitsize))
+      {
+        nodeSubtableEnlarge(MNG,v);
+        hash = nodeTableHash(v, pf, pt, BiddyChainSize(v));
+        sup1 = NULL;
+      }
+#endif
       addNodeTable(MNG, hash, sup, sup1);
     }
 
@@ -7219,6 +8361,12 @@ BiddyManagedTaggedFoaNode(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf,
 
   }
 
+#ifdef PARALLELAPPLY
+  if (biddyApplyPool) {
+    pthread_mutex_unlock(&biddyApplyPool->nodelock);
+  }
+#endif
+
   edge = sup;
 
   if (complementedResult) {
@@ -7284,9 +8432,15 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
   Biddy_Boolean cacheOK;
   Biddy_Boolean resizeRequired;
   Biddy_Boolean gcUseful;
+  Biddy_Boolean minor;
   Biddy_Variable v;
   unsigned int hash;
-  clock_t starttime;
+  unsigned int nursery,removed;
+  clock_t starttime,wallstarttime;
+#if defined(PARALLELGC) && !defined(NODETABLE_OPENADDRESSING)
+  BiddyGCSweep sweep[BIDDYGCTHREADSMAX];
+  unsigned int t;
+#endif
 
   assert( MNG );
 
@@ -7311,7 +8465,15 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
     biddyNodeTable.garbage++;
   }
 
-#ifdef BIDDYEXTENDEDSTATS_YES
+  /* MINOR GC CONSIDERS ONLY NODES CREATED SINCE THE PREVIOUS GC (NURSERY) */
+  /* nodes are never changed, thus older nodes cannot point to nodes from the nursery */
+  /* lists of nodes must not be changed since the previous GC (e.g. by sifting) */
+  /* minor GC is not used if the nursery is larger than the older generation */
+  minor = (biddyNodeTable.generational && biddyNodeTable.nurseryok &&
+           !biddyNodeTable.nurseryfull && (targetLT == 0) && !purge && !total &&
+           (biddyNodeTable.num < 2 * biddyNodeTable.oldnum));
+  nursery = 0;
+
   if (!(biddyNodeTable.gcobsolete = (unsigned long long int *) realloc(biddyNodeTable.gcobsolete,
         biddyNodeTable.garbage * sizeof(unsigned long long int))))
   {
@@ -7319,7 +8481,6 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
     exit(1);
   }
   biddyNodeTable.gcobsolete[biddyNodeTable.garbage-1] = 0;
-#endif
 
   /* DEBUGGING - REPORT ALL NODES WITH A SPECIFIC VARIABLE */
   /*
@@ -7336,6 +8497,7 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
   */
 
   starttime = clock();
+  wallstarttime = wallClock();
 
   /* REMOVE ALL FORMULAE WHICH ARE NOT PRESERVED ANYMORE */
   /* the first two formulae ("0" and "1") are never removed */
@@ -7491,9 +8653,24 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
     biddyVariableTable.table[v].numobsolete = 0;
   }
   for (v=1; v<biddyVariableTable.num; v++) {
+    /* if minor then only nodes from the nursery are checked */
+    /* successors of older nodes are older nodes, they are not removed by minor GC */
+    /* obsolete nodes are counted afterwards because prolonging may also */
+    /* reach older obsolete nodes which are not counted */
+    if (minor) {
+      sup = (BiddyNode *) biddyVariableTable.table[v].lastOldNode->list;
+      while (sup) {
+        assert( sup->v == v );
+        if (!(sup->expiry) || (sup->expiry >= biddySystemAge)) {
+          BiddyProlongRecursively(MNG,BiddyE(sup),sup->expiry,0);
+          BiddyProlongRecursively(MNG,BiddyT(sup),sup->expiry,0);
+        }
+        sup = (BiddyNode *) sup->list;
+      }
+    }
     /* if (targetLT != 0) then nodes equal or higher (bottom-more) than targetLT */
     /* and smaller (top-more) than targetGEQ will not be prolonged */
-    if (v == targetLT) {
+    else if (v == targetLT) {
       /* there is always at least one node in the list */
       sup = biddyVariableTable.table[v].firstNode;
       assert( sup != NULL );
@@ -7528,6 +8705,19 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
     }
   }
 
+  if (minor) {
+    for (v=1; v<biddyVariableTable.num; v++) {
+      sup = (BiddyNode *) biddyVariableTable.table[v].lastOldNode->list;
+      while (sup) {
+        nursery++;
+        if ((sup->expiry) && (sup->expiry < biddySystemAge)) {
+          (biddyVariableTable.table[v].numobsolete)++;
+        }
+        sup = (BiddyNode *) sup->list;
+      }
+    }
+  }
+
   /* CHECK IF THE RESIZING OF NODE TABLE IS NECESSARY */
   i = biddyNodeTable.num; /* we will count how many nodes are non-obsolete */
   resizeRequired = FALSE;
@@ -7546,6 +8736,14 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
   /* IF (targetLT != 0) THEN NODE TABLE RESIZING IS DISABLED */
   if (targetLT != 0) resizeRequired = FALSE;
 
+  /* MINOR GC DOES NOT RESIZE NODE TABLE, THIS IS LEFT TO THE NEXT MAJOR GC */
+  if (minor) resizeRequired = FALSE;
+
+#ifdef NODETABLE_SUBTABLES
+  /* SUBTABLES ARE ENLARGED ONE BY ONE IN BiddyManagedTaggedFoaNode AND swapVariables */
+  resizeRequired = FALSE;
+#endif
+
   /* CHECK IF THE DELETION OF NODES IS USEFUL - how many nodes will be deleted */
   gcUseful = ((biddyNodeTable.num - i) > (biddyNodeTable.gcratio * biddyNodeTable.blocksize));
   if (gcUseful) resizeRequired = FALSE;
@@ -7563,11 +8761,11 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
 
   /* REMOVE ALL OBSOLETE NODES */
   cacheOK = TRUE;
+  removed = biddyNodeTable.num;
   if (gcUseful || resizeRequired) {
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-    biddyNodeTable.gcobsolete[biddyNodeTable.garbage-1]  = (biddyNodeTable.num - i);
-#endif
+    biddyNodeTable.gcobsolete[biddyNodeTable.garbage-1] =
+      biddyNodeTable.extendedstats ? (biddyNodeTable.num - i) : 0;
 
     /* RESIZE NODE TABLE BECASUE IT SEEMS TO BE TO SMALL */
     if (resizeRequired) {
@@ -7616,6 +8814,27 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
     }
     */
 
+#if defined(PARALLELGC) && !defined(NODETABLE_OPENADDRESSING)
+    /* PARALLEL GC: CHAINS OF NODE TABLE AND LISTS OF NODES ARE SHARED BY THE THREADS */
+    /* obsolete nodes are removed from Node table before they are removed from the lists */
+    /* afterwards, there are no obsolete nodes for the serial loop below */
+    if ((biddyNodeTable.gcthreads > 1) && !resizeRequired && !minor && (targetLT == 0)) {
+      memset(sweep,0,biddyNodeTable.gcthreads * sizeof(BiddyGCSweep));
+#ifndef NODETABLE_SUBTABLES
+      BiddyParallelFor(MNG,gcSweepChains,NULL,biddyNodeTable.size+1,biddyNodeTable.size+1);
+#endif
+      BiddyParallelFor(MNG,gcSweepVariables,sweep,biddyVariableTable.num-1,biddyNodeTable.num);
+      for (t=0; t<biddyNodeTable.gcthreads; t++) {
+        if (sweep[t].first) {
+          cacheOK = FALSE;
+          biddyNodeTable.num -= sweep[t].removed;
+          sweep[t].last->list = (void *) biddyFreeNodes;
+          biddyFreeNodes = sweep[t].first;
+        }
+      }
+    }
+#endif
+
     /* CHECK ALL LISTS AND IF RESIZE THEN PUT ALL KEPT NODES ALSO TO THE NEW NODE TABLE */
     /* BECAUSE OF REHASHING (NODES ARE STORED IN NODE TABLE IN 'ORDERED' LISTS) */
     /* IT IS REQUIRED TO VISIT NODES STARTING WITH THE LAST VARIABLE! */
@@ -7647,8 +8866,13 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
 
         /* UPDATING NODE TABLE */
         /* there is always at least one node in the list and the first node is never obsolete */
-        tmpnode1 = biddyVariableTable.table[v].firstNode;
-        assert( BiddyIsOK(tmpnode1) );
+        /* if minor then nodes before the nursery are not checked */
+        if (minor) {
+          tmpnode1 = biddyVariableTable.table[v].lastOldNode;
+        } else {
+          tmpnode1 = biddyVariableTable.table[v].firstNode;
+          assert( BiddyIsOK(tmpnode1) );
+        }
 
         biddyVariableTable.table[v].lastNode->list = NULL;
 
@@ -7698,10 +8922,7 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
             (biddyVariableTable.table[v].numobsolete)--;
             /* if resize is not required then remove from Node table */
             if (!resizeRequired) {
-              tmpnode2->prev->next = tmpnode2->next;
-              if (tmpnode2->next) {
-                tmpnode2->next->prev = tmpnode2->prev;
-              }
+              removeNodeTable(MNG,tmpnode2);
             }
             /* update list of live nodes */
             tmpnode1->list = (BiddyNode *) tmpnode2->list;
@@ -7759,9 +8980,27 @@ BiddyManagedGC(Biddy_Manager MNG, Biddy_Variable targetLT,
   }
   */
 
+  /* ALL NODES BECOME OLDER NODES, THE NEXT GC IS A MAJOR ONE */
+  /* IF TOO MANY NODES HAVE SURVIVED THE MINOR GC */
+  removed = removed - biddyNodeTable.num;
+  if (targetLT == 0) {
+    for (v=1; v<biddyVariableTable.num; v++) {
+      biddyVariableTable.table[v].lastOldNode = biddyVariableTable.table[v].lastNode;
+    }
+    biddyNodeTable.nurseryok = TRUE;
+    biddyNodeTable.nurseryfull = minor &&
+      ((nursery - removed) > BIDDYNODETABLEGCSURVIVAL * nursery);
+    biddyNodeTable.oldnum = biddyNodeTable.num;
+  }
+
   /* GC calls used during sifting are not counted */
   if (targetLT == 0) {
     biddyNodeTable.gctime += clock() - starttime;
+    biddyNodeTable.gcwalltime += wallClock() - wallstarttime;
+    if (minor) {
+      biddyNodeTable.gcminor++;
+      biddyNodeTable.gcminortime += clock() - starttime;
+    }
   }
 }
 
@@ -7841,6 +9080,30 @@ BiddyManagedPurgeAndReorder(Biddy_Manager MNG, Biddy_Edge f,
   BiddyManagedSifting(MNG,f,converge);
 }
 
+/***************************************************************************//*!
+\brief Function BiddyManagedPurgeAndCompact.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_PurgeAndCompact.
+*******************************************************************************/
+
+void
+BiddyManagedPurgeAndCompact(Biddy_Manager MNG)
+{
+  clock_t starttime;
+
+  assert( MNG );
+
+  BiddyManagedPurge(MNG);
+
+  starttime = clock();
+  nodeTableCompact(MNG);
+  biddyNodeTable.compaction++;
+  biddyNodeTable.compacttime += clock() - starttime;
+}
+
 /***************************************************************************//*!
 \brief Function BiddyManagedAddCache.
 
@@ -7864,23 +9127,192 @@ BiddyManagedAddCache(Biddy_Manager MNG, Biddy_GCFunction gc)
       exit(1);
     }
 
-    biddyCacheList->gc = gc;
-    biddyCacheList->next = NULL;
-  } else {
-    sup = biddyCacheList;
-    while (sup->next) sup = sup->next;
+    biddyCacheList->gc = gc;
+    biddyCacheList->next = NULL;
+  } else {
+    sup = biddyCacheList;
+    while (sup->next) sup = sup->next;
+
+    if (!(sup->next = (BiddyCacheList *) malloc(sizeof(BiddyCacheList)))) {
+      fprintf(stdout,"BiddyManagedAddCache: Out of memoy!\n");
+      exit(1);
+    }
+
+    sup = sup->next;
+    sup->gc = gc;
+    sup->next = NULL;
+  }
+}
+
+/***************************************************************************//*!
+\brief Function BiddyAllocCacheTable allocates zeroed memory for a cache table.
+
+### Description
+    On UNIX and MACOSX, the table is aligned to BIDDYCACHELINESIZE bytes,
+    thus a set of entries does not cross more cache lines than needed.
+### Side effects
+    The table is released with free. Return NULL if the table cannot be
+    allocated.
+### More info
+*******************************************************************************/
+
+void *
+BiddyAllocCacheTable(size_t size)
+{
+#if defined(UNIX) || defined(MACOSX)
+  void *table;
+
+  if (posix_memalign(&table,BIDDYCACHELINESIZE,size)) return NULL;
+  memset(table,0,size);
+  return table;
+#else
+  return calloc(1,size);
+#endif
+}
+
+/***************************************************************************//*!
+\brief Function BiddyParallelFor performs the given task using the threads
+       reserved for garbage collection.
+
+### Description
+    The task [0,n) is split into parts which are taken by the threads one by
+    one. The given function is called for each part, its argument t is the
+    index of the thread (0 is the calling thread), thus data can contain
+    a separate result for each thread. Parameter work estimates the number
+    of visited items, if it is too small or if variant PARALLELGC is not
+    used then the function is called only once, i.e. fn(MNG,data,0,0,n).
+### Side effects
+    The given function must not change anything which can be changed by
+    the other parts of the task.
+### More info
+*******************************************************************************/
+
+void
+BiddyParallelFor(Biddy_Manager MNG, BiddyParallelFunction fn, void *data,
+                 unsigned int n, unsigned int work)
+{
+#ifdef PARALLELGC
+  unsigned int i,threads,grain,next;
+  pthread_t thread[BIDDYGCTHREADSMAX];
+  BiddyParallelTask task[BIDDYGCTHREADSMAX];
+#endif
+
+  assert( MNG );
+
+#ifdef PARALLELGC
+  threads = biddyNodeTable.gcthreads;
+  if (threads > n) threads = n;
+  if ((threads > 1) && (work >= BIDDYGCPARALLELMIN)) {
+    next = 0;
+    grain = n / (8 * threads);
+    if (grain == 0) grain = 1;
+    for (i=0; i<threads; i++) {
+      task[i].MNG = MNG;
+      task[i].fn = fn;
+      task[i].data = data;
+      task[i].t = i;
+      task[i].n = n;
+      task[i].grain = grain;
+      task[i].next = &next;
+    }
+    /* if a thread cannot be created then its parts are taken by the others */
+    for (i=1; i<threads; i++) {
+      if (pthread_create(&thread[i],NULL,parallelWorker,&task[i])) break;
+    }
+    threads = i;
+    parallelWorker(&task[0]);
+    for (i=1; i<threads; i++) {
+      pthread_join(thread[i],NULL);
+    }
+    return;
+  }
+#endif
+
+  fn(MNG,data,0,0,n);
+}
+
+#ifdef PARALLELAPPLY
+
+/***************************************************************************//*!
+\brief Function BiddyParallelApply performs two recursive calls of an
+       operation, the second one may be performed by another thread.
+
+### Description
+    The second call is added to the waiting tasks and the first one is
+    performed by the calling thread. If the second call has not been taken
+    by another thread in the meantime then it is performed by the calling
+    thread, too. Otherwise, the calling thread performs other waiting tasks
+    until the second call is finished. If there are too many waiting tasks
+    then both calls are performed by the calling thread.
+### Side effects
+    Available in variant PARALLELAPPLY, only.
+### More info
+*******************************************************************************/
+
+void
+BiddyParallelApply(Biddy_Manager MNG, BiddyApplyFunction fn,
+                   Biddy_Edge f1, Biddy_Edge g1, Biddy_Edge h1, Biddy_Edge *r1,
+                   Biddy_Edge f2, Biddy_Edge g2, Biddy_Edge h2, Biddy_Edge *r2)
+{
+  BiddyApplyPool *pool;
+  BiddyApplyTask task;
+  unsigned int i;
+
+  assert( MNG );
+  assert( biddyApplyPool );
+
+  pool = biddyApplyPool;
+
+  task.fn = fn;
+  task.f = f2;
+  task.g = g2;
+  task.h = h2;
+  task.r = biddyNull;
+  task.state = 0;
+
+  pthread_mutex_lock(&pool->lock);
+  if (pool->waiting == BIDDYAPPLYTASKSPERTHREAD * pool->threads) {
+    pthread_mutex_unlock(&pool->lock);
+    *r1 = fn(MNG,f1,g1,h1);
+    *r2 = fn(MNG,f2,g2,h2);
+    return;
+  }
+  pool->task[pool->waiting++] = &task;
+  pool->busy++;
+  pthread_cond_broadcast(&pool->cond);
+  pthread_mutex_unlock(&pool->lock);
+
+  *r1 = fn(MNG,f1,g1,h1);
+
+  pthread_mutex_lock(&pool->lock);
 
-    if (!(sup->next = (BiddyCacheList *) malloc(sizeof(BiddyCacheList)))) {
-      fprintf(stdout,"BiddyManagedAddCache: Out of memoy!\n");
-      exit(1);
-    }
+  if (task.state == 0) {
+    /* THE TASK HAS NOT BEEN TAKEN, IT IS REMOVED FROM THE WAITING TASKS */
+    i = 0;
+    while (pool->task[i] != &task) i++;
+    memmove(&pool->task[i],&pool->task[i+1],(pool->waiting-i-1) * sizeof(BiddyApplyTask *));
+    pool->waiting--;
+    pool->busy--;
+    pthread_mutex_unlock(&pool->lock);
+    *r2 = fn(MNG,f2,g2,h2);
+    return;
+  }
 
-    sup = sup->next;
-    sup->gc = gc;
-    sup->next = NULL;
+  /* WHILE WAITING, OTHER TASKS ARE PERFORMED */
+  while (task.state != 2) {
+    if (pool->waiting) {
+      performApplyTask(pool);
+    } else {
+      pthread_cond_wait(&pool->cond,&pool->lock);
+    }
   }
+
+  pthread_mutex_unlock(&pool->lock);
+  *r2 = task.r;
 }
 
+#endif
+
 /***************************************************************************//*!
 \brief Function BiddyManagedAddFormula.
 
@@ -8703,6 +10135,8 @@ BiddyManagedSifting(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean converge)
   BiddyEAGarbageDeleteAll(MNG);
   BiddyRCGarbageDeleteAll(MNG);
   BiddyReplaceGarbageDeleteAll(MNG);
+  BiddyCountGarbageDeleteAll(MNG);
+  BiddyCopyGarbageDeleteAll(MNG);
   biddyOPCache.disabled = TRUE;
   biddyEACache.disabled = TRUE;
   biddyRCCache.disabled = TRUE;
@@ -9133,6 +10567,7 @@ BiddyManagedCopy(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f,
   */
 
   if (f == biddyZero1) return biddyZero2; /* domain has been already copied */
+  if (BiddyIsNull(f)) return biddyNull; /* e.g. formula without a function */
 
   r = biddyNull;
 
@@ -9692,10 +11127,10 @@ BiddyProlongRecursively(Biddy_Manager MNG, Biddy_Edge f, unsigned int c,
        function.
 
 ### Description
-    Only one local info table may exists! It is not allowed to add new BDD
-    nodes if local info table exists. It is not allowed to start GC if local
-    info table exists. The last element and only the last element in the table
-    has back = NULL. Function returns number of noticeable variables.
+    Only one local info table may exists in a manager! It is not allowed to
+    add new BDD nodes if local info table exists. It is not allowed to start
+    GC if local info table exists. The last element and only the last element
+    in the table has back = NULL. Function returns number of noticeable variables.
     For OBDD, noticeable variables are all variables existing in the graph.
     For ZBDD, all variables are noticeable variables.
     For TZBDD, noticeable variables are all variables equal or below a top
@@ -9811,8 +11246,8 @@ BiddyCreateLocalInfo(Biddy_Manager MNG, Biddy_Edge f)
        function.
 
 ### Description
-    Only one local info table may exists! After deleting local info table,
-    Biddy is ready for any operation.
+    Only one local info table may exists in a manager! After deleting local
+    info table, Biddy is ready for any operation.
 ### Side effects
     All nodes except terminal node must be selected.
     Local info for terminal node should not be created!
@@ -11292,26 +12727,269 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
     } else {
       stop = FALSE;
 
-      /* VARIANT A: start with shorter direction, thus calculate v's global ordering */
-      /**/
-      n = getGlobalOrdering(MNG,v);
-      if (n > (minvarOrder+maxvarOrder)/2) highfirst = TRUE; else highfirst = FALSE;
-      /**/
+      /* VARIANT A: start with shorter direction, thus calculate v's global ordering */
+      /**/
+      n = getGlobalOrdering(MNG,v);
+      if (n > (minvarOrder+maxvarOrder)/2) highfirst = TRUE; else highfirst = FALSE;
+      /**/
+
+      /* VARIANT B: start with highfirst = TRUE */
+      /*
+      highfirst = TRUE;
+      */
+    }
+
+    /* PROFILING */
+    /*
+    {
+    Biddy_Variable varOrder;
+    varOrder = getGlobalOrdering(MNG,v);
+    printf("SIFTING START: variable: \"%s\" (v=%u), startOrder=%u, min=%u, numNodes=%u, systemAge=%u, ",
+           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG),biddySystemAge);
+    if (highfirst) printf("HIGHFIRST\n"); else printf("LOWFIRST\n");
+    }
+    */
+
+    /* DEBUGGING */
+    /*
+    for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
+      printf("[\"%s\"@%u]",biddyVariableTable.table[k].name,biddyVariableTable.table[k].num);
+    }
+    printf("\n");
+    */
+
+    /* DEBUGGING */
+    /*
+    printf("SIFTING: FIRST DIRECTION\n");
+    */
+
+    /* ONE DIRECTION */
+    n = 0;
+    best1 = 0;
+    while (!stop && (highfirst ?
+                      (k=swapWithHigher(MNG,v,&active)) :
+                      (k=swapWithLower(MNG,v,&active))))
+    {
+
+      n++; /* number of steps performed*/
+
+      /* DEBUGGING */
+      /*
+      printf("SIFTING: ");
+      if (highfirst) {
+        printf("%u swaped with higher %u",v,k);
+      } else {
+        printf("%u swaped with lower %u",v,k);
+      }
+      if (active) printf(" (ACTIVE)");
+      printf("\n");
+      */
+
+      if (active) {
+        /* IF v AND k HAVE BEEN SWAPPED */
+
+        if (highfirst) {
+          if (v == minvar) {
+            minvar = k;  /* update minvar */
+            /* minvarOrder is the same */
+          }
+          if (k == maxvar) {
+            maxvar = v; /* update maxvar */
+            /* maxvarOrder is the same */
+            stop = TRUE;
+          }
+        } else {
+          if (k == minvar) {
+            minvar = v; /* update minvar */
+            /* minvarOrder is the same */
+            stop = TRUE;
+          }
+          if (v == maxvar) {
+            maxvar = k;  /* update maxvar */
+            /* maxvarOrder is the same */
+          }
+        }
+
+      } else {
+        /* IF v AND k HAVE NOT BEEN SWAPPED */
+        /* THEY ARE NOT NEIGHBOURS BUT THEY MAY BE BOTH IN f !! */
+
+        if (highfirst) {
+          if (v == minvar) {
+            /* if k is in f then minvar = k else minvarOrder++ */
+            if (varTable[k]) {
+              minvar = k;
+            } else {
+              minvarOrder++;
+            }
+          }
+          if (k == maxvar) {
+            /* if v is in f then maxvar = v else maxvarOrder-- */
+            if (varTable[v]) {
+              maxvar = v;
+            } else {
+              maxvarOrder--;
+            }
+            stop = TRUE;
+          }
+        } else {
+          if (k == minvar) {
+            /* if v is in f then minvar = v else minvarOrder++ */
+            if (varTable[v]) {
+              minvar = v;
+            } else {
+              minvarOrder++;
+            }
+            stop = TRUE;
+          }
+          if (v == maxvar) {
+            /* if k is in f then maxvar = k else maxvarOrder-- */
+            if (varTable[k]) {
+              maxvar = k;
+            } else {
+              maxvarOrder--;
+            }
+          }
+        }
+
+      }
+
+      /* NUMBER OF NODES CAN CHANGE ONLY IF v AND k HAVE BEEN ACTIVELY SWAPPED */
+      if (active) {
+
+        /* update node number and variable ordering for the specific function */
+        /* both is neccessary for the algorithm */
+        /* *fOrdering is the same ordering as biddyOrderingTable, but it */
+        /* also contains information about which variables are neighbours */
+        /* garbage collection is not neccessary here! */
+        for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
+          biddyVariableTable.table[vmax].numone = 0;
+        }
+        nullOrdering(*fOrdering);
+        num = 1;
+        nodeNumberOrdering(MNG,f,&num,*fOrdering);
+        BiddyManagedDeselectAll(MNG);
+
+        /* DEBUGGING */
+        /*
+        printf("SIFTING: first direction, step=%u, min=%u, num=%u\n",n,min,num);
+        */
+
+        if (num < min) { /* first direction should use strict less */
+          min = num;
+          best1 = n;
+        }
+
+        if (num > (treshold * min)) {
+          stop = TRUE;
+        }
+
+        /* THIS IS EXPERIMENTAL !!! */
+        /* IN THE FIRST DIRECTION, PERFORM LIMIT NUMBER OF STEPS */
+        /* THIS COULD RESULT IN SHORT TIME AND NOT VERY BAD SIZE */
+        /*
+        if (n >= 1) {
+          stop = TRUE;
+        }
+        */
+
+      }
+    } /* while (!stop ...) */
+
+    /* PROFILING */
+    /*
+    {
+    Biddy_Variable varOrder;
+    varOrder = getGlobalOrdering(MNG,v);
+    printf("SIFTING BEFORE GO-BACK: variable: \"%s\" (v=%u), currentOrder=%u, min=%u, numNodes=%u\n",
+           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG));
+    }
+    */
+
+    /* DEBUGGING */
+    /*
+    for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
+      printf("[\"%s\"@%u]",biddyVariableTable.table[k].name,biddyVariableTable.table[k].num);
+    }
+    printf("\n");
+    */
+
+    /* DEBUGGING */
+    /*
+    printf("SIFTING: GO-BACK!\n");
+    */
+
+    /* GO BACK */
+    while (n) {
+      if (highfirst) {
+        k = swapWithLower(MNG,v,&active);
+
+        if (v == maxvar) {
+          /* if k is in f then maxvar = k else maxvarOrder-- */
+          if (varTable[k]) {
+            maxvar = k;
+          } else {
+            maxvarOrder--;
+          }
+        }
+        if (k == minvar) {
+          /* if v is in f then minvar = v else minvarOrder++ */
+          if (varTable[v]) {
+            minvar = v;
+          } else {
+            minvarOrder++;
+          }
+        }
+      } else {
+        k = swapWithHigher(MNG,v,&active);
+
+        if (v == minvar) {
+          /* if k is in f then minvar = k else minvarOrder++ */
+          if (varTable[k]) {
+            minvar = k;
+          } else {
+            minvarOrder++;
+          }
+        }
+        if (k == maxvar) {
+          /* if v is in f then maxvar = v else maxvarOrder-- */
+          if (varTable[v]) {
+            maxvar = v;
+          } else {
+            maxvarOrder--;
+          }
+        }
+      }
+      n--;
+    }
+
+    /* IF GO-BACK WAS MOVING VARIABLE UP (highfirst == TRUE) */
+    /* ONLY OBSOLETE NODES WITH var == v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
 
-      /* VARIANT B: start with highfirst = TRUE */
-      /*
-      highfirst = TRUE;
-      */
+    /* IF GO-BACK WAS MOVING VARIABLE DOWN (highfirst == FALSE) */
+    /* OBSOLETE NODES WITH var < v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
+
+    /* garbage collection is not needed here */
+    /* however, it seems to be a good idea */
+    BiddyManagedGC(MNG,0,0,FALSE,TRUE);
+
+    /* update variable ordering for the specific function */
+    /* to update which variables are neighbours */
+    for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
+      biddyVariableTable.table[vmax].numone = 0;
     }
+    nullOrdering(*fOrdering);
+    num = 1;
+    nodeNumberOrdering(MNG,f,&num,*fOrdering);
+    BiddyManagedDeselectAll(MNG);
 
     /* PROFILING */
     /*
     {
     Biddy_Variable varOrder;
     varOrder = getGlobalOrdering(MNG,v);
-    printf("SIFTING START: variable: \"%s\" (v=%u), startOrder=%u, min=%u, numNodes=%u, systemAge=%u, ",
-           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG),biddySystemAge);
-    if (highfirst) printf("HIGHFIRST\n"); else printf("LOWFIRST\n");
+    printf("SIFTING AFTER FIRST DIRECTION: variable: \"%s\" (v=%u), currentOrder=%u, min=%u, numNodes=%u\n",
+           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG));
     }
     */
 
@@ -11325,26 +13003,62 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
 
     /* DEBUGGING */
     /*
-    printf("SIFTING: FIRST DIRECTION\n");
+    printf("SIFTING: SECOND DIRECTION\n");
     */
 
-    /* ONE DIRECTION */
+    /* OPPOSITE DIRECTION */
+
     n = 0;
-    best1 = 0;
+    best2 = 0;
+    stop = FALSE;
+    min2 = BiddyManagedNodeTableNum(MNG); /* recalculate node number after go-back */
+
+    if (converge) {
+
+      /* VARIANT C1: min from the first direction is not used within second direction */
+      /* no code is needed in this variant */
+
+      /* VARIANT C2: min from the first direction is used within second direction */
+      /*
+      min2 = min;
+      */
+
+      /* VARIANT C3: if there is min in the first direction do not check second direction */
+      /*
+      if (best1) {
+        stop = TRUE;
+      }
+      */
+
+    } else {
+
+      /* VARIANT NC1: min from the first direction is not used within second direction */
+      /* no code is needed in this variant */
+
+      /* VARIANT NC2: min from the first direction is used within second direction */
+      /*
+      min2 = min;
+      */
+
+      /* VARIANT NC3: if there is min in the first direction do not check second direction */
+      /* THIS SEEMS TO BE BAD FOR REGULAR SIFTING */
+
+    }
+
     while (!stop && (highfirst ?
-                      (k=swapWithHigher(MNG,v,&active)) :
-                      (k=swapWithLower(MNG,v,&active))))
+                      (k=swapWithLower(MNG,v,&active)) :
+                      (k=swapWithHigher(MNG,v,&active))))
     {
 
-      n++; /* number of steps performed*/
+      n++;
 
       /* DEBUGGING */
       /*
       printf("SIFTING: ");
       if (highfirst) {
-        printf("%u swaped with higher %u",v,k);
-      } else {
         printf("%u swaped with lower %u",v,k);
+      } else {
+        printf("%u swaped with higher %u",v,k);
       }
       if (active) printf(" (ACTIVE)");
       printf("\n");
@@ -11354,32 +13068,157 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
         /* IF v AND k HAVE BEEN SWAPPED */
 
         if (highfirst) {
+          if (k == minvar) {
+            minvar = v; /* update minvar */
+            stop = TRUE;
+          }
+          if (v == maxvar) {
+            maxvar = k;  /* update maxvar */
+            /* maxvarOrder is the same */
+          }
+        } else {
           if (v == minvar) {
             minvar = k;  /* update minvar */
             /* minvarOrder is the same */
           }
           if (k == maxvar) {
             maxvar = v; /* update maxvar */
-            /* maxvarOrder is the same */
             stop = TRUE;
           }
-        } else {
+        }
+
+      } else {
+        /* IF v AND k HAVE NOT BEEN SWAPPED */
+        /* THEY ARE NOT NEIGHBOURS BUT THEY MAY BE BOTH IN f !! */
+
+        if (highfirst) {
           if (k == minvar) {
-            minvar = v; /* update minvar */
-            /* minvarOrder is the same */
+            /* if v is in f then minvar = v else minvarOrder++ */
+            if (varTable[v]) {
+              minvar = v;
+            } else {
+              minvarOrder++;
+            }
             stop = TRUE;
           }
           if (v == maxvar) {
-            maxvar = k;  /* update maxvar */
-            /* maxvarOrder is the same */
+            /* if k is in f then maxvar = k else maxvarOrder-- */
+            if (varTable[k]) {
+              maxvar = k;
+            } else {
+              maxvarOrder--;
+            }
+          }
+        } else {
+          if (v == minvar) {
+            /* if k is in f then minvar = k else minvarOrder++ */
+            if (varTable[k]) {
+              minvar = k;
+            } else {
+              minvarOrder++;
+            }
+          }
+          if (k == maxvar) {
+            /* if v is in f then maxvar = v else maxvarOrder-- */
+            if (varTable[v]) {
+              maxvar = v;
+            } else {
+              maxvarOrder--;
+            }
+            stop = TRUE;
           }
         }
 
-      } else {
-        /* IF v AND k HAVE NOT BEEN SWAPPED */
-        /* THEY ARE NOT NEIGHBOURS BUT THEY MAY BE BOTH IN f !! */
+      }
+
+      /* NUMBER OF NODES CAN CHANGE ONLY IF v AND k HAVE BEEN ACTIVELY SWAPPED */
+      if (active) {
+
+        /* update node number and variable ordering for the specific function */
+        /* both is neccessary for the algorithm */
+        /* *fOrdering is the same ordering as biddyOrderingTable, but it */
+        /* also contains information about which variables are neighbours */
+        /* garbage collection is not neccessary here! */
+        for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
+          biddyVariableTable.table[vmax].numone = 0;
+        }
+        nullOrdering(*fOrdering);
+        num = 1;
+        nodeNumberOrdering(MNG,f,&num,*fOrdering);
+        BiddyManagedDeselectAll(MNG);
+
+        /* DEBUGGING */
+        /*
+        printf("SIFTING: second direction, step=%u, min2=%u, num=%u\n",n,min2,num);
+        */
 
+        if (num <= min2) { /* second direction should use less or equal */
+          min2 = num;
+          best2 = n;
+        }
+
+        if (num > (treshold * min2)) {
+          stop = TRUE;
+        }
+
+      }
+    } /* while (!stop ...) */
+
+    if (min2 <= min) { /* second direction should use less or equal */
+      min = min2;
+    } else {
+      best2 = 0;
+    }
+
+    /* IF best2==0 THEN MINIMUM WAS REACHED IN THE FIRST WHILE */
+    /* YOU HAVE TO GO-BACK AND THEN MAKE ADDITIONAL best1 BACK STEPS */
+    /* IF best2!=0 THEN MINIMUM WAS REACHED IN THE SECOND WHILE */
+    /* YOU HAVE TO GO-BACK UNTIL n == best2 */
+
+    if (!best2) {
+      while (n) {
         if (highfirst) {
+          k = swapWithHigher(MNG,v,&active);
+          if (v == minvar) {
+            /* if k is in f then minvar = k else minvarOrder++ */
+            if (varTable[k]) {
+              minvar = k;
+            } else {
+              minvarOrder++;
+            }
+          }
+          if (k == maxvar) {
+            /* if v is in f then maxvar = v else maxvarOrder-- */
+            if (varTable[v]) {
+              maxvar = v;
+            } else {
+              maxvarOrder--;
+            }
+          }
+        } else {
+          k = swapWithLower(MNG,v,&active);
+          if (v == maxvar) {
+            /* if k is in f then maxvar = k else maxvarOrder-- */
+            if (varTable[k]) {
+              maxvar = k;
+            } else {
+              maxvarOrder--;
+            }
+          }
+          if (k == minvar) {
+            /* if v is in f then minvar = v else minvarOrder++ */
+            if (varTable[v]) {
+              minvar = v;
+            } else {
+              minvarOrder++;
+            }
+          }
+        }
+        n--;
+      }
+      while (n!=best1) {
+        if (highfirst) {
+          k = swapWithHigher(MNG,v,&active);
           if (v == minvar) {
             /* if k is in f then minvar = k else minvarOrder++ */
             if (varTable[k]) {
@@ -11395,18 +13234,50 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
             } else {
               maxvarOrder--;
             }
-            stop = TRUE;
           }
         } else {
+          k = swapWithLower(MNG,v,&active);
+          if (v == maxvar) {
+            /* if k is in f then maxvar = k else maxvarOrder-- */
+            if (varTable[k]) {
+              maxvar = k;
+            } else {
+              maxvarOrder--;
+            }
+          }
           if (k == minvar) {
             /* if v is in f then minvar = v else minvarOrder++ */
             if (varTable[v]) {
-              minvar = v;
+              minvar = v;
+            } else {
+              minvarOrder++;
+            }
+          }
+        }
+        n++;
+      }
+    } else {
+      while (n!=best2) {
+        if (highfirst) {
+          k = swapWithHigher(MNG,v,&active);
+          if (v == minvar) {
+            /* if k is in f then minvar = k else minvarOrder++ */
+            if (varTable[k]) {
+              minvar = k;
+            } else {
+              minvarOrder++;
+            }
+          }
+          if (k == maxvar) {
+            /* if v is in f then maxvar = v else maxvarOrder-- */
+            if (varTable[v]) {
+              maxvar = v;
             } else {
-              minvarOrder++;
+              maxvarOrder--;
             }
-            stop = TRUE;
           }
+        } else {
+          k = swapWithLower(MNG,v,&active);
           if (v == maxvar) {
             /* if k is in f then maxvar = k else maxvarOrder-- */
             if (varTable[k]) {
@@ -11415,59 +13286,48 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
               maxvarOrder--;
             }
           }
+          if (k == minvar) {
+            /* if v is in f then minvar = v else minvarOrder++ */
+            if (varTable[v]) {
+              minvar = v;
+            } else {
+              minvarOrder++;
+            }
+          }
         }
-
+        n--;
       }
+    }
 
-      /* NUMBER OF NODES CAN CHANGE ONLY IF v AND k HAVE BEEN ACTIVELY SWAPPED */
-      if (active) {
-
-        /* update node number and variable ordering for the specific function */
-        /* both is neccessary for the algorithm */
-        /* *fOrdering is the same ordering as biddyOrderingTable, but it */
-        /* also contains information about which variables are neighbours */
-        /* garbage collection is not neccessary here! */
-        for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
-          biddyVariableTable.table[vmax].numone = 0;
-        }
-        nullOrdering(*fOrdering);
-        num = 1;
-        nodeNumberOrdering(MNG,f,&num,*fOrdering);
-        BiddyManagedDeselectAll(MNG);
-
-        /* DEBUGGING */
-        /*
-        printf("SIFTING: first direction, step=%u, min=%u, num=%u\n",n,min,num);
-        */
+    /* IF SECOND GO-BACK WAS MOVING VARIABLE UP (highfirst == FALSE) */
+    /* ONLY OBSOLETE NODES WITH var == v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
 
-        if (num < min) { /* first direction should use strict less */
-          min = num;
-          best1 = n;
-        }
+    /* IF SECOND GO-BACK WAS MOVING VARIABLE DOWN (highfirst == TRUE) */
+    /* OBSOLETE NODES WITH var < v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
 
-        if (num > (treshold * min)) {
-          stop = TRUE;
-        }
+    /* garbage collection is not needed here */
+    /* however, it seems to be a good idea */
+    BiddyManagedGC(MNG,0,0,FALSE,TRUE);
 
-        /* THIS IS EXPERIMENTAL !!! */
-        /* IN THE FIRST DIRECTION, PERFORM LIMIT NUMBER OF STEPS */
-        /* THIS COULD RESULT IN SHORT TIME AND NOT VERY BAD SIZE */
-        /*
-        if (n >= 1) {
-          stop = TRUE;
-        }
-        */
+    /* CHOOSE NEXT VARIABLE OR FINISH */
+    /* VARIABLES NOT IN f WILL BE SKIPPED */
+    /* ou have to update variable ordering for the function to update which variables are neighbours */
 
-      }
-    } /* while (!stop ...) */
+    for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
+      biddyVariableTable.table[vmax].numone = 0;
+    }
+    nullOrdering(*fOrdering);
+    num = 1;
+    nodeNumberOrdering(MNG,f,&num,*fOrdering);
+    BiddyManagedDeselectAll(MNG);
 
     /* PROFILING */
     /*
     {
     Biddy_Variable varOrder;
     varOrder = getGlobalOrdering(MNG,v);
-    printf("SIFTING BEFORE GO-BACK: variable: \"%s\" (v=%u), currentOrder=%u, min=%u, numNodes=%u\n",
-           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG));
+    printf("SIFTING FINAL: variable: \"%s\" (v=%u), finalOrder=%u, best1=%u, best2=%u, min=%u, num=%u, numNodes=%u\n",
+           BiddyManagedGetVariableName(MNG,v),v,varOrder,best1,best2,min,num,BiddyManagedNodeTableNum(MNG));
     }
     */
 
@@ -11479,2228 +13339,2747 @@ BiddySiftingOnFunctionDirect(Biddy_Manager MNG, Biddy_Edge f,
     printf("\n");
     */
 
-    /* DEBUGGING */
+    finish = TRUE;
+    /* choose a variable that has not been sifted, yet, and has the max number of nodes */
+    vmax = 0;
+    vnum = 0;
+    v = 1;
+    while (v < BiddyManagedVariableTableNum(MNG)) {
+      if ((varTable[v] == 1) && ((vv=biddyVariableTable.table[v].numone) > vnum)) {
+        vmax = v;
+        vnum = vv;
+        finish = FALSE;
+      }
+      v++;
+    }
+    v = vmax;
+
+    /* FOR NON-CONVERGING SIFTING, EVERY NEXT VARIABLE HAS A LITTLE BIT GREATER TRESHOLD */
+    if (!converge) {
+      if (treshold < 1.25 * biddyNodeTable.siftingtreshold) {
+        treshold = treshold + 1 / ((float)3.14 * BiddyManagedVariableTableNum(MNG));
+      }
+    }
+
+    /* PROFILING */
     /*
-    printf("SIFTING: GO-BACK!\n");
+    printf("TRESHOLD = %.3f\n",treshold);
     */
 
-    /* GO BACK */
-    while (n) {
-      if (highfirst) {
-        k = swapWithLower(MNG,v,&active);
+  } /* while (!finish) */
 
-        if (v == maxvar) {
-          /* if k is in f then maxvar = k else maxvarOrder-- */
-          if (varTable[k]) {
-            maxvar = k;
-          } else {
-            maxvarOrder--;
-          }
-        }
-        if (k == minvar) {
-          /* if v is in f then minvar = v else minvarOrder++ */
-          if (varTable[v]) {
-            minvar = v;
-          } else {
-            minvarOrder++;
-          }
-        }
-      } else {
-        k = swapWithHigher(MNG,v,&active);
+  /* THIS CODE DISABLES FURTHER CALLS IN THE CASE OF NOT-CONVERGING SIFTING */
+  /* IN THE CASE OF CONVERGING SIFTING, TRESHOLD IS ADAPTED IN EVERY STEP */
+  if (!converge) {
+    totalbest = min;
+  } else {
+    treshold = treshold * biddyNodeTable.convergesiftingtreshold;
+  }
 
-        if (v == minvar) {
-          /* if k is in f then minvar = k else minvarOrder++ */
-          if (varTable[k]) {
-            minvar = k;
-          } else {
-            minvarOrder++;
-          }
+  } /* while (min < totalbest) */
+
+  /* END OF SIFTING ALGORITHM */
+
+  free(fOrdering);
+
+  return TRUE; /* sifting has been performed */
+}
+
+/*******************************************************************************
+\brief Initialization of Steinhaus–Johnson–Trotter algorithm.
+
+### Description
+    Create data needed for Steinhaus–Johnson–Trotter algorithm.
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddySjtInit(Biddy_Manager MNG)
+{
+  unsigned int i;
+  Biddy_Variable v;
+
+  struct userdata {
+    unsigned int value;
+    Biddy_Boolean direction;
+  } *ud;
+
+  /* OBSOLETE NODES ARE REMOVED TO MAKE SWAPPING FASTER */
+  BiddyManagedAutoGC(MNG);
+
+  v = BiddyManagedGetLowestVariable(MNG);
+  i = 0;
+  do {
+    ud = (struct userdata *) malloc(sizeof(struct userdata));
+    ud->value = i;
+    ud->direction = FALSE; /* FALSE = left = toTop = toLowest, TRUE = right = toBottom = toHighest */
+    BiddyManagedSetVariableData(MNG,v,(void *) ud);
+    v = biddyVariableTable.table[v].next;
+    i++;
+  } while (v != 0);
+}
+
+/*******************************************************************************
+\brief Remove data needed for Steinhaus–Johnson–Trotter algorithm.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddySjtExit(Biddy_Manager MNG)
+{
+  BiddyManagedClearVariablesData(MNG);
+}
+
+/*******************************************************************************
+\brief One step of Steinhaus–Johnson–Trotter algorithm.
+
+### Description
+    Returns TRUE if a step was made, otherwise it returns FALSE.
+### Side effects
+### More info
+*******************************************************************************/
+
+Biddy_Boolean
+BiddySjtStep(Biddy_Manager MNG)
+{
+  Biddy_Variable v,mm;
+  unsigned int mmvalue;
+  Biddy_Boolean STOP;
+
+  struct userdata {
+    unsigned int value;
+    Biddy_Boolean direction;
+  } *ud1,*ud2;
+
+  /* find the largest mobile element */
+  mm = 0;
+  mmvalue = 0;
+  STOP = TRUE;
+  v = 0;
+  do {
+    v = biddyVariableTable.table[v].prev;
+    ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,v);
+    if (ud1->direction && !(BiddyIsHighest(v)))
+    {
+      ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].next);
+      if (ud1->value > ud2->value)
+      {
+        STOP = FALSE; /* there exists a mobile element */
+        if (ud1->value > mmvalue) {
+          mm = v;
+          mmvalue = ud1->value;
         }
-        if (k == maxvar) {
-          /* if v is in f then maxvar = v else maxvarOrder-- */
-          if (varTable[v]) {
-            maxvar = v;
-          } else {
-            maxvarOrder--;
-          }
+      }
+    }
+    if (!(ud1->direction) && !(BiddyIsLowest(v)))
+    {
+      ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].prev);
+      if (ud1->value > ud2->value)
+      {
+        STOP = FALSE; /* there exists a mobile element */
+        if (ud1->value > mmvalue) {
+          mm = v;
+          mmvalue = ud1->value;
         }
       }
-      n--;
     }
+  } while (!(BiddyIsLowest(v)));
 
-    /* IF GO-BACK WAS MOVING VARIABLE UP (highfirst == TRUE) */
-    /* ONLY OBSOLETE NODES WITH var == v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
-
-    /* IF GO-BACK WAS MOVING VARIABLE DOWN (highfirst == FALSE) */
-    /* OBSOLETE NODES WITH var < v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
-
-    /* garbage collection is not needed here */
-    /* however, it seems to be a good idea */
-    BiddyManagedGC(MNG,0,0,FALSE,TRUE);
-
-    /* update variable ordering for the specific function */
-    /* to update which variables are neighbours */
-    for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
-      biddyVariableTable.table[vmax].numone = 0;
+  if (!(STOP)) {
+    /* swap mm and the adjacent element it is looking at */
+    ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,mm);
+    if (ud1->direction) {
+      BiddyManagedSwapWithHigher(MNG,mm);
+      /* swapWithHigher(MNG,mm,&active); */ /* not sure about this */
+    } else {
+      BiddyManagedSwapWithLower(MNG,mm);
+      /* swapWithLower(MNG,mm,&active); */ /* not sure about this */
     }
-    nullOrdering(*fOrdering);
-    num = 1;
-    nodeNumberOrdering(MNG,f,&num,*fOrdering);
-    BiddyManagedDeselectAll(MNG);
-
-    /* PROFILING */
-    /*
-    {
-    Biddy_Variable varOrder;
-    varOrder = getGlobalOrdering(MNG,v);
-    printf("SIFTING AFTER FIRST DIRECTION: variable: \"%s\" (v=%u), currentOrder=%u, min=%u, numNodes=%u\n",
-           BiddyManagedGetVariableName(MNG,v),v,varOrder,min,BiddyManagedNodeTableNum(MNG));
+    /* reverse the direction of all elements larger than mm */
+    ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,mm);
+    for (v = 1; v < BiddyManagedVariableTableNum(MNG); v++) {
+      ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,v);
+      if (ud1->value > ud2->value)
+      {
+        if (ud1->direction) {
+          ud1->direction = FALSE;
+        } else {
+          ud1->direction = TRUE;
+        }
+      }
     }
-    */
+  }
 
-    /* DEBUGGING */
-    /*
-    for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
-      printf("[\"%s\"@%u]",biddyVariableTable.table[k].name,biddyVariableTable.table[k].num);
-    }
-    printf("\n");
-    */
+  return !STOP;
+}
 
-    /* DEBUGGING */
-    /*
-    printf("SIFTING: SECOND DIRECTION\n");
-    */
+/*******************************************************************************
+\brief Function BiddySetOrdering uses variable swapping to create a given
+        variable ordering.
 
-    /* OPPOSITE DIRECTION */
+### Description
+    All obsolete nodes will be removed.
+    An optimized version of Bubble Sort is used.
+### Side effects
+    Variables are reordered globally. All obsolete nodes will be removed.
+    For TZBDD, all unreferenced nodes (not part of registered formulae)
+    will be removed. For TZBDD, this function may change top edge or even
+    a top node of any function/formula - this is a problem, because functions
+    referenced by local variables only may become wrong. Consequently, for
+    TZBDDs, reordering is not safe to start automatically!
+### More info
+*******************************************************************************/
 
-    n = 0;
-    best2 = 0;
-    stop = FALSE;
-    min2 = BiddyManagedNodeTableNum(MNG); /* recalculate node number after go-back */
+void
+BiddySetOrdering(Biddy_Manager MNG, BiddyOrderingTable ordering)
+{
+  Biddy_Variable v;
+  Biddy_Boolean swapped,OK;
 
-    if (converge) {
+  /* THIS IS FROM http://www.geeksforgeeks.org/bubble-sort/ */
+  if (biddyVariableTable.num == 1) return;
+  do {
+    v = biddyVariableTable.table[0].prev;
+    swapped = FALSE;
+    while (!BiddyIsLowest(v)) {
+      if (BiddyIsSmaller(ordering,v,biddyVariableTable.table[v].prev)) {
+        /* v IS SMALLER THAN v.lower */
+        swapWithLower(MNG,v,&OK);
+        swapped = TRUE;
+      } else {
+        v = biddyVariableTable.table[v].prev;
+      }
+    }
 
-      /* VARIANT C1: min from the first direction is not used within second direction */
-      /* no code is needed in this variant */
+    /* variable swapping does not clean obsolete nodes and thus GC is useful here */
+    if (swapped) BiddyManagedGC(MNG,0,0,FALSE,TRUE);
 
-      /* VARIANT C2: min from the first direction is used within second direction */
-      /*
-      min2 = min;
-      */
+  } while (swapped);
+}
 
-      /* VARIANT C3: if there is min in the first direction do not check second direction */
-      /*
-      if (best1) {
-        stop = TRUE;
-      }
-      */
+/*******************************************************************************
+\brief Function BiddySetOrderingByData uses variable swapping to create a given
+        variable ordering.
 
-    } else {
+### Description
+    All obsolete nodes will be removed.
+    This is the same as BiddySetOrdering() except that variables' data are
+    used instead of values in the given ordering table.
+    An optimized version of Bubble Sort is used.
+### Side effects
+    Variables are reordered globally. All obsolete nodes will be removed.
+    For TZBDD, all unreferenced nodes (not part of registered formulae)
+    will be removed. For TZBDD, this function may change top edge or even
+    a top node of any function/formula - this is a problem, because functions
+    referenced by local variables only may become wrong. Consequently, for
+    TZBDDs, reordering is not safe to start automatically!
+### More info
+*******************************************************************************/
 
-      /* VARIANT NC1: min from the first direction is not used within second direction */
-      /* no code is needed in this variant */
+void
+BiddySetOrderingByData(Biddy_Manager MNG)
+{
+  Biddy_Variable v,vo;
+  Biddy_Boolean swapped,OK;
 
-      /* VARIANT NC2: min from the first direction is used within second direction */
-      /*
-      min2 = min;
-      */
+  /* PROFILING */
+  /*
+  clock_t elapsedtime;
+  elapsedtime = clock();
+  */
 
-      /* VARIANT NC3: if there is min in the first direction do not check second direction */
-      /* THIS SEEMS TO BE BAD FOR REGULAR SIFTING */
+  /* MAKE SURE, THAT ALL VARIABLES HAVE APPROPRIATE DATA */
+  v = BiddyManagedGetLowestVariable(MNG);
+  while (v && !biddyVariableTable.table[v].data) {
+    v = biddyVariableTable.table[v].next;
+  }
+  if (!v) return; /* NO DATA ARE GIVEN */
+  vo = *((Biddy_Variable *)biddyVariableTable.table[v].data);
+  v = BiddyManagedGetLowestVariable(MNG);
+  while (v) {
+    if (biddyVariableTable.table[v].data) {
+      vo = *((Biddy_Variable *)biddyVariableTable.table[v].data);
+    } else {
+      biddyVariableTable.table[v].data = (void *) malloc(sizeof(Biddy_Variable));
+      *((Biddy_Variable *)biddyVariableTable.table[v].data) = vo;
+    }
+    v = biddyVariableTable.table[v].next;
+  }
 
+  /* THIS IS FROM http://www.geeksforgeeks.org/bubble-sort/ */
+  if (biddyVariableTable.num == 1) return;
+  do {
+    v = biddyVariableTable.table[0].prev;
+    swapped = FALSE;
+    while (!BiddyIsLowest(v)) {
+      if (*((Biddy_Variable *)(BiddyManagedGetVariableData(MNG,v))) <
+          *((Biddy_Variable *)(BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].prev))))
+      {
+        /* v.data IS SMALLER THAN (v.lower).data */
+        swapWithLower(MNG,v,&OK);
+        swapped = TRUE;
+      } else {
+        v = biddyVariableTable.table[v].prev;
+      }
     }
 
-    while (!stop && (highfirst ?
-                      (k=swapWithLower(MNG,v,&active)) :
-                      (k=swapWithHigher(MNG,v,&active))))
-    {
+    /* PROFILING */
+    /*
+#ifdef MINGW
+    printf("v = %u, numNodes = %u, memory in use: %I64u bytes\n",v,biddyNodeTable.num,BiddyManagedReadMemoryInUse(MNG));
+#else
+    printf("v = %u, numNodes = %u, memory in use: %llu bytes\n",v,biddyNodeTable.num,BiddyManagedReadMemoryInUse(MNG));
+#endif
+    */
 
-      n++;
+    /* variable swapping does not clean obsolete nodes and thus GC is useful here */
+    if (swapped) BiddyManagedGC(MNG,0,0,FALSE,TRUE);
 
-      /* DEBUGGING */
-      /*
-      printf("SIFTING: ");
-      if (highfirst) {
-        printf("%u swaped with lower %u",v,k);
-      } else {
-        printf("%u swaped with higher %u",v,k);
-      }
-      if (active) printf(" (ACTIVE)");
-      printf("\n");
-      */
+  } while (swapped);
 
-      if (active) {
-        /* IF v AND k HAVE BEEN SWAPPED */
+  /* PROFILING */
+  /*
+  printf("BiddySetOrderingByData ADAPTING TIME = %.2f\n",(clock()-elapsedtime)/(1.0*CLOCKS_PER_SEC));
+  */
+}
 
-        if (highfirst) {
-          if (k == minvar) {
-            minvar = v; /* update minvar */
-            stop = TRUE;
-          }
-          if (v == maxvar) {
-            maxvar = k;  /* update maxvar */
-            /* maxvarOrder is the same */
-          }
-        } else {
-          if (v == minvar) {
-            minvar = k;  /* update minvar */
-            /* minvarOrder is the same */
-          }
-          if (k == maxvar) {
-            maxvar = v; /* update maxvar */
-            stop = TRUE;
-          }
-        }
+/*******************************************************************************
+\brief Function BiddyCopy creates a copy of BDD in another manager of the same
+       BDD type.
 
-      } else {
-        /* IF v AND k HAVE NOT BEEN SWAPPED */
-        /* THEY ARE NOT NEIGHBOURS BUT THEY MAY BE BOTH IN f !! */
+### Description
+### Side effects
+    Expiry value of the original nodes is not copied.
+    It is assumed that the target manager has the same or larger domain and
+    the same ordering for all variables from the source manager.
+### More info
+*******************************************************************************/
+
+static Biddy_Edge BiddyCopyR(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f);
 
-        if (highfirst) {
-          if (k == minvar) {
-            /* if v is in f then minvar = v else minvarOrder++ */
-            if (varTable[v]) {
-              minvar = v;
-            } else {
-              minvarOrder++;
-            }
-            stop = TRUE;
-          }
-          if (v == maxvar) {
-            /* if k is in f then maxvar = k else maxvarOrder-- */
-            if (varTable[k]) {
-              maxvar = k;
-            } else {
-              maxvarOrder--;
-            }
-          }
-        } else {
-          if (v == minvar) {
-            /* if k is in f then minvar = k else minvarOrder++ */
-            if (varTable[k]) {
-              minvar = k;
-            } else {
-              minvarOrder++;
-            }
-          }
-          if (k == maxvar) {
-            /* if v is in f then maxvar = v else maxvarOrder-- */
-            if (varTable[v]) {
-              maxvar = v;
-            } else {
-              maxvarOrder--;
-            }
-            stop = TRUE;
-          }
-        }
+Biddy_Edge
+BiddyCopy(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+{
+  Biddy_Edge r;
 
-      }
+  assert( MNG1 != MNG2 );
+  assert( biddyManagerType1 == biddyManagerType2 );
 
-      /* NUMBER OF NODES CAN CHANGE ONLY IF v AND k HAVE BEEN ACTIVELY SWAPPED */
-      if (active) {
+  /* TO DO: use Special case 2 of taggedFoaNode to simplify this function! */
 
-        /* update node number and variable ordering for the specific function */
-        /* both is neccessary for the algorithm */
-        /* *fOrdering is the same ordering as biddyOrderingTable, but it */
-        /* also contains information about which variables are neighbours */
-        /* garbage collection is not neccessary here! */
-        for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
-          biddyVariableTable.table[vmax].numone = 0;
-        }
-        nullOrdering(*fOrdering);
-        num = 1;
-        nodeNumberOrdering(MNG,f,&num,*fOrdering);
-        BiddyManagedDeselectAll(MNG);
+  BiddyCreateLocalInfo(MNG1,f);
+  r = BiddyCopyR(MNG1,MNG2,f);
+  BiddyDeleteLocalInfo(MNG1,f);
 
-        /* DEBUGGING */
-        /*
-        printf("SIFTING: second direction, step=%u, min2=%u, num=%u\n",n,min2,num);
-        */
+  return r;
+}
 
-        if (num <= min2) { /* second direction should use less or equal */
-          min2 = num;
-          best2 = n;
-        }
+static Biddy_Edge
+BiddyCopyR(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+{
+  Biddy_Edge e,t,r;
+  Biddy_Variable tag;
+  Biddy_Boolean mark;
+  Biddy_String name;
+  Biddy_Variable v;
 
-        if (num > (treshold * min2)) {
-          stop = TRUE;
-        }
+  /* TO DO: use Special case 2 of taggedFoaNode to simplify this function! */
 
-      }
-    } /* while (!stop ...) */
+  tag = BiddyGetTag(f); /* tag of the given edge */
+  if (tag) {
+    name = BiddyManagedGetVariableName(MNG1,tag);
+    tag = BiddyManagedGetVariable(MNG2,name);
+  }
+  mark = BiddyGetMark(f); /* complement bit of the given edge */
 
-    if (min2 <= min) { /* second direction should use less or equal */
-      min = min2;
+  if (f == biddyNull) return biddyNull;
+  if (BiddyIsTerminal(f)) {
+    if (mark) {
+      r = BiddyComplement(biddyTerminal2);
     } else {
-      best2 = 0;
+      r = biddyTerminal2;
     }
-
-    /* IF best2==0 THEN MINIMUM WAS REACHED IN THE FIRST WHILE */
-    /* YOU HAVE TO GO-BACK AND THEN MAKE ADDITIONAL best1 BACK STEPS */
-    /* IF best2!=0 THEN MINIMUM WAS REACHED IN THE SECOND WHILE */
-    /* YOU HAVE TO GO-BACK UNTIL n == best2 */
-
-    if (!best2) {
-      while (n) {
-        if (highfirst) {
-          k = swapWithHigher(MNG,v,&active);
-          if (v == minvar) {
-            /* if k is in f then minvar = k else minvarOrder++ */
-            if (varTable[k]) {
-              minvar = k;
-            } else {
-              minvarOrder++;
-            }
-          }
-          if (k == maxvar) {
-            /* if v is in f then maxvar = v else maxvarOrder-- */
-            if (varTable[v]) {
-              maxvar = v;
-            } else {
-              maxvarOrder--;
-            }
-          }
-        } else {
-          k = swapWithLower(MNG,v,&active);
-          if (v == maxvar) {
-            /* if k is in f then maxvar = k else maxvarOrder-- */
-            if (varTable[k]) {
-              maxvar = k;
-            } else {
-              maxvarOrder--;
-            }
-          }
-          if (k == minvar) {
-            /* if v is in f then minvar = v else minvarOrder++ */
-            if (varTable[v]) {
-              minvar = v;
-            } else {
-              minvarOrder++;
-            }
-          }
-        }
-        n--;
-      }
-      while (n!=best1) {
-        if (highfirst) {
-          k = swapWithHigher(MNG,v,&active);
-          if (v == minvar) {
-            /* if k is in f then minvar = k else minvarOrder++ */
-            if (varTable[k]) {
-              minvar = k;
-            } else {
-              minvarOrder++;
-            }
-          }
-          if (k == maxvar) {
-            /* if v is in f then maxvar = v else maxvarOrder-- */
-            if (varTable[v]) {
-              maxvar = v;
-            } else {
-              maxvarOrder--;
-            }
-          }
-        } else {
-          k = swapWithLower(MNG,v,&active);
-          if (v == maxvar) {
-            /* if k is in f then maxvar = k else maxvarOrder-- */
-            if (varTable[k]) {
-              maxvar = k;
-            } else {
-              maxvarOrder--;
-            }
-          }
-          if (k == minvar) {
-            /* if v is in f then minvar = v else minvarOrder++ */
-            if (varTable[v]) {
-              minvar = v;
-            } else {
-              minvarOrder++;
-            }
-          }
-        }
-        n++;
-      }
+    if (tag) BiddySetTag(r,tag);
+  } else {
+    if (BiddyManagedIsSelected(MNG1,f)) {
+      r = BiddyGetCopy(f);
+      BiddySetTag(r,tag);
+      if (mark) BiddySetMark(r);
     } else {
-      while (n!=best2) {
-        if (highfirst) {
-          k = swapWithHigher(MNG,v,&active);
-          if (v == minvar) {
-            /* if k is in f then minvar = k else minvarOrder++ */
-            if (varTable[k]) {
-              minvar = k;
-            } else {
-              minvarOrder++;
-            }
-          }
-          if (k == maxvar) {
-            /* if v is in f then maxvar = v else maxvarOrder-- */
-            if (varTable[v]) {
-              maxvar = v;
-            } else {
-              maxvarOrder--;
-            }
-          }
-        } else {
-          k = swapWithLower(MNG,v,&active);
-          if (v == maxvar) {
-            /* if k is in f then maxvar = k else maxvarOrder-- */
-            if (varTable[k]) {
-              maxvar = k;
-            } else {
-              maxvarOrder--;
-            }
-          }
-          if (k == minvar) {
-            /* if v is in f then minvar = v else minvarOrder++ */
-            if (varTable[v]) {
-              minvar = v;
-            } else {
-              minvarOrder++;
-            }
-          }
-        }
-        n--;
+      BiddyManagedSelectNode(MNG1,f);
+      name = BiddyManagedGetTopVariableName(MNG1,f); /* top variable of the given edge */
+      v = BiddyManagedGetVariable(MNG2,name);
+      e = BiddyCopyR(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+      t = BiddyCopyR(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+#ifdef COMPACT
+      r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
+#else
+      if ((biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD)) {
+        r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,tag,TRUE);
+      } else {
+        r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
       }
+#endif
+      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
+      BiddySetCopy(f,BiddyN(r));
+      addCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),r); /* used by the next copies */
     }
+  }
+
+  return r;
+}
+
+/*******************************************************************************
+\brief Function BiddyCopyOBDD copies a BIDDYTYPEOBDD or BIDDYTYPEOBDDC
+        into another manager.
+
+### Description
+### Side effects
+    Expiry value of the original nodes is not copied.
+    The variable ordering of created BDD is adapted to the target manager.
+    It is assumed that the target manager has the same or larger domain.
+### More info
+*******************************************************************************/
 
-    /* IF SECOND GO-BACK WAS MOVING VARIABLE UP (highfirst == FALSE) */
-    /* ONLY OBSOLETE NODES WITH var == v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
+Biddy_Edge
+BiddyCopyOBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+{
+  Biddy_String topname;
+  Biddy_Variable v;
+  Biddy_Boolean mark;
+  Biddy_Edge e,t,r;
 
-    /* IF SECOND GO-BACK WAS MOVING VARIABLE DOWN (highfirst == TRUE) */
-    /* OBSOLETE NODES WITH var < v EXIST IN THE SYSTEM (NO GC WAS CALLED FOR GO-BACK) */
+  assert ( (biddyManagerType1 == BIDDYTYPEOBDDC) || (biddyManagerType1 == BIDDYTYPEOBDD) );
 
-    /* garbage collection is not needed here */
-    /* however, it seems to be a good idea */
-    BiddyManagedGC(MNG,0,0,FALSE,TRUE);
+  if (f == biddyNull) return biddyNull;
+  if (f == biddyZero1) return biddyZero2;
+  if (f == biddyOne1) return biddyOne2;
 
-    /* CHOOSE NEXT VARIABLE OR FINISH */
-    /* VARIABLES NOT IN f WILL BE SKIPPED */
-    /* ou have to update variable ordering for the function to update which variables are neighbours */
+  if (findCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),&r)) return r;
 
-    for (vmax=1; vmax<BiddyManagedVariableTableNum(MNG); vmax++) {
-      biddyVariableTable.table[vmax].numone = 0;
-    }
-    nullOrdering(*fOrdering);
-    num = 1;
-    nodeNumberOrdering(MNG,f,&num,*fOrdering);
-    BiddyManagedDeselectAll(MNG);
+  topname = BiddyManagedGetTopVariableName(MNG1,f);
+  mark = BiddyGetMark(f);
+  v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
+  /* DEBUGGING */
+  /*
+  printf("Variable <%s> BiddyManagedGetVariableEdge in MNG1\n",topname);
+  Biddy_Managed_PrintfBDD(MNG1,BiddyManagedGetVariableEdge(MNG1,BiddyManagedGetVariable(MNG1,topname)));
+  Biddy_Managed_PrintfSOP(MNG1,BiddyManagedGetVariableEdge(MNG1,BiddyManagedGetVariable(MNG1,topname)));
+  printf("Variable <%s> BiddyManagedGetVariableEdge in MNG2\n",topname);
+  Biddy_Managed_PrintfBDD(MNG2,BiddyManagedGetVariableEdge(MNG2,BiddyManagedGetVariable(MNG2,topname)));
+  Biddy_Managed_PrintfSOP(MNG2,BiddyManagedGetVariableEdge(MNG2,BiddyManagedGetVariable(MNG2,topname)));
+  */
+  assert ( v != 0 );
+  e = BiddyCopyOBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+  t = BiddyCopyOBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+  r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),t,e);
 
-    /* PROFILING */
-    /*
-    {
-    Biddy_Variable varOrder;
-    varOrder = getGlobalOrdering(MNG,v);
-    printf("SIFTING FINAL: variable: \"%s\" (v=%u), finalOrder=%u, best1=%u, best2=%u, min=%u, num=%u, numNodes=%u\n",
-           BiddyManagedGetVariableName(MNG,v),v,varOrder,best1,best2,min,num,BiddyManagedNodeTableNum(MNG));
-    }
-    */
+  /* keyword is determined again because GC in MNG2 may change it */
+  addCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),r);
 
-    /* DEBUGGING */
-    /*
-    for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
-      printf("[\"%s\"@%u]",biddyVariableTable.table[k].name,biddyVariableTable.table[k].num);
-    }
-    printf("\n");
-    */
+  return r;
+}
 
-    finish = TRUE;
-    /* choose a variable that has not been sifted, yet, and has the max number of nodes */
-    vmax = 0;
-    vnum = 0;
-    v = 1;
-    while (v < BiddyManagedVariableTableNum(MNG)) {
-      if ((varTable[v] == 1) && ((vv=biddyVariableTable.table[v].numone) > vnum)) {
-        vmax = v;
-        vnum = vv;
-        finish = FALSE;
-      }
-      v++;
-    }
-    v = vmax;
+/*******************************************************************************
+\brief Function BiddyCopyZBDD copies a BIDDYTYPEZBDD or BIDDYTYPEZBDDC
+        into another manager.
 
-    /* FOR NON-CONVERGING SIFTING, EVERY NEXT VARIABLE HAS A LITTLE BIT GREATER TRESHOLD */
-    if (!converge) {
-      if (treshold < 1.25 * biddyNodeTable.siftingtreshold) {
-        treshold = treshold + 1 / ((float)3.14 * BiddyManagedVariableTableNum(MNG));
-      }
-    }
+### Description
+### Side effects
+    Expiry value of the original nodes is not copied.
+    The variable ordering of created BDD is adapted to the target manager.
+    It is assumed that the target manager has the same or larger domain.
+### More info
+*******************************************************************************/
 
-    /* PROFILING */
-    /*
-    printf("TRESHOLD = %.3f\n",treshold);
-    */
+Biddy_Edge
+BiddyCopyZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+{
+#ifndef COMPACT
+  Biddy_String topname;
+  Biddy_Variable k;
+  Biddy_Variable v;
+  Biddy_Boolean mark;
+  Biddy_Edge e,t,r;
 
-  } /* while (!finish) */
+  assert ( (biddyManagerType1 == BIDDYTYPEZBDDC) || (biddyManagerType1 == BIDDYTYPEZBDD) );
 
-  /* THIS CODE DISABLES FURTHER CALLS IN THE CASE OF NOT-CONVERGING SIFTING */
-  /* IN THE CASE OF CONVERGING SIFTING, TRESHOLD IS ADAPTED IN EVERY STEP */
-  if (!converge) {
-    totalbest = min;
+  if (f == biddyNull) return biddyNull;
+  if (f == biddyZero1) return biddyZero2;
+
+  if (findCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),&r)) return r;
+
+  if (f == biddyTerminal1) {
+    r = biddyOne2;
+    for (k = 1; k < biddyVariableTable1.num; k++) {
+      topname = BiddyManagedGetVariableName(MNG1,k);
+      v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
+      r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),biddyZero2,r);
+    }
   } else {
-    treshold = treshold * biddyNodeTable.convergesiftingtreshold;
+    topname = BiddyManagedGetTopVariableName(MNG1,f);
+    mark = BiddyGetMark(f);
+    v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
+    assert ( v != 0 );
+    e = BiddyCopyZBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+    t = BiddyCopyZBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+    t = BiddyManagedChange(MNG2,t,v);
+    r = BiddyManagedOr(MNG2,e,t); /* or/xor, both is correct, what is faster? */
   }
 
-  } /* while (min < totalbest) */
-
-  /* END OF SIFTING ALGORITHM */
+  /* keyword is determined again because GC in MNG2 may change it */
+  addCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),r);
 
-  free(fOrdering);
+  return r;
 
-  return TRUE; /* sifting has been performed */
+#else
+  if (MNG1 || MNG2 || f) {
+    /* MAKE COMPILER HAPPY */
+  }
+  return biddyNull;
+#endif
 }
 
 /*******************************************************************************
-\brief Initialization of Steinhaus–Johnson–Trotter algorithm.
+\brief Function BiddyCopyTZBDD copies a BIDDYTYPETZBDD or BIDDYTYPETZBDDC
+        into another manager.
 
 ### Description
-    Create data needed for Steinhaus–Johnson–Trotter algorithm.
 ### Side effects
+    Expiry value of the original nodes is not copied.
+    The variable ordering of created BDD is adapted to the target manager.
+    It is assumed that the target manager has the same or larger domain.
 ### More info
 *******************************************************************************/
 
-void
-BiddySjtInit(Biddy_Manager MNG)
+Biddy_Edge
+BiddyCopyTZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
 {
-  unsigned int i;
+#ifndef COMPACT
+  Biddy_String topname;
+  Biddy_Variable top,tag;
   Biddy_Variable v;
+  Biddy_Edge e,t,r;
 
-  struct userdata {
-    unsigned int value;
-    Biddy_Boolean direction;
-  } *ud;
+  assert ( (biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD) );
 
-  /* OBSOLETE NODES ARE REMOVED TO MAKE SWAPPING FASTER */
-  BiddyManagedAutoGC(MNG);
+  if (f == biddyNull) return biddyNull;
+  if (f == biddyZero1) return biddyZero2;
 
-  v = BiddyManagedGetLowestVariable(MNG);
-  i = 0;
-  do {
-    ud = (struct userdata *) malloc(sizeof(struct userdata));
-    ud->value = i;
-    ud->direction = FALSE; /* FALSE = left = toTop = toLowest, TRUE = right = toBottom = toHighest */
-    BiddyManagedSetVariableData(MNG,v,(void *) ud);
-    v = biddyVariableTable.table[v].next;
-    i++;
-  } while (v != 0);
+  if (findCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),&r)) return r;
+
+  top = BiddyV(f);
+  if (!top) {
+    r = biddyOne2;
+  } else {
+    topname = BiddyManagedGetVariableName(MNG1,top);
+    v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
+    assert ( v != 0 );
+    e = BiddyCopyTZBDD(MNG1,MNG2,BiddyE(f));
+    t = BiddyCopyTZBDD(MNG1,MNG2,BiddyT(f));
+    r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),t,e);
+  }
+
+  tag = BiddyGetTag(f);
+  while (top != tag) {
+    top = biddyVariableTable1.table[top].prev;
+    topname = BiddyManagedGetVariableName(MNG1,top);
+    v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
+    assert ( v != 0 );
+    r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),biddyZero2,r);
+  }
+
+  /* keyword is determined again because GC in MNG2 may change it */
+  addCopyCache(MNG1,f,copyKeyword(MNG1,MNG2),r);
+
+  return r;
+
+#else
+  if (MNG1 || MNG2 || f) {
+    /* MAKE COMPILER HAPPY */
+  }
+  return biddyNull;
+#endif
 }
 
 /*******************************************************************************
-\brief Remove data needed for Steinhaus–Johnson–Trotter algorithm.
+\brief Function BiddyConvertDirect copies a graph from one manager to
+       another manager which can use the same or different BDD type.
 
 ### Description
+    This should be faster than a general copy functions. But, it is not
+    implemented for all BDD type conversions. However, it is safe to use this
+    function for any BDD type conversion because in the case the conversion
+    is not directly implemented a regular copy will be called.
 ### Side effects
+    It is assumed, that domain has already been copied.
+    For conversion from OBDD/TZBDD into ZBDD this function does not create
+    the topmost variables which are not present in OBDD/TZBDD.
+    For conversion from ZBDD into OBDD/TZBDD this function does not create
+    the topmost variables which are not present in ZBDD.
+    Results are stored in Copy cache, they are labelled with a different
+    keyword than results of regular copy.
 ### More info
 *******************************************************************************/
 
-void
-BiddySjtExit(Biddy_Manager MNG)
+Biddy_Edge
+BiddyConvertDirect(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
 {
-  BiddyManagedClearVariablesData(MNG);
-}
+  Biddy_Edge e,t;
+  Biddy_Variable top;
+  Biddy_Boolean mark;
+  Biddy_String topname;
+  Biddy_Variable v;
+  Biddy_Edge r;
+
+#ifndef COMPACT
+  Biddy_Variable tag;
+  Biddy_Variable prevvar;
+#endif
+
+  assert( biddyManagerType1 != BIDDYTYPEOFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType1 != BIDDYTYPEOFDDC ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType1 != BIDDYTYPEZFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType1 != BIDDYTYPEZFDDC ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType1 != BIDDYTYPETZFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType1 != BIDDYTYPETZFDDC ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPEOFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPEOFDDC ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPEZFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPEZFDDC ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPETZFDD ); /* NOT IMPLEMENTED, YET */
+  assert( biddyManagerType2 != BIDDYTYPETZFDDC ); /* NOT IMPLEMENTED, YET */
+
+  assert( MNG1 != MNG2 );
+
+  /* DEBUGGING */
+  /*
+  printf("Convert direct: f = %s (%p)\n",BiddyManagedGetTopVariableName(MNG1,f),f);
+  */
 
-/*******************************************************************************
-\brief One step of Steinhaus–Johnson–Trotter algorithm.
+  if (f == biddyNull) return biddyNull;
 
-### Description
-    Returns TRUE if a step was made, otherwise it returns FALSE.
-### Side effects
-### More info
-*******************************************************************************/
+  if (findCopyCache(MNG1,f,copyKeyword(MNG1,MNG2)+1,&r)) return r;
 
-Biddy_Boolean
-BiddySjtStep(Biddy_Manager MNG)
-{
-  Biddy_Variable v,mm;
-  unsigned int mmvalue;
-  Biddy_Boolean STOP;
+  r = biddyNull;
 
-  struct userdata {
-    unsigned int value;
-    Biddy_Boolean direction;
-  } *ud1,*ud2;
+  if ((biddyManagerType1 == BIDDYTYPEOBDDC) || (biddyManagerType1 == BIDDYTYPEOBDD)) {
 
-  /* find the largest mobile element */
-  mm = 0;
-  mmvalue = 0;
-  STOP = TRUE;
-  v = 0;
-  do {
-    v = biddyVariableTable.table[v].prev;
-    ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,v);
-    if (ud1->direction && !(BiddyIsHighest(v)))
-    {
-      ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].next);
-      if (ud1->value > ud2->value)
-      {
-        STOP = FALSE; /* there exists a mobile element */
-        if (ud1->value > mmvalue) {
-          mm = v;
-          mmvalue = ud1->value;
-        }
+    if (BiddyIsTerminal(f)) {
+      if (BiddyGetMark(f)) {
+        return BiddyComplement(biddyTerminal2);
+      } else {
+        return biddyTerminal2;
       }
     }
-    if (!(ud1->direction) && !(BiddyIsLowest(v)))
-    {
-      ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].prev);
-      if (ud1->value > ud2->value)
-      {
-        STOP = FALSE; /* there exists a mobile element */
-        if (ud1->value > mmvalue) {
-          mm = v;
-          mmvalue = ud1->value;
-        }
-      }
+
+    mark = BiddyGetMark(f); /* complement bit of the given edge */
+    top = BiddyV(f); /* top variable of the given edge */
+    topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
+    v = BiddyManagedGetVariable(MNG2,topname);
+
+#ifndef COMPACT
+    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
+      top = BiddyManagedGetVariable(MNG2,topname);
     }
-  } while (!(BiddyIsLowest(v)));
+#endif
 
-  if (!(STOP)) {
-    /* swap mm and the adjacent element it is looking at */
-    ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,mm);
-    if (ud1->direction) {
-      BiddyManagedSwapWithHigher(MNG,mm);
-      /* swapWithHigher(MNG,mm,&active); */ /* not sure about this */
-    } else {
-      BiddyManagedSwapWithLower(MNG,mm);
-      /* swapWithLower(MNG,mm,&active); */ /* not sure about this */
+    e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+
+#ifndef COMPACT
+    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
+      topname = BiddyManagedGetTopVariableName(MNG1,BiddyE(f));
+      prevvar = BiddyManagedGetVariable(MNG2,topname);
+      prevvar = biddyVariableTable2.table[prevvar].prev;
+      while (prevvar != top) {
+        e = BiddyManagedTaggedFoaNode(MNG2,prevvar,e,e,prevvar,TRUE);
+        BiddyProlongOne(e,biddySystemAge2); /* FoaNode returns an obsolete node! */
+        prevvar = biddyVariableTable2.table[prevvar].prev;
+      }
     }
-    /* reverse the direction of all elements larger than mm */
-    ud2 = (struct userdata *) BiddyManagedGetVariableData(MNG,mm);
-    for (v = 1; v < BiddyManagedVariableTableNum(MNG); v++) {
-      ud1 = (struct userdata *) BiddyManagedGetVariableData(MNG,v);
-      if (ud1->value > ud2->value)
-      {
-        if (ud1->direction) {
-          ud1->direction = FALSE;
-        } else {
-          ud1->direction = TRUE;
-        }
+#endif
+
+    t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+
+#ifndef COMPACT
+    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
+      topname = BiddyManagedGetTopVariableName(MNG1,BiddyT(f));
+      prevvar = BiddyManagedGetVariable(MNG2,topname);
+      prevvar = biddyVariableTable2.table[prevvar].prev;
+      while (prevvar != top) {
+        t = BiddyManagedTaggedFoaNode(MNG2,prevvar,t,t,prevvar,TRUE);
+        BiddyProlongOne(t,biddySystemAge2); /* FoaNode returns an obsolete node! */
+        prevvar = biddyVariableTable2.table[prevvar].prev;
       }
     }
-  }
+#endif
 
-  return !STOP;
-}
+    r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
+    BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
 
-/*******************************************************************************
-\brief Function BiddySetOrdering uses variable swapping to create a given
-        variable ordering.
+  }
 
-### Description
-    All obsolete nodes will be removed.
-    An optimized version of Bubble Sort is used.
-### Side effects
-    Variables are reordered globally. All obsolete nodes will be removed.
-    For TZBDD, all unreferenced nodes (not part of registered formulae)
-    will be removed. For TZBDD, this function may change top edge or even
-    a top node of any function/formula - this is a problem, because functions
-    referenced by local variables only may become wrong. Consequently, for
-    TZBDDs, reordering is not safe to start automatically!
-### More info
-*******************************************************************************/
+#ifndef COMPACT
+  else if ((biddyManagerType1 == BIDDYTYPEZBDDC) || (biddyManagerType1 == BIDDYTYPEZBDD)) {
 
-void
-BiddySetOrdering(Biddy_Manager MNG, BiddyOrderingTable ordering)
-{
-  Biddy_Variable v;
-  Biddy_Boolean swapped,OK;
+    if ((biddyManagerType2 == BIDDYTYPETZBDDC) || (biddyManagerType2 == BIDDYTYPETZBDD)) {
+      /* TO DO: DIRECT CONVERSION ZBDD -> TZBDD IS NOT IMPLEMENTED, YET */
+      Biddy_Manager MNGTMP;
+      Biddy_Edge tmp;
+      BiddyInitMNG(&MNGTMP,BIDDYTYPEOBDDC);
+      BiddyManagedCopy(MNG1,MNGTMP,biddyZero1,TRUE); /* copy domain from MNG1 to MNGTMP */
+      tmp = BiddyConvertDirect(MNG1,MNGTMP,f);
+      r = BiddyConvertDirect(MNGTMP,MNG2,tmp);
+      BiddyExitMNG(&MNGTMP);
+      return r;
+    }
 
-  /* THIS IS FROM http://www.geeksforgeeks.org/bubble-sort/ */
-  if (biddyVariableTable.num == 1) return;
-  do {
-    v = biddyVariableTable.table[0].prev;
-    swapped = FALSE;
-    while (!BiddyIsLowest(v)) {
-      if (BiddyIsSmaller(ordering,v,biddyVariableTable.table[v].prev)) {
-        /* v IS SMALLER THAN v.lower */
-        swapWithLower(MNG,v,&OK);
-        swapped = TRUE;
+    if (BiddyIsTerminal(f)) {
+      if (BiddyGetMark(f)) {
+        return BiddyComplement(biddyTerminal2);
       } else {
-        v = biddyVariableTable.table[v].prev;
+        return biddyTerminal2;
       }
     }
 
-    /* variable swapping does not clean obsolete nodes and thus GC is useful here */
-    if (swapped) BiddyManagedGC(MNG,0,0,FALSE,TRUE);
+    mark = BiddyGetMark(f); /* complement bit of the given edge */
+    top = BiddyV(f); /* top variable of the given edge */
+    topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
+    v = BiddyManagedGetVariable(MNG2,topname);
 
-  } while (swapped);
-}
+    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)){
+      top = BiddyManagedGetVariable(MNG2,topname);
+    }
 
-/*******************************************************************************
-\brief Function BiddySetOrderingByData uses variable swapping to create a given
-        variable ordering.
+    e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
 
-### Description
-    All obsolete nodes will be removed.
-    This is the same as BiddySetOrdering() except that variables' data are
-    used instead of values in the given ordering table.
-    An optimized version of Bubble Sort is used.
-### Side effects
-    Variables are reordered globally. All obsolete nodes will be removed.
-    For TZBDD, all unreferenced nodes (not part of registered formulae)
-    will be removed. For TZBDD, this function may change top edge or even
-    a top node of any function/formula - this is a problem, because functions
-    referenced by local variables only may become wrong. Consequently, for
-    TZBDDs, reordering is not safe to start automatically!
-### More info
-*******************************************************************************/
+    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)) {
+      topname = BiddyManagedGetTopVariableName(MNG1,BiddyE(f));
+      prevvar = BiddyManagedGetVariable(MNG2,topname);
+      prevvar = biddyVariableTable2.table[prevvar].prev;
+      while (prevvar != top) {
+        e = BiddyManagedTaggedFoaNode(MNG2,prevvar,e,biddyZero2,prevvar,TRUE);
+        BiddyProlongOne(e,biddySystemAge2); /* FoaNode returns an obsolete node! */
+        prevvar = biddyVariableTable2.table[prevvar].prev;
+      }
+    }
 
-void
-BiddySetOrderingByData(Biddy_Manager MNG)
-{
-  Biddy_Variable v,vo;
-  Biddy_Boolean swapped,OK;
+    t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
 
-  /* PROFILING */
-  /*
-  clock_t elapsedtime;
-  elapsedtime = clock();
-  */
+    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)) {
+      topname = BiddyManagedGetTopVariableName(MNG1,BiddyT(f));
+      prevvar = BiddyManagedGetVariable(MNG2,topname);
+      prevvar = biddyVariableTable2.table[prevvar].prev;
+      while (prevvar != top) {
+        t = BiddyManagedTaggedFoaNode(MNG2,prevvar,t,biddyZero2,prevvar,TRUE);
+        BiddyProlongOne(t,biddySystemAge2); /* FoaNode returns an obsolete node! */
+        prevvar = biddyVariableTable2.table[prevvar].prev;
+      }
+    }
+
+    r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
+    BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
 
-  /* MAKE SURE, THAT ALL VARIABLES HAVE APPROPRIATE DATA */
-  v = BiddyManagedGetLowestVariable(MNG);
-  while (v && !biddyVariableTable.table[v].data) {
-    v = biddyVariableTable.table[v].next;
   }
-  if (!v) return; /* NO DATA ARE GIVEN */
-  vo = *((Biddy_Variable *)biddyVariableTable.table[v].data);
-  v = BiddyManagedGetLowestVariable(MNG);
-  while (v) {
-    if (biddyVariableTable.table[v].data) {
-      vo = *((Biddy_Variable *)biddyVariableTable.table[v].data);
-    } else {
-      biddyVariableTable.table[v].data = (void *) malloc(sizeof(Biddy_Variable));
-      *((Biddy_Variable *)biddyVariableTable.table[v].data) = vo;
+
+  else if ((biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD)) {
+
+    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
+      /* TO DO: DIRECT CONVERSION TZBDD -> ZBDD IS NOT IMPLEMENTED, YET */
+      Biddy_Manager MNGTMP;
+      Biddy_Edge tmp;
+      BiddyInitMNG(&MNGTMP,BIDDYTYPEOBDDC);
+      BiddyManagedCopy(MNG1,MNGTMP,biddyZero1,TRUE); /* copy domain from MNG1 to MNGTMP */
+      tmp = BiddyConvertDirect(MNG1,MNGTMP,f);
+      r = BiddyConvertDirect(MNGTMP,MNG2,tmp);
+      BiddyExitMNG(&MNGTMP);
+      return r;
     }
-    v = biddyVariableTable.table[v].next;
-  }
 
-  /* THIS IS FROM http://www.geeksforgeeks.org/bubble-sort/ */
-  if (biddyVariableTable.num == 1) return;
-  do {
-    v = biddyVariableTable.table[0].prev;
-    swapped = FALSE;
-    while (!BiddyIsLowest(v)) {
-      if (*((Biddy_Variable *)(BiddyManagedGetVariableData(MNG,v))) <
-          *((Biddy_Variable *)(BiddyManagedGetVariableData(MNG,biddyVariableTable.table[v].prev))))
-      {
-        /* v.data IS SMALLER THAN (v.lower).data */
-        swapWithLower(MNG,v,&OK);
-        swapped = TRUE;
+    tag = BiddyGetTag(f); /* tag of the given edge */
+    mark = BiddyGetMark(f); /* complement bit of the given edge */
+    top = BiddyV(f); /* top variable of the given edge */
+
+    if (BiddyIsTerminal(f)) {
+      if (BiddyGetMark(f)) {
+        r = BiddyComplement(biddyTerminal2); /* this should not be reached */
       } else {
-        v = biddyVariableTable.table[v].prev;
+        r = biddyTerminal2;
       }
+    } else {
+      topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
+      v = BiddyManagedGetVariable(MNG2,topname);
+      e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+      t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+      r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
+      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
     }
 
-    /* PROFILING */
-    /*
-#ifdef MINGW
-    printf("v = %u, numNodes = %u, memory in use: %I64u bytes\n",v,biddyNodeTable.num,BiddyManagedReadMemoryInUse(MNG));
-#else
-    printf("v = %u, numNodes = %u, memory in use: %llu bytes\n",v,biddyNodeTable.num,BiddyManagedReadMemoryInUse(MNG));
-#endif
-    */
-
-    /* variable swapping does not clean obsolete nodes and thus GC is useful here */
-    if (swapped) BiddyManagedGC(MNG,0,0,FALSE,TRUE);
+    while (tag != top) {
+      top = biddyVariableTable1.table[top].prev;
+      topname = BiddyManagedGetVariableName(MNG1,top);
+      v = BiddyManagedGetVariable(MNG2,topname);
+      r = BiddyManagedTaggedFoaNode(MNG2,v,r,biddyZero2,v,TRUE);
+      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
+    }
 
-  } while (swapped);
+  }
+#endif
 
-  /* PROFILING */
+  /* DEBUGGING */
   /*
-  printf("BiddySetOrderingByData ADAPTING TIME = %.2f\n",(clock()-elapsedtime)/(1.0*CLOCKS_PER_SEC));
+  printf("Result: f = %s (%p)\n",BiddyManagedGetTopVariableName(MNG2,r),r);
   */
+
+  /* keyword is determined again because GC in MNG2 may change it */
+  addCopyCache(MNG1,f,copyKeyword(MNG1,MNG2)+1,r);
+
+  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyCopy creates a copy of BDD in another manager of the same
-       BDD type.
+\brief Function BiddyCopyGarbage performs Garbage Collection for the Copy
+       cache.
 
 ### Description
+    Results are checked in the target managers by using keywords, only
+    entries with obsolete nodes from this manager are deleted here.
 ### Side effects
-    Expiry value of the original nodes is not copied.
-    It is assumed that the target manager has the same or larger domain and
-    the same ordering for all variables from the source manager.
 ### More info
 *******************************************************************************/
 
-static Biddy_Edge BiddyCopyR(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f);
-
-Biddy_Edge
-BiddyCopy(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
-{
-  Biddy_Edge r;
-
-  assert( MNG1 != MNG2 );
-  assert( biddyManagerType1 == biddyManagerType2 );
-
-  /* TO DO: use Special case 2 of taggedFoaNode to simplify this function! */
-
-  BiddyCreateLocalInfo(MNG1,f);
-  r = BiddyCopyR(MNG1,MNG2,f);
-  BiddyDeleteLocalInfo(MNG1,f);
-
-  return r;
-}
-
-static Biddy_Edge
-BiddyCopyR(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+void
+BiddyCopyGarbage(Biddy_Manager MNG)
 {
-  Biddy_Edge e,t,r;
-  Biddy_Variable tag;
-  Biddy_Boolean mark;
-  Biddy_String name;
-  Biddy_Variable v;
-
-  /* TO DO: use Special case 2 of taggedFoaNode to simplify this function! */
+  unsigned int j;
+  BiddyKeywordCache *c;
 
-  tag = BiddyGetTag(f); /* tag of the given edge */
-  if (tag) {
-    name = BiddyManagedGetVariableName(MNG1,tag);
-    tag = BiddyManagedGetVariable(MNG2,name);
-  }
-  mark = BiddyGetMark(f); /* complement bit of the given edge */
+  if (!biddyCopyCache.table) return;
 
-  if (f == biddyNull) return biddyNull;
-  if (BiddyIsTerminal(f)) {
-    if (mark) {
-      r = BiddyComplement(biddyTerminal2);
-    } else {
-      r = biddyTerminal2;
-    }
-    if (tag) BiddySetTag(r,tag);
-  } else {
-    if (BiddyManagedIsSelected(MNG1,f)) {
-      r = BiddyGetCopy(f);
-      BiddySetTag(r,tag);
-      if (mark) BiddySetMark(r);
-    } else {
-      BiddyManagedSelectNode(MNG1,f);
-      name = BiddyManagedGetTopVariableName(MNG1,f); /* top variable of the given edge */
-      v = BiddyManagedGetVariable(MNG2,name);
-      e = BiddyCopyR(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
-      t = BiddyCopyR(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
-#ifdef COMPACT
-      r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
-#else
-      if ((biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD)) {
-        r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,tag,TRUE);
-      } else {
-        r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
-      }
-#endif
-      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
-      BiddySetCopy(f,BiddyN(r));
+  for (j=0; j<=biddyCopyCache.size; j++) {
+    c = &biddyCopyCache.table[j];
+    if (!BiddyIsNull(c->result) &&
+        (BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge))
+    {
+      c->result = biddyNull;
     }
   }
-
-  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyCopyOBDD copies a BIDDYTYPEOBDD or BIDDYTYPEOBDDC
-        into another manager.
+\brief Function BiddyCopyGarbageDeleteAll deletes all entries in the Copy
+       cache.
 
 ### Description
 ### Side effects
-    Expiry value of the original nodes is not copied.
-    The variable ordering of created BDD is adapted to the target manager.
-    It is assumed that the target manager has the same or larger domain.
+    Target managers are not forgotten.
 ### More info
 *******************************************************************************/
 
-Biddy_Edge
-BiddyCopyOBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+void
+BiddyCopyGarbageDeleteAll(Biddy_Manager MNG)
 {
-  Biddy_String topname;
-  Biddy_Variable v;
-  Biddy_Boolean mark;
-  Biddy_Edge e,t,r;
-
-  assert ( (biddyManagerType1 == BIDDYTYPEOBDDC) || (biddyManagerType1 == BIDDYTYPEOBDD) );
-
-  if (f == biddyNull) return biddyNull;
-  if (f == biddyZero1) return biddyZero2;
-  if (f == biddyOne1) return biddyOne2;
-
-  topname = BiddyManagedGetTopVariableName(MNG1,f);
-  mark = BiddyGetMark(f);
-  v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
-  /* DEBUGGING */
-  /*
-  printf("Variable <%s> BiddyManagedGetVariableEdge in MNG1\n",topname);
-  Biddy_Managed_PrintfBDD(MNG1,BiddyManagedGetVariableEdge(MNG1,BiddyManagedGetVariable(MNG1,topname)));
-  Biddy_Managed_PrintfSOP(MNG1,BiddyManagedGetVariableEdge(MNG1,BiddyManagedGetVariable(MNG1,topname)));
-  printf("Variable <%s> BiddyManagedGetVariableEdge in MNG2\n",topname);
-  Biddy_Managed_PrintfBDD(MNG2,BiddyManagedGetVariableEdge(MNG2,BiddyManagedGetVariable(MNG2,topname)));
-  Biddy_Managed_PrintfSOP(MNG2,BiddyManagedGetVariableEdge(MNG2,BiddyManagedGetVariable(MNG2,topname)));
-  */
-  assert ( v != 0 );
-  e = BiddyCopyOBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
-  t = BiddyCopyOBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
-  r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),t,e);
+  if (!biddyCopyCache.table) return;
 
-  return r;
+  memset(biddyCopyCache.table,0,(biddyCopyCache.size+1)*sizeof(BiddyKeywordCache));
 }
 
 /*******************************************************************************
-\brief Function BiddyCopyZBDD copies a BIDDYTYPEZBDD or BIDDYTYPEZBDDC
-        into another manager.
+\brief Function BiddyConstructBDD constructs BDDs.
 
 ### Description
 ### Side effects
-    Expiry value of the original nodes is not copied.
-    The variable ordering of created BDD is adapted to the target manager.
-    It is assumed that the target manager has the same or larger domain.
 ### More info
 *******************************************************************************/
 
-Biddy_Edge
-BiddyCopyZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+/*
+The first element in nodelist is ignored. An example node
+list is: 'Biddy 0 Biddy 2 1 -1 1 B 4 2 3 2 0 0 -1 -1 3 i 4 4
+9 4 d 4 5 6 5 0 0 -1 -1 6 y 4 7 8 7 0 0 -1 -1 8 1 1 -1 -1 9
+d 4 6 10 10 1 1 -1 -1' which is constructed as: '{Biddy}
+{0 Biddy 2 1 -1} {1 B 4 2 3} {2 0 0 -1 -1} {3 i 4 4 9}
+{4 d 4 5 6} {5 0 0 -1 -1} {6 y 4 7 8} {7 0 0 -1 -1}
+{8 1 1 -1 -1} {9 d 4 6 10} {10 1 1 -1 -1}'.
+*/
+
+void
+BiddyConstructBDD(Biddy_Manager MNG, int numN, BiddyNodeList *tableN, int numF, BiddyFormulaList *tableF)
 {
+  int i,j;
+  Biddy_Edge r;
+
 #ifndef COMPACT
-  Biddy_String topname;
-  Biddy_Variable k;
-  Biddy_Variable v;
-  Biddy_Boolean mark;
-  Biddy_Edge e,t,r;
+  Biddy_Boolean usetags;
+#endif
 
-  assert ( (biddyManagerType1 == BIDDYTYPEZBDDC) || (biddyManagerType1 == BIDDYTYPEZBDD) );
+  r = biddyNull;
 
-  if (f == biddyNull) return biddyNull;
-  if (f == biddyZero1) return biddyZero2;
-  if (f == biddyTerminal1) {
-    r = biddyOne2;
-    for (k = 1; k < biddyVariableTable1.num; k++) {
-      topname = BiddyManagedGetVariableName(MNG1,k);
-      v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
-      r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),biddyZero2,r);
+#ifndef COMPACT
+  usetags = FALSE;
+  if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD))
+  {
+    usetags = TRUE;
+  }
+#endif
+
+  /* CONSTRUCT TERMINAL NODES */
+  /* for all BDD types, constant zero is always represented by a single node */
+  /* in fact, for all BDD types, terminal zero is represented as a complemented terminal node */
+  /* however, constant one may not be the same as terminal node */
+  for (i=0; i<numN; ++i) {
+    if (tableN[i].type == 0) {
+      tableN[i].created = TRUE;
+      tableN[i].f = biddyZero;
+    } else if (tableN[i].type == 1) {
+      tableN[i].created = TRUE;
+      tableN[i].f = biddyTerminal;
+    } else {
+      tableN[i].created = FALSE;
+      tableN[i].f = biddyNull;
+    }
+  }
+
+  /* THIS WILL CREATE BDD FOR ALL FUNCTIONS DEFINED BY LABELS */
+  /* TO DO: implement and use reorderVariables() for better results */
+  for (i=0; i<numN; ++i) {
+    /* printf("DEBUG (BiddyConstructBDD): i = %d, type = %u\n",i,tableN[i].type); */
+    /* regular label: type = 2, r = -1 */
+    if (tableN[i].type == 2) {
+      /* printf("DEBUG (BiddyConstructBDD): BDD for regular label %s is being constructed\n",tableN[i].name); */
+      constructBDD(MNG,numN,tableN,tableN[i].l);
+      tableN[i].f = tableN[tableN[i].l].f;
+#ifndef COMPACT
+      if (usetags) {
+        BiddySetTag(tableN[i].f,tableN[i].ltag);
+      }
+#endif
+      r = tableN[i].f;
+      for (j=0; j<numF; ++j) {
+        if (tableF[j].id == i) {
+          tableF[j].f = r;
+        }
+      }
+      /* printf("DEBUG (BiddyConstructBDD): BDD for regular label %s has %u nodes\n",tableN[i].name,BiddyManagedCountNodes(MNG,r)); */
+    }
+    /* complemented label: type = 3, r = -1 */
+    if (tableN[i].type == 3) {
+      /* printf("DEBUG (BiddyConstructBDD): BDD for complemented label %s is being constructed\n",tableN[i].name); */
+      constructBDD(MNG,numN,tableN,tableN[i].l);
+      tableN[i].f = BiddyComplement(tableN[tableN[i].l].f);
+#ifndef COMPACT
+      if (usetags) {
+        BiddySetTag(tableN[i].f,tableN[i].ltag);
+      }
+#endif
+      r = tableN[i].f;
+      for (j=0; j<numF; ++i) {
+        if (tableF[j].id == i) {
+          tableF[j].f = r;
+        }
+      }
+      /* printf("DEBUG (BiddyConstructBDD): BDD for complemented label %s has %u nodes\n",tableN[i].name,BiddyManagedCountNodes(MNG,r)); */
     }
-    return r;
   }
 
-  topname = BiddyManagedGetTopVariableName(MNG1,f);
-  mark = BiddyGetMark(f);
-  v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
-  assert ( v != 0 );
-  e = BiddyCopyZBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
-  t = BiddyCopyZBDD(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
-  t = BiddyManagedChange(MNG2,t,v);
-  r = BiddyManagedOr(MNG2,e,t); /* or/xor, both is correct, what is faster? */
-
-  return r;
-
-#else
-  if (MNG1 || MNG2 || f) {
-    /* MAKE COMPILER HAPPY */
+  /* DEBUGGING */
+  /*
+  printf("DEBUG: BiddyConstructBDD finished:\n");
+  for (i=0; i<numF; ++i) {
+    printf("DEBUG (BiddyConstructBDD): %s (id = %d) has %u nodes\n",tableF[i].name,tableF[i].id,BiddyManagedCountNodes(MNG,tableF[i].f));
   }
-  return biddyNull;
-#endif
+  */
+
 }
 
 /*******************************************************************************
-\brief Function BiddyCopyTZBDD copies a BIDDYTYPETZBDD or BIDDYTYPETZBDDC
-        into another manager.
+\brief Function BiddySystemReport is intended for debugging.
 
 ### Description
 ### Side effects
-    Expiry value of the original nodes is not copied.
-    The variable ordering of created BDD is adapted to the target manager.
-    It is assumed that the target manager has the same or larger domain.
+    By default, there is no output and the function is intended for checking
+    the soundness of thy system.
 ### More info
 *******************************************************************************/
 
-Biddy_Edge
-BiddyCopyTZBDD(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
+/* USE THIS TO GET SOME STATISTICS PRINTED */
+#define SYSTEMREPORTVERBOSE
+#undef SYSTEMREPORTVERBOSE
+#define SYSTEMREPORTVERBOSE
+
+/* USE THIS TO GET PRINTED MORE STATISTIC, E.G. LISTING OF ALL NODES  IN THE SYSTEM */
+#define SYSTEMREPORTDETAILS
+#undef SYSTEMREPORTDETAILS
+
+void
+BiddySystemReport(Biddy_Manager MNG)
 {
-#ifndef COMPACT
-  Biddy_String topname;
-  Biddy_Variable top,tag;
   Biddy_Variable v;
-  Biddy_Edge e,t,r;
+  unsigned int i;
+  unsigned int count1,count2;
+  unsigned int countdeleted;
+  unsigned int countfortified,countprolonged,countfresh,countobsolete;
 
-  assert ( (biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD) );
+#ifdef SYSTEMREPORTDETAILS
+#undef SYSTEMREPORTVERBOSE
+#define SYSTEMREPORTVERBOSE
+#endif
 
-  if (f == biddyNull) return biddyNull;
-  if (f == biddyZero1) return biddyZero2;
+  /* VARIABLES */
 
-  top = BiddyV(f);
-  if (!top) {
-    r = biddyOne2;
-  } else {
-    topname = BiddyManagedGetVariableName(MNG1,top);
-    v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
-    assert ( v != 0 );
-    e = BiddyCopyTZBDD(MNG1,MNG2,BiddyE(f));
-    t = BiddyCopyTZBDD(MNG1,MNG2,BiddyT(f));
-    r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),t,e);
-  }
+#ifdef SYSTEMREPORTDETAILS
+  printf("SYSTEM REPORT (VARIABLES)\n");
+#endif
 
-  tag = BiddyGetTag(f);
-  while (top != tag) {
-    top = biddyVariableTable1.table[top].prev;
-    topname = BiddyManagedGetVariableName(MNG1,top);
-    v = BiddyManagedGetVariable(MNG2,topname); /* variable must exist */
-    assert ( v != 0 );
-    r = BiddyManagedITE(MNG2,BiddyManagedGetVariableEdge(MNG2,v),biddyZero2,r);
+#ifdef SYSTEMREPORTDETAILS
+  for (v=0; v<biddyVariableTable.num; v++) {
+    printf("%s(%d),",
+           BiddyManagedGetVariableName(MNG,v),
+           biddyVariableTable.num
+    );
   }
+  printf("\n");
+  printf("unused variables: %d\n",BIDDYVARMAX-biddyVariableTable.num);
+#endif
 
-  return r;
-
-#else
-  if (MNG1 || MNG2 || f) {
-    /* MAKE COMPILER HAPPY */
-  }
-  return biddyNull;
+#ifdef SYSTEMREPORTVERBOSE
+  printf("BiddySystemReport (variables): number of used variables: %d\n",biddyVariableTable.num);
 #endif
-}
 
-/*******************************************************************************
-\brief Function BiddyConvertDirect copies a graph from one manager to
-       another manager which can use the same or different BDD type.
+#ifdef SYSTEMREPORTDETAILS
+  printf("list of variables: ");
+  v = 0;
+  do {
+    v = biddyVariableTable.table[v].prev;
+  } while (biddyVariableTable.table[v].prev < biddyVariableTable.num);
+  do {
+    printf("[%s]",biddyVariableTable.table[v].name);
+    v = biddyVariableTable.table[v].next;
+  } while (v != 0);
+  printf("\n");
+#endif
 
-### Description
-    This should be faster than a general copy functions. But, it is not
-    implemented for all BDD type conversions. However, it is safe to use this
-    function for any BDD type conversion because in the case the conversion
-    is not directly implemented a regular copy will be called.
-### Side effects
-    It is assumed, that domain has already been copied.
-    For conversion from OBDD/TZBDD into ZBDD this function does not create
-    the topmost variables which are not present in OBDD/TZBDD.
-    For conversion from ZBDD into OBDD/TZBDD this function does not create
-    the topmost variables which are not present in ZBDD.
-    TO DO: use cache to get more efficient solution!
-### More info
-*******************************************************************************/
+  /* FORMULAE */
 
-Biddy_Edge
-BiddyConvertDirect(Biddy_Manager MNG1, Biddy_Manager MNG2, Biddy_Edge f)
-{
-  Biddy_Edge e,t;
-  Biddy_Variable top;
-  Biddy_Boolean mark;
-  Biddy_String topname;
-  Biddy_Variable v;
-  Biddy_Edge r;
+#ifdef SYSTEMREPORTDETAILS
+  printf("SYSTEM REPORT (FORMULAE)\n");
+#endif
 
+  countdeleted = 0;
+  for (i = 1; i < biddyFormulaTable.size; i++) {
 #ifndef COMPACT
-  Biddy_Variable tag;
-  Biddy_Variable prevvar;
+    if (biddyFormulaTable.table[i].deleted) countdeleted++;
+    if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+        (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+    {
+#ifdef SYSTEMREPORTDETAILS
+      printf("CHECKING FORMULA: %s\n",biddyFormulaTable.table[i].name);
 #endif
+      if (!biddyFormulaTable.table[i].deleted &&
+          !BiddyIsNull(biddyFormulaTable.table[i].f) &&
+          !BiddyIsTerminal(biddyFormulaTable.table[i].f))
+      {
+        if (BiddyIsSmaller(biddyOrderingTable,BiddyV(biddyFormulaTable.table[i].f),BiddyGetTag(biddyFormulaTable.table[i].f))) {
+          fprintf(stderr,"ERROR (BiddySystemReport): Formula %s has bad tag for its top edge\n",biddyFormulaTable.table[i].name);
+          fprintf(stderr,"TOP EDGE: tag=\"%s\", variable \"%s\", elsetag=\"%s\", else=\"%s\", thentag=\"%s\", then=\"%s\"\n",
+            BiddyManagedGetVariableName(MNG,BiddyGetTag(biddyFormulaTable.table[i].f)),
+            BiddyManagedGetTopVariableName(MNG,biddyFormulaTable.table[i].f),
+            BiddyManagedGetVariableName(MNG,BiddyGetTag(BiddyE(biddyFormulaTable.table[i].f))),
+            BiddyManagedGetTopVariableName(MNG,BiddyE(biddyFormulaTable.table[i].f)),
+            BiddyManagedGetVariableName(MNG,BiddyGetTag(BiddyT(biddyFormulaTable.table[i].f))),
+            BiddyManagedGetTopVariableName(MNG,BiddyT(biddyFormulaTable.table[i].f)));
+          /* free((void*)1); */ /* BREAKPOINT */
+        }
 
-  assert( biddyManagerType1 != BIDDYTYPEOFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType1 != BIDDYTYPEOFDDC ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType1 != BIDDYTYPEZFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType1 != BIDDYTYPEZFDDC ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType1 != BIDDYTYPETZFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType1 != BIDDYTYPETZFDDC ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPEOFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPEOFDDC ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPEZFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPEZFDDC ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPETZFDD ); /* NOT IMPLEMENTED, YET */
-  assert( biddyManagerType2 != BIDDYTYPETZFDDC ); /* NOT IMPLEMENTED, YET */
+        /* this will check the structure of the graph */
+        /* this should not be used if some nodes are selected */
+        /*
+        {
+        unsigned int n = 1;
+        BiddyManagedSelectNode(MNG,biddyTerminal);
+        BiddyNodeNumber(MNG,biddyFormulaTable.table[i].f,&n);
+        BiddyManagedDeselectAll(MNG);
+        }
+        */
+      }
+    }
+#endif
+  }
 
-  assert( MNG1 != MNG2 );
+#ifdef SYSTEMREPORTVERBOSE
+  printf("BiddySystemReport (formulae): number of all formulae: %d, deleted formulae: %d\n",biddyFormulaTable.size,countdeleted);
+#endif
 
-  /* DEBUGGING */
-  /*
-  printf("Convert direct: f = %s (%p)\n",BiddyManagedGetTopVariableName(MNG1,f),f);
-  */
+  /* BDD SYSTEM BY VARIABLE'S LISTS */
 
-  /* TO DO: use cache to get more efficient solution! */
+#ifdef SYSTEMREPORTDETAILS
+  printf("SYSTEM REPORT (VARIABLE LISTS)\n");
+#endif
 
-  if (f == biddyNull) return biddyNull;
+  countfresh = 1; /* all variables, including terminal node, are fresh */
+  countfortified = countprolonged = countobsolete = 0;
+  for (v=1; v<biddyVariableTable.num; v++) {
 
-  r = biddyNull;
+    BiddyNode *sup;
+    BiddyNode *sup1,*sup2;
+    Biddy_Boolean end;
+    unsigned int hash;
 
-  if ((biddyManagerType1 == BIDDYTYPEOBDDC) || (biddyManagerType1 == BIDDYTYPEOBDD)) {
+    count1 = 0;
 
-    if (BiddyIsTerminal(f)) {
-      if (BiddyGetMark(f)) {
-        return BiddyComplement(biddyTerminal2);
-      } else {
-        return biddyTerminal2;
+#ifdef SYSTEMREPORTDETAILS
+    printf("VARIABLE: variable %s, num=%u\n",
+      biddyVariableTable.table[v].name,biddyVariableTable.table[v].num);
+#endif
+
+#ifdef SYSTEMREPORTDETAILS
+    printf("firstNode: pointer=%p, lastNode=%p\n",
+      (void *) biddyVariableTable.table[v].firstNode,
+      (void *) biddyVariableTable.table[v].lastNode
+    );
+#endif
+
+    sup = biddyVariableTable.table[v].firstNode;
+
+    if (!sup) {
+      fprintf(stderr,"ERROR (BiddySystemReport): Empty list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+      /* free((void*)1); */ /* BREAKPOINT */
+    }
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD) ||
+        (biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
+    {
+      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
+          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
+          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
+        /* free((void*)1); */ /* BREAKPOINT */
       }
     }
 
-    mark = BiddyGetMark(f); /* complement bit of the given edge */
-    top = BiddyV(f); /* top variable of the given edge */
-    topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
-    v = BiddyManagedGetVariable(MNG2,topname);
-
 #ifndef COMPACT
-    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
-      top = BiddyManagedGetVariable(MNG2,topname);
+    if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZFDDC))
+    {
+      if ((sup->f != biddyTerminal) || (sup->t != biddyTerminal)) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
+          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
+          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
+        /* free((void*)1); */ /* BREAKPOINT */
+      }
     }
 #endif
 
-    e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
-
 #ifndef COMPACT
-    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
-      topname = BiddyManagedGetTopVariableName(MNG1,BiddyE(f));
-      prevvar = BiddyManagedGetVariable(MNG2,topname);
-      prevvar = biddyVariableTable2.table[prevvar].prev;
-      while (prevvar != top) {
-        e = BiddyManagedTaggedFoaNode(MNG2,prevvar,e,e,prevvar,TRUE);
-        BiddyProlongOne(e,biddySystemAge2); /* FoaNode returns an obsolete node! */
-        prevvar = biddyVariableTable2.table[prevvar].prev;
+    if ((biddyManagerType == BIDDYTYPEZBDD) || (biddyManagerType == BIDDYTYPEZFDD))
+    {
+      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
+          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
+          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
+        /* free((void*)1); */ /* BREAKPOINT */
       }
     }
 #endif
 
-    t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
-
 #ifndef COMPACT
-    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
-      topname = BiddyManagedGetTopVariableName(MNG1,BiddyT(f));
-      prevvar = BiddyManagedGetVariable(MNG2,topname);
-      prevvar = biddyVariableTable2.table[prevvar].prev;
-      while (prevvar != top) {
-        t = BiddyManagedTaggedFoaNode(MNG2,prevvar,t,t,prevvar,TRUE);
-        BiddyProlongOne(t,biddySystemAge2); /* FoaNode returns an obsolete node! */
-        prevvar = biddyVariableTable2.table[prevvar].prev;
+    if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+        (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+    {
+      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
+          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
+          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
+        /* free((void*)1); */ /* BREAKPOINT */
       }
     }
 #endif
 
-    r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
-    BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
+    if (sup->expiry && (sup->expiry < biddySystemAge)) {
+      Biddy_Edge tmp;
+      fprintf(stderr,"ERROR (BiddySystemReport): First element in the list for variable \"%s\" is obsolete (expiry = %u, biddySystemAge = %u)\n",
+              biddyVariableTable.table[v].name,sup->expiry,biddySystemAge);
+      fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+      fprintf(stderr,"NODE: variable \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
+        BiddyManagedGetTopVariableName(MNG,sup),
+        sup->f?BiddyGetMark(sup->f):0,
+        sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
+        sup->t?BiddyGetMark(sup->t):0,
+        sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
+      tmp = BiddyManagedGetVariableEdge(MNG,BiddyV(sup));
+      fprintf(stderr,"VARIABLE: top \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
+        tmp?BiddyManagedGetTopVariableName(MNG,tmp):"NULL",
+        tmp?BiddyGetMark(BiddyE(tmp)):0,
+        tmp?BiddyManagedGetTopVariableName(MNG,BiddyE(tmp)):"NULL",
+        tmp?BiddyGetMark(BiddyT(tmp)):0,
+        tmp?BiddyManagedGetTopVariableName(MNG,BiddyT(tmp)):"NULL");
+      tmp = BiddyManagedGetElementEdge(MNG,BiddyV(sup));
+      fprintf(stderr,"ELEMENT: top \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
+        tmp?BiddyManagedGetTopVariableName(MNG,tmp):"NULL",
+        tmp?BiddyGetMark(BiddyE(tmp)):0,
+        tmp?BiddyManagedGetTopVariableName(MNG,BiddyE(tmp)):"NULL",
+        tmp?BiddyGetMark(BiddyT(tmp)):0,
+        tmp?BiddyManagedGetTopVariableName(MNG,BiddyT(tmp)):"NULL");
+      /* free((void*)1); */ /* BREAKPOINT */
+    }
 
-  }
+    do {
+
+      if (!sup) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Problem with lastNode for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        /* free((void*)1); */ /* BREAKPOINT */
+      }
+
+      if (!sup->f || !sup->t) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Node with NULL successor \"%s\"\n",biddyVariableTable.table[v].name);
+        debugNode(MNG,sup);
+        /* free((void*)1); */ /* BREAKPOINT */
+      }
+
+      if (sup->v != v) {
+        fprintf(stderr,"ERROR (BiddySystemReport): Node with bad variable in list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+          BiddyManagedGetTopVariableName(MNG,sup),
+          BiddyManagedGetTopVariableName(MNG,sup->f),
+          BiddyManagedGetTopVariableName(MNG,sup->t));
+        /* free((void*)1); */ /* BREAKPOINT */
+      }
+
+      if ((sup->f && !BiddyIsSmaller(biddyOrderingTable,v,BiddyV(sup->f))) || (sup->t && !BiddyIsSmaller(biddyOrderingTable,v,BiddyV(sup->t))))
+      {
+        fprintf(stderr,"ERROR (BiddySystemReport): Node with bad ordering in list for variable \"%s\"\n",biddyVariableTable.table[v].name);
+        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\", @%u\n",
+          BiddyManagedGetTopVariableName(MNG,sup),
+          BiddyManagedGetTopVariableName(MNG,sup->f),
+          BiddyManagedGetTopVariableName(MNG,sup->t),
+          sup->expiry);
+        /* free((void*)1); */ /* BREAKPOINT */
+      }
 
 #ifndef COMPACT
-  else if ((biddyManagerType1 == BIDDYTYPEZBDDC) || (biddyManagerType1 == BIDDYTYPEZBDD)) {
+      if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
+          (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+      {
+        if ((sup->f && BiddyIsSmaller(biddyOrderingTable,BiddyV(sup->f),BiddyGetTag(sup->f))) ||
+            (sup->t && BiddyIsSmaller(biddyOrderingTable,BiddyV(sup->t),BiddyGetTag(sup->t))))
+        {
+          fprintf(stderr,"ERROR (BiddySystemReport): Node \"%s\" has bad tag for its successor\n",biddyVariableTable.table[v].name);
+          fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+          fprintf(stderr,"NODE: variable \"%s\", elsetag=\"%s\", else=\"%s\", thentag=\"%s\", then=\"%s\"\n",
+            BiddyManagedGetTopVariableName(MNG,sup),
+            BiddyManagedGetVariableName(MNG,BiddyGetTag(sup->f)),
+            BiddyManagedGetTopVariableName(MNG,sup->f),
+            BiddyManagedGetVariableName(MNG,BiddyGetTag(sup->t)),
+            BiddyManagedGetTopVariableName(MNG,sup->t));
+          /* free((void*)1); */ /* BREAKPOINT */
+        }
+      }
+#endif
 
-    if ((biddyManagerType2 == BIDDYTYPETZBDDC) || (biddyManagerType2 == BIDDYTYPETZBDD)) {
-      /* TO DO: DIRECT CONVERSION ZBDD -> TZBDD IS NOT IMPLEMENTED, YET */
-      Biddy_Manager MNGTMP;
-      Biddy_Edge tmp;
-      BiddyInitMNG(&MNGTMP,BIDDYTYPEOBDDC);
-      BiddyManagedCopy(MNG1,MNGTMP,biddyZero1,TRUE); /* copy domain from MNG1 to MNGTMP */
-      tmp = BiddyConvertDirect(MNG1,MNGTMP,f);
-      r = BiddyConvertDirect(MNGTMP,MNG2,tmp);
-      BiddyExitMNG(&MNGTMP);
-      return r;
-    }
+      if (sup->f && sup->t && (sup != biddyVariableTable.table[v].firstNode)) {
+        hash = nodeTableHash(v,sup->f,sup->t,BiddyChainSize(v));
+        sup1 = BiddyChainTable(v)[hash];
+        findNodeTable(MNG,v,sup->f,sup->t,&sup1);
+        if (!sup1 || (v != sup1->v)) {
+          fprintf(stderr,"ERROR (BiddySystemReport): Node not correctly inserted into Node table\n");
+          fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
+          fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
+            BiddyManagedGetTopVariableName(MNG,sup),
+            BiddyManagedGetTopVariableName(MNG,sup->f),
+            BiddyManagedGetTopVariableName(MNG,sup->t));
+          /* free((void*)1); */ /* BREAKPOINT */
+        }
+        sup2 = BiddyNextInChain(sup1);
+        if (sup2) {
+          findNodeTable(MNG,v,sup->f,sup->t,&sup2);
+          if (sup2 && (v == sup2->v)) {
+            fprintf(stderr,"ERROR (BiddySystemReport): The same node multiple times in Node table\n");
+            fprintf(stderr,"NODE: pointer = %p\n",(void *) sup1);
+            fprintf(stderr,"NODE: variable \"%s\", else=\"%s\" (%p), then=\"%s\" (%p)\n",
+              BiddyManagedGetTopVariableName(MNG,sup1),
+              BiddyManagedGetTopVariableName(MNG,sup1->f),sup1->f,
+              BiddyManagedGetTopVariableName(MNG,sup1->t),sup1->t);
+            fprintf(stderr,"NODE: pointer = %p\n",(void *) sup1);
+            fprintf(stderr,"NODE: variable \"%s\", else=\"%s\" (%p), then=\"%s\" (%p)\n",
+              BiddyManagedGetTopVariableName(MNG,sup2),
+              BiddyManagedGetTopVariableName(MNG,sup2->f),sup2->f,
+              BiddyManagedGetTopVariableName(MNG,sup2->t),sup2->t);
+            /* free((void*)1); */ /* BREAKPOINT */
+          }
+        }
+      }
 
-    if (BiddyIsTerminal(f)) {
-      if (BiddyGetMark(f)) {
-        return BiddyComplement(biddyTerminal2);
+#ifdef SYSTEMREPORTDETAILS
+      printf("NODE ");
+      debugNode(MNG,sup);
+      printf("\n");
+#endif
+
+      if (!(sup->expiry)) {
+        countfortified++;
+      } else if (sup->expiry == biddySystemAge) {
+        countfresh++;
+      } else if (sup->expiry > biddySystemAge) {
+        countprolonged++;
       } else {
-        return biddyTerminal2;
+        countobsolete++;
       }
-    }
 
-    mark = BiddyGetMark(f); /* complement bit of the given edge */
-    top = BiddyV(f); /* top variable of the given edge */
-    topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
-    v = BiddyManagedGetVariable(MNG2,topname);
+      count1++;
 
-    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)){
-      top = BiddyManagedGetVariable(MNG2,topname);
-    }
+      end = (sup == biddyVariableTable.table[v].lastNode);
+      if (!end) sup = (BiddyNode *) sup->list;
 
-    e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
+    } while (!end);
 
-    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)) {
-      topname = BiddyManagedGetTopVariableName(MNG1,BiddyE(f));
-      prevvar = BiddyManagedGetVariable(MNG2,topname);
-      prevvar = biddyVariableTable2.table[prevvar].prev;
-      while (prevvar != top) {
-        e = BiddyManagedTaggedFoaNode(MNG2,prevvar,e,biddyZero2,prevvar,TRUE);
-        BiddyProlongOne(e,biddySystemAge2); /* FoaNode returns an obsolete node! */
-        prevvar = biddyVariableTable2.table[prevvar].prev;
-      }
+    if (biddyVariableTable.table[v].num != count1) {
+      fprintf(stderr,"ERROR (BiddySystemReport): wrong number of nodes for a variable\n");
+      fprintf(stderr,"VARIABLE: variable \"%s\", num=%u, count1=%u\n",
+        biddyVariableTable.table[v].name,biddyVariableTable.table[v].num,count1);
+      /* free((void*)1); */ /* BREAKPOINT */
     }
 
-    t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
+#ifdef SYSTEMREPORTDETAILS
+    printf("COUNT listOfNewNodes = %u\n",count1);
+#endif
+
+  }
+
+  /* FINAL REPORT FOR LISTS */
+#ifdef SYSTEMREPORTVERBOSE
+  printf("BiddySystemReport (lists): numFortified: %u, numProlonged: %u, numFresh: %u, numBad: %u, total: %u\n",
+                 countfortified,countprolonged,countfresh,countobsolete,
+                 countfortified+countprolonged+countfresh+countobsolete
+  );
+#endif
+
+  if (biddyNodeTable.num != countfortified+countprolonged+countfresh+countobsolete) {
+    fprintf(stderr,"ERROR (BiddySystemReport): total number of nodes (%u by lists) differs from num = %u\n",
+            countfortified+countprolonged+countfresh+countobsolete,
+            biddyNodeTable.num);
+    /* free((void*)1); */ /* BREAKPOINT */
+  }
+
+  /* BDD SYSTEM BY NODE TABLE */
 
-    if ((biddyManagerType2 == BIDDYTYPEOBDDC) || (biddyManagerType2 == BIDDYTYPEOBDD)) {
-      topname = BiddyManagedGetTopVariableName(MNG1,BiddyT(f));
-      prevvar = BiddyManagedGetVariable(MNG2,topname);
-      prevvar = biddyVariableTable2.table[prevvar].prev;
-      while (prevvar != top) {
-        t = BiddyManagedTaggedFoaNode(MNG2,prevvar,t,biddyZero2,prevvar,TRUE);
-        BiddyProlongOne(t,biddySystemAge2); /* FoaNode returns an obsolete node! */
-        prevvar = biddyVariableTable2.table[prevvar].prev;
-      }
-    }
+#ifdef SYSTEMREPORTDETAILS
+  printf("SYSTEM REPORT (NODE TABLE)\n");
+#endif
 
-    r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
-    BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
+  count1 = 0; /* biddyNodeTable.table[0] is not considered */
+  count2 = 0; /* biddyNodeTable.table[0] is counted as a variable */
+  countfresh = biddyVariableTable.num; /* variables are not stored in Node table, they are fresh */
+  countprolonged = countfortified = countobsolete = 0;
+#ifdef NODETABLE_SUBTABLES
+  for (v=1; v<biddyVariableTable.num; v++)
+  for (i=1; i<=BiddyChainSize(v)+1; i++) {
+    BiddyNode *sup;
 
-  }
+    sup = BiddyChainTable(v)[i];
+#else
+  for (i=1; i<=biddyNodeTable.size+1; i++) {
+    BiddyNode *sup;
 
-  else if ((biddyManagerType1 == BIDDYTYPETZBDDC) || (biddyManagerType1 == BIDDYTYPETZBDD)) {
+    sup = BiddyNodeTableEntry(i);
+#endif
+    if (sup != NULL) {
 
-    if ((biddyManagerType2 == BIDDYTYPEZBDDC) || (biddyManagerType2 == BIDDYTYPEZBDD)) {
-      /* TO DO: DIRECT CONVERSION TZBDD -> ZBDD IS NOT IMPLEMENTED, YET */
-      Biddy_Manager MNGTMP;
-      Biddy_Edge tmp;
-      BiddyInitMNG(&MNGTMP,BIDDYTYPEOBDDC);
-      BiddyManagedCopy(MNG1,MNGTMP,biddyZero1,TRUE); /* copy domain from MNG1 to MNGTMP */
-      tmp = BiddyConvertDirect(MNG1,MNGTMP,f);
-      r = BiddyConvertDirect(MNGTMP,MNG2,tmp);
-      BiddyExitMNG(&MNGTMP);
-      return r;
-    }
+      count1++;
+      while (sup) {
+        count2++;
+        if (!(sup->expiry)) {
+          countfortified++;
+        } else if (sup->expiry == biddySystemAge) {
+          countfresh++;
+        } else if (sup->expiry > biddySystemAge) {
+          countprolonged++;
+        } else {
+          countobsolete++;
+        }
 
-    tag = BiddyGetTag(f); /* tag of the given edge */
-    mark = BiddyGetMark(f); /* complement bit of the given edge */
-    top = BiddyV(f); /* top variable of the given edge */
+#ifdef SYSTEMREPORTDETAILS
+        printf("NODE %u-",i);
+        debugNode(MNG,sup);
+        printf("\n");
+#endif
 
-    if (BiddyIsTerminal(f)) {
-      if (BiddyGetMark(f)) {
-        r = BiddyComplement(biddyTerminal2); /* this should not be reached */
-      } else {
-        r = biddyTerminal2;
+        sup = BiddyNextInChain(sup);
       }
-    } else {
-      topname = BiddyManagedGetVariableName(MNG1,top); /* name of the top variable of the given edge */
-      v = BiddyManagedGetVariable(MNG2,topname);
-      e = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyE(f),mark,TRUE)); /* TRUE = left */
-      t = BiddyConvertDirect(MNG1,MNG2,BiddyManagedTransferMark(MNG1,BiddyT(f),mark,FALSE)); /* FALSE = right */
-      r = BiddyManagedTaggedFoaNode(MNG2,v,e,t,v,TRUE);
-      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
     }
+  }
 
-    while (tag != top) {
-      top = biddyVariableTable1.table[top].prev;
-      topname = BiddyManagedGetVariableName(MNG1,top);
-      v = BiddyManagedGetVariable(MNG2,topname);
-      r = BiddyManagedTaggedFoaNode(MNG2,v,r,biddyZero2,v,TRUE);
-      BiddyProlongOne(r,biddySystemAge2); /* FoaNode returns an obsolete node! */
-    }
+#ifdef SYSTEMREPORTDETAILS
+  printf("NODE TABLE HAS %u NON-EMPTY LISTS\n",count1);
+  printf("NODE TABLE HAS %u NODES (+variables = %u)\n",count2,count2+biddyVariableTable.num);
+#endif
 
-  }
+  /* FINAL REPORT FOR TABLE */
+#ifdef SYSTEMREPORTDETAILS
+  printf("BiddySystemReport (table): numFortified: %u, numProlonged: %u, numFresh: %u, numBad: %u, total: %u\n",
+         countfortified,countprolonged,countfresh,countobsolete,
+         countfortified+countprolonged+countfresh+countobsolete
+  );
 #endif
 
-  /* DEBUGGING */
-  /*
-  printf("Result: f = %s (%p)\n",BiddyManagedGetTopVariableName(MNG2,r),r);
-  */
+  if (biddyNodeTable.num != countfortified+countprolonged+countfresh+countobsolete) {
+    fprintf(stderr,"ERROR (BiddySystemReport): total number of nodes (%u by table) differs from num = %u\n",
+            countfortified+countprolonged+countfresh+countobsolete,
+            biddyNodeTable.num);
+    /* free((void*)1); */ /* BREAKPOINT */
+  }
 
-  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyConstructBDD constructs BDDs.
+\brief Function BiddyFunctionReport is intended for debugging.
 
 ### Description
 ### Side effects
 ### More info
 *******************************************************************************/
 
-/*
-The first element in nodelist is ignored. An example node
-list is: 'Biddy 0 Biddy 2 1 -1 1 B 4 2 3 2 0 0 -1 -1 3 i 4 4
-9 4 d 4 5 6 5 0 0 -1 -1 6 y 4 7 8 7 0 0 -1 -1 8 1 1 -1 -1 9
-d 4 6 10 10 1 1 -1 -1' which is constructed as: '{Biddy}
-{0 Biddy 2 1 -1} {1 B 4 2 3} {2 0 0 -1 -1} {3 i 4 4 9}
-{4 d 4 5 6} {5 0 0 -1 -1} {6 y 4 7 8} {7 0 0 -1 -1}
-{8 1 1 -1 -1} {9 d 4 6 10} {10 1 1 -1 -1}'.
-*/
+#undef FUNCTIONREPORTVERBOSE
+#define FUNCTIONREPORTVERBOSE
+
+#define FUNCTIONREPORTDETAILS
+#undef FUNCTIONREPORTDETAILS
 
 void
-BiddyConstructBDD(Biddy_Manager MNG, int numN, BiddyNodeList *tableN, int numF, BiddyFormulaList *tableF)
+BiddyFunctionReport(Biddy_Manager MNG, Biddy_Edge f)
 {
-  int i,j;
-  Biddy_Edge r;
+  Biddy_Boolean ok;
+#ifdef FUNCTIONREPORTVERBOSE
+  unsigned int num;
+  BiddyOrderingTable *fOrdering;
+  Biddy_Variable k;
+  Biddy_Boolean stop;
+  Biddy_Variable minvar,maxvar,minvarOrder,maxvarOrder;
+#endif
 
-#ifndef COMPACT
-  Biddy_Boolean usetags;
+#ifdef FUNCTIONREPORTVERBOSE
+  printf("REPORT ON FUNCTION\n");
 #endif
 
-  r = biddyNull;
+  if (BiddyIsNull(f)) {
+#ifdef FUNCTIONREPORTVERBOSE
+    printf("FUNCTION IS NULL\n");
+#endif
+    return;
+  }
 
-#ifndef COMPACT
-  usetags = FALSE;
-  if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD))
-  {
-    usetags = TRUE;
+  ok = checkFunctionOrdering(MNG,f);
+  if (!ok) {
+    printf("FUNCTION: wrong ordering!\n");
   }
+
+#ifdef FUNCTIONREPORTVERBOSE
+  printf("Function represented by %s depends on %u variables.\n", BiddyManagedGetManagerName(MNG),BiddyManagedDependentVariableNumber(MNG,f,FALSE));
+  printf("%s for function has %u nodes (including terminals).\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountNodes(MNG,f));
+  printf("%s for function has %u plain nodes (including terminals).\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountNodesPlain(MNG,f));
+  printf("%s for function has %llu one-paths.\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountPaths(MNG,f));
+  printf("%s for function has %.0f minterms/combinations.\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountMinterms(MNG,f,0));
+  printf("%s for function has density = %.2e.\n",BiddyManagedGetManagerName(MNG),BiddyManagedDensityOfFunction(MNG,f,0));
+  printf("%s for function has max level = %u.\n",BiddyManagedGetManagerName(MNG),BiddyMaxLevel(f));
 #endif
 
-  /* CONSTRUCT TERMINAL NODES */
-  /* for all BDD types, constant zero is always represented by a single node */
-  /* in fact, for all BDD types, terminal zero is represented as a complemented terminal node */
-  /* however, constant one may not be the same as terminal node */
-  for (i=0; i<numN; ++i) {
-    if (tableN[i].type == 0) {
-      tableN[i].created = TRUE;
-      tableN[i].f = biddyZero;
-    } else if (tableN[i].type == 1) {
-      tableN[i].created = TRUE;
-      tableN[i].f = biddyTerminal;
-    } else {
-      tableN[i].created = FALSE;
-      tableN[i].f = biddyNull;
-    }
+#ifdef FUNCTIONREPORTVERBOSE
+  /* determine function ordering and node number */
+  if (!(fOrdering = (BiddyOrderingTable *)malloc(sizeof(BiddyOrderingTable)))) {
+    fprintf(stderr, "BiddyFunctionReport: Out of memoy!\n");
+    exit(1);
   }
+  for (k=1; k<BiddyManagedVariableTableNum(MNG); k++) {
+    biddyVariableTable.table[k].numone = 0;
+  }
+  nullOrdering(*fOrdering);
+  num = 1;
+  nodeNumberOrdering(MNG,f,&num,*fOrdering);
+  BiddyManagedDeselectAll(MNG);
+  printf("FUNCTION: counted number of nodes: %d, expiry value of top node: %d/%d\n",num,
+          ((BiddyNode *) BiddyP(f))->expiry,biddySystemAge);
 
-  /* THIS WILL CREATE BDD FOR ALL FUNCTIONS DEFINED BY LABELS */
-  /* TO DO: implement and use reorderVariables() for better results */
-  for (i=0; i<numN; ++i) {
-    /* printf("DEBUG (BiddyConstructBDD): i = %d, type = %u\n",i,tableN[i].type); */
-    /* regular label: type = 2, r = -1 */
-    if (tableN[i].type == 2) {
-      /* printf("DEBUG (BiddyConstructBDD): BDD for regular label %s is being constructed\n",tableN[i].name); */
-      constructBDD(MNG,numN,tableN,tableN[i].l);
-      tableN[i].f = tableN[tableN[i].l].f;
-#ifndef COMPACT
-      if (usetags) {
-        BiddySetTag(tableN[i].f,tableN[i].ltag);
-      }
-#endif
-      r = tableN[i].f;
-      for (j=0; j<numF; ++j) {
-        if (tableF[j].id == i) {
-          tableF[j].f = r;
-        }
-      }
-      /* printf("DEBUG (BiddyConstructBDD): BDD for regular label %s has %u nodes\n",tableN[i].name,BiddyManagedCountNodes(MNG,r)); */
-    }
-    /* complemented label: type = 3, r = -1 */
-    if (tableN[i].type == 3) {
-      /* printf("DEBUG (BiddyConstructBDD): BDD for complemented label %s is being constructed\n",tableN[i].name); */
-      constructBDD(MNG,numN,tableN,tableN[i].l);
-      tableN[i].f = BiddyComplement(tableN[tableN[i].l].f);
-#ifndef COMPACT
-      if (usetags) {
-        BiddySetTag(tableN[i].f,tableN[i].ltag);
-      }
-#endif
-      r = tableN[i].f;
-      for (j=0; j<numF; ++i) {
-        if (tableF[j].id == i) {
-          tableF[j].f = r;
-        }
+  /* determine highest (bottommost) variable that is not "1" */
+  minvar = maxvar = BiddyV(f);
+  stop = FALSE;
+  while (!stop) {
+    stop = TRUE;
+    for (k=1; k<BiddyManagedVariableTableNum(MNG); k++) {
+      if (BiddyIsSmaller(*fOrdering,maxvar,k)) {
+        maxvar = k;
+        stop = FALSE;
+        break;
       }
-      /* printf("DEBUG (BiddyConstructBDD): BDD for complemented label %s has %u nodes\n",tableN[i].name,BiddyManagedCountNodes(MNG,r)); */
     }
   }
-
-  /* DEBUGGING */
-  /*
-  printf("DEBUG: BiddyConstructBDD finished:\n");
-  for (i=0; i<numF; ++i) {
-    printf("DEBUG (BiddyConstructBDD): %s (id = %d) has %u nodes\n",tableF[i].name,tableF[i].id,BiddyManagedCountNodes(MNG,tableF[i].f));
+  minvarOrder = maxvarOrder = BiddyManagedVariableTableNum(MNG);
+  for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
+    if (BiddyIsSmaller(biddyOrderingTable,minvar,k)) --minvarOrder;
+    if (BiddyIsSmaller(biddyOrderingTable,maxvar,k)) --maxvarOrder;
   }
-  */
+  printf("FUNCTION: minvar: %s (id=%u, order=%u), maxvar: %s (id=%u, order=%u)\n",
+          BiddyManagedGetVariableName(MNG,minvar),minvar,minvarOrder,
+          BiddyManagedGetVariableName(MNG,maxvar),maxvar,maxvarOrder);
+  free(fOrdering);
+#endif
+
+#ifdef FUNCTIONREPORTDETAILS
+#endif
+
+}
+
+/*******************************************************************************
+\brief Function BiddyDebugNode.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
+void
+BiddyDebugNode(Biddy_Manager MNG, BiddyNode *node)
+{
+  debugNode(MNG,node);
 }
 
 /*******************************************************************************
-\brief Function BiddySystemReport is intended for debugging.
+\brief Function BiddyDebugEdge.
 
 ### Description
 ### Side effects
-    By default, there is no output and the function is intended for checking
-    the soundness of thy system.
 ### More info
 *******************************************************************************/
 
-/* USE THIS TO GET SOME STATISTICS PRINTED */
-#define SYSTEMREPORTVERBOSE
-#undef SYSTEMREPORTVERBOSE
-#define SYSTEMREPORTVERBOSE
+void
+BiddyDebugEdge(Biddy_Manager MNG, Biddy_Edge edge)
+{
+  debugEdge(MNG,edge);
+}
 
-/* USE THIS TO GET PRINTED MORE STATISTIC, E.G. LISTING OF ALL NODES  IN THE SYSTEM */
-#define SYSTEMREPORTDETAILS
-#undef SYSTEMREPORTDETAILS
+/*----------------------------------------------------------------------------*/
+/* Definition of static functions                                             */
+/*----------------------------------------------------------------------------*/
 
-void
-BiddySystemReport(Biddy_Manager MNG)
+/*******************************************************************************
+\brief Function isEqv.
+
+### Description
+    It is assumed that f1 and f2 have the same ordering.
+### Side effects
+### More info
+*******************************************************************************/
+
+static Biddy_Boolean
+isEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2, Biddy_Edge f2)
 {
-  Biddy_Variable v;
-  unsigned int i;
-  unsigned int count1,count2;
-  unsigned int countdeleted;
-  unsigned int countfortified,countprolonged,countfresh,countobsolete;
+  Biddy_Boolean r;
 
-#ifdef SYSTEMREPORTDETAILS
-#undef SYSTEMREPORTVERBOSE
-#define SYSTEMREPORTVERBOSE
-#endif
+  if (BiddyIsTerminal(f1)) {
+    r = BiddyIsTerminal(f2) &&
+        (BiddyGetMark(f1) == BiddyGetMark(f2)) &&
+        !strcmp(
+          BiddyManagedGetVariableName(MNG1,BiddyGetTag(f1)),
+          BiddyManagedGetVariableName(MNG2,BiddyGetTag(f2)));
+  } else {
+    r = !BiddyIsTerminal(f2) &&
+        (BiddyGetMark(f1) == BiddyGetMark(f2)) &&
+        !strcmp(
+          BiddyManagedGetTopVariableName(MNG1,f1),
+          BiddyManagedGetTopVariableName(MNG2,f2)) &&
+        !strcmp(
+          BiddyManagedGetVariableName(MNG1,BiddyGetTag(f1)),
+          BiddyManagedGetVariableName(MNG2,BiddyGetTag(f2))) &&
+        isEqv(MNG1,BiddyE(f1),MNG2,BiddyE(f2)) &&
+        isEqv(MNG1,BiddyT(f1),MNG2,BiddyT(f2));
+  }
 
-  /* VARIABLES */
+  return r;
+}
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("SYSTEM REPORT (VARIABLES)\n");
-#endif
+/*******************************************************************************
+\brief Function createLocalInfo recursively creates local info for all nodes
+       except terminal node.
 
-#ifdef SYSTEMREPORTDETAILS
-  for (v=0; v<biddyVariableTable.num; v++) {
-    printf("%s(%d),",
-           BiddyManagedGetVariableName(MNG,v),
-           biddyVariableTable.num
-    );
+### Description
+### Side effects
+    All nodes except terminal node must be selected!
+    Function createLocalInfo will deselect them.
+    data.mintermCount is using GNU Multiple Precision Arithmetic Library (GMP).
+    No initialization of elements is performed here.
+### More info
+*******************************************************************************/
+
+static BiddyLocalInfo *
+createLocalInfo(Biddy_Manager MNG, Biddy_Edge f, BiddyLocalInfo *c)
+{
+  if (BiddyManagedIsSelected(MNG,f)) {
+    BiddyManagedDeselectNode(MNG,f);
+    c->back = (BiddyNode *)BiddyP(f);
+    c->org = (BiddyNode *)(((BiddyNode *) BiddyP(f))->list);
+    ((BiddyNode *) BiddyP(f))->list = (void *) c;
+    c = &c[1]; /* next field in the array */
+    c = createLocalInfo(MNG,BiddyE(f),c);
+    c = createLocalInfo(MNG,BiddyT(f),c);
   }
-  printf("\n");
-  printf("unused variables: %d\n",BIDDYVARMAX-biddyVariableTable.num);
-#endif
+  return c;
+}
 
-#ifdef SYSTEMREPORTVERBOSE
-  printf("BiddySystemReport (variables): number of used variables: %d\n",biddyVariableTable.num);
-#endif
+/*******************************************************************************
+\brief Function deleteLocalInfo recursively deletes local info for all nodes
+       except terminal node.
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("list of variables: ");
-  v = 0;
-  do {
-    v = biddyVariableTable.table[v].prev;
-  } while (biddyVariableTable.table[v].prev < biddyVariableTable.num);
-  do {
-    printf("[%s]",biddyVariableTable.table[v].name);
-    v = biddyVariableTable.table[v].next;
-  } while (v != 0);
-  printf("\n");
-#endif
+### Description
+### Side effects
+    All nodes except terminal node must be selected!
+    Function deleteLocalInfo will deselect them.
+    TO DO: memory reserved for data.mintermCount is not removed!
+### More info
+*******************************************************************************/
 
-  /* FORMULAE */
+static void
+deleteLocalInfo(Biddy_Manager MNG, Biddy_Edge f)
+{
+  if (BiddyManagedIsSelected(MNG,f)) {
+    BiddyManagedDeselectNode(MNG,f);
+    ((BiddyNode *) BiddyP(f))->list = (void *)
+      ((BiddyLocalInfo *)((BiddyNode *) BiddyP(f))->list)->org;
+    deleteLocalInfo(MNG,BiddyE(f));
+    deleteLocalInfo(MNG,BiddyT(f));
+  }
+}
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("SYSTEM REPORT (FORMULAE)\n");
-#endif
+/*******************************************************************************
+\brief Function nodeTableHash.
 
-  countdeleted = 0;
-  for (i = 1; i < biddyFormulaTable.size; i++) {
-#ifndef COMPACT
-    if (biddyFormulaTable.table[i].deleted) countdeleted++;
-    if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
-        (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
-    {
-#ifdef SYSTEMREPORTDETAILS
-      printf("CHECKING FORMULA: %s\n",biddyFormulaTable.table[i].name);
-#endif
-      if (!biddyFormulaTable.table[i].deleted &&
-          !BiddyIsNull(biddyFormulaTable.table[i].f) &&
-          !BiddyIsTerminal(biddyFormulaTable.table[i].f))
-      {
-        if (BiddyIsSmaller(biddyOrderingTable,BiddyV(biddyFormulaTable.table[i].f),BiddyGetTag(biddyFormulaTable.table[i].f))) {
-          fprintf(stderr,"ERROR (BiddySystemReport): Formula %s has bad tag for its top edge\n",biddyFormulaTable.table[i].name);
-          fprintf(stderr,"TOP EDGE: tag=\"%s\", variable \"%s\", elsetag=\"%s\", else=\"%s\", thentag=\"%s\", then=\"%s\"\n",
-            BiddyManagedGetVariableName(MNG,BiddyGetTag(biddyFormulaTable.table[i].f)),
-            BiddyManagedGetTopVariableName(MNG,biddyFormulaTable.table[i].f),
-            BiddyManagedGetVariableName(MNG,BiddyGetTag(BiddyE(biddyFormulaTable.table[i].f))),
-            BiddyManagedGetTopVariableName(MNG,BiddyE(biddyFormulaTable.table[i].f)),
-            BiddyManagedGetVariableName(MNG,BiddyGetTag(BiddyT(biddyFormulaTable.table[i].f))),
-            BiddyManagedGetTopVariableName(MNG,BiddyT(biddyFormulaTable.table[i].f)));
-          /* free((void*)1); */ /* BREAKPOINT */
-        }
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
-        /* this will check the structure of the graph */
-        /* this should not be used if some nodes are selected */
-        /*
-        {
-        unsigned int n = 1;
-        BiddyManagedSelectNode(MNG,biddyTerminal);
-        BiddyNodeNumber(MNG,biddyFormulaTable.table[i].f,&n);
-        BiddyManagedDeselectAll(MNG);
-        }
-        */
-      }
-    }
-#endif
+static inline unsigned int
+nodeTableHash(Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt, unsigned int size)
+{
+  unsigned int hash;
+
+  /* THIS IS HASH FUNCTION FOR NODE TABLE */
+  /* THE SIZE OF NODE TABLE IS biddyNodeTable.size+2 */
+  /* BECAUSE OF USED TRICKS, HASH FUNCTION MUST NEVER RETURN ZERO! */
+  /* USEFUL INDICES ARE FROM [1] TO [biddyNodeTable.size+1] */
+
+  /* this is very simple but quite efficient, not using v */
+  /*
+  {
+  uintptr_t k;
+  k = ((uintptr_t) pt >> 6) + ((uintptr_t) pf >> 5);
+  hash = 1 + (k & size);
+  return hash;
   }
+  */
 
-#ifdef SYSTEMREPORTVERBOSE
-  printf("BiddySystemReport (formulae): number of all formulae: %d, deleted formulae: %d\n",biddyFormulaTable.size,countdeleted);
-#endif
+  /* this is very simple but quite efficient, using v */
+  /*
+  {
+  uintptr_t k;
+  k = ((uintptr_t) pt >> 6) + ((uintptr_t) pf >> 2) + (uintptr_t) v;
+  hash = 1 + (k & size);
+  return hash;
+  }
+  */
 
-  /* BDD SYSTEM BY VARIABLE'S LISTS */
+#if UINTPTR_MAX == 0xffffffffffffffff
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("SYSTEM REPORT (VARIABLE LISTS)\n");
-#endif
+  /* this is used to experimentally determine parameters */
+  /* for i in `seq 10`; do ./biddy-example-8queens 8; done */
+  /*
+  {
+  uintptr_t k;
+  static unsigned int GG=0;
+  static unsigned int rnd1=1214272557,rnd2=1422347099;
+  if (!GG) {GG=1;rnd1=rand();rnd2=rand();printf("<rnd1=%u><rnd2=%u>\n",rnd1,rnd2);}
+  k = ((uintptr_t) pt * rnd1 + (uintptr_t) pf + (uintptr_t) v) * rnd2;
+  hash = 1 + ((k >> 24) & size);
+  return hash;
+  }
+  */
+
+  /* this is experimentally determined, not using v, efficient for OBDDs, only */
+  /*
+  {
+  uintptr_t k;
+  k = ((uintptr_t) pt * 352241492 + (uintptr_t) pf) * 231629123;
+  hash = 1 + ((k >> 32) & size);
+  return hash;
+  }
+  */
+
+  /* this is experimentally determined, using v, seems to be better for TZBDDs */
+  /**/
+  {
+  uintptr_t k;
+  k = ((uintptr_t) pt * 103406078 + (uintptr_t) pf + (uintptr_t) v) * 1186577883;
+  hash = 1 + ((k >> 24) & size);
+  return hash;
+  }
+  /**/
 
-  countfresh = 1; /* all variables, including terminal node, are fresh */
-  countfortified = countprolonged = countobsolete = 0;
-  for (v=1; v<biddyVariableTable.num; v++) {
+  /* this is using ideas from MURMUR3, see https://code.google.com/p/smhasher/ */
+  /*
+  {
+  uintptr_t k,k1,k2;
+  k = (uintptr_t) v;
+  k1 = (uintptr_t) pf;
+  k1 = (k1 << 31) | (k1 >> 33);
+  k ^= k1;
+  k2 = (uintptr_t) pt;
+  k2 = (k2 << 35) | (k2 >> 29);
+  k ^= k2;
+  k *= 0xff51afd7ed558ccdL;
+  k ^= k >> 32;
+  k *= 0xc4ceb9fe1a85ec53L;
+  k ^= k >> 32;
+  hash = 1 + (k & size);
+  return hash;
+  }
+  */
 
-    BiddyNode *sup;
-    BiddyNode *sup1,*sup2;
-    Biddy_Boolean end;
-    unsigned int hash;
+#else
 
-    count1 = 0;
+  /* MURMUR3 (A KIND OF) 32-bit HASH FUNCTION */
+  /* https://code.google.com/p/smhasher/ */
+  {
+  uintptr_t k,k1,k2;
+  k = (uintptr_t) v;
+  k1 = (uintptr_t) pf;
+  k1 = (k1 << 15) | (k1 >> 17);
+  k ^= k1;
+  k = (k << 19) | (k >> 13);
+  k2 = (uintptr_t) pt;
+  k ^= k2;
+  k *= 0x85ebca6b;
+  k ^= k >> 16;
+  k *= 0xc2b2ae35;
+  k ^= k >> 16;
+  hash = 1 + (k & size);
+  return hash;
+  }
 
-#ifdef SYSTEMREPORTDETAILS
-    printf("VARIABLE: variable %s, num=%u\n",
-      biddyVariableTable.table[v].name,biddyVariableTable.table[v].num);
 #endif
 
-#ifdef SYSTEMREPORTDETAILS
-    printf("firstNode: pointer=%p, lastNode=%p\n",
-      (void *) biddyVariableTable.table[v].firstNode,
-      (void *) biddyVariableTable.table[v].lastNode
-    );
-#endif
+  return 0;
 
-    sup = biddyVariableTable.table[v].firstNode;
+}
 
-    if (!sup) {
-      fprintf(stderr,"ERROR (BiddySystemReport): Empty list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-      /* free((void*)1); */ /* BREAKPOINT */
-    }
+/*******************************************************************************
+\brief Function addNodeTable adds node to the table, node itself is not
+       changed in any way.
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD) ||
-        (biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD))
-    {
-      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
-          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
-          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
-    }
+### Description
+### Side effects
+    This is low level functon. It is not checked, if the same node already
+    exists.
+### More info
+*******************************************************************************/
 
-#ifndef COMPACT
-    if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZFDDC))
-    {
-      if ((sup->f != biddyTerminal) || (sup->t != biddyTerminal)) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
-          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
-          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
-    }
-#endif
+static inline void
+addNodeTable(Biddy_Manager MNG, unsigned int hash, BiddyNode *node,
+             BiddyNode *sup1)
+{
+  /* DEBUGGING */
+  /*
+  fprintf(stderr,"\n[ADD NODE: variable %s, else=%s (%p), then=%s (%p)]",
+    BiddyManagedGetTopVariableName(MNG,node),
+    BiddyManagedGetTopVariableName(MNG,node->f),node->f,
+    BiddyManagedGetTopVariableName(MNG,node->t),node->t);
+  */
 
-#ifndef COMPACT
-    if ((biddyManagerType == BIDDYTYPEZBDD) || (biddyManagerType == BIDDYTYPEZFDD))
-    {
-      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
-          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
-          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
-    }
-#endif
+    if (biddyNodeTable.extendedstats) biddyNodeTable.add++;
 
-#ifndef COMPACT
-    if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
-        (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
-    {
-      if ((sup->f != biddyZero) || (sup->t != biddyTerminal)) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Bad first element in the list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-          sup?BiddyManagedGetTopVariableName(MNG,sup):"NULL",
-          sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
-          sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
-    }
-#endif
+  /* ******************************************************************* */
+  /* NODES ARE INSERTED AFTER sup1                                       */
+  /* IF sup1 = NULL THEN NEW NODE WILL BE INSERTED AT THE BEGINNING      */
+  /* IF sup1 = lastNode THEN NEW NODE WILL BE INSERTED AT THE END        */
+  /* ******************************************************************* */
 
-    if (sup->expiry && (sup->expiry < biddySystemAge)) {
-      Biddy_Edge tmp;
-      fprintf(stderr,"ERROR (BiddySystemReport): First element in the list for variable \"%s\" is obsolete (expiry = %u, biddySystemAge = %u)\n",
-              biddyVariableTable.table[v].name,sup->expiry,biddySystemAge);
-      fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-      fprintf(stderr,"NODE: variable \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
-        BiddyManagedGetTopVariableName(MNG,sup),
-        sup->f?BiddyGetMark(sup->f):0,
-        sup->f?BiddyManagedGetTopVariableName(MNG,sup->f):"NULL",
-        sup->t?BiddyGetMark(sup->t):0,
-        sup->t?BiddyManagedGetTopVariableName(MNG,sup->t):"NULL");
-      tmp = BiddyManagedGetVariableEdge(MNG,BiddyV(sup));
-      fprintf(stderr,"VARIABLE: top \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
-        tmp?BiddyManagedGetTopVariableName(MNG,tmp):"NULL",
-        tmp?BiddyGetMark(BiddyE(tmp)):0,
-        tmp?BiddyManagedGetTopVariableName(MNG,BiddyE(tmp)):"NULL",
-        tmp?BiddyGetMark(BiddyT(tmp)):0,
-        tmp?BiddyManagedGetTopVariableName(MNG,BiddyT(tmp)):"NULL");
-      tmp = BiddyManagedGetElementEdge(MNG,BiddyV(sup));
-      fprintf(stderr,"ELEMENT: top \"%s\", else=(%u)\"%s\", then=(%u)\"%s\"\n",
-        tmp?BiddyManagedGetTopVariableName(MNG,tmp):"NULL",
-        tmp?BiddyGetMark(BiddyE(tmp)):0,
-        tmp?BiddyManagedGetTopVariableName(MNG,BiddyE(tmp)):"NULL",
-        tmp?BiddyGetMark(BiddyT(tmp)):0,
-        tmp?BiddyManagedGetTopVariableName(MNG,BiddyT(tmp)):"NULL");
-      /* free((void*)1); */ /* BREAKPOINT */
-    }
+#if defined(NODETABLE_OPENADDRESSING)
 
-    do {
+  /* LINEAR PROBING, NODE IS STORED INTO THE FIRST EMPTY POSITION */
+  /* THE FINGERPRINT IS STORED IN THE HIGHEST 16 BITS OF THE POINTER */
 
-      if (!sup) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Problem with lastNode for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
+  (void)(sup1); // to avoid the unused warning
 
-      if (!sup->f || !sup->t) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Node with NULL successor \"%s\"\n",biddyVariableTable.table[v].name);
-        debugNode(MNG,sup);
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
+  while (biddyNodeTable.table[hash]) hash = (hash & biddyNodeTable.size) + 1;
+  biddyNodeTable.table[hash] = (BiddyNode *) ((uintptr_t) node |
+    ((uintptr_t) nodeTableFingerprint(node->v,node->f,node->t) << 48));
 
-      if (sup->v != v) {
-        fprintf(stderr,"ERROR (BiddySystemReport): Node with bad variable in list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-          BiddyManagedGetTopVariableName(MNG,sup),
-          BiddyManagedGetTopVariableName(MNG,sup->f),
-          BiddyManagedGetTopVariableName(MNG,sup->t));
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
+#elif defined(ARENA)
 
-      if ((sup->f && !BiddyIsSmaller(biddyOrderingTable,v,BiddyV(sup->f))) || (sup->t && !BiddyIsSmaller(biddyOrderingTable,v,BiddyV(sup->t))))
-      {
-        fprintf(stderr,"ERROR (BiddySystemReport): Node with bad ordering in list for variable \"%s\"\n",biddyVariableTable.table[v].name);
-        fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-        fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\", @%u\n",
-          BiddyManagedGetTopVariableName(MNG,sup),
-          BiddyManagedGetTopVariableName(MNG,sup->f),
-          BiddyManagedGetTopVariableName(MNG,sup->t),
-          sup->expiry);
-        /* free((void*)1); */ /* BREAKPOINT */
-      }
+  /* THE FIRST ELEMENT OF EACH CHAIN HAS PREV ELEMENT 0 */
+  /* INDEX 0 IS USED BY THE TERMINAL NODE WHICH IS NEVER IN THE CHAIN */
 
-#ifndef COMPACT
-      if ((biddyManagerType == BIDDYTYPETZBDDC) || (biddyManagerType == BIDDYTYPETZBDD) ||
-          (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
-      {
-        if ((sup->f && BiddyIsSmaller(biddyOrderingTable,BiddyV(sup->f),BiddyGetTag(sup->f))) ||
-            (sup->t && BiddyIsSmaller(biddyOrderingTable,BiddyV(sup->t),BiddyGetTag(sup->t))))
-        {
-          fprintf(stderr,"ERROR (BiddySystemReport): Node \"%s\" has bad tag for its successor\n",biddyVariableTable.table[v].name);
-          fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-          fprintf(stderr,"NODE: variable \"%s\", elsetag=\"%s\", else=\"%s\", thentag=\"%s\", then=\"%s\"\n",
-            BiddyManagedGetTopVariableName(MNG,sup),
-            BiddyManagedGetVariableName(MNG,BiddyGetTag(sup->f)),
-            BiddyManagedGetTopVariableName(MNG,sup->f),
-            BiddyManagedGetVariableName(MNG,BiddyGetTag(sup->t)),
-            BiddyManagedGetTopVariableName(MNG,sup->t));
-          /* free((void*)1); */ /* BREAKPOINT */
-        }
-      }
-#endif
+  if (sup1) {
+    node->prev = BiddyArenaIndex(sup1);
+    node->next = sup1->next;
+    sup1->next = BiddyArenaIndex(node);
+  } else {
+    node->prev = 0;
+    node->next = BiddyChainTable(node->v)[hash] ? BiddyArenaIndex(BiddyChainTable(node->v)[hash]) : 0;
+    BiddyChainTable(node->v)[hash] = node;
+  }
+  if (node->next) BiddyArenaNode(node->next)->prev = BiddyArenaIndex(node);
 
-      if (sup->f && sup->t && (sup != biddyVariableTable.table[v].firstNode)) {
-        hash = nodeTableHash(v,sup->f,sup->t,biddyNodeTable.size);
-        sup1 = biddyNodeTable.table[hash];
-        findNodeTable(MNG,v,sup->f,sup->t,&sup1);
-        if (!sup1 || (v != sup1->v)) {
-          fprintf(stderr,"ERROR (BiddySystemReport): Node not correctly inserted into Node table\n");
-          fprintf(stderr,"NODE: pointer = %p\n",(void *) sup);
-          fprintf(stderr,"NODE: variable \"%s\", else=\"%s\", then=\"%s\"\n",
-            BiddyManagedGetTopVariableName(MNG,sup),
-            BiddyManagedGetTopVariableName(MNG,sup->f),
-            BiddyManagedGetTopVariableName(MNG,sup->t));
-          /* free((void*)1); */ /* BREAKPOINT */
-        }
-        sup2 = (BiddyNode *) sup1->next;
-        if (sup2) {
-          findNodeTable(MNG,v,sup->f,sup->t,&sup2);
-          if (sup2 && (v == sup2->v)) {
-            fprintf(stderr,"ERROR (BiddySystemReport): The same node multiple times in Node table\n");
-            fprintf(stderr,"NODE: pointer = %p\n",(void *) sup1);
-            fprintf(stderr,"NODE: variable \"%s\", else=\"%s\" (%p), then=\"%s\" (%p)\n",
-              BiddyManagedGetTopVariableName(MNG,sup1),
-              BiddyManagedGetTopVariableName(MNG,sup1->f),sup1->f,
-              BiddyManagedGetTopVariableName(MNG,sup1->t),sup1->t);
-            fprintf(stderr,"NODE: pointer = %p\n",(void *) sup1);
-            fprintf(stderr,"NODE: variable \"%s\", else=\"%s\" (%p), then=\"%s\" (%p)\n",
-              BiddyManagedGetTopVariableName(MNG,sup2),
-              BiddyManagedGetTopVariableName(MNG,sup2->f),sup2->f,
-              BiddyManagedGetTopVariableName(MNG,sup2->t),sup2->t);
-            /* free((void*)1); */ /* BREAKPOINT */
-          }
-        }
-      }
+#else
+
+  /* THE FIRST ELEMENT OF EACH CHAIN SHOULD HAVE A SPECIAL VALUE */
+  /* FOR ITS PREV ELEMENT TO ALLOW TRICKY BUT EFFICIENT DELETING */
+
+  node->prev = sup1 ? sup1 : (BiddyNode *) &BiddyChainTable(node->v)[hash-1];
+  node->next = node->prev->next;
+  node->prev->next = node;
+  if (node->next) node->next->prev = node;
 
-#ifdef SYSTEMREPORTDETAILS
-      printf("NODE ");
-      debugNode(MNG,sup);
-      printf("\n");
 #endif
+}
 
-      if (!(sup->expiry)) {
-        countfortified++;
-      } else if (sup->expiry == biddySystemAge) {
-        countfresh++;
-      } else if (sup->expiry > biddySystemAge) {
-        countprolonged++;
-      } else {
-        countobsolete++;
-      }
+/*******************************************************************************
+\brief Function removeNodeTable removes node from its chain in Node table.
 
-      count1++;
+### Description
+### Side effects
+    Fields v, f, and t must not be changed after the node has been added to
+    Node table (for variant ARENA, they are used to find the chain).
+### More info
+*******************************************************************************/
 
-      end = (sup == biddyVariableTable.table[v].lastNode);
-      if (!end) sup = (BiddyNode *) sup->list;
+static inline void
+removeNodeTable(Biddy_Manager MNG, BiddyNode *node)
+{
+#if defined(NODETABLE_OPENADDRESSING)
 
-    } while (!end);
+  unsigned int i,j,h;
+  BiddyNode *sup;
 
-    if (biddyVariableTable.table[v].num != count1) {
-      fprintf(stderr,"ERROR (BiddySystemReport): wrong number of nodes for a variable\n");
-      fprintf(stderr,"VARIABLE: variable \"%s\", num=%u, count1=%u\n",
-        biddyVariableTable.table[v].name,biddyVariableTable.table[v].num,count1);
-      /* free((void*)1); */ /* BREAKPOINT */
+  i = nodeTableHash(node->v,node->f,node->t,biddyNodeTable.size);
+  while (BiddyNodeTableEntry(i) != node) {
+    if (!biddyNodeTable.table[i]) return; /* node is not in Node table */
+    i = (i & biddyNodeTable.size) + 1;
+  }
+
+  /* BACKWARD SHIFT DELETION, NO TOMBSTONES ARE USED */
+  /* node at position j is moved to position i if its home position */
+  /* is not cyclically between i (exclusively) and j (inclusively) */
+  j = i;
+  while (1) {
+    j = (j & biddyNodeTable.size) + 1;
+    if (!biddyNodeTable.table[j]) break;
+    sup = BiddyNodeTableEntry(j);
+    h = nodeTableHash(sup->v,sup->f,sup->t,biddyNodeTable.size);
+    if (((j - h) & biddyNodeTable.size) >= ((j - i) & biddyNodeTable.size)) {
+      biddyNodeTable.table[i] = biddyNodeTable.table[j];
+      i = j;
     }
+  }
+  biddyNodeTable.table[i] = NULL;
 
-#ifdef SYSTEMREPORTDETAILS
-    printf("COUNT listOfNewNodes = %u\n",count1);
-#endif
+#elif defined(ARENA)
 
+  if (node->prev) {
+    BiddyArenaNode(node->prev)->next = node->next;
+  } else {
+    BiddyChainTable(node->v)[nodeTableHash(node->v,node->f,node->t,BiddyChainSize(node->v))] =
+      BiddyNextInChain(node);
   }
+  if (node->next) BiddyArenaNode(node->next)->prev = node->prev;
 
-  /* FINAL REPORT FOR LISTS */
-#ifdef SYSTEMREPORTVERBOSE
-  printf("BiddySystemReport (lists): numFortified: %u, numProlonged: %u, numFresh: %u, numBad: %u, total: %u\n",
-                 countfortified,countprolonged,countfresh,countobsolete,
-                 countfortified+countprolonged+countfresh+countobsolete
-  );
-#endif
+#else
 
-  if (biddyNodeTable.num != countfortified+countprolonged+countfresh+countobsolete) {
-    fprintf(stderr,"ERROR (BiddySystemReport): total number of nodes (%u by lists) differs from num = %u\n",
-            countfortified+countprolonged+countfresh+countobsolete,
-            biddyNodeTable.num);
-    /* free((void*)1); */ /* BREAKPOINT */
-  }
+  (void)(MNG); // to avoid the unused warning
 
-  /* BDD SYSTEM BY NODE TABLE */
+  node->prev->next = node->next;
+  if (node->next) node->next->prev = node->prev;
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("SYSTEM REPORT (NODE TABLE)\n");
 #endif
+}
 
-  count1 = 0; /* biddyNodeTable.table[0] is not considered */
-  count2 = 0; /* biddyNodeTable.table[0] is counted as a variable */
-  countfresh = biddyVariableTable.num; /* variables are not stored in Node table, they are fresh */
-  countprolonged = countfortified = countobsolete = 0;
-  for (i=1; i<=biddyNodeTable.size+1; i++) {
-    BiddyNode *sup;
+/*******************************************************************************
+\brief Function findNodeTable checks for the node in the chain referenced
+       by thesup.
 
-    sup = biddyNodeTable.table[i];
-    if (sup != NULL) {
+### Description
+    Return NULL and (*thesup = NULL) iff node does not exists and
+           chain is empty.
+    Return NULL and (*thesup = theNode) iff node exists and
+           it is first element in the chain.
+    Return lastNodeInChain and (*thesup = NULL) or
+           nodeBeforeNodeWithWrongVariable and (*thesup = nodeWithWrongVariable)
+           iff node does not exists and chain is not empty.
+    Return nodeBeforeTheNode and (*thesup = theNode) iff node exists and
+           it is not first element in the chain.
+### Side effects
+### More info
+*******************************************************************************/
 
-      count1++;
-      while (sup) {
-        count2++;
-        if (!(sup->expiry)) {
-          countfortified++;
-        } else if (sup->expiry == biddySystemAge) {
-          countfresh++;
-        } else if (sup->expiry > biddySystemAge) {
-          countprolonged++;
-        } else {
-          countobsolete++;
-        }
+static inline BiddyNode *
+findNodeTable(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt,
+              BiddyNode **thesup)
+{
+  BiddyNode *sup,*sup1;
+  unsigned int n; /* the number of compared nodes, for extended stats */
 
-#ifdef SYSTEMREPORTDETAILS
-        printf("NODE %u-",i);
-        debugNode(MNG,sup);
-        printf("\n");
-#endif
+  (void)(MNG); // to avoid the unused warning
+
+  /* DEBUGGING */
+  /*
+  printf("FIND NODE TABLE (*thesup=%p, v=%u, f=%p, t=%p, next=%p): v=%s (%u), pf=%s (%p), pt=%s (%p)\n",
+    (void *) *thesup,
+    (*thesup) ? (*thesup)->v : 0,
+    (*thesup) ? (void *) (*thesup)->f : NULL,
+    (*thesup) ? (void *) (*thesup)->t : NULL,
+    (*thesup) ? (void *) BiddyNextInChain(*thesup) : NULL,
+    BiddyManagedGetVariableName(MNG,v),v,
+    BiddyManagedGetTopVariableName(MNG,pf),pf,
+    BiddyManagedGetTopVariableName(MNG,pt),pt);
+  */
+
+  if (biddyNodeTable.extendedstats) biddyNodeTable.find++;
+
+#ifdef NODETABLE_OPENADDRESSING
+
+  /* ********************************************************************* */
+  /* OPEN ADDRESSING: THE GIVEN CHAIN IS NOT USED, PROBING STARTS AT HASH  */
+  /* ONLY NODES WITH MATCHING FINGERPRINT ARE COMPARED                     */
+  /* ********************************************************************* */
+
+  {
+  unsigned int i,fp;
 
-        sup = sup->next;
+  fp = nodeTableFingerprint(v,pf,pt);
+  i = nodeTableHash(v,pf,pt,biddyNodeTable.size);
+  n = 0;
+  while (biddyNodeTable.table[i]) {
+    n++;
+    if (BiddyNodeTableFingerprint(i) == fp) {
+      sup = BiddyNodeTableEntry(i);
+      if ((v == sup->v) && (pf == sup->f) && (pt == sup->t)) {
+        if (biddyNodeTable.extendedstats) biddyNodeTable.compare += n;
+        *thesup = sup;
+        return NULL;
       }
     }
+    i = (i & biddyNodeTable.size) + 1;
+  }
+  if (biddyNodeTable.extendedstats) biddyNodeTable.compare += n;
+  *thesup = NULL;
+  return NULL;
   }
 
-#ifdef SYSTEMREPORTDETAILS
-  printf("NODE TABLE HAS %u NON-EMPTY LISTS\n",count1);
-  printf("NODE TABLE HAS %u NODES (+variables = %u)\n",count2,count2+biddyVariableTable.num);
 #endif
 
-  /* FINAL REPORT FOR TABLE */
-#ifdef SYSTEMREPORTDETAILS
-  printf("BiddySystemReport (table): numFortified: %u, numProlonged: %u, numFresh: %u, numBad: %u, total: %u\n",
-         countfortified,countprolonged,countfresh,countobsolete,
-         countfortified+countprolonged+countfresh+countobsolete
-  );
-#endif
+  if (!(*thesup)) return NULL;
 
-  if (biddyNodeTable.num != countfortified+countprolonged+countfresh+countobsolete) {
-    fprintf(stderr,"ERROR (BiddySystemReport): total number of nodes (%u by table) differs from num = %u\n",
-            countfortified+countprolonged+countfresh+countobsolete,
-            biddyNodeTable.num);
-    /* free((void*)1); */ /* BREAKPOINT */
+  sup = *thesup;
+  sup1 = NULL;
+
+  /* ********************************************************************* */
+  /* WE HAVE ORDERED CHAINS IN NODE TABLE                                  */
+  /* ********************************************************************* */
+
+  while (sup && (v > sup->v))
+  {
+    sup1 = sup;
+    sup = BiddyNextInChain(sup);
+  }
+
+  while (sup &&
+          (v == sup->v) &&
+          ((pf != sup->f) || (pt != sup->t))
+        )
+  {
+    sup1 = sup;
+    sup = BiddyNextInChain(sup);
+  }
+
+  /* COMPARED NODES ARE COUNTED AFTER THE LOOPS TO KEEP THEM FAST */
+  if (biddyNodeTable.extendedstats) {
+    BiddyNode *tmp;
+    n = 0;
+    for (tmp = *thesup; tmp != sup; tmp = BiddyNextInChain(tmp)) n++;
+    if (sup) n++;
+    biddyNodeTable.compare += n;
   }
 
+  *thesup = sup;
+  return sup1;
 }
 
+#ifdef NODETABLE_OPENADDRESSING
+
 /*******************************************************************************
-\brief Function BiddyFunctionReport is intended for debugging.
+\brief Function nodeTableFingerprint.
 
 ### Description
+    Fingerprint is a 16-bit value stored together with the pointer to the node.
+    It is computed independently of the hash function.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-#undef FUNCTIONREPORTVERBOSE
-#define FUNCTIONREPORTVERBOSE
+static inline unsigned int
+nodeTableFingerprint(Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt)
+{
+  uintptr_t k;
 
-#define FUNCTIONREPORTDETAILS
-#undef FUNCTIONREPORTDETAILS
+  k = ((uintptr_t) pf * 0x9e3779b97f4a7c15 + (uintptr_t) pt + (uintptr_t) v) * 0xc4ceb9fe1a85ec53;
+  return (unsigned int) (k >> 48);
+}
 
-void
-BiddyFunctionReport(Biddy_Manager MNG, Biddy_Edge f)
+/*******************************************************************************
+\brief Function nodeTableEnlarge doubles the size of Node table.
+
+### Description
+    All nodes are rehashed into the new table. The nodes are not touched
+    and thus this is allowed in the middle of any operation, also during
+    variable swapping.
+### Side effects
+    Limit for the size of Node table is not considered because with open
+    addressing the table must never become full.
+### More info
+*******************************************************************************/
+
+static void
+nodeTableEnlarge(Biddy_Manager MNG)
 {
-  Biddy_Boolean ok;
-#ifdef FUNCTIONREPORTVERBOSE
-  unsigned int num;
-  BiddyOrderingTable *fOrdering;
-  Biddy_Variable k;
-  Biddy_Boolean stop;
-  Biddy_Variable minvar,maxvar,minvarOrder,maxvarOrder;
-#endif
+  BiddyNode **oldtable;
+  BiddyNode *sup;
+  unsigned int oldsize,i,j;
 
-#ifdef FUNCTIONREPORTVERBOSE
-  printf("REPORT ON FUNCTION\n");
-#endif
+  oldtable = biddyNodeTable.table;
+  oldsize = biddyNodeTable.size;
 
-  if (BiddyIsNull(f)) {
-#ifdef FUNCTIONREPORTVERBOSE
-    printf("FUNCTION IS NULL\n");
-#endif
-    return;
+  biddyNodeTable.size = 2 * biddyNodeTable.size + 1;
+  biddyNodeTable.nodetableresize++;
+  if (!(biddyNodeTable.table = (BiddyNode **)
+  calloc((biddyNodeTable.size+2),sizeof(BiddyNode *)))) {
+    fprintf(stderr,"nodeTableEnlarge: Out of memoy!\n");
+    exit(1);
   }
+  biddyNodeTable.table[0] = oldtable[0];
 
-  ok = checkFunctionOrdering(MNG,f);
-  if (!ok) {
-    printf("FUNCTION: wrong ordering!\n");
+  for (i=1; i<=oldsize+1; i++) {
+    if (oldtable[i]) {
+      sup = (BiddyNode *)((uintptr_t) oldtable[i] & 0x0000ffffffffffff);
+      j = nodeTableHash(sup->v,sup->f,sup->t,biddyNodeTable.size);
+      while (biddyNodeTable.table[j]) j = (j & biddyNodeTable.size) + 1;
+      biddyNodeTable.table[j] = oldtable[i]; /* fingerprint is not changed */
+    }
   }
 
-#ifdef FUNCTIONREPORTVERBOSE
-  printf("Function represented by %s depends on %u variables.\n", BiddyManagedGetManagerName(MNG),BiddyManagedDependentVariableNumber(MNG,f,FALSE));
-  printf("%s for function has %u nodes (including terminals).\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountNodes(MNG,f));
-  printf("%s for function has %u plain nodes (including terminals).\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountNodesPlain(MNG,f));
-  printf("%s for function has %llu one-paths.\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountPaths(MNG,f));
-  printf("%s for function has %.0f minterms/combinations.\n",BiddyManagedGetManagerName(MNG),BiddyManagedCountMinterms(MNG,f,0));
-  printf("%s for function has density = %.2e.\n",BiddyManagedGetManagerName(MNG),BiddyManagedDensityOfFunction(MNG,f,0));
-  printf("%s for function has max level = %u.\n",BiddyManagedGetManagerName(MNG),BiddyMaxLevel(f));
+  free(oldtable);
+}
+
 #endif
 
-#ifdef FUNCTIONREPORTVERBOSE
-  /* determine function ordering and node number */
-  if (!(fOrdering = (BiddyOrderingTable *)malloc(sizeof(BiddyOrderingTable)))) {
-    fprintf(stderr, "BiddyFunctionReport: Out of memoy!\n");
+#ifdef NODETABLE_SUBTABLES
+
+/*******************************************************************************
+\brief Function nodeSubtableCreate creates an empty subtable for the given
+       variable.
+
+### Description
+### Side effects
+    The total size of all subtables is accumulated in biddyNodeTable.size.
+### More info
+*******************************************************************************/
+
+static void
+nodeSubtableCreate(Biddy_Manager MNG, Biddy_Variable v)
+{
+  BiddyChainSize(v) = BIDDYNODESUBTABLEINITSIZE;
+  if (!(BiddyChainTable(v) = (BiddyNode **)
+  calloc((BiddyChainSize(v)+2),sizeof(BiddyNode *)))) {
+    fprintf(stderr,"nodeSubtableCreate: Out of memoy!\n");
+    exit(1);
+  }
+  biddyNodeTable.size += BiddyChainSize(v) + 1;
+}
+
+/*******************************************************************************
+\brief Function nodeSubtableEnlarge enlarges the subtable for the given
+       variable.
+
+### Description
+    The size is doubled until there are at most BIDDYNODESUBTABLELOAD nodes
+    per chain. All nodes from the old subtable are rehashed. Other subtables
+    are not touched, and thus this is allowed during variable swapping.
+### Side effects
+    Chains in the subtable contain nodes with the same variable, only, thus
+    the order of nodes in the new chains is not important.
+### More info
+*******************************************************************************/
+
+static void
+nodeSubtableEnlarge(Biddy_Manager MNG, Biddy_Variable v)
+{
+  BiddyNode **oldtable;
+  BiddyNode *sup,*next;
+  unsigned int oldsize,i;
+
+  oldtable = BiddyChainTable(v);
+  oldsize = BiddyChainSize(v);
+
+  do {
+    BiddyChainSize(v) = 2 * BiddyChainSize(v) + 1;
+  } while ((biddyVariableTable.table[v].num > BIDDYNODESUBTABLELOAD * BiddyChainSize(v)) &&
+           (BiddyChainSize(v) < biddyNodeTable.limitsize));
+  biddyNodeTable.size += BiddyChainSize(v) - oldsize;
+  biddyNodeTable.nodetableresize++;
+
+  if (!(BiddyChainTable(v) = (BiddyNode **)
+  calloc((BiddyChainSize(v)+2),sizeof(BiddyNode *)))) {
+    fprintf(stderr,"nodeSubtableEnlarge: Out of memoy!\n");
     exit(1);
   }
-  for (k=1; k<BiddyManagedVariableTableNum(MNG); k++) {
-    biddyVariableTable.table[k].numone = 0;
-  }
-  nullOrdering(*fOrdering);
-  num = 1;
-  nodeNumberOrdering(MNG,f,&num,*fOrdering);
-  BiddyManagedDeselectAll(MNG);
-  printf("FUNCTION: counted number of nodes: %d, expiry value of top node: %d/%d\n",num,
-          ((BiddyNode *) BiddyP(f))->expiry,biddySystemAge);
 
-  /* determine highest (bottommost) variable that is not "1" */
-  minvar = maxvar = BiddyV(f);
-  stop = FALSE;
-  while (!stop) {
-    stop = TRUE;
-    for (k=1; k<BiddyManagedVariableTableNum(MNG); k++) {
-      if (BiddyIsSmaller(*fOrdering,maxvar,k)) {
-        maxvar = k;
-        stop = FALSE;
-        break;
-      }
+  for (i=1; i<=oldsize+1; i++) {
+    sup = oldtable[i];
+    while (sup) {
+      next = BiddyNextInChain(sup);
+      addNodeTable(MNG,nodeTableHash(v,sup->f,sup->t,BiddyChainSize(v)),sup,NULL);
+      sup = next;
     }
   }
-  minvarOrder = maxvarOrder = BiddyManagedVariableTableNum(MNG);
-  for (k=0; k<BiddyManagedVariableTableNum(MNG); k++) {
-    if (BiddyIsSmaller(biddyOrderingTable,minvar,k)) --minvarOrder;
-    if (BiddyIsSmaller(biddyOrderingTable,maxvar,k)) --maxvarOrder;
-  }
-  printf("FUNCTION: minvar: %s (id=%u, order=%u), maxvar: %s (id=%u, order=%u)\n",
-          BiddyManagedGetVariableName(MNG,minvar),minvar,minvarOrder,
-          BiddyManagedGetVariableName(MNG,maxvar),maxvar,maxvarOrder);
-  free(fOrdering);
-#endif
-
-#ifdef FUNCTIONREPORTDETAILS
-#endif
 
+  free(oldtable);
 }
 
+#endif
+
 /*******************************************************************************
-\brief Function BiddyDebugNode.
+\brief Function nodeBlockNumber returns the index of the memory block
+       which contains the given node.
 
 ### Description
+    Return biddyNodeTable.blocknumber if node is not in any memory block.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyDebugNode(Biddy_Manager MNG, BiddyNode *node)
+static inline unsigned int
+nodeBlockNumber(Biddy_Manager MNG, BiddyNode *node)
 {
-  debugNode(MNG,node);
+  unsigned int b;
+
+  for (b=0; b<biddyNodeTable.blocknumber; b++) {
+    if (((uintptr_t) node >= (uintptr_t) biddyNodeTable.blocktable[b]) &&
+        ((uintptr_t) node < (uintptr_t) (biddyNodeTable.blocktable[b] + biddyNodeTable.blocksizetable[b])))
+    {
+      return b;
+    }
+  }
+
+  return b;
 }
 
 /*******************************************************************************
-\brief Function BiddyDebugEdge.
+\brief Function relocatedEdge returns the edge with the same mark and tag
+       which points to the new copy of the node if the node has been relocated.
 
 ### Description
+    Nodes from memory blocks [k] and higher have been relocated, the old
+    node stores the address of its new copy in field list.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyDebugEdge(Biddy_Manager MNG, Biddy_Edge edge)
+static inline Biddy_Edge
+relocatedEdge(Biddy_Manager MNG, Biddy_Edge f, unsigned int k)
 {
-  debugEdge(MNG,edge);
-}
+  if (BiddyIsNull(f) || (nodeBlockNumber(MNG,BiddyN(f)) < k)) return f;
 
-/*----------------------------------------------------------------------------*/
-/* Definition of static functions                                             */
-/*----------------------------------------------------------------------------*/
+  return (Biddy_Edge) ((uintptr_t) f - (uintptr_t) BiddyN(f) + (uintptr_t) BiddyN(f)->list);
+}
 
 /*******************************************************************************
-\brief Function isEqv.
+\brief Function nodeTableCompact relocates live nodes into the first memory
+       blocks and releases memory blocks which become empty.
 
 ### Description
-    It is assumed that f1 and f2 have the same ordering.
+    The smallest number of the first memory blocks is kept, such that they
+    have enough free nodes for all live nodes from the other memory blocks.
+    Live nodes from the other memory blocks are copied into free nodes,
+    formulae, variables, elements, and all edges are updated, cache tables
+    are cleaned, Node table is rebuilt and the empty memory blocks are
+    released.
 ### Side effects
+    There must be no obsolete nodes, i.e. Purge must be called before.
+    The terminal node is in the first memory block, it is never relocated.
 ### More info
 *******************************************************************************/
 
-static Biddy_Boolean
-isEqv(Biddy_Manager MNG1, Biddy_Edge f1, Biddy_Manager MNG2, Biddy_Edge f2)
+static void
+nodeTableCompact(Biddy_Manager MNG)
 {
-  Biddy_Boolean r;
+  unsigned int *numfree;
+  unsigned int b,k,i;
+  unsigned int moved,spare,live;
+  unsigned long long int released;
+  BiddyNode *sup,*next,*last,*freenodes,*tmp;
+  BiddyCacheList *c;
+  Biddy_Variable v;
 
-  if (BiddyIsTerminal(f1)) {
-    r = BiddyIsTerminal(f2) &&
-        (BiddyGetMark(f1) == BiddyGetMark(f2)) &&
-        !strcmp(
-          BiddyManagedGetVariableName(MNG1,BiddyGetTag(f1)),
-          BiddyManagedGetVariableName(MNG2,BiddyGetTag(f2)));
-  } else {
-    r = !BiddyIsTerminal(f2) &&
-        (BiddyGetMark(f1) == BiddyGetMark(f2)) &&
-        !strcmp(
-          BiddyManagedGetTopVariableName(MNG1,f1),
-          BiddyManagedGetTopVariableName(MNG2,f2)) &&
-        !strcmp(
-          BiddyManagedGetVariableName(MNG1,BiddyGetTag(f1)),
-          BiddyManagedGetVariableName(MNG2,BiddyGetTag(f2))) &&
-        isEqv(MNG1,BiddyE(f1),MNG2,BiddyE(f2)) &&
-        isEqv(MNG1,BiddyT(f1),MNG2,BiddyT(f2));
+  if (biddyNodeTable.blocknumber < 2) return;
+
+  /* NODES WHICH HAVE NEVER BEEN USED ARE LINKED INTO THE LIST OF FREE NODES */
+  while (biddyNodeTable.unusednum) {
+    sup = biddyNodeTable.unused++;
+    biddyNodeTable.unusednum--;
+    sup->list = (void *) biddyFreeNodes;
+    biddyFreeNodes = sup;
   }
 
-  return r;
+  /* COUNT FREE NODES IN EACH MEMORY BLOCK */
+  if (!(numfree = (unsigned int *)
+  calloc(biddyNodeTable.blocknumber,sizeof(unsigned int)))) {
+    fprintf(stderr,"nodeTableCompact: Out of memoy!\n");
+    exit(1);
+  }
+  spare = 0;
+  for (sup = biddyFreeNodes; sup; sup = (BiddyNode *) sup->list) {
+    numfree[nodeBlockNumber(MNG,sup)]++;
+    spare++;
+  }
+
+  /* DETERMINE THE NUMBER OF KEPT MEMORY BLOCKS, THE FIRST ONE IS ALWAYS KEPT */
+  /* live nodes from blocks [k] and higher must fit into free nodes of blocks [0]..[k-1] */
+  moved = 0;
+  k = biddyNodeTable.blocknumber;
+  while (k > 1) {
+    b = k - 1;
+    live = biddyNodeTable.blocksizetable[b] - numfree[b];
+    spare = spare - numfree[b];
+    if (spare < moved + live) break;
+    moved = moved + live;
+    k--;
+  }
+  free(numfree);
+
+  if (k == biddyNodeTable.blocknumber) return;
+
+  /* FREE NODES FROM THE RELEASED MEMORY BLOCKS ARE REMOVED FROM THE LIST OF FREE NODES */
+  freenodes = last = NULL;
+  for (sup = biddyFreeNodes; sup; sup = next) {
+    next = (BiddyNode *) sup->list;
+    if (nodeBlockNumber(MNG,sup) < k) {
+      if (last) last->list = (void *) sup; else freenodes = sup;
+      last = sup;
+    }
+  }
+  if (last) last->list = NULL;
+
+  /* LIVE NODES FROM THE RELEASED MEMORY BLOCKS ARE COPIED INTO FREE NODES */
+  /* THE OLD NODE BECOMES OBSOLETE AND ITS FIELD list POINTS TO THE NEW COPY */
+  /* THE LIST OF LIVE NODES FOR EACH VARIABLE IS REBUILT */
+  for (v=1; v<biddyVariableTable.num; v++) {
+    biddyVariableTable.table[v].lastNode->list = NULL;
+    last = NULL;
+    sup = biddyVariableTable.table[v].firstNode;
+    while (sup) {
+      next = (BiddyNode *) sup->list;
+      if (nodeBlockNumber(MNG,sup) >= k) {
+        assert( freenodes != NULL );
+        tmp = freenodes;
+        freenodes = (BiddyNode *) freenodes->list;
+        *tmp = *sup;
+        sup->list = (void *) tmp;
+        sup->expiry = 1; /* cache tables will delete all results with this node */
+        sup = tmp;
+      }
+      if (last) last->list = (void *) sup; else biddyVariableTable.table[v].firstNode = sup;
+      last = sup;
+      sup = next;
+    }
+    last->list = NULL;
+    biddyVariableTable.table[v].lastNode = last;
+  }
+  biddyFreeNodes = freenodes;
+
+  /* lists have been rebuilt, thus the next GC must be a major one */
+  biddyNodeTable.nurseryok = FALSE;
+
+  /* UPDATE ALL EDGES TO THE RELOCATED NODES */
+  for (v=1; v<biddyVariableTable.num; v++) {
+    sup = biddyVariableTable.table[v].firstNode;
+    while (sup) {
+      sup->f = relocatedEdge(MNG,sup->f,k);
+      sup->t = relocatedEdge(MNG,sup->t,k);
+      sup = (BiddyNode *) sup->list;
+    }
+    biddyVariableTable.table[v].variable = relocatedEdge(MNG,biddyVariableTable.table[v].variable,k);
+    biddyVariableTable.table[v].element = relocatedEdge(MNG,biddyVariableTable.table[v].element,k);
+    biddyVariableTable.table[v].value = relocatedEdge(MNG,biddyVariableTable.table[v].value,k);
+  }
+  MNG[3] = relocatedEdge(MNG,biddyZero,k);
+  MNG[4] = relocatedEdge(MNG,biddyOne,k);
+  for (i=0; i<biddyFormulaTable.size; i++) {
+    biddyFormulaTable.table[i].f = relocatedEdge(MNG,biddyFormulaTable.table[i].f,k);
+  }
+
+  /* DELETE RESULTS WITH RELOCATED NODES FROM ALL CACHE TABLES */
+  /* this must be done before the memory blocks are released */
+  c = biddyCacheList;
+  while (c) {
+    c->gc(MNG);
+    c = c->next;
+  }
+
+  /* REBUILD NODE TABLE */
+  /* THE FIRST NODE IN THE LIST IS VARIABLE/ELEMENT AND IT IS NOT STORED IN NODE TABLE */
+  /* BECAUSE OF ORDERED CHAINS, NODES ARE ADDED STARTING WITH THE LAST VARIABLE */
+#ifdef NODETABLE_SUBTABLES
+  for (v=1; v<biddyVariableTable.num; v++) {
+    memset(BiddyChainTable(v),0,(BiddyChainSize(v)+2)*sizeof(BiddyNode *));
+  }
+#else
+  memset(&biddyNodeTable.table[1],0,(biddyNodeTable.size+1)*sizeof(BiddyNode *));
+#endif
+  for (v=biddyVariableTable.num-1; v>0; v--) {
+    sup = (BiddyNode *) biddyVariableTable.table[v].firstNode->list;
+    while (sup) {
+      addNodeTable(MNG,nodeTableHash(v,sup->f,sup->t,BiddyChainSize(v)),sup,NULL);
+      sup = (BiddyNode *) sup->list;
+    }
+  }
+
+  /* RELEASE EMPTY MEMORY BLOCKS */
+  released = 0;
+  for (b=k; b<biddyNodeTable.blocknumber; b++) {
+    released += (unsigned long long int) biddyNodeTable.blocksizetable[b] * sizeof(BiddyNode);
+    biddyNodeTable.generated -= biddyNodeTable.blocksizetable[b];
+#ifndef ARENA
+    biddyNodeTable.blockfree(biddyNodeTable.blocktable[b],
+      biddyNodeTable.blocksizetable[b] * sizeof(BiddyNode));
+#endif
+  }
+#ifdef ARENA
+  /* released blocks are at the end of the used part of the arena */
+  arenaDiscard(biddyNodeTable.blocktable[k],released / sizeof(BiddyNode));
+#endif
+  biddyNodeTable.blocknumber = k;
+  biddyNodeTable.blocksize = biddyNodeTable.blocksizetable[k-1];
+  biddyNodeTable.compactfreed += released;
 }
 
 /*******************************************************************************
-\brief Function createLocalInfo recursively creates local info for all nodes
-       except terminal node.
+\brief Function nodeBlockMalloc allocates memory block with malloc.
 
 ### Description
+    This is the default allocator for memory blocks of nodes.
 ### Side effects
-    All nodes except terminal node must be selected!
-    Function createLocalInfo will deselect them.
-    data.mintermCount is using GNU Multiple Precision Arithmetic Library (GMP).
-    No initialization of elements is performed here.
 ### More info
 *******************************************************************************/
 
-static BiddyLocalInfo *
-createLocalInfo(Biddy_Manager MNG, Biddy_Edge f, BiddyLocalInfo *c)
+static void *
+nodeBlockMalloc(size_t size)
 {
-  if (BiddyManagedIsSelected(MNG,f)) {
-    BiddyManagedDeselectNode(MNG,f);
-    c->back = (BiddyNode *)BiddyP(f);
-    c->org = (BiddyNode *)(((BiddyNode *) BiddyP(f))->list);
-    ((BiddyNode *) BiddyP(f))->list = (void *) c;
-    c = &c[1]; /* next field in the array */
-    c = createLocalInfo(MNG,BiddyE(f),c);
-    c = createLocalInfo(MNG,BiddyT(f),c);
-  }
-  return c;
+  return malloc(size);
 }
 
 /*******************************************************************************
-\brief Function deleteLocalInfo recursively deletes local info for all nodes
-       except terminal node.
+\brief Function nodeBlockFree releases memory block allocated with
+       nodeBlockMalloc.
 
 ### Description
 ### Side effects
-    All nodes except terminal node must be selected!
-    Function deleteLocalInfo will deselect them.
-    TO DO: memory reserved for data.mintermCount is not removed!
 ### More info
 *******************************************************************************/
 
 static void
-deleteLocalInfo(Biddy_Manager MNG, Biddy_Edge f)
+nodeBlockFree(void *block, size_t size)
 {
-  if (BiddyManagedIsSelected(MNG,f)) {
-    BiddyManagedDeselectNode(MNG,f);
-    ((BiddyNode *) BiddyP(f))->list = (void *)
-      ((BiddyLocalInfo *)((BiddyNode *) BiddyP(f))->list)->org;
-    deleteLocalInfo(MNG,BiddyE(f));
-    deleteLocalInfo(MNG,BiddyT(f));
-  }
+  (void)(size); // to avoid the unused warning
+  free(block);
 }
 
 /*******************************************************************************
-\brief Function nodeTableHash.
+\brief Function nodeBlockMmap allocates memory block with anonymous mmap.
 
 ### Description
+    If supported, transparent huge pages are requested for the memory block.
+    Memory pages are provided by the system when they are used, thus nodes
+    which have never been used do not occupy memory.
 ### Side effects
+    On systems other than UNIX and MACOSX, malloc is used.
 ### More info
 *******************************************************************************/
 
-static inline unsigned int
-nodeTableHash(Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt, unsigned int size)
+static void *
+nodeBlockMmap(size_t size)
 {
-  unsigned int hash;
+#if defined(UNIX) || defined(MACOSX)
+  void *block;
 
-  /* THIS IS HASH FUNCTION FOR NODE TABLE */
-  /* THE SIZE OF NODE TABLE IS biddyNodeTable.size+2 */
-  /* BECAUSE OF USED TRICKS, HASH FUNCTION MUST NEVER RETURN ZERO! */
-  /* USEFUL INDICES ARE FROM [1] TO [biddyNodeTable.size+1] */
+  block = mmap(NULL,size,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+  if (block == MAP_FAILED) return NULL;
+#ifdef MADV_HUGEPAGE
+  madvise(block,size,MADV_HUGEPAGE);
+#endif
+  return block;
+#else
+  return malloc(size);
+#endif
+}
 
-  /* this is very simple but quite efficient, not using v */
-  /*
-  {
-  uintptr_t k;
-  k = ((uintptr_t) pt >> 6) + ((uintptr_t) pf >> 5);
-  hash = 1 + (k & size);
-  return hash;
-  }
-  */
+/*******************************************************************************
+\brief Function nodeBlockMunmap releases memory block allocated with
+       nodeBlockMmap.
 
-  /* this is very simple but quite efficient, using v */
-  /*
-  {
-  uintptr_t k;
-  k = ((uintptr_t) pt >> 6) + ((uintptr_t) pf >> 2) + (uintptr_t) v;
-  hash = 1 + (k & size);
-  return hash;
-  }
-  */
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
-#if UINTPTR_MAX == 0xffffffffffffffff
+static void
+nodeBlockMunmap(void *block, size_t size)
+{
+#if defined(UNIX) || defined(MACOSX)
+  munmap(block,size);
+#else
+  (void)(size); // to avoid the unused warning
+  free(block);
+#endif
+}
 
-  /* this is used to experimentally determine parameters */
-  /* for i in `seq 10`; do ./biddy-example-8queens 8; done */
-  /*
-  {
-  uintptr_t k;
-  static unsigned int GG=0;
-  static unsigned int rnd1=1214272557,rnd2=1422347099;
-  if (!GG) {GG=1;rnd1=rand();rnd2=rand();printf("<rnd1=%u><rnd2=%u>\n",rnd1,rnd2);}
-  k = ((uintptr_t) pt * rnd1 + (uintptr_t) pf + (uintptr_t) v) * rnd2;
-  hash = 1 + ((k >> 24) & size);
-  return hash;
-  }
-  */
+#ifdef ARENA
 
-  /* this is experimentally determined, not using v, efficient for OBDDs, only */
-  /*
-  {
-  uintptr_t k;
-  k = ((uintptr_t) pt * 352241492 + (uintptr_t) pf) * 231629123;
-  hash = 1 + ((k >> 32) & size);
-  return hash;
-  }
-  */
+/*******************************************************************************
+\brief Function arenaReserve allocates the arena for the given number of nodes.
 
-  /* this is experimentally determined, using v, seems to be better for TZBDDs */
-  /**/
-  {
-  uintptr_t k;
-  k = ((uintptr_t) pt * 103406078 + (uintptr_t) pf + (uintptr_t) v) * 1186577883;
-  hash = 1 + ((k >> 24) & size);
-  return hash;
-  }
-  /**/
+### Description
+    On UNIX and MACOSX, only address space is reserved, memory pages are
+    provided by the system when they are used for the first time. On other
+    systems, the arena is allocated with malloc.
+### Side effects
+    Return NULL if the arena cannot be allocated.
+### More info
+*******************************************************************************/
 
-  /* this is using ideas from MURMUR3, see https://code.google.com/p/smhasher/ */
-  /*
-  {
-  uintptr_t k,k1,k2;
-  k = (uintptr_t) v;
-  k1 = (uintptr_t) pf;
-  k1 = (k1 << 31) | (k1 >> 33);
-  k ^= k1;
-  k2 = (uintptr_t) pt;
-  k2 = (k2 << 35) | (k2 >> 29);
-  k ^= k2;
-  k *= 0xff51afd7ed558ccdL;
-  k ^= k >> 32;
-  k *= 0xc4ceb9fe1a85ec53L;
-  k ^= k >> 32;
-  hash = 1 + (k & size);
-  return hash;
-  }
-  */
+static BiddyNode *
+arenaReserve(size_t size)
+{
+  BiddyNode *arena;
 
+#if defined(UNIX) || defined(MACOSX)
+#ifdef MAP_NORESERVE
+  arena = (BiddyNode *) mmap(NULL,size * sizeof(BiddyNode),PROT_READ|PROT_WRITE,
+                             MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE,-1,0);
+#else
+  arena = (BiddyNode *) mmap(NULL,size * sizeof(BiddyNode),PROT_READ|PROT_WRITE,
+                             MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+#endif
+  if (arena == (BiddyNode *) MAP_FAILED) arena = NULL;
+#ifdef MADV_HUGEPAGE
+  if (arena) madvise(arena,size * sizeof(BiddyNode),MADV_HUGEPAGE);
+#endif
 #else
+  arena = (BiddyNode *) malloc(size * sizeof(BiddyNode));
+#endif
 
-  /* MURMUR3 (A KIND OF) 32-bit HASH FUNCTION */
-  /* https://code.google.com/p/smhasher/ */
-  {
-  uintptr_t k,k1,k2;
-  k = (uintptr_t) v;
-  k1 = (uintptr_t) pf;
-  k1 = (k1 << 15) | (k1 >> 17);
-  k ^= k1;
-  k = (k << 19) | (k >> 13);
-  k2 = (uintptr_t) pt;
-  k ^= k2;
-  k *= 0x85ebca6b;
-  k ^= k >> 16;
-  k *= 0xc2b2ae35;
-  k ^= k >> 16;
-  hash = 1 + (k & size);
-  return hash;
-  }
+  return arena;
+}
+
+/*******************************************************************************
+\brief Function arenaRelease releases the arena.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+static void
+arenaRelease(BiddyNode *arena, size_t size)
+{
+  if (!arena) return;
 
+#if defined(UNIX) || defined(MACOSX)
+  munmap((void *) arena,size * sizeof(BiddyNode));
+#else
+  (void)(size); // to avoid the unused warning
+  free(arena);
 #endif
+}
 
-  return 0;
+/*******************************************************************************
+\brief Function arenaDiscard returns memory pages used by the given part
+       of the arena to the system.
+
+### Description
+    On UNIX and MACOSX, the part of the arena remains reserved and memory
+    pages are provided again when they are used. On other systems, nothing
+    is done.
+### Side effects
+    The given part must be at the end of the used part of the arena.
+### More info
+*******************************************************************************/
 
+static void
+arenaDiscard(BiddyNode *from, size_t size)
+{
+#if defined(UNIX) || defined(MACOSX)
+  uintptr_t start,end,page;
+
+  /* the rest of the last page is not used, thus end can be rounded up */
+  page = (uintptr_t) sysconf(_SC_PAGESIZE);
+  start = ((uintptr_t) from + page - 1) & ~(page - 1);
+  end = ((uintptr_t) (from + size) + page - 1) & ~(page - 1);
+  if (end > start) madvise((void *) start,end - start,MADV_DONTNEED);
+#else
+  (void)(from); // to avoid the unused warning
+  (void)(size); // to avoid the unused warning
+#endif
 }
 
+#endif
+
 /*******************************************************************************
-\brief Function addNodeTable adds node to the table, node itself is not
-       changed in any way.
+\brief Function wallClock returns the wall clock time.
 
 ### Description
+    The result is given in units of clock(), i.e. CLOCKS_PER_SEC per second.
+    On systems other than UNIX and MACOSX, processor time is returned.
 ### Side effects
-    This is low level functon. It is not checked, if the same node already
-    exists.
 ### More info
 *******************************************************************************/
 
-static inline void
-addNodeTable(Biddy_Manager MNG, unsigned int hash, BiddyNode *node,
-             BiddyNode *sup1)
+static clock_t
+wallClock()
 {
-  /* DEBUGGING */
-  /*
-  fprintf(stderr,"\n[ADD NODE: variable %s, else=%s (%p), then=%s (%p)]",
-    BiddyManagedGetTopVariableName(MNG,node),
-    BiddyManagedGetTopVariableName(MNG,node->f),node->f,
-    BiddyManagedGetTopVariableName(MNG,node->t),node->t);
-  */
+#if defined(UNIX) || defined(MACOSX)
+  struct timespec ts;
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-    biddyNodeTable.add++;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (clock_t) ts.tv_sec * CLOCKS_PER_SEC +
+         (clock_t) (ts.tv_nsec / (1000000000.0 / CLOCKS_PER_SEC));
+#else
+  return clock();
 #endif
+}
 
-  /* ******************************************************************* */
-  /* NODES ARE INSERTED AFTER sup1                                       */
-  /* IF sup1 = NULL THEN NEW NODE WILL BE INSERTED AT THE BEGINNING      */
-  /* IF sup1 = lastNode THEN NEW NODE WILL BE INSERTED AT THE END        */
-  /* ******************************************************************* */
+#ifdef PARALLELAPPLY
 
-  /* THE FIRST ELEMENT OF EACH CHAIN SHOULD HAVE A SPECIAL VALUE */
-  /* FOR ITS PREV ELEMENT TO ALLOW TRICKY BUT EFFICIENT DELETING */
+/*******************************************************************************
+\brief Function applyWorker performs waiting tasks until the threads are
+       stopped.
 
-  node->prev = sup1 ? sup1 : (BiddyNode *) &biddyNodeTable.table[hash-1];
-  node->next = node->prev->next;
-  node->prev->next = node;
-  if (node->next) node->next->prev = node;
+### Description
+    Used in BiddyManagedSetApplyThreads.
+### Side effects
+### More info
+*******************************************************************************/
+
+static void *
+applyWorker(void *arg)
+{
+  BiddyApplyPool *pool;
+
+  pool = (BiddyApplyPool *) arg;
+
+  pthread_mutex_lock(&pool->lock);
+  while (!pool->stop) {
+    if (pool->waiting) {
+      performApplyTask(pool);
+    } else {
+      pthread_cond_wait(&pool->cond,&pool->lock);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
 }
 
 /*******************************************************************************
-\brief Function findNodeTable checks for the node in the chain referenced
-       by thesup.
+\brief Function performApplyTask takes the oldest waiting task and
+       performs it.
 
 ### Description
-    Return NULL and (*thesup = NULL) iff node does not exists and
-           chain is empty.
-    Return NULL and (*thesup = theNode) iff node exists and
-           it is first element in the chain.
-    Return lastNodeInChain and (*thesup = NULL) or
-           nodeBeforeNodeWithWrongVariable and (*thesup = nodeWithWrongVariable)
-           iff node does not exists and chain is not empty.
-    Return nodeBeforeTheNode and (*thesup = theNode) iff node exists and
-           it is not first element in the chain.
+    Used in applyWorker and BiddyParallelApply. The oldest task is usually
+    the largest one. The lock of waiting tasks must be held by the caller,
+    it is released while the task is performed.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-static inline BiddyNode *
-findNodeTable(Biddy_Manager MNG, Biddy_Variable v, Biddy_Edge pf, Biddy_Edge pt,
-              BiddyNode **thesup)
+static void
+performApplyTask(BiddyApplyPool *pool)
 {
-  BiddyNode *sup,*sup1;
+  BiddyApplyTask *task;
 
-  (void)(MNG); // to avoid the unused warning
+  assert( pool->waiting );
 
-  /* DEBUGGING */
-  /*
-  printf("FIND NODE TABLE (*thesup=%p, v=%u, f=%p, t=%p, next=%p): v=%s (%u), pf=%s (%p), pt=%s (%p)\n",
-    (void *) *thesup,
-    (*thesup) ? (*thesup)->v : 0,
-    (*thesup) ? (void *) (*thesup)->f : NULL,
-    (*thesup) ? (void *) (*thesup)->t : NULL,
-    (*thesup) ? (void *) (*thesup)->next : NULL,
-    BiddyManagedGetVariableName(MNG,v),v,
-    BiddyManagedGetTopVariableName(MNG,pf),pf,
-    BiddyManagedGetTopVariableName(MNG,pt),pt);
-  */
+  task = pool->task[0];
+  pool->waiting--;
+  memmove(&pool->task[0],&pool->task[1],pool->waiting * sizeof(BiddyApplyTask *));
+  task->state = 1;
+  pthread_mutex_unlock(&pool->lock);
+
+  task->r = task->fn(pool->MNG,task->f,task->g,task->h);
+
+  pthread_mutex_lock(&pool->lock);
+  task->state = 2;
+  pool->busy--;
+  pthread_cond_broadcast(&pool->cond);
+}
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.find++;
 #endif
 
-  if (!(*thesup)) return NULL;
+#ifdef PARALLELGC
 
-  sup = *thesup;
-  sup1 = NULL;
+/*******************************************************************************
+\brief Function parallelWorker takes parts of the task until all are taken.
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.compare++;
-#endif
+### Description
+    Used in BiddyParallelFor.
+### Side effects
+### More info
+*******************************************************************************/
 
-  /* ********************************************************************* */
-  /* WE HAVE ORDERED CHAINS IN NODE TABLE                                  */
-  /* ********************************************************************* */
+static void *
+parallelWorker(void *arg)
+{
+  BiddyParallelTask *task;
+  unsigned int lo,hi;
 
-  while (sup && (v > sup->v))
-  {
-    sup1 = sup;
-    sup = sup->next;
+  task = (BiddyParallelTask *) arg;
+  while ((lo = __sync_fetch_and_add(task->next,task->grain)) < task->n) {
+    hi = (task->n - lo > task->grain) ? lo + task->grain : task->n;
+    task->fn(task->MNG,task->data,task->t,lo,hi);
+  }
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-    if (sup) biddyNodeTable.compare++;
-#endif
+  return NULL;
+}
+
+#ifndef NODETABLE_OPENADDRESSING
+
+/*******************************************************************************
+\brief Function gcSweepChains removes obsolete nodes from the given chains
+       of Node table.
+
+### Description
+    Used in BiddyManagedGC via BiddyParallelFor. Part [lo,hi) refers to
+    chains [lo+1,hi+1) because useful indices of Node table start with 1.
+    Chains are disjoint, thus no locking is needed.
+### Side effects
+    Lists of nodes are not updated, see gcSweepVariables.
+### More info
+*******************************************************************************/
+
+static void
+gcSweepChains(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+              unsigned int hi)
+{
+  unsigned int i;
+  BiddyNode *sup,*next;
+
+  (void)(data); // to avoid the unused warning
+  (void)(t); // to avoid the unused warning
 
+  for (i=lo+1; i<hi+1; i++) {
+    sup = BiddyNodeTableEntry(i);
+    while (sup) {
+      next = BiddyNextInChain(sup);
+      if ((sup->expiry) && (sup->expiry < biddySystemAge)) {
+        removeNodeTable(MNG,sup);
+      }
+      sup = next;
+    }
   }
+}
 
-  while (sup &&
-          (v == sup->v) &&
-          ((pf != sup->f) || (pt != sup->t))
-        )
-  {
-    sup1 = sup;
-    sup = sup->next;
+/*******************************************************************************
+\brief Function gcSweepVariables removes obsolete nodes from the lists of
+       nodes of the given variables.
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-    if (sup) biddyNodeTable.compare++;
-#endif
+### Description
+    Used in BiddyManagedGC via BiddyParallelFor. Part [lo,hi) refers to
+    variables [lo+1,hi+1). Removed nodes are collected in data[t]. For
+    NODETABLE_SUBTABLES, nodes are also removed from the subtables of the
+    variables, otherwise this is done by gcSweepChains.
+### Side effects
+### More info
+*******************************************************************************/
+
+static void
+gcSweepVariables(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+                 unsigned int hi)
+{
+  BiddyGCSweep *sweep;
+  BiddyNode *tmpnode1,*tmpnode2;
+  BiddyNode *first,*last;
+  unsigned int removed;
+  Biddy_Variable v;
+
+  first = last = NULL;
+  removed = 0;
+  for (v=lo+1; v<hi+1; v++) {
+    if (!biddyVariableTable.table[v].numobsolete) continue;
 
+    /* the first node in the list is variable/element and it is never obsolete */
+    tmpnode1 = biddyVariableTable.table[v].firstNode;
+    biddyVariableTable.table[v].lastNode->list = NULL;
+    tmpnode2 = (BiddyNode *) tmpnode1->list;
+
+    while (biddyVariableTable.table[v].numobsolete) {
+      assert( tmpnode2 != NULL) ;
+      assert( tmpnode2->v == v ) ;
+      if (!(tmpnode2->expiry) || (tmpnode2->expiry >= biddySystemAge)) {
+        /* fortified, fresh or prolonged  node */
+        tmpnode1 = tmpnode2;
+      } else {
+        /* obsolete node */
+        removed++;
+        (biddyVariableTable.table[v].num)--;
+        (biddyVariableTable.table[v].numobsolete)--;
+#ifdef NODETABLE_SUBTABLES
+        removeNodeTable(MNG,tmpnode2);
+#endif
+        tmpnode1->list = (BiddyNode *) tmpnode2->list;
+        tmpnode2->list = (void *) first;
+        if (!first) last = tmpnode2;
+        first = tmpnode2;
+      }
+      tmpnode2 = (BiddyNode *) tmpnode1->list;
+    }
+    if (!tmpnode1->list) {
+      biddyVariableTable.table[v].lastNode = tmpnode1;
+    }
   }
 
-  *thesup = sup;
-  return sup1;
+  sweep = (BiddyGCSweep *) data;
+  if (first) {
+    last->list = (void *) sweep[t].first;
+    if (!sweep[t].first) sweep[t].last = last;
+    sweep[t].first = first;
+  }
+  sweep[t].removed += removed;
 }
 
+#endif
+
+#endif
+
 /*******************************************************************************
 \brief Function addVariableElement adds new variable and new element.
 
@@ -13764,10 +16143,14 @@ addVariableElement(Biddy_Manager MNG, Biddy_String x, Biddy_Boolean varelem,
 
   biddyVariableTable.table[v].name = strdup(x);
   biddyVariableTable.table[v].num = 0;
+#ifdef NODETABLE_SUBTABLES
+  nodeSubtableCreate(MNG,v);
+#endif
   biddyVariableTable.table[v].firstNode = biddyNodeTable.table[0];
   biddyVariableTable.table[v].lastNode = biddyNodeTable.table[0];
   r = BiddyManagedTaggedFoaNode(MNG,v,biddyNull,biddyNull,v,FALSE); /* FALSE is important! */
   biddyVariableTable.table[v].firstNode = BiddyN(r);
+  biddyVariableTable.table[v].lastOldNode = BiddyN(r); /* all other nodes are new */
   biddyNodeTable.table[0]->list = NULL; /* REPAIR TERMINAL NODE */
 
   /* FOR OBDD AND OFDD, NOW YOU HAVE A VARIABLE BUT AN ELEMENT MAY ALSO BE REQUESTED */
@@ -13850,6 +16233,140 @@ addVariableElement(Biddy_Manager MNG, Biddy_String x, Biddy_Boolean varelem,
 
 }
 
+/*******************************************************************************
+\brief Function copyKeyword returns the keyword which is used in the Copy
+       cache of MNG1 for the results in MNG2.
+
+### Description
+    A new keyword is given to MNG2 if it has not been used, yet, or if
+    GC, swapping, compaction or adding variables could invalidate its
+    results. Target managers are identified by their serial, thus a new
+    manager with the same address gets a new keyword, too.
+### Side effects
+    Copy cache is created on the first call.
+### More info
+*******************************************************************************/
+
+static unsigned int
+copyKeyword(Biddy_Manager MNG1, Biddy_Manager MNG2)
+{
+  unsigned int i;
+  BiddyCopyTarget *target;
+
+  if (!biddyCopyCache1.table) {
+    biddyCopyCache1.size = BIDDYCOPYCACHESIZE;
+    if (!(biddyCopyCache1.table = (BiddyKeywordCache *)
+    calloc((biddyCopyCache1.size+1),sizeof(BiddyKeywordCache)))) {
+      fprintf(stderr,"copyKeyword: Out of memoy!\n");
+      exit(1);
+    }
+  }
+
+  target = NULL;
+  for (i = 0; i < biddyCopyCache1.targetNum; i++) {
+    if (biddyCopyCache1.targetList[i].MNG == MNG2) {
+      target = &biddyCopyCache1.targetList[i];
+      break;
+    }
+  }
+
+  if (target &&
+      (target->serial == biddyCopyCache2.serial) &&
+      (target->garbage == biddyNodeTable2.garbage) &&
+      (target->swap == biddyNodeTable2.swap) &&
+      (target->compaction == biddyNodeTable2.compaction) &&
+      (target->num1 == biddyVariableTable1.num) &&
+      (target->num2 == biddyVariableTable2.num))
+  {
+    return target->keyword;
+  }
+
+  if (!target) {
+    biddyCopyCache1.targetNum++;
+    if (!(target = (BiddyCopyTarget *)
+       realloc(biddyCopyCache1.targetList,biddyCopyCache1.targetNum*sizeof(BiddyCopyTarget))))
+    {
+      fprintf(stderr,"copyKeyword: Out of memoy!\n");
+      exit(1);
+    }
+    biddyCopyCache1.targetList = target;
+    target = &biddyCopyCache1.targetList[biddyCopyCache1.targetNum-1];
+    target->MNG = MNG2;
+  }
+
+  /* keyword and keyword+1 are used, keywords are not reused before the overflow */
+  if (biddyCopyCache1.keyNum + 4 < biddyCopyCache1.keyNum) {
+    memset(biddyCopyCache1.table,0,(biddyCopyCache1.size+1)*sizeof(BiddyKeywordCache));
+    biddyCopyCache1.keyNum = 0;
+    for (i = 0; i < biddyCopyCache1.targetNum; i++) {
+      biddyCopyCache1.targetList[i].serial = 0; /* serial 0 is never used */
+    }
+  }
+  biddyCopyCache1.keyNum = biddyCopyCache1.keyNum + 2;
+
+  target->serial = biddyCopyCache2.serial;
+  target->garbage = biddyNodeTable2.garbage;
+  target->swap = biddyNodeTable2.swap;
+  target->compaction = biddyNodeTable2.compaction;
+  target->num1 = biddyVariableTable1.num;
+  target->num2 = biddyVariableTable2.num;
+  target->keyword = biddyCopyCache1.keyNum;
+
+  return target->keyword;
+}
+
+/*******************************************************************************
+\brief Function findCopyCache looks for the copy of the given edge in the
+       Copy cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+static inline Biddy_Boolean
+findCopyCache(Biddy_Manager MNG1, Biddy_Edge f, unsigned int k, Biddy_Edge *r)
+{
+  uintptr_t key;
+  BiddyKeywordCache *p;
+
+  key = ((uintptr_t) f >> 3) + ((uintptr_t) k >> 0);
+  p = &biddyCopyCache1.table[key & biddyCopyCache1.size];
+
+  biddyCopyCache1.search++;
+
+  if ((p->f == f) && (p->keyword == k) && !BiddyIsNull(p->result)) {
+    biddyCopyCache1.find++;
+    *r = p->result;
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/*******************************************************************************
+\brief Function addCopyCache adds the copy of the given edge to the Copy
+       cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+static inline void
+addCopyCache(Biddy_Manager MNG1, Biddy_Edge f, unsigned int k, Biddy_Edge r)
+{
+  uintptr_t key;
+  BiddyKeywordCache *p;
+
+  key = ((uintptr_t) f >> 3) + ((uintptr_t) k >> 0);
+  p = &biddyCopyCache1.table[key & biddyCopyCache1.size];
+
+  p->f = f;
+  p->keyword = k;
+  p->result = r;
+}
+
 /*******************************************************************************
 \brief Function evalProbability.
 
@@ -14297,6 +16814,9 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
 
   biddyNodeTable.swap++;
 
+  /* nodes are moved between lists, thus the next GC must be a major one */
+  biddyNodeTable.nurseryok = FALSE;
+
   /* DEBUGGING */
   /*
   printf("SWAPPING: low =  \"%s\", high = \"%s\"\n",
@@ -14428,6 +16948,9 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
 
           oneSwap(MNG,sup,low,high,&u0,&u1);
 
+          /* remove node from the old chain, this must be done before the node is changed */
+          removeNodeTable(MNG,sup);
+
           sup->v = high;
           sup->f = u0;
           sup->t = u1;
@@ -14445,10 +16968,8 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
           */
 
           /* rehash this node */
-          sup->prev->next = sup->next; /* remove node from the old chain */
-          if (sup->next) sup->next->prev = sup->prev; /* remove node from the old chain */
-          hash = nodeTableHash(high,sup->f,sup->t,biddyNodeTable.size);
-          tmp = biddyNodeTable.table[hash]; /* the beginning of new chain */
+          hash = nodeTableHash(high,sup->f,sup->t,BiddyChainSize(high));
+          tmp = BiddyChainTable(high)[hash]; /* the beginning of new chain */
           tmp1 = findNodeTable(MNG,high,sup->f,sup->t,&tmp); /* to calculate tmp1, such node cannot exists! */
           assert( !tmp || (sup->v != tmp->v) );
           addNodeTable(MNG,hash,sup,tmp1); /* add node to hash table */
@@ -14553,6 +17074,9 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
           BiddyManagedPrintfBDD(MNG,sup);
           */
 
+          /* remove node from the old chain, this must be done before the node is changed */
+          removeNodeTable(MNG,sup);
+
           sup->f = u0;
           sup->t = u1;
 
@@ -14564,10 +17088,8 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
           BiddyManagedPrintfBDD(MNG,sup);
           */
 
-          sup->prev->next = sup->next; /* remove node from the old chain */
-          if (sup->next) sup->next->prev = sup->prev; /* remove node from the old chain */
-          hash = nodeTableHash(sup->v,sup->f,sup->t,biddyNodeTable.size);
-          tmp = biddyNodeTable.table[hash]; /* the beginning of new chain */
+          hash = nodeTableHash(sup->v,sup->f,sup->t,BiddyChainSize(sup->v));
+          tmp = BiddyChainTable(sup->v)[hash]; /* the beginning of new chain */
           tmp1 = findNodeTable(MNG,sup->v,sup->f,sup->t,&tmp); /* to calculate tmp1 */
 
           /* no problem if the same node already exists, the existing one will be changed  */
@@ -14663,6 +17185,15 @@ swapVariables(Biddy_Manager MNG, Biddy_Variable low, Biddy_Variable high,
     /* REPAIR TERMINAL NODE */
     biddyNodeTable.table[0]->list = NULL;
 
+#ifdef NODETABLE_SUBTABLES
+    /* renamed nodes have been added to the subtable for 'high' without checking its size */
+    if ((biddyVariableTable.table[high].num > BIDDYNODESUBTABLELOAD * BiddyChainSize(high)) &&
+        (BiddyChainSize(high) < biddyNodeTable.limitsize))
+    {
+      nodeSubtableEnlarge(MNG,high);
+    }
+#endif
+
   }
 
 #ifndef COMPACT
@@ -47,6 +47,22 @@ See also: biddy.h, biddyInt.h
 /* Constant declarations                                                      */
 /*----------------------------------------------------------------------------*/
 
+/* operations calculated by iterative apply */
+#define APPLYAND 1
+#define APPLYOR 2
+#define APPLYXOR 3
+#define APPLYITE 4
+#define APPLYNOT 5
+#define APPLYEXISTAND 6
+
+/* states of a frame in iterative apply */
+#define APPLYSTART 0 /* a new frame */
+#define APPLYELSE 1 /* waiting for the else successor */
+#define APPLYTHEN 2 /* waiting for the then successor */
+#define APPLYQELSE 3 /* ExistAndAbstract, waiting for the else successor of quantified variable */
+#define APPLYQTHEN 4 /* ExistAndAbstract, waiting for the then successor of quantified variable */
+#define APPLYQOR 5 /* ExistAndAbstract, waiting for Or of both successors */
+
 /*----------------------------------------------------------------------------*/
 /* Variable declarations                                                      */
 /*----------------------------------------------------------------------------*/
@@ -77,6 +93,66 @@ static inline void addKeywordCache(BiddyKeywordCacheTable cache, Biddy_Edge a, u
 
 static inline Biddy_Boolean findKeywordCache(BiddyKeywordCacheTable cache, Biddy_Edge a, unsigned int k, Biddy_Edge *r, unsigned int *index);
 
+#ifndef LAZYCACHE
+static void opGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+
+static void eaGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+
+static void rcGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+
+static void replaceGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo, unsigned int hi);
+#endif
+
+static unsigned int resizedCacheSize(Biddy_Manager MNG, unsigned int size, unsigned int initsize, unsigned long long int search, unsigned long long int find);
+
+static Biddy_Boolean resizeOp3Cache(Biddy_Manager MNG, BiddyOp3CacheTable *cache);
+
+static Biddy_Boolean resizeKeywordCache(Biddy_Manager MNG, BiddyKeywordCacheTable *cache);
+
+#ifdef PARALLELAPPLY
+static Biddy_Edge applyAnd(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+
+static Biddy_Edge applyOr(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+
+static Biddy_Edge applyXor(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+#endif
+
+static inline BiddyApplyFrame *pushApplyFrame(Biddy_Manager MNG, unsigned char op, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+
+static Biddy_Edge applySimpleCase(Biddy_Manager MNG, BiddyApplyFrame *fr);
+
+static Biddy_Edge applyIterative(Biddy_Manager MNG, unsigned char op, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h);
+
+static Biddy_Edge applyN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule, Biddy_Boolean conjunction);
+
+static void scheduleHeapDown(Biddy_Edge *q, unsigned int *size, unsigned int m, unsigned int i);
+
+static Biddy_Variable *scheduleSupport(Biddy_Manager MNG, Biddy_Edge f, unsigned int *num);
+
+static unsigned int scheduleOverlap(Biddy_Variable *a, unsigned int na, Biddy_Variable *b, unsigned int nb);
+
+static inline Biddy_Boolean bfAndKey(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge *FF, Biddy_Edge *GG, Biddy_Edge *HH);
+
+static unsigned int bfAndRequest(Biddy_Manager MNG, BiddyBFQueue *q, Biddy_Edge f, Biddy_Edge g, Biddy_Edge *r);
+
+static void relationSchedule(Biddy_Manager MNG, Biddy_Variable **supp, unsigned int *nsupp, unsigned int *size, unsigned int n, Biddy_Boolean *quant, BiddyRelationSchedule *s);
+
+static Biddy_Edge relationCube(Biddy_Manager MNG, Biddy_Variable *v, unsigned int n);
+
+static Biddy_Edge relationImage(Biddy_Manager MNG, BiddyRelation *r, BiddyRelationSchedule *s, Biddy_Edge R);
+
+static Biddy_Edge relationRename(Biddy_Manager MNG, BiddyRelation *r, Biddy_Edge f, Biddy_Boolean tocur);
+
+static Biddy_Edge saturate(Biddy_Manager MNG, BiddySaturation *sat, Biddy_Edge f, unsigned int k);
+
+static Biddy_Edge saturateImage(Biddy_Manager MNG, BiddySaturation *sat, BiddySatEvent *e, Biddy_Edge f);
+
+static Biddy_Edge vectorCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge *subst, Biddy_Variable last, const unsigned int key);
+
+static Biddy_Boolean restrictCubeLiterals(Biddy_Manager MNG, Biddy_Edge cube, Biddy_Variable top, Biddy_Edge *lit);
+
+static Biddy_Edge restrictCube(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v, Biddy_Edge *lit, Biddy_Variable last, Biddy_Edge cube);
+
 /*----------------------------------------------------------------------------*/
 /* Definition of exported functions                                           */
 /*----------------------------------------------------------------------------*/
@@ -3489,633 +3565,872 @@ Biddy_Managed_Dual(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean neg)
 }
 #endif
 
-/*----------------------------------------------------------------------------*/
-/* Definition of internal functions used to implement external functions      */
-/*----------------------------------------------------------------------------*/
-
 /***************************************************************************//*!
-\brief Function BiddyManagedNot.
+\brief Function Biddy_Managed_AndN calculates Boolean function AND (conjunction) of n functions.
 
 ### Description
+    The result is the same as if Biddy_And is applied to all functions in
+    the given array, but the order of pairwise operations is chosen by the
+    schedule to keep intermediate results small:
+    BIDDYSCHEDULELINEAR folds the functions in the given order,
+    BIDDYSCHEDULETREE combines neighbours in rounds (balanced tree),
+    BIDDYSCHEDULESMALLEST always combines the two smallest functions, and
+    BIDDYSCHEDULESUPPORT combines the smallest function with the one that
+    shares the most variables with it. For n = 0, constant one is returned.
 ### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    BIDDYSCHEDULESMALLEST and BIDDYSCHEDULESUPPORT count nodes of each
+    intermediate result, BIDDYSCHEDULESUPPORT also finds its dependent
+    variables.
 ### More info
-    See Biddy_Managed_Not.
+    Macro Biddy_AndN(f,n,schedule) is defined for use with anonymous manager.
 *******************************************************************************/
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 Biddy_Edge
-BiddyManagedNot(const Biddy_Manager MNG, const Biddy_Edge f)
+Biddy_Managed_AndN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule)
 {
-  Biddy_Edge r, T, E, Fv, Fneg_v;
-  Biddy_Edge FF, GG, HH;
-  Biddy_Variable v;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Edge Gv, Gneg_v;
-  Biddy_Variable nt;
-#endif
+  Biddy_Edge r;
 
-  assert( MNG != NULL );
-  assert( f != NULL );
+  assert( (n == 0) || (f != NULL) );
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_AndN");
 
   r = biddyNull;
 
-  /* LOOKING FOR SIMPLE CASE */
-
-  if (f == biddyZero) {
-    return biddyOne;
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndN(MNG,f,n,schedule);
   }
-  if (f == biddyOne) {
-    return biddyZero;
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_AndN: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_AndN: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_AndN: Unsupported BDD type!\n");
+    return biddyNull;
   }
+#endif
 
-  /* THIS IS NOT A SIMPLE CASE */
+  return r;
+}
 
-  FF = GG = HH = biddyNull;
-  Fneg_v = Fv = biddyNull;
+#ifdef __cplusplus
+}
+#endif
 
-#ifndef COMPACT
-  Gneg_v = Gv = biddyNull;
+/***************************************************************************//*!
+\brief Function Biddy_Managed_OrN calculates Boolean function OR (disjunction) of n functions.
+
+### Description
+    The result is the same as if Biddy_Or is applied to all functions in
+    the given array, but the order of pairwise operations is chosen by the
+    schedule to keep intermediate results small:
+    BIDDYSCHEDULELINEAR folds the functions in the given order,
+    BIDDYSCHEDULETREE combines neighbours in rounds (balanced tree),
+    BIDDYSCHEDULESMALLEST always combines the two smallest functions, and
+    BIDDYSCHEDULESUPPORT combines the smallest function with the one that
+    shares the most variables with it. For n = 0, constant zero is returned.
+### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    BIDDYSCHEDULESMALLEST and BIDDYSCHEDULESUPPORT count nodes of each
+    intermediate result, BIDDYSCHEDULESUPPORT also finds its dependent
+    variables.
+### More info
+    Macro Biddy_OrN(f,n,schedule) is defined for use with anonymous manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
 #endif
 
-  v = 0;
+Biddy_Edge
+Biddy_Managed_OrN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule)
+{
+  Biddy_Edge r;
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
+  assert( (n == 0) || (f != NULL) );
 
-    /* FOR OBDDC, CACHE TABLE IS NOT NEEDED */
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_OrN");
 
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    r = BiddyInv(f);
+  r = biddyNull;
 
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedOrN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedOrN(MNG,f,n,schedule);
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedOrN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedOrN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedOrN(MNG,f,n,schedule);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_OrN: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_OrN: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_OrN: Unsupported BDD type!\n");
+    return biddyNull;
   }
+#endif
 
-  else if (biddyManagerType == BIDDYTYPEOBDD) {
+  return r;
+}
 
-    /* FOR OBDD, 'NOT' USES CACHE TABLE DIRECTLY */
-    /* THIS IS NOT ITE CACHE! */
+#ifdef __cplusplus
+}
+#endif
 
-    FF = f;
-    GG = biddyZero;
-    HH = biddyOne;
+/***************************************************************************//*!
+\brief Function Biddy_Managed_AndBF calculates Boolean function AND
+       (conjunction) by using breadth-first apply.
 
-    /* IF RESULT IS NOT IN THE CACHE TABLE... */
-    cindex = 0;
-    if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-    {
+### Description
+    The result is the same as for Biddy_And. Instead of depth-first
+    recursion, the calculation is split into two passes over the levels
+    (variables) of the operands. In the first pass, requests are collected
+    level by level from the top to the bottom, each level has its own
+    queue and equal requests are joined. In the second pass, the requests
+    are reduced level by level from the bottom to the top, i.e. the nodes
+    of the result are created one level after another. Nodes with the same
+    variable are accessed together, which gives a better locality for very
+    large operands. Results are stored into the same cache as the results
+    of Biddy_And.
+### Side effects
+    Implemented for OBDD and OBDDC. For ZBDD, ZBDDC, and TZBDD, Biddy_And is
+    used. Memory for the requests is allocated for each call, thus for
+    small operands Biddy_And is faster.
+### More info
+    Macro Biddy_AndBF(f,g) is defined for use with anonymous manager.
+*******************************************************************************/
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      v = BiddyV(f);
-      Fneg_v = BiddyE(f);
-      Fv = BiddyT(f);
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-      /* RECURSIVE CALLS */
-      if (Fneg_v == biddyZero) {
-        E = biddyOne;
-      } else if (Fneg_v == biddyOne) {
-        E = biddyZero;
-      } else  {
-        E = BiddyManagedNot(MNG,Fneg_v);
-      }
-      if (Fv == biddyZero) {
-        T = biddyOne;
-      } else if (Fv == biddyOne) {
-        T = biddyZero;
-      } else  {
-        T = BiddyManagedNot(MNG,Fv);
-      }
+Biddy_Edge
+Biddy_Managed_AndBF(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
+{
+  Biddy_Edge r;
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+  assert( f != NULL );
+  assert( g != NULL );
 
-      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_AndBF");
 
-    } else {
+  assert( BiddyIsOK(f) == TRUE );
+  assert( BiddyIsOK(g) == TRUE );
 
-      /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-      BiddyRefresh(r);
+  biddyNodeTable.funandor++;
 
-    }
+  r = biddyNull;
 
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndBF(MNG,f,g);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndBF(MNG,f,g);
   }
-
 #ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndBF(MNG,f,g);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndBF(MNG,f,g);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedAndBF(MNG,f,g);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_AndBF: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_AndBF: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_AndBF: Unsupported BDD type!\n");
+    return biddyNull;
+  }
+#endif
 
-    /* FOR ZBDD AND ZBDDC, RECURSIVE CALLS ARE VIA 'XOR' AND THUS ITS CACHE TABLE IS USED */
+  return r;
+}
 
-    v = BiddyV(biddyOne); /* biddyOne includes all variables */
+#ifdef __cplusplus
+}
+#endif
 
-    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-    if (BiddyV(f) == v) {
-      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      Fv = BiddyT(f);
-    } else {
-      Fneg_v = f;
-      Fv = biddyZero;
-    }
-    Gneg_v = BiddyE(biddyOne); /* biddyOne does not have complement */
-    Gv = BiddyT(biddyOne);
+/***************************************************************************//*!
+\brief Function Biddy_Managed_CreateRelation creates a partitioned
+       transition relation.
 
-    /* RECURSIVE CALLS */
-    if (Fneg_v == biddyZero) {
-      E = Gneg_v;
-    } else if (Gneg_v == biddyZero) {
-      E = Fneg_v;
-    } else  {
-      E = BiddyManagedXor(MNG,Fneg_v,Gneg_v);
-    }
-    if (Fv == biddyZero) {
-      T = Gv;
-    } else if (Gv == biddyZero) {
-      T = Fv;
-    } else  {
-      T = BiddyManagedXor(MNG,Fv,Gv);
-    }
+### Description
+    The transition relation is the conjunction of the given partitions.
+    Current state variables cur[i] and next state variables next[i] are
+    given in pairs. Partitions are ordered by a greedy heuristic similar to
+    the one from IWLS95: the next partition is the one which allows
+    quantification of the largest part of its current state variables,
+    ties are broken by the number of next state variables introduced and
+    by the size. Adjacent partitions are conjoined into clusters as long as
+    the number of nodes in a cluster does not exceed clustersize
+    (if clustersize is 0, each partition is a cluster). For each cluster,
+    the variables which do not occur in the remaining clusters are
+    determined, they are quantified immediately after the cluster has been
+    conjoined. Separate schedules are determined for forward image
+    (current state variables are quantified) and backward image (next state
+    variables are quantified).
+### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    Clusters are preserved as persistent formulae (see Biddy_AddFormula),
+    thus partitions do not need to be preserved after this call. Use
+    Biddy_DeleteRelation to remove the relation.
+### More info
+    Macro Biddy_CreateRelation(T,n,cur,next,m,clustersize) is defined for
+    use with anonymous manager.
+*******************************************************************************/
 
-    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
-    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+#ifdef __cplusplus
+extern "C" {
+#endif
 
+Biddy_Relation
+Biddy_Managed_CreateRelation(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n,
+                             Biddy_Variable *cur, Biddy_Variable *next,
+                             unsigned int m, unsigned int clustersize)
+{
+  Biddy_Relation r;
+
+  assert( (n == 0) || (T != NULL) );
+  assert( (m == 0) || ((cur != NULL) && (next != NULL)) );
+
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_CreateRelation");
+
+  r = NULL;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedCreateRelation(MNG,T,n,cur,next,m,clustersize);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedCreateRelation(MNG,T,n,cur,next,m,clustersize);
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedCreateRelation(MNG,T,n,cur,next,m,clustersize);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedCreateRelation(MNG,T,n,cur,next,m,clustersize);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedCreateRelation(MNG,T,n,cur,next,m,clustersize);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_CreateRelation: this BDD type is not supported, yet!\n");
+    return NULL;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_CreateRelation: this BDD type is not supported, yet!\n");
+    return NULL;
+  } else {
+    fprintf(stderr,"Biddy_CreateRelation: Unsupported BDD type!\n");
+    return NULL;
   }
+#endif
 
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
+  return r;
+}
 
-    /* FOR TZBDD, 'NOT' USES CACHE TABLE DIRECTLY */
-    /* THIS IS NOT ITE CACHE! */
+#ifdef __cplusplus
+}
+#endif
 
-    FF = f;
-    GG = biddyZero;
-    HH = biddyOne;
+/***************************************************************************//*!
+\brief Function Biddy_Managed_DeleteRelation removes a partitioned
+       transition relation.
 
-    /* IF RESULT IS NOT IN THE CACHE TABLE... */
-    cindex = 0;
-    if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-    {
+### Description
+    Formulae used to preserve clusters are deleted.
+### Side effects
+    Nodes of clusters are removed by the next Biddy_Purge.
+### More info
+    Macro Biddy_DeleteRelation(rel) is defined for use with anonymous
+    manager.
+*******************************************************************************/
 
-      v = BiddyV(f);
-      nt = BiddyGetTag(f);
-      if (!v) {
-        r = biddyZero;
-      } else {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-        /* RECURSIVE CALLS */
-        if (Fneg_v == biddyZero) {
-          E = biddyOne;
-        } else if (Fneg_v == biddyOne) {
-          E = biddyZero;
-        } else  {
-          E = BiddyManagedNot(MNG,Fneg_v);
-        }
-        if (Fv == biddyZero) {
-          T = biddyOne;
-        } else if (Fv == biddyOne) {
-          T = biddyZero;
-        } else  {
-          T = BiddyManagedNot(MNG,Fv);
-        }
+void
+Biddy_Managed_DeleteRelation(Biddy_Manager MNG, Biddy_Relation rel)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_DeleteRelation");
 
-        r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
+  if (rel) BiddyManagedDeleteRelation(MNG,rel);
+}
 
-      while (v != nt) {
-        v = biddyVariableTable.table[v].prev;
-        r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyOne,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
+#ifdef __cplusplus
+}
+#endif
 
-      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+/***************************************************************************//*!
+\brief Function Biddy_Managed_Image calculates the set of states reachable
+       in one step (forward image).
 
-    } else {
+### Description
+    The given relations are treated as a disjunction, i.e. the result is
+    the union of images for all relations. Each image is calculated by
+    conjoining clusters one after another, variables are quantified as
+    early as possible (by using Biddy_ExistAndAbstract). Finally, next
+    state variables are renamed to current state variables.
+    The given set of states must depend on current state variables, only.
+### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    For OBDD, OBDDC, and TZBDD, renaming is done by Biddy_ReplaceByKeyword,
+    thus values of variables are changed (see Biddy_SetVariableValue).
+    For ZBDD and ZBDDC, Biddy_Compose is used.
+### More info
+    Macro Biddy_Image(rel,k,R) is defined for use with anonymous manager.
+*******************************************************************************/
 
-      /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-      BiddyRefresh(r);
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-    }
+Biddy_Edge
+Biddy_Managed_Image(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                    Biddy_Edge R)
+{
+  Biddy_Edge r;
 
+  assert( (k == 0) || (rel != NULL) );
+  assert( R != NULL );
+
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_Image");
+
+  assert( BiddyIsOK(R) == TRUE );
+
+  r = biddyNull;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedImage(MNG,rel,k,R);
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_Image: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_Image: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_Image: Unsupported BDD type!\n");
+    return biddyNull;
   }
 #endif
 
   return r;
 }
 
+#ifdef __cplusplus
+}
+#endif
+
 /***************************************************************************//*!
-\brief Function BiddyManagedITE.
+\brief Function Biddy_Managed_PreImage calculates the set of states from
+       which the given states are reachable in one step (backward image).
 
 ### Description
+    The given relations are treated as a disjunction. Current state
+    variables in the given set are renamed to next state variables, then
+    clusters are conjoined one after another and next state variables are
+    quantified as early as possible (by using Biddy_ExistAndAbstract).
+    The given set of states must depend on current state variables, only.
 ### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    For OBDD, OBDDC, and TZBDD, renaming is done by Biddy_ReplaceByKeyword,
+    thus values of variables are changed (see Biddy_SetVariableValue).
+    For ZBDD and ZBDDC, Biddy_Compose is used.
 ### More info
-    See Biddy_Managed_ITE.
+    Macro Biddy_PreImage(rel,k,R) is defined for use with anonymous manager.
 *******************************************************************************/
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 Biddy_Edge
-BiddyManagedITE(const Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
+Biddy_Managed_PreImage(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                       Biddy_Edge R)
 {
-  Biddy_Edge r, T, E, Fv, Gv, Hv, Fneg_v, Gneg_v, Hneg_v;
-  Biddy_Edge FF, GG, HH;
-  Biddy_Boolean NN;
-  Biddy_Variable v,rtag;
-  unsigned cindex;
+  Biddy_Edge r;
+
+  assert( (k == 0) || (rel != NULL) );
+  assert( R != NULL );
+
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_PreImage");
+
+  assert( BiddyIsOK(R) == TRUE );
 
-  static Biddy_Variable topF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topH;    /* CAN BE STATIC, WHAT IS BETTER? */
+  r = biddyNull;
 
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedPreImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedPreImage(MNG,rel,k,R);
+  }
 #ifndef COMPACT
-  static Biddy_Variable tagF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagH;    /* CAN BE STATIC, WHAT IS BETTER? */
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedPreImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedPreImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedPreImage(MNG,rel,k,R);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_PreImage: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_PreImage: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_PreImage: Unsupported BDD type!\n");
+    return biddyNull;
+  }
 #endif
 
-  /* DEBUGGING */
-  /*
-  static int mm = 0;
-  int nn;
-  nn = ++mm;
-  printf("BiddyManagedITE (%d) F\n",nn);
-  BiddyManagedPrintfBDD(MNG,f);
-  printf("\n");
-  printf("BiddyManagedITE (%d) G\n",nn);
-  BiddyManagedPrintfBDD(MNG,g);
-  printf("\n");
-  printf("BiddyManagedITE (%d) H\n",nn);
-  BiddyManagedPrintfBDD(MNG,h);
-  printf("\n");
-  mm = nn;
-  */
+  return r;
+}
 
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-  assert( h != NULL );
+#ifdef __cplusplus
+}
+#endif
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+/***************************************************************************//*!
+\brief Function Biddy_Managed_Reachable calculates the set of states
+       reachable from the given initial states.
+
+### Description
+    Breadth-first traversal: in each step, the forward image of the states
+    reached in the previous step (the frontier) is calculated by using
+    Biddy_Image. Only new states form the next frontier. The calculation
+    stops if there are no new states. If target is not NULL, the
+    calculation stops as soon as some state from the target set is reached.
+    If steps is not NULL, the number of calculated images is returned in it.
+### Side effects
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    Biddy_Clean is called after each step, thus all formulae which are not
+    preserved become obsolete. The initial states, the target states, and
+    the result are preserved until the next call to Biddy_Clean.
+### More info
+    Macro Biddy_Reachable(rel,k,I,target,steps) is defined for use with
+    anonymous manager.
+*******************************************************************************/
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.iterecursive++;
+#ifdef __cplusplus
+extern "C" {
 #endif
 
-  r = biddyNull;
+Biddy_Edge
+Biddy_Managed_Reachable(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                        Biddy_Edge I, Biddy_Edge target, unsigned int *steps)
+{
+  Biddy_Edge r;
 
-  /* LOOKING FOR SIMPLE CASE */
-  /* using Not/Leq and returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
-  /* because top variable of the result may be lower (topmore) than top variables of the arguments */
-  /* (i.e. because the result depends on domain) */
+  assert( (k == 0) || (rel != NULL) );
+  assert( I != NULL );
 
-  if (f == biddyOne) {
-    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-    return g;
-  } else if (f == biddyZero) {
-    BiddyRefresh(h); /* return non-obsolete node even if the parameter is an obsolete node */
-    return h;
-  } else if (g == biddyOne) {
-    if (h == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      return biddyOne;
-    } else if (h == biddyZero) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
-    } else {
-      return BiddyManagedOr(MNG,f,h);
-    }
-  } else if (g == biddyZero) {
-    if (h == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      return BiddyManagedNot(MNG,f);
-    } else if (h == biddyZero) {
-      return biddyZero;
-    } else {
-      return BiddyManagedGt(MNG,h,f);
-    }
-  } else if (h == biddyOne) {
-    if ((biddyManagerType != BIDDYTYPEZBDDC) && (biddyManagerType != BIDDYTYPEZBDD)) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      /* FOR ZBDD AND ZBDDC ITE CANNOT BE RESOLVED BY LEQ, BECAUSE LEQ IS RESOLVED BY ITE */
-      return BiddyManagedLeq(MNG,f,g);
-    }
-  } else if (h == biddyZero) {
-    return BiddyManagedAnd(MNG,f,g);
-  } else if (g == h) {
-    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-    return g;
-  } else if (f == g) {
-    return BiddyManagedOr(MNG,f,h);
-  } else if (f == h) {
-    return BiddyManagedAnd(MNG,f,g);
-  }
-
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyIsEqvPointer(g,h)) {
-      return BiddyManagedXor(MNG,f,h);
-    } else if (BiddyIsEqvPointer(f,g)) {
-      return BiddyManagedAnd(MNG,g,h);
-    } else if (BiddyIsEqvPointer(f,h)) {
-      return BiddyManagedOr(MNG,g,h);
-    }
-  }
-
-  /* THIS IS NOT A SIMPLE CASE */
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_Reachable");
 
-  FF = GG = HH = biddyNull;
-  NN = FALSE;
-  Fneg_v = Fv = biddyNull;
-  Gneg_v = Gv = biddyNull;
-  Hneg_v = Hv = biddyNull;
-  rtag = 0;
-  v = 0;
+  assert( BiddyIsOK(I) == TRUE );
 
-  /* NORMALIZATION OF COMPLEMENTED EDGES */
-  /* APLICABLE ONLY TO OBDDC */
-  /* FF, GG, HH, and NN ARE USED FOR CACHE LOOKUP, ONLY */
+  r = biddyNull;
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyGetMark(f)) {
-      if (BiddyGetMark(h)) {
-        NN = TRUE;
-        FF = BiddyInv(f);
-        GG = BiddyInv(h);
-        HH = BiddyInv(g);
-      } else {
-        FF = BiddyInv(f);
-        GG = h;
-        HH = g;
-      }
-    } else if (BiddyGetMark(g)) {
-      NN = TRUE;
-      FF = f;
-      GG = BiddyInv(g);
-      HH = BiddyInv(h);
-    } else {
-      FF = f;
-      GG = g;
-      HH = h;
-    }
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedReachable(MNG,rel,k,I,target,steps);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedReachable(MNG,rel,k,I,target,steps);
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedReachable(MNG,rel,k,I,target,steps);
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedReachable(MNG,rel,k,I,target,steps);
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedReachable(MNG,rel,k,I,target,steps);
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_Reachable: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_Reachable: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_Reachable: Unsupported BDD type!\n");
+    return biddyNull;
   }
+#endif
 
-  else {
+  return r;
+}
 
-    /* IF NOT OBDDC THEN ITE CACHE IS NOT SHARED WITH OTHER OPERATIONS! */
+#ifdef __cplusplus
+}
+#endif
 
-    FF = f;
-    GG = g;
-    HH = h;
-  }
+/***************************************************************************//*!
+\brief Function Biddy_Managed_Saturate calculates the set of states
+       reachable from the given initial states by using saturation.
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-  {
+### Description
+    The transition relation is given as a list of events, i.e. the
+    system is asynchronous and in each step one of the events is fired.
+    Current state variables cur[i] and next state variables next[i] are
+    given in pairs. A state variable is changed by the event if its next
+    state variable occurs in the relation of the event, all other state
+    variables are not changed (they do not need to be constrained by the
+    relation). Variables which are neither current nor next state
+    variables are treated as inputs and they are quantified. Each event
+    belongs to the level of its topmost state variable. Nodes are
+    saturated bottom-up: after the successors of a node on the given level
+    have been saturated, events on this level are fired until there are no
+    new states. Saturated nodes are cached in a separate cache, which
+    is used in one call, only.
+### Side effects
+    Implemented for OBDD and OBDDC.
+    Renaming is done by Biddy_ReplaceByKeyword, thus values of variables
+    are changed (see Biddy_SetVariableValue).
+    Intermediate results are not preserved, they are removed by the next
+    GC after Biddy_Clean.
+### More info
+    Macro Biddy_Saturate(T,n,cur,next,m,I) is defined for use with anonymous
+    manager.
+*******************************************************************************/
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      topH = BiddyV(h);
+Biddy_Edge
+Biddy_Managed_Saturate(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n,
+                       Biddy_Variable *cur, Biddy_Variable *next,
+                       unsigned int m, Biddy_Edge I)
+{
+  Biddy_Edge r;
 
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
-        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
-      } else {
-        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
-      }
+  assert( (n == 0) || (T != NULL) );
+  assert( (m == 0) || ((cur != NULL) && (next != NULL)) );
+  assert( I != NULL );
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-      } else {
-        Gneg_v = Gv = g;
-      }
-      if (topH == v) {
-        Hneg_v = BiddyInvCond(BiddyE(h),BiddyGetMark(h));
-        Hv = BiddyInvCond(BiddyT(h),BiddyGetMark(h));
-      } else {
-        Hneg_v = Hv = h;
-      }
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_Saturate");
 
-      rtag = v;
+  assert( BiddyIsOK(I) == TRUE );
 
-    }
+  r = biddyNull;
 
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedSaturate(MNG,T,n,cur,next,m,I);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedSaturate(MNG,T,n,cur,next,m,I);
+  }
 #ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+  else if ((biddyManagerType == BIDDYTYPEZBDD) || (biddyManagerType == BIDDYTYPEZBDDC) ||
+           (biddyManagerType == BIDDYTYPETZBDD) || (biddyManagerType == BIDDYTYPETZBDDC))
+  {
+    fprintf(stderr,"Biddy_Saturate: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_Saturate: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_Saturate: Unsupported BDD type!\n");
+    return biddyNull;
+  }
+#endif
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      topH = BiddyV(h);
+  return r;
+}
 
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
-        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
-      } else {
-        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
-      }
+#ifdef __cplusplus
+}
+#endif
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fv = biddyZero;
-        Fneg_v = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gv = biddyZero;
-        Gneg_v = g;
-      }
-      if (topH == v) {
-        Hneg_v = BiddyInvCond(BiddyE(h),BiddyGetMark(h));
-        Hv = BiddyT(h);
-      } else {
-        Hv = biddyZero;
-        Hneg_v = h;
-      }
+/***************************************************************************//*!
+\brief Function Biddy_Managed_VectorCompose calculates a simultaneous
+       substitution of Boolean functions for variables.
 
-      rtag = v;
+### Description
+    Each variable v[i] in f is replaced by function g[i]. All substitutions
+    are done simultaneously in one recursive pass, i.e. variables occurring
+    in the given functions are not substituted again. Variables which are
+    not given in the vector are not changed. If a variable is given more
+    than once, the last function is used. Intermediate results are cached
+    in Replace cache with a new key for each call.
+### Side effects
+    Original BDD is not changed.
+    Implemented for OBDD and OBDDC.
+### More info
+    Macro Biddy_VectorCompose(f,v,g,n) is defined for use with anonymous
+    manager.
+*******************************************************************************/
 
-    }
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
+Biddy_Edge
+Biddy_Managed_VectorCompose(Biddy_Manager MNG, Biddy_Edge f,
+                            Biddy_Variable *v, Biddy_Edge *g, unsigned int n)
+{
+  Biddy_Edge r;
 
-      /* LOOKING FOR THE SMALLEST TAG AND THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      tagF = BiddyGetTag(f);
-      tagG = BiddyGetTag(g);
-      tagH = BiddyGetTag(h);
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      topH = BiddyV(h);
+  assert( f != NULL );
+  assert( (n == 0) || ((v != NULL) && (g != NULL)) );
 
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
-        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagH) ? tagF : tagH;
-      } else {
-        rtag = BiddyIsSmaller(biddyOrderingTable,tagH,tagG) ? tagH : tagG;
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
-        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
-      } else {
-        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
-      }
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_VectorCompose");
 
-      if ((tagF != tagG) || (tagF != tagH)) v = rtag;
+  assert( BiddyIsOK(f) == TRUE );
 
-      if (tagF == rtag) {
-        if (topF == v) {
-          Fneg_v = BiddyE(f);
-          Fv = BiddyT(f);
-        } else {
-          Fneg_v = f;
-          BiddySetTag(Fneg_v,v);
-          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-          Fv = biddyZero;
-        }
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (tagG == rtag) {
-        if (topG == v) {
-          Gneg_v = BiddyE(g);
-          Gv = BiddyT(g);
-        } else {
-          Gneg_v = g;
-          BiddySetTag(Gneg_v,v);
-          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-          Gv = biddyZero;
-        }
-      } else {
-        Gneg_v = Gv = g;
-      }
-      if (tagH == rtag) {
-        if (topH == v) {
-          Hneg_v = BiddyE(h);
-          Hv = BiddyT(h);
-        } else {
-          Hneg_v = h;
-          BiddySetTag(Hneg_v,v);
-          Hneg_v = BiddyManagedIncTag(MNG,Hneg_v);
-          Hv = biddyZero;
-        }
-      } else {
-        Hneg_v = Hv = h;
-      }
+  r = biddyNull;
 
-    }
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedVectorCompose(MNG,f,v,g,n);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedVectorCompose */
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedVectorCompose(MNG,f,v,g,n);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedVectorCompose */
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDD) || (biddyManagerType == BIDDYTYPEZBDDC) ||
+           (biddyManagerType == BIDDYTYPETZBDD) || (biddyManagerType == BIDDYTYPETZBDDC))
+  {
+    fprintf(stderr,"Biddy_VectorCompose: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_VectorCompose: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_VectorCompose: Unsupported BDD type!\n");
+    return biddyNull;
+  }
 #endif
 
-    /* RECURSIVE CALLS */
-    if (Fneg_v == biddyOne) {
-      E = Gneg_v;
-    } else if (Fneg_v == biddyZero) {
-      E = Hneg_v;
-    } else if (Gneg_v == Hneg_v) {
-      E = Gneg_v;
-    } else {
-      E = BiddyManagedITE(MNG,Fneg_v,Gneg_v,Hneg_v);
-    }
-    if (Fv == biddyOne) {
-      T = Gv;
-    } else if (Fv == biddyZero) {
-      T = Hv;
-    } else if (Gv == Hv) {
-      T = Gv;
-    } else {
-      T = BiddyManagedITE(MNG,Fv,Gv,Hv);
-    }
+  return r;
+}
 
-    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
-    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+#ifdef __cplusplus
+}
+#endif
 
-    /* CACHE EVERYTHING */
-    if (NN) {
-      addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),cindex);
-    } else {
-      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
-    }
+/***************************************************************************//*!
+\brief Function Biddy_Managed_RestrictCube calculates a cofactor of Boolean
+       function with respect to the given cube.
 
-    /* DEBUGGING */
-    /*
-    printf("ITE has not used cache\n");
-    */
+### Description
+    The cube is a product of literals, i.e. a conjunction of variables and
+    their negations. The result is the same as if Biddy_Restrict were called
+    for each literal in the cube but the cofactor is calculated in a single
+    traversal of the graph. Variables from the cube do not occur in the
+    result. If the given function is not a product of literals then
+    biddyNull is returned.
+### Side effects
+    Original BDD is not changed.
+    Implemented for OBDD, OBDDC, ZBDD, ZBDDC, and TZBDD.
+    Results are cached in RC cache.
+### More info
+    Macro Biddy_RestrictCube(f,cube) is defined for use with anonymous
+    manager.
+*******************************************************************************/
 
-  } else {
+#ifdef __cplusplus
+extern "C" {
+#endif
 
-    if (NN) {
-      BiddyInvertMark(r);
-    }
+Biddy_Edge
+Biddy_Managed_RestrictCube(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
+{
+  Biddy_Edge r;
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  assert( f != NULL );
+  assert( cube != NULL );
 
-  }
+  if (!MNG) MNG = biddyAnonymousManager;
+  ZF_LOGI("Biddy_RestrictCube");
 
-  /* DEBUGGING */
-  /*
-  printf("BiddyManagedITE: (%d) result\n",nn);
-  BiddyManagedPrintfBDD(MNG,r);
-  */
+  assert( BiddyIsOK(f) == TRUE );
+  assert( BiddyIsOK(cube) == TRUE );
+
+  r = biddyNull;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedRestrictCube(MNG,f,cube);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedRestrictCube */
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedRestrictCube(MNG,f,cube);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedRestrictCube */
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedRestrictCube(MNG,f,cube);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedRestrictCube */
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+    r = BiddyManagedRestrictCube(MNG,f,cube);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedRestrictCube */
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+    r = BiddyManagedRestrictCube(MNG,f,cube);
+    /* BiddyRefresh(r); */ /* TESTING */ /* not always refreshed by BiddyManagedRestrictCube */
+  } else if (biddyManagerType == BIDDYTYPETZBDDC)
+  {
+    fprintf(stderr,"Biddy_RestrictCube: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else if ((biddyManagerType == BIDDYTYPEOFDDC) || (biddyManagerType == BIDDYTYPEOFDD) ||
+              (biddyManagerType == BIDDYTYPEZFDDC) || (biddyManagerType == BIDDYTYPEZFDD) ||
+              (biddyManagerType == BIDDYTYPETZFDDC) || (biddyManagerType == BIDDYTYPETZFDD))
+  {
+    fprintf(stderr,"Biddy_RestrictCube: this BDD type is not supported, yet!\n");
+    return biddyNull;
+  } else {
+    fprintf(stderr,"Biddy_RestrictCube: Unsupported BDD type!\n");
+    return biddyNull;
+  }
+#endif
 
   return r;
 }
 
+#ifdef __cplusplus
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+/* Definition of internal functions used to implement external functions      */
+/*----------------------------------------------------------------------------*/
+
 /***************************************************************************//*!
-\brief Function BiddyManagedAnd.
+\brief Function BiddyManagedNot.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_And.
+    See Biddy_Managed_Not.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedAnd(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
+BiddyManagedNot(const Biddy_Manager MNG, const Biddy_Edge f)
 {
-  Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Edge r, T, E, Fv, Fneg_v;
   Biddy_Edge FF, GG, HH;
-  Biddy_Boolean NN;
-  Biddy_Variable v,rtag;
+  Biddy_Variable v;
   unsigned int cindex;
 
-  static Biddy_Variable topF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG;    /* CAN BE STATIC, WHAT IS BETTER? */
-
 #ifndef COMPACT
-  static Biddy_Variable tagF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG;    /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Edge Gv, Gneg_v;
+  Biddy_Variable nt;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( g != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -4126,368 +4441,242 @@ BiddyManagedAnd(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.andorrecursive++;
-#endif
+  if ((biddyManagerType == BIDDYTYPEOBDD) && BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYNOT,f,biddyNull,biddyNull);
+  }
+
+  r = biddyNull;
 
   /* LOOKING FOR SIMPLE CASE */
-  if (f == biddyZero) {
-    return biddyZero;
-  } else if (g == biddyZero) {
-    return biddyZero;
-  } else if (f == biddyOne) {
-    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-    return g;
-  } else if (g == biddyOne) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  } else if (f == g) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  }
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyIsEqvPointer(f,g)) {
-      return biddyZero;
-    }
+  if (f == biddyZero) {
+    return biddyOne;
   }
-
-#ifndef COMPACT
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (BiddyR(f) == BiddyR(g)) {
-      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
-      } else {
-        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-        return g;
-      }
-    }
+  if (f == biddyOne) {
+    return biddyZero;
   }
-#endif
 
   /* THIS IS NOT A SIMPLE CASE */
 
   FF = GG = HH = biddyNull;
-  NN = FALSE;
   Fneg_v = Fv = biddyNull;
+
+#ifndef COMPACT
   Gneg_v = Gv = biddyNull;
-  rtag = 0;
-  v = 0;
+#endif
 
-  /* NORMALIZATION OF COMPLEMENTED EDGES */
-  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
-  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
-  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
+  v = 0;
 
   if (biddyManagerType == BIDDYTYPEOBDDC) {
 
-    if (((uintptr_t) f) > ((uintptr_t) g)) {
-      if (BiddyGetMark(f)) {
-        NN = TRUE;
-        FF = BiddyInv(f);
-        GG = biddyOne; /* BiddyInv(h) */
-        HH = BiddyInv(g);
-      } else {
-        if (BiddyGetMark(g)) {
-          NN = TRUE;
-          FF = f;
-          GG = BiddyInv(g);
-          HH = biddyOne; /* BiddyInv(h) */
-        } else {
-          FF = f;
-          GG = g;
-          HH = biddyZero; /* h */
-        }
-      }
-    } else {
-      if (BiddyGetMark(g)) {
-        NN = TRUE;
-        FF = BiddyInv(g);
-        GG = biddyOne; /* BiddyInv(h) */
-        HH = BiddyInv(f);
-      } else {
-        if (BiddyGetMark(f)) {
-          NN = TRUE;
-          FF = g;
-          GG = BiddyInv(f);
-          HH = biddyOne; /* BiddyInv(h) */
-        } else {
-          FF = g;
-          GG = f;
-          HH = biddyZero; /* h */
-        }
-      }
-    }
+    /* FOR OBDDC, CACHE TABLE IS NOT NEEDED */
+
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    r = BiddyInv(f);
 
   }
 
-  else {
+  else if (biddyManagerType == BIDDYTYPEOBDD) {
 
+    /* FOR OBDD, 'NOT' USES CACHE TABLE DIRECTLY */
     /* THIS IS NOT ITE CACHE! */
 
-    if (((uintptr_t) f) > ((uintptr_t) g)) {
-      FF = f;
-      GG = g;
-      HH = biddyZero;
-    } else {
-      FF = g;
-      GG = f;
-      HH = biddyZero;
-    }
-
-  }
-
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  /* FOR ZBDDs, NOT EVERYTHING IS CACHED */
-  cindex = 0;
-  if ((((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) &&
-       ((topF = BiddyV(f)) != (topG = BiddyV(g)))
-      ) || !findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-  {
-
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    FF = f;
+    GG = biddyZero;
+    HH = biddyOne;
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+    /* IF RESULT IS NOT IN THE CACHE TABLE... */
+    cindex = 0;
+    if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+    {
 
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      v = BiddyV(f);
+      Fneg_v = BiddyE(f);
+      Fv = BiddyT(f);
 
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
+      /* RECURSIVE CALLS */
+      if (Fneg_v == biddyZero) {
+        E = biddyOne;
+      } else if (Fneg_v == biddyOne) {
+        E = biddyZero;
+      } else  {
+        E = BiddyManagedNot(MNG,Fneg_v);
       }
-
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-      } else {
-        Gneg_v = Gv = g;
+      if (Fv == biddyZero) {
+        T = biddyOne;
+      } else if (Fv == biddyOne) {
+        T = biddyZero;
+      } else  {
+        T = BiddyManagedNot(MNG,Fv);
       }
 
-      rtag = v;
-
-    }
-
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      /* FOR ZBDD, topF AND topG HAVE BEEN ALREADY CALCULATED */
-      /* topF = BiddyV(f); */ /* ALREADY CALCULATED */
-      /* topG = BiddyV(g); */ /* ALREADY CALCULATED */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-      /* THIS CALL IS NOT INTRODUCING NEW NODES */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      /* IT SEEMS THAT CACHING THIS RESULTS IS NOT A GOOD IDEA */
-      if (topF != topG) {
-        if (topF == v) {
-          r = BiddyManagedAnd(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),g);
-          return r;
-        } else {
-          r = BiddyManagedAnd(MNG,f,BiddyInvCond(BiddyE(g),BiddyGetMark(g)));
-          return r;
-        }
-      }
+      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS, topF == topG */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      Fv = BiddyT(f);
-      Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-      Gv = BiddyT(g);
+    } else {
 
-      rtag = v;
+      /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+      BiddyRefresh(r);
 
     }
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
-
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      tagF = BiddyGetTag(f);
-      tagG = BiddyGetTag(g);
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  }
 
-      /* VARIANT 1 */
-      /*
-      if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = Gv = g;
-      } else if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
-        Fneg_v = Fv = f;
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else {
-        if (topF == v) {
-          Fneg_v = BiddyE(f);
-          Fv = BiddyT(f);
-        } else {
-          Fneg_v = f;
-          BiddySetTag(Fneg_v,v);
-          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-          Fv = biddyZero;
-        }
-        if (topG == v) {
-          Gneg_v = BiddyE(g);
-          Gv = BiddyT(g);
-        } else {
-          Gneg_v = g;
-          BiddySetTag(Gneg_v,v);
-          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-          Gv = biddyZero;
-        }
-      }
-      */
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
 
-      /* VARIANT 2 */
-      /*
-      if (topF == v) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-      } else {
-        if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
-          Fneg_v = Fv = f;
-        } else {
-          Fneg_v = f;
-          BiddySetTag(Fneg_v,v);
-          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-          Fv = biddyZero;
-        }
-      }
-      if (topG == v) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else {
-        if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
-          Gneg_v = Gv = g;
-        } else {
-          Gneg_v = g;
-          BiddySetTag(Gneg_v,v);
-          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-          Gv = biddyZero;
-        }
-      }
-      */
+    /* FOR ZBDD AND ZBDDC, RECURSIVE CALLS ARE VIA 'XOR' AND THUS ITS CACHE TABLE IS USED */
 
-      /* VARIANT 3 */
-      /**/
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
-        Fneg_v = Fv = f;
-      } else if (v == topF) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
-        Gneg_v = Gv = g;
-      } else if (v == topG) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = biddyZero;
-      }
-      /**/
+    v = BiddyV(biddyOne); /* biddyOne includes all variables */
 
+    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+    if (BiddyV(f) == v) {
+      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      Fv = BiddyT(f);
+    } else {
+      Fneg_v = f;
+      Fv = biddyZero;
     }
-#endif
+    Gneg_v = BiddyE(biddyOne); /* biddyOne does not have complement */
+    Gv = BiddyT(biddyOne);
 
     /* RECURSIVE CALLS */
     if (Fneg_v == biddyZero) {
-      E = biddyZero;
-    } else if (Gneg_v == biddyZero) {
-      E = biddyZero;
-    } else if (Fneg_v == biddyOne) {
       E = Gneg_v;
-    } else if (Gneg_v == biddyOne) {
+    } else if (Gneg_v == biddyZero) {
       E = Fneg_v;
     } else  {
-      E = BiddyManagedAnd(MNG,Fneg_v,Gneg_v);
+      E = BiddyManagedXor(MNG,Fneg_v,Gneg_v);
     }
     if (Fv == biddyZero) {
-      T = biddyZero;
-    } else if (Gv == biddyZero) {
-      T = biddyZero;
-    } else if (Fv == biddyOne) {
       T = Gv;
-    } else if (Gv == biddyOne) {
+    } else if (Gv == biddyZero) {
       T = Fv;
     } else  {
-      T = BiddyManagedAnd(MNG,Fv,Gv);
+      T = BiddyManagedXor(MNG,Fv,Gv);
     }
 
-    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
+    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
     BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-    if (NN) {
-      addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),cindex);
-    } else {
-      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
-    }
-
-  } else {
-
-    if (NN) {
-      BiddyInvertMark(r);
-    }
-
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
-
   }
 
-  return r;
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-}
+    /* FOR TZBDD, 'NOT' USES CACHE TABLE DIRECTLY */
+    /* THIS IS NOT ITE CACHE! */
 
-/***************************************************************************//*!
-\brief Function BiddyManagedOr.
+    FF = f;
+    GG = biddyZero;
+    HH = biddyOne;
 
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_Or.
-*******************************************************************************/
+    /* IF RESULT IS NOT IN THE CACHE TABLE... */
+    cindex = 0;
+    if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+    {
 
-Biddy_Edge
-BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
+      v = BiddyV(f);
+      nt = BiddyGetTag(f);
+      if (!v) {
+        r = biddyZero;
+      } else {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+
+        /* RECURSIVE CALLS */
+        if (Fneg_v == biddyZero) {
+          E = biddyOne;
+        } else if (Fneg_v == biddyOne) {
+          E = biddyZero;
+        } else  {
+          E = BiddyManagedNot(MNG,Fneg_v);
+        }
+        if (Fv == biddyZero) {
+          T = biddyOne;
+        } else if (Fv == biddyOne) {
+          T = biddyZero;
+        } else  {
+          T = BiddyManagedNot(MNG,Fv);
+        }
+
+        r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+
+      while (v != nt) {
+        v = biddyVariableTable.table[v].prev;
+        r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyOne,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+
+      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+
+    } else {
+
+      /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+      BiddyRefresh(r);
+
+    }
+
+  }
+#endif
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedITE.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_ITE.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedITE(const Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
 {
-  Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Edge r, T, E, Fv, Gv, Hv, Fneg_v, Gneg_v, Hneg_v;
   Biddy_Edge FF, GG, HH;
   Biddy_Boolean NN;
   Biddy_Variable v,rtag;
-  unsigned int cindex;
+  unsigned cindex;
 
-  static Biddy_Variable topF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG;    /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable topF;
+  Biddy_Variable topG;
+  Biddy_Variable topH;
 
 #ifndef COMPACT
-  static Biddy_Variable tagF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG;    /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
+  Biddy_Variable tagH;
 #endif
 
+  /* DEBUGGING */
+  /*
+  static int mm = 0;
+  int nn;
+  nn = ++mm;
+  printf("BiddyManagedITE (%d) F\n",nn);
+  BiddyManagedPrintfBDD(MNG,f);
+  printf("\n");
+  printf("BiddyManagedITE (%d) G\n",nn);
+  BiddyManagedPrintfBDD(MNG,g);
+  printf("\n");
+  printf("BiddyManagedITE (%d) H\n",nn);
+  BiddyManagedPrintfBDD(MNG,h);
+  printf("\n");
+  mm = nn;
+  */
+
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
+  assert( h != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -4498,53 +4687,70 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.andorrecursive++;
-#endif
+  if (BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYITE,f,g,h);
+  }
+
+  if (biddyNodeTable.extendedstats) biddyNodeTable.iterecursive++;
 
   r = biddyNull;
 
   /* LOOKING FOR SIMPLE CASE */
-  /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
+  /* using Not/Leq and returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
   /* because top variable of the result may be lower (topmore) than top variables of the arguments */
   /* (i.e. because the result depends on domain) */
 
-  if (f == biddyZero) {
+  if (f == biddyOne) {
     BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
     return g;
-  } else if (g == biddyZero) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  } else if (f == biddyOne) {
-    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-    return biddyOne;
+  } else if (f == biddyZero) {
+    BiddyRefresh(h); /* return non-obsolete node even if the parameter is an obsolete node */
+    return h;
   } else if (g == biddyOne) {
-    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-    return biddyOne;
-  } else if (f == g) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  }
-
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyIsEqvPointer(f,g)) {
+    if (h == biddyOne) {
+      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
       return biddyOne;
+    } else if (h == biddyZero) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    } else {
+      return BiddyManagedOr(MNG,f,h);
+    }
+  } else if (g == biddyZero) {
+    if (h == biddyOne) {
+      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+      return BiddyManagedNot(MNG,f);
+    } else if (h == biddyZero) {
+      return biddyZero;
+    } else {
+      return BiddyManagedGt(MNG,h,f);
+    }
+  } else if (h == biddyOne) {
+    if ((biddyManagerType != BIDDYTYPEZBDDC) && (biddyManagerType != BIDDYTYPEZBDD)) {
+      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+      /* FOR ZBDD AND ZBDDC ITE CANNOT BE RESOLVED BY LEQ, BECAUSE LEQ IS RESOLVED BY ITE */
+      return BiddyManagedLeq(MNG,f,g);
     }
+  } else if (h == biddyZero) {
+    return BiddyManagedAnd(MNG,f,g);
+  } else if (g == h) {
+    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+    return g;
+  } else if (f == g) {
+    return BiddyManagedOr(MNG,f,h);
+  } else if (f == h) {
+    return BiddyManagedAnd(MNG,f,g);
   }
 
-#ifndef COMPACT
-  if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (BiddyR(f) == BiddyR(g)) {
-      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
-        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-        return g;
-      } else {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
-      }
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyIsEqvPointer(g,h)) {
+      return BiddyManagedXor(MNG,f,h);
+    } else if (BiddyIsEqvPointer(f,g)) {
+      return BiddyManagedAnd(MNG,g,h);
+    } else if (BiddyIsEqvPointer(f,h)) {
+      return BiddyManagedOr(MNG,g,h);
     }
   }
-#endif
 
   /* THIS IS NOT A SIMPLE CASE */
 
@@ -4552,67 +4758,45 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
   NN = FALSE;
   Fneg_v = Fv = biddyNull;
   Gneg_v = Gv = biddyNull;
+  Hneg_v = Hv = biddyNull;
   rtag = 0;
   v = 0;
 
   /* NORMALIZATION OF COMPLEMENTED EDGES */
-  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
-  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
-  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
+  /* APLICABLE ONLY TO OBDDC */
+  /* FF, GG, HH, and NN ARE USED FOR CACHE LOOKUP, ONLY */
 
   if (biddyManagerType == BIDDYTYPEOBDDC) {
-
-    if (((uintptr_t) f) > ((uintptr_t) g)) {
-      if (BiddyGetMark(f)) {
-        if (BiddyGetMark(g)) {
-          NN = TRUE;
-          FF = BiddyInv(f);
-          GG = BiddyInv(g);
-          HH = biddyZero;  /* BiddyInv(g) */
-        } else {
-          FF = BiddyInv(f);
-          GG = g;
-          HH = biddyOne; /* g */
-        }
+    if (BiddyGetMark(f)) {
+      if (BiddyGetMark(h)) {
+        NN = TRUE;
+        FF = BiddyInv(f);
+        GG = BiddyInv(h);
+        HH = BiddyInv(g);
       } else {
-        FF = f;
-        GG = biddyOne;
+        FF = BiddyInv(f);
+        GG = h;
         HH = g;
       }
+    } else if (BiddyGetMark(g)) {
+      NN = TRUE;
+      FF = f;
+      GG = BiddyInv(g);
+      HH = BiddyInv(h);
     } else {
-      if (BiddyGetMark(g)) {
-        if (BiddyGetMark(f)) {
-          NN = TRUE;
-          FF = BiddyInv(g);
-          GG = BiddyInv(f);
-          HH = biddyZero;  /* BiddyInv(g) */
-        } else {
-          FF = BiddyInv(g);
-          GG = f;
-          HH = biddyOne; /* g */
-        }
-      } else {
-        FF = g;
-        GG = biddyOne;
-        HH = f;
-      }
+      FF = f;
+      GG = g;
+      HH = h;
     }
   }
 
   else {
 
-    /* THIS IS NOT ITE CACHE! */
-
-    if (((uintptr_t) f) > ((uintptr_t) g)) {
-      FF = biddyZero;
-      GG = f;
-      HH = g;
-    } else {
-      FF = biddyZero;
-      GG = g;
-      HH = f;
-    }
+    /* IF NOT OBDDC THEN ITE CACHE IS NOT SHARED WITH OTHER OPERATIONS! */
 
+    FF = f;
+    GG = g;
+    HH = h;
   }
 
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
@@ -4623,26 +4807,36 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
 
       /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
       topF = BiddyV(f);
       topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      topH = BiddyV(h);
+
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
+        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
+      } else {
+        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
+      }
 
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
       if (topF == v) {
         Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
         Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
       } else {
         Fneg_v = Fv = f;
       }
-
       if (topG == v) {
         Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
         Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
       } else {
         Gneg_v = Gv = g;
       }
+      if (topH == v) {
+        Hneg_v = BiddyInvCond(BiddyE(h),BiddyGetMark(h));
+        Hv = BiddyInvCond(BiddyT(h),BiddyGetMark(h));
+      } else {
+        Hneg_v = Hv = h;
+      }
 
       rtag = v;
 
@@ -4652,26 +4846,38 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
 
       /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
       topF = BiddyV(f);
       topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      topH = BiddyV(h);
+
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
+        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
+      } else {
+        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
+      }
 
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
       if (topF == v) {
         Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
         Fv = BiddyT(f);
       } else {
-        Fneg_v = f;
         Fv = biddyZero;
+        Fneg_v = f;
       }
       if (topG == v) {
         Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
         Gv = BiddyT(g);
       } else {
-        Gneg_v = g;
         Gv = biddyZero;
+        Gneg_v = g;
+      }
+      if (topH == v) {
+        Hneg_v = BiddyInvCond(BiddyE(h),BiddyGetMark(h));
+        Hv = BiddyT(h);
+      } else {
+        Hv = biddyZero;
+        Hneg_v = h;
       }
 
       rtag = v;
@@ -4680,78 +4886,29 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-      /* VARIANT 1 */
-      /*
+      /* LOOKING FOR THE SMALLEST TAG AND THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
       tagF = BiddyGetTag(f);
       tagG = BiddyGetTag(g);
-      if (tagF == tagG) {
-        / * THE SAME TAG * /
-        topF = BiddyV(f);
-        topG = BiddyV(g);
-        v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-        rtag = tagF;
-        w = v;
-        if (topF == v) {
-          Fneg_v = BiddyE(f);
-          Fv = BiddyT(f);
-        } else {
-          Fneg_v = f;
-          BiddySetTag(Fneg_v,v);
-          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-          Fv = biddyZero;
-        }
-        if (topG == v) {
-          Gneg_v = BiddyE(g);
-          Gv = BiddyT(g);
-        } else {
-          Gneg_v = g;
-          BiddySetTag(Gneg_v,v);
-          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-          Gv = biddyZero;
-        }
+      tagH = BiddyGetTag(h);
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      topH = BiddyV(h);
+
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
+        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagH) ? tagF : tagH;
       } else {
-        / * DIFFERENT TAG * /
-        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
-        w = rtag;
-        if (tagF == rtag) {
-          if (BiddyV(f) == rtag) {
-            / * TAG AND TOP VARIABLE ARE EQUAL * /
-            Fneg_v = BiddyE(f);
-            Fv = BiddyT(f);
-          } else {
-            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
-            Fneg_v = f;
-            BiddySetTag(Fneg_v,rtag);
-            Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-            Fv = biddyZero;
-          }
-          Gneg_v = Gv = g;
-        } else {
-          if (BiddyV(g) == rtag) {
-            / * TAG AND TOP VARIABLE ARE EQUAL * /
-            Gneg_v = BiddyE(g);
-            Gv = BiddyT(g);
-          } else {
-            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
-            Gneg_v = g;
-            BiddySetTag(Gneg_v,rtag);
-            Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-            Gv = biddyZero;
-          }
-          Fneg_v = Fv = f;
-        }
+        rtag = BiddyIsSmaller(biddyOrderingTable,tagH,tagG) ? tagH : tagG;
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,topF,topG)) {
+        v = BiddyIsSmaller(biddyOrderingTable,topF,topH) ? topF : topH;
+      } else {
+        v = BiddyIsSmaller(biddyOrderingTable,topH,topG) ? topH : topG;
       }
-      */
 
-      /* VARIANT 2 */
-      /**/
-      tagF = BiddyGetTag(f);
-      tagG = BiddyGetTag(g);
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-      if (tagF != tagG) v = rtag;
+      if ((tagF != tagG) || (tagF != tagH)) v = rtag;
+
       if (tagF == rtag) {
         if (topF == v) {
           Fneg_v = BiddyE(f);
@@ -4778,51 +4935,69 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
       } else {
         Gneg_v = Gv = g;
       }
-      /**/
+      if (tagH == rtag) {
+        if (topH == v) {
+          Hneg_v = BiddyE(h);
+          Hv = BiddyT(h);
+        } else {
+          Hneg_v = h;
+          BiddySetTag(Hneg_v,v);
+          Hneg_v = BiddyManagedIncTag(MNG,Hneg_v);
+          Hv = biddyZero;
+        }
+      } else {
+        Hneg_v = Hv = h;
+      }
 
     }
 #endif
 
     /* RECURSIVE CALLS */
-    /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
-    /* because top variable of the result may be lower (topmore) than top variables of the arguments */
-    /* (i.e. because the result depends on domain) */
-    if (Fneg_v == biddyZero) {
-      E = Gneg_v;
-    } else if (Gneg_v == biddyZero) {
-      E = Fneg_v;
-    } else if (Fneg_v == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      E = biddyOne;
-    } else if (Gneg_v == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      E = biddyOne;
-    } else  {
-      E = BiddyManagedOr(MNG,Fneg_v,Gneg_v);
-    }
-    if (Fv == biddyZero) {
-      T = Gv;
-    } else if (Gv == biddyZero) {
-      T = Fv;
-    } else if (Fv == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      T = biddyOne;
-    } else if (Gv == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      T = biddyOne;
-    } else  {
-      T = BiddyManagedOr(MNG,Fv,Gv);
+#ifdef PARALLELAPPLY
+    /* IF BOTH RECURSIVE CALLS ARE NOT TRIVIAL, THE SECOND ONE MAY BE PERFORMED BY ANOTHER THREAD */
+    if (BiddyApplySpawn(MNG) &&
+        !BiddyIsTerminal(Fneg_v) && (Gneg_v != Hneg_v) &&
+        !BiddyIsTerminal(Fv) && (Gv != Hv))
+    {
+      BiddyParallelApply(MNG,BiddyManagedITE,Fneg_v,Gneg_v,Hneg_v,&E,Fv,Gv,Hv,&T);
+    } else
+#endif
+    {
+      if (Fneg_v == biddyOne) {
+        E = Gneg_v;
+      } else if (Fneg_v == biddyZero) {
+        E = Hneg_v;
+      } else if (Gneg_v == Hneg_v) {
+        E = Gneg_v;
+      } else {
+        E = BiddyManagedITE(MNG,Fneg_v,Gneg_v,Hneg_v);
+      }
+      if (Fv == biddyOne) {
+        T = Gv;
+      } else if (Fv == biddyZero) {
+        T = Hv;
+      } else if (Gv == Hv) {
+        T = Gv;
+      } else {
+        T = BiddyManagedITE(MNG,Fv,Gv,Hv);
+      }
     }
 
     r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
     BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
+    /* CACHE EVERYTHING */
     if (NN) {
       addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),cindex);
     } else {
       addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
     }
 
+    /* DEBUGGING */
+    /*
+    printf("ITE has not used cache\n");
+    */
+
   } else {
 
     if (NN) {
@@ -4834,83 +5009,26 @@ BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 
   }
 
-  return r;
-}
-
-/***************************************************************************//*!
-\brief Function BiddyManagedNand.
-
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_Nand.
-*******************************************************************************/
-
-Biddy_Edge
-BiddyManagedNand(const Biddy_Manager MNG, const Biddy_Edge f,
-                 const Biddy_Edge g)
-{
-  Biddy_Edge r;
-
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
-
-  r = biddyNull;
-
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    r = BiddyInv(BiddyManagedAnd(MNG,f,g));
-  }
-
-  return r;
-}
-
-/***************************************************************************//*!
-\brief Function BiddyManagedNor.
-
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_Nor.
-*******************************************************************************/
-
-Biddy_Edge
-BiddyManagedNor(const Biddy_Manager MNG, const Biddy_Edge f,
-                const Biddy_Edge g)
-{
-  Biddy_Edge r;
-
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
-
-  r = biddyNull;
-
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    r = BiddyManagedAnd(MNG,BiddyInv(f),BiddyInv(g));
-  }
+  /* DEBUGGING */
+  /*
+  printf("BiddyManagedITE: (%d) result\n",nn);
+  BiddyManagedPrintfBDD(MNG,r);
+  */
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedXor.
+\brief Function BiddyManagedAnd.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Xor.
+    See Biddy_Managed_And.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
-                const Biddy_Edge g)
+BiddyManagedAnd(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 {
   Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
   Biddy_Edge FF, GG, HH;
@@ -4918,12 +5036,12 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
   Biddy_Variable v,rtag;
   unsigned int cindex;
 
-  static Biddy_Variable topF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG;    /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable topF;
+  Biddy_Variable topG;
 
 #ifndef COMPACT
-  static Biddy_Variable tagF;    /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG;    /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
 #endif
 
   assert( MNG != NULL );
@@ -4939,99 +5057,98 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  biddyNodeTable.xorrecursive++;
-#endif
+  if (BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYAND,f,g,biddyNull);
+  }
 
-  /* LOOKING FOR SIMPLE CASE */
-  /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
-  /* because top variable of the result may be lower (topmore) than top variables of the arguments */
-  /* (i.e. because the result depends on domain) */
+  if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
 
+  /* LOOKING FOR SIMPLE CASE */
   if (f == biddyZero) {
+    return biddyZero;
+  } else if (g == biddyZero) {
+    return biddyZero;
+  } else if (f == biddyOne) {
     BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
     return g;
-  } else if (g == biddyZero) {
+  } else if (g == biddyOne) {
     BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
     return f;
-  } else if (f == biddyOne) {
-    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-    return BiddyManagedNot(MNG,g);
-  } else if (g == biddyOne) {
-    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-    return BiddyManagedNot(MNG,f);
   } else if (f == g) {
-    return biddyZero;
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
   }
 
   if (biddyManagerType == BIDDYTYPEOBDDC) {
     if (BiddyIsEqvPointer(f,g)) {
-      return biddyOne;
+      return biddyZero;
     }
   }
 
-  /* THIS IS NOT A SIMPLE CASE */
-
-  FF = GG = HH = biddyNull;
-  NN = FALSE;
-  Fneg_v = Fv = biddyNull;
-  Gneg_v = Gv = biddyNull;
-  rtag = 0;
-  v = 0;
-
-  /* NORMALIZATION OF COMPLEMENTED EDGES */
-  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
-  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
-  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    if (BiddyR(f) == BiddyR(g)) {
+      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      }
+    }
+  }
+#endif
+
+  /* THIS IS NOT A SIMPLE CASE */
+
+  FF = GG = HH = biddyNull;
+  NN = FALSE;
+  Fneg_v = Fv = biddyNull;
+  Gneg_v = Gv = biddyNull;
+  rtag = 0;
+  v = 0;
+
+  /* NORMALIZATION OF COMPLEMENTED EDGES */
+  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
+  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
+  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
 
   if (biddyManagerType == BIDDYTYPEOBDDC) {
 
     if (((uintptr_t) f) > ((uintptr_t) g)) {
       if (BiddyGetMark(f)) {
-        if (BiddyGetMark(g)) {
-          FF = BiddyInv(f);
-          GG = BiddyInv(g); /* h */
-          HH = g;
-        } else {
-          NN = TRUE;
-          FF = BiddyInv(f);
-          GG = g;
-          HH = BiddyInv(g); /* h */
-        }
+        NN = TRUE;
+        FF = BiddyInv(f);
+        GG = biddyOne; /* BiddyInv(h) */
+        HH = BiddyInv(g);
       } else {
         if (BiddyGetMark(g)) {
           NN = TRUE;
           FF = f;
-          GG = BiddyInv(g); /* h */
-          HH = g;
+          GG = BiddyInv(g);
+          HH = biddyOne; /* BiddyInv(h) */
         } else {
           FF = f;
           GG = g;
-          HH = BiddyInv(g); /* h */
+          HH = biddyZero; /* h */
         }
       }
     } else {
       if (BiddyGetMark(g)) {
-        if (BiddyGetMark(f)) {
-          FF = BiddyInv(g);
-          GG = BiddyInv(f); /* h */
-          HH = f;
-        } else {
-          NN = TRUE;
-          FF = BiddyInv(g);
-          GG = f;
-          HH = BiddyInv(f); /* h */
-        }
+        NN = TRUE;
+        FF = BiddyInv(g);
+        GG = biddyOne; /* BiddyInv(h) */
+        HH = BiddyInv(f);
       } else {
         if (BiddyGetMark(f)) {
           NN = TRUE;
           FF = g;
-          GG = BiddyInv(f); /* h */
-          HH = f;
+          GG = BiddyInv(f);
+          HH = biddyOne; /* BiddyInv(h) */
         } else {
           FF = g;
           GG = f;
-          HH = BiddyInv(f); /* h */
+          HH = biddyZero; /* h */
         }
       }
     }
@@ -5044,19 +5161,25 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
 
     if (((uintptr_t) f) > ((uintptr_t) g)) {
       FF = f;
-      GG = biddyZero;
-      HH = g;
+      GG = g;
+      HH = biddyZero;
     } else {
       FF = g;
-      GG = biddyZero;
-      HH = f;
+      GG = f;
+      HH = biddyZero;
     }
 
   }
 
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  /* FOR ZBDDs, NOT EVERYTHING IS CACHED (SEE Biddy_SetZBDDSkip) */
+  /* FOR ZBDDs, topF AND topG ARE CALCULATED HERE */
   cindex = 0;
-  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+  topF = topG = 0; /* to avoid the uninitialized warning */
+  if ((((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) &&
+       ((topF = BiddyV(f)) != (topG = BiddyV(g))) &&
+       (biddyNodeTable.zbddskip != BIDDYZBDDSKIPCACHE)
+      ) || !findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
@@ -5069,12 +5192,14 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
 
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
       /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+
       if (topF == v) {
         Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
         Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
       } else {
         Fneg_v = Fv = f;
       }
+
       if (topG == v) {
         Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
         Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
@@ -5091,44 +5216,77 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
 
       /* LOOKING FOR THE SMALLEST TOP VARIABLE */
       /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
+      /* FOR ZBDD, topF AND topG HAVE BEEN ALREADY CALCULATED */
+      /* topF = BiddyV(f); */ /* ALREADY CALCULATED */
+      /* topG = BiddyV(g); */ /* ALREADY CALCULATED */
       v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* THIS CALL IS NOT INTRODUCING NEW NODES */
       /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = f;
-        Fv = biddyZero;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = g;
-        Gv = biddyZero;
+      /* BIDDYZBDDSKIPRECURSIVE: ONE UNCACHED CALL FOR EACH SKIPPED NODE */
+      /* BIDDYZBDDSKIPJUMP: SKIP ALL NODES WITH A SMALLER TOP VARIABLE IN A LOOP */
+      /* BIDDYZBDDSKIPCACHE: ONE CALL FOR EACH SKIPPED NODE, RESULTS ARE CACHED */
+      if (topF != topG) {
+        if (biddyNodeTable.zbddskip == BIDDYZBDDSKIPJUMP) {
+          Fneg_v = f;
+          Gneg_v = g;
+          do {
+            if (topF == v) {
+              Fneg_v = BiddyInvCond(BiddyE(Fneg_v),BiddyGetMark(Fneg_v));
+              topF = BiddyV(Fneg_v);
+            } else {
+              Gneg_v = BiddyInvCond(BiddyE(Gneg_v),BiddyGetMark(Gneg_v));
+              topG = BiddyV(Gneg_v);
+            }
+            v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+          } while ((topF != topG) && (Fneg_v != biddyZero) && (Gneg_v != biddyZero));
+          r = BiddyManagedAnd(MNG,Fneg_v,Gneg_v);
+          return r;
+        }
+        if (topF == v) {
+          r = BiddyManagedAnd(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),g);
+        } else {
+          r = BiddyManagedAnd(MNG,f,BiddyInvCond(BiddyE(g),BiddyGetMark(g)));
+        }
+        if (biddyNodeTable.zbddskip == BIDDYZBDDSKIPCACHE) {
+          addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+        }
+        return r;
       }
 
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS, topF == topG */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      Fv = BiddyT(f);
+      Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+      Gv = BiddyT(g);
+
       rtag = v;
 
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-      /* VARIANT 1 */
-      /*
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
       tagF = BiddyGetTag(f);
       tagG = BiddyGetTag(g);
-      if (tagF == tagG) {
-        / * THE SAME TAG * /
-        topF = BiddyV(f);
-        topG = BiddyV(g);
-        v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-        rtag = tagF;
-        w = v;
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* VARIANT 1 */
+      /*
+      if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = Gv = g;
+      } else if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
+        Fneg_v = Fv = f;
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
         if (topF == v) {
           Fneg_v = BiddyE(f);
           Fv = BiddyT(f);
@@ -5147,74 +5305,62 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
           Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
           Gv = biddyZero;
         }
-      } else {
-        / * DIFFERENT TAG * /
-        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
-        w = rtag;
-        if (tagF == rtag) {
-          if (BiddyV(f) == rtag) {
-            / * TAG AND TOP VARIABLE ARE EQUAL * /
-            Fneg_v = BiddyE(f);
-            Fv = BiddyT(f);
-          } else {
-            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
-            Fneg_v = f;
-            BiddySetTag(Fneg_v,rtag);
-            Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-            Fv = biddyZero;
-          }
-          Gneg_v = Gv = g;
-        } else {
-          if (BiddyV(g) == rtag) {
-            / * TAG AND TOP VARIABLE ARE EQUAL * /
-            Gneg_v = BiddyE(g);
-            Gv = BiddyT(g);
-          } else {
-            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
-            Gneg_v = g;
-            BiddySetTag(Gneg_v,rtag);
-            Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-            Gv = biddyZero;
-          }
-          Fneg_v = Fv = f;
-        }
       }
       */
 
       /* VARIANT 2 */
-      /**/
-      tagF = BiddyGetTag(f);
-      tagG = BiddyGetTag(g);
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-      if (tagF != tagG) v = rtag;
-      if (tagF == rtag) {
-        if (topF == v) {
-          Fneg_v = BiddyE(f);
-          Fv = BiddyT(f);
+      /*
+      if (topF == v) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      } else {
+        if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
+          Fneg_v = Fv = f;
         } else {
           Fneg_v = f;
           BiddySetTag(Fneg_v,v);
           Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
           Fv = biddyZero;
         }
-      } else {
-        Fneg_v = Fv = f;
       }
-      if (tagG == rtag) {
-        if (topG == v) {
-          Gneg_v = BiddyE(g);
-          Gv = BiddyT(g);
+      if (topG == v) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
+          Gneg_v = Gv = g;
         } else {
           Gneg_v = g;
           BiddySetTag(Gneg_v,v);
           Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
           Gv = biddyZero;
         }
+      }
+      */
+
+      /* VARIANT 3 */
+      /**/
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
+        Fneg_v = Fv = f;
+      } else if (v == topF) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
       } else {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
         Gneg_v = Gv = g;
+      } else if (v == topG) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = biddyZero;
       }
       /**/
 
@@ -5222,38 +5368,38 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
 #endif
 
     /* RECURSIVE CALLS */
-    /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
-    /* because top variable of the result may be lower (topmore) than top variables of the arguments */
-    /* (i.e. because the result depends on domain) */
-    if (Fneg_v == biddyZero) {
-      E = Gneg_v;
-    } else if (Gneg_v == biddyZero) {
-      E = Fneg_v;
-    } else if (Fneg_v == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      E = BiddyManagedNot(MNG,Gneg_v);
-    } else if (Gneg_v == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      E = BiddyManagedNot(MNG,Fneg_v);
-    } else if (Fneg_v == Gneg_v) {
-      E = biddyZero;
-    } else  {
-      E = BiddyManagedXor(MNG,Fneg_v,Gneg_v);
-    }
-    if (Fv == biddyZero) {
-      T = Gv;
-    } else if (Gv == biddyZero) {
-      T = Fv;
-    } else if (Fv == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      T = BiddyManagedNot(MNG,Gv);
-    } else if (Gv == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      T = BiddyManagedNot(MNG,Fv);
-    } else if (Fv == Gv) {
-      T = biddyZero;
-    } else  {
-      T = BiddyManagedXor(MNG,Fv,Gv);
+#ifdef PARALLELAPPLY
+    /* IF BOTH RECURSIVE CALLS ARE NOT TRIVIAL, THE SECOND ONE MAY BE PERFORMED BY ANOTHER THREAD */
+    if (BiddyApplySpawn(MNG) &&
+        !BiddyIsTerminal(Fneg_v) && !BiddyIsTerminal(Gneg_v) &&
+        !BiddyIsTerminal(Fv) && !BiddyIsTerminal(Gv))
+    {
+      BiddyParallelApply(MNG,applyAnd,Fneg_v,Gneg_v,biddyNull,&E,Fv,Gv,biddyNull,&T);
+    } else
+#endif
+    {
+      if (Fneg_v == biddyZero) {
+        E = biddyZero;
+      } else if (Gneg_v == biddyZero) {
+        E = biddyZero;
+      } else if (Fneg_v == biddyOne) {
+        E = Gneg_v;
+      } else if (Gneg_v == biddyOne) {
+        E = Fneg_v;
+      } else  {
+        E = BiddyManagedAnd(MNG,Fneg_v,Gneg_v);
+      }
+      if (Fv == biddyZero) {
+        T = biddyZero;
+      } else if (Gv == biddyZero) {
+        T = biddyZero;
+      } else if (Fv == biddyOne) {
+        T = Gv;
+      } else if (Gv == biddyOne) {
+        T = Fv;
+      } else  {
+        T = BiddyManagedAnd(MNG,Fv,Gv);
+      }
     }
 
     r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
@@ -5277,71 +5423,40 @@ BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
   }
 
   return r;
-}
-
-/***************************************************************************//*!
-\brief Function BiddyManagedXnor.
-
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_Xnor.
-*******************************************************************************/
-
-Biddy_Edge
-BiddyManagedXnor(const Biddy_Manager MNG, const Biddy_Edge f,
-                 const Biddy_Edge g)
-{
-  Biddy_Edge r;
-
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-
-  r = biddyNull;
 
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
-
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    r = BiddyInv(BiddyManagedXor(MNG,f,g));
-  }
-
-  return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedLeq.
+\brief Function BiddyManagedOr.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Leq.
+    See Biddy_Managed_Or.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
+BiddyManagedOr(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 {
   Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
   Biddy_Edge FF, GG, HH;
+  Biddy_Boolean NN;
   Biddy_Variable v,rtag;
   unsigned int cindex;
 
-  static Biddy_Variable topF; /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG; /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable topF;
+  Biddy_Variable topG;
 
 #ifndef COMPACT
-  static Biddy_Variable tagF; /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG; /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
 
-  r = biddyNull;
-
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -5350,53 +5465,51 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-
-    /* FOR OBDDC, PROCEED BY CALCULATING NOT-AND */
-
-    r = BiddyInv(BiddyManagedAnd(MNG,f,BiddyInv(g)));
-    return r;
-
+  if (BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYOR,f,g,biddyNull);
   }
 
-#ifndef COMPACT
-  if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-
-    /* FOR ZBDD AND ZBDDC, PROCEED BY CALCULATING ITE */
-    /* THIS IS NOT DIRECT IMPLEMENTATION (AS FOR OBDD AND TZBDD), */
-    /* BUT IT IS NOT SIGNIFICANTLY SLOWER */
-
-    r = BiddyManagedITE(MNG,f,g,biddyOne);
-    return r;
+  if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
 
-  }
-#endif
+  r = biddyNull;
 
   /* LOOKING FOR SIMPLE CASE */
-  /* returning biddyOne in a RECURSIVE call is wrong for ZBDD and ZBDDC */
-  /* using Not in a RECURSIVE call is wrong for ZBDD and ZBDDC */
-  /* because top variable of biddyOne/result may be lower (topmore) than top variables of the arguments */
-  /* (i.e. because biddyOne/result depends on domain) */
+  /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
+  /* because top variable of the result may be lower (topmore) than top variables of the arguments */
+  /* (i.e. because the result depends on domain) */
 
-  /* ZBDD AND ZBDDC ARE ALREADY CALCULATED */
   if (f == biddyZero) {
-    return biddyOne;
-  } else if (g == biddyZero) {
-    return BiddyManagedNot(MNG,f);
-  } else if (f == biddyOne) {
     BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
     return g;
+  } else if (g == biddyZero) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  } else if (f == biddyOne) {
+    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+    return biddyOne;
   } else if (g == biddyOne) {
+    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
     return biddyOne;
   } else if (f == g) {
-    return biddyOne;
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  }
+
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyIsEqvPointer(f,g)) {
+      return biddyOne;
+    }
   }
 
 #ifndef COMPACT
   if (biddyManagerType == BIDDYTYPETZBDD) {
     if (BiddyR(f) == BiddyR(g)) {
       if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
-        return biddyOne;
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
       }
     }
   }
@@ -5405,33 +5518,69 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
   /* THIS IS NOT A SIMPLE CASE */
 
   FF = GG = HH = biddyNull;
+  NN = FALSE;
   Fneg_v = Fv = biddyNull;
   Gneg_v = Gv = biddyNull;
   rtag = 0;
   v = 0;
 
+  /* NORMALIZATION OF COMPLEMENTED EDGES */
+  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
+  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
+  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
+
   if (biddyManagerType == BIDDYTYPEOBDDC) {
-    /* ALREADY CALCULATED */
-  }
 
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    /* ALREADY CALCULATED */
+    if (((uintptr_t) f) > ((uintptr_t) g)) {
+      if (BiddyGetMark(f)) {
+        if (BiddyGetMark(g)) {
+          NN = TRUE;
+          FF = BiddyInv(f);
+          GG = BiddyInv(g);
+          HH = biddyZero;  /* BiddyInv(g) */
+        } else {
+          FF = BiddyInv(f);
+          GG = g;
+          HH = biddyOne; /* g */
+        }
+      } else {
+        FF = f;
+        GG = biddyOne;
+        HH = g;
+      }
+    } else {
+      if (BiddyGetMark(g)) {
+        if (BiddyGetMark(f)) {
+          NN = TRUE;
+          FF = BiddyInv(g);
+          GG = BiddyInv(f);
+          HH = biddyZero;  /* BiddyInv(g) */
+        } else {
+          FF = BiddyInv(g);
+          GG = f;
+          HH = biddyOne; /* g */
+        }
+      } else {
+        FF = g;
+        GG = biddyOne;
+        HH = f;
+      }
+    }
   }
-#endif
 
   else {
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-    biddyNodeTable.andorrecursive++;
-#endif
-
-    /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
     /* THIS IS NOT ITE CACHE! */
 
-    FF = f;
-    GG = f;
-    HH = g;
+    if (((uintptr_t) f) > ((uintptr_t) g)) {
+      FF = biddyZero;
+      GG = f;
+      HH = g;
+    } else {
+      FF = biddyZero;
+      GG = g;
+      HH = f;
+    }
 
   }
 
@@ -5440,7 +5589,7 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
   if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
   {
 
-    if (biddyManagerType == BIDDYTYPEOBDD) {
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
 
       /* LOOKING FOR THE SMALLEST TOP VARIABLE */
       /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
@@ -5451,15 +5600,15 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
       /* COMPLEMENTED EDGES MUST BE TRANSFERED */
       if (topF == v) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
       } else {
         Fneg_v = Fv = f;
       }
 
       if (topG == v) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
       } else {
         Gneg_v = Gv = g;
       }
@@ -5468,28 +5617,49 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 
     }
 
-    else if (biddyManagerType == BIDDYTYPEOBDDC) {
-      /* ALREADY CALCULATED */
-    }
-
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      /* ALREADY CALCULATED */
-    }
-
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
       /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      tagF = BiddyGetTag(f);
-      tagG = BiddyGetTag(g);
       topF = BiddyV(f);
       topG = BiddyV(g);
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
       v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
 
-      if (tagF != tagG) v = rtag;
-      if (tagF == rtag) {
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = f;
+        Fv = biddyZero;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = g;
+        Gv = biddyZero;
+      }
+
+      rtag = v;
+
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+
+      /* VARIANT 1 */
+      /*
+      tagF = BiddyGetTag(f);
+      tagG = BiddyGetTag(g);
+      if (tagF == tagG) {
+        / * THE SAME TAG * /
+        topF = BiddyV(f);
+        topG = BiddyV(g);
+        v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+        rtag = tagF;
+        w = v;
         if (topF == v) {
           Fneg_v = BiddyE(f);
           Fv = BiddyT(f);
@@ -5499,10 +5669,6 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
           Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
           Fv = biddyZero;
         }
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (tagG == rtag) {
         if (topG == v) {
           Gneg_v = BiddyE(g);
           Gv = BiddyT(g);
@@ -5513,53 +5679,136 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
           Gv = biddyZero;
         }
       } else {
-        Gneg_v = Gv = g;
-      }
-
-    }
-#endif
-
-    /* RECURSIVE CALLS */
-    /* returning biddyOne in a RECURSIVE call is wrong for ZBDD and ZBDDC */
-    /* using Not in a RECURSIVE call is wrong for ZBDD and ZBDDC */
-    /* because top variable of biddyOne/result may be lower (topmore) than top variables of the arguments */
-    /* (i.e. because biddyOne/result depends on domain) */
+        / * DIFFERENT TAG * /
+        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+        w = rtag;
+        if (tagF == rtag) {
+          if (BiddyV(f) == rtag) {
+            / * TAG AND TOP VARIABLE ARE EQUAL * /
+            Fneg_v = BiddyE(f);
+            Fv = BiddyT(f);
+          } else {
+            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
+            Fneg_v = f;
+            BiddySetTag(Fneg_v,rtag);
+            Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+            Fv = biddyZero;
+          }
+          Gneg_v = Gv = g;
+        } else {
+          if (BiddyV(g) == rtag) {
+            / * TAG AND TOP VARIABLE ARE EQUAL * /
+            Gneg_v = BiddyE(g);
+            Gv = BiddyT(g);
+          } else {
+            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
+            Gneg_v = g;
+            BiddySetTag(Gneg_v,rtag);
+            Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+            Gv = biddyZero;
+          }
+          Fneg_v = Fv = f;
+        }
+      }
+      */
+
+      /* VARIANT 2 */
+      /**/
+      tagF = BiddyGetTag(f);
+      tagG = BiddyGetTag(g);
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      if (tagF != tagG) v = rtag;
+      if (tagF == rtag) {
+        if (topF == v) {
+          Fneg_v = BiddyE(f);
+          Fv = BiddyT(f);
+        } else {
+          Fneg_v = f;
+          BiddySetTag(Fneg_v,v);
+          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+          Fv = biddyZero;
+        }
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (tagG == rtag) {
+        if (topG == v) {
+          Gneg_v = BiddyE(g);
+          Gv = BiddyT(g);
+        } else {
+          Gneg_v = g;
+          BiddySetTag(Gneg_v,v);
+          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+          Gv = biddyZero;
+        }
+      } else {
+        Gneg_v = Gv = g;
+      }
+      /**/
 
-    /* ZBDD AND ZBDDC ARE ALREADY CALCULATED */
-    if (Fneg_v == biddyZero) {
-      E = biddyOne;
-    } else if (Gneg_v == biddyZero) {
-      E = BiddyManagedNot(MNG,Fneg_v);
-    } else if (Fneg_v == biddyOne) {
-      E = Gneg_v;
-    } else if (Gneg_v == biddyOne) {
-      E = biddyOne;
-    } else if (Fneg_v == Gneg_v) {
-      E = biddyOne;
-    } else  {
-      E = BiddyManagedLeq(MNG,Fneg_v,Gneg_v);
     }
-    if (Fv == biddyZero) {
-      T = biddyOne;
-    } else if (Gv == biddyZero) {
-      T = BiddyManagedNot(MNG,Fv);
-    } else if (Fv == biddyOne) {
-      T = Gv;
-    } else if (Gv == biddyOne) {
-      T = biddyOne;
-    } else if (Fv == Gv) {
-      T = biddyOne;
-    } else  {
-      T = BiddyManagedLeq(MNG,Fv,Gv);
+#endif
+
+    /* RECURSIVE CALLS */
+    /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
+    /* because top variable of the result may be lower (topmore) than top variables of the arguments */
+    /* (i.e. because the result depends on domain) */
+#ifdef PARALLELAPPLY
+    /* IF BOTH RECURSIVE CALLS ARE NOT TRIVIAL, THE SECOND ONE MAY BE PERFORMED BY ANOTHER THREAD */
+    if (BiddyApplySpawn(MNG) &&
+        !BiddyIsTerminal(Fneg_v) && !BiddyIsTerminal(Gneg_v) &&
+        !BiddyIsTerminal(Fv) && !BiddyIsTerminal(Gv))
+    {
+      BiddyParallelApply(MNG,applyOr,Fneg_v,Gneg_v,biddyNull,&E,Fv,Gv,biddyNull,&T);
+    } else
+#endif
+    {
+      if (Fneg_v == biddyZero) {
+        E = Gneg_v;
+      } else if (Gneg_v == biddyZero) {
+        E = Fneg_v;
+      } else if (Fneg_v == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        E = biddyOne;
+      } else if (Gneg_v == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        E = biddyOne;
+      } else  {
+        E = BiddyManagedOr(MNG,Fneg_v,Gneg_v);
+      }
+      if (Fv == biddyZero) {
+        T = Gv;
+      } else if (Gv == biddyZero) {
+        T = Fv;
+      } else if (Fv == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        T = biddyOne;
+      } else if (Gv == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        T = biddyOne;
+      } else  {
+        T = BiddyManagedOr(MNG,Fv,Gv);
+      }
     }
 
     r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
     BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-    addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+    if (NN) {
+      addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),cindex);
+    } else {
+      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+    }
 
   } else {
 
+    if (NN) {
+      BiddyInvertMark(r);
+    }
+
     /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
     BiddyRefresh(r);
 
@@ -5569,37 +5818,99 @@ BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedGt.
+\brief Function BiddyManagedNand.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Gt.
+    See Biddy_Managed_Nand.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
+BiddyManagedNand(const Biddy_Manager MNG, const Biddy_Edge f,
+                 const Biddy_Edge g)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  r = biddyNull;
+
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    r = BiddyInv(BiddyManagedAnd(MNG,f,g));
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedNor.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Nor.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedNor(const Biddy_Manager MNG, const Biddy_Edge f,
+                const Biddy_Edge g)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  r = biddyNull;
+
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    r = BiddyManagedAnd(MNG,BiddyInv(f),BiddyInv(g));
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedXor.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Xor.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedXor(const Biddy_Manager MNG, const Biddy_Edge f,
+                const Biddy_Edge g)
 {
   Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
   Biddy_Edge FF, GG, HH;
+  Biddy_Boolean NN;
   Biddy_Variable v,rtag;
   unsigned int cindex;
 
-  static Biddy_Variable topF; /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable topG; /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable topF;
+  Biddy_Variable topG;
 
 #ifndef COMPACT
-  static Biddy_Variable tagF; /* CAN BE STATIC, WHAT IS BETTER? */
-  static Biddy_Variable tagG; /* CAN BE STATIC, WHAT IS BETTER? */
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
 
-  r = biddyNull;
-
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -5608,22 +5919,20 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-
-    /* FOR OBDDC, PROCEED BY CALCULATING NOT-AND */
-
-    r = BiddyManagedAnd(MNG,f,BiddyInv(g));
-    return r;
-
+  if (BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYXOR,f,g,biddyNull);
   }
 
+  if (biddyNodeTable.extendedstats) biddyNodeTable.xorrecursive++;
+
   /* LOOKING FOR SIMPLE CASE */
-  /* using BiddyManagedNot in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+  /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
   /* because top variable of the result may be lower (topmore) than top variables of the arguments */
   /* (i.e. because the result depends on domain) */
 
   if (f == biddyZero) {
-    return biddyZero;
+    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+    return g;
   } else if (g == biddyZero) {
     BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
     return f;
@@ -5631,58 +5940,108 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
     /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
     return BiddyManagedNot(MNG,g);
   } else if (g == biddyOne) {
-    return biddyZero;
+    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+    return BiddyManagedNot(MNG,f);
   } else if (f == g) {
     return biddyZero;
   }
 
-#ifndef COMPACT
-  if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (BiddyR(f) == BiddyR(g)) {
-      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
-        return biddyZero;
-      }
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyIsEqvPointer(f,g)) {
+      return biddyOne;
     }
   }
-#endif
 
   /* THIS IS NOT A SIMPLE CASE */
 
   FF = GG = HH = biddyNull;
+  NN = FALSE;
   Fneg_v = Fv = biddyNull;
   Gneg_v = Gv = biddyNull;
   rtag = 0;
   v = 0;
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    /* ALREADY CALCULATED */
-  }
-
-  else {
-
-#ifdef BIDDYEXTENDEDSTATS_YES
-    biddyNodeTable.andorrecursive++;
-#endif
-
-    /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
-    /* THIS IS NOT ITE CACHE! */
-
-    FF = f;
-    GG = g;
-    HH = g;
-
-  }
-
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if ((((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD))
-       && BiddyIsSmaller(biddyOrderingTable,BiddyV(g),BiddyV(f))
-      ) || !findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-  {
+  /* NORMALIZATION OF COMPLEMENTED EDGES */
+  /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
+  /* FF AND GG SHOULD NOT BE COMPLEMENTED */
+  /* ((uintptr_t) f) SHOULD BE GREATER THAN ((uintptr_t) g) */
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
 
-      /* FOR OBDDC THE RESULTS HAS BEEN ALREADY CALCULATED */
+    if (((uintptr_t) f) > ((uintptr_t) g)) {
+      if (BiddyGetMark(f)) {
+        if (BiddyGetMark(g)) {
+          FF = BiddyInv(f);
+          GG = BiddyInv(g); /* h */
+          HH = g;
+        } else {
+          NN = TRUE;
+          FF = BiddyInv(f);
+          GG = g;
+          HH = BiddyInv(g); /* h */
+        }
+      } else {
+        if (BiddyGetMark(g)) {
+          NN = TRUE;
+          FF = f;
+          GG = BiddyInv(g); /* h */
+          HH = g;
+        } else {
+          FF = f;
+          GG = g;
+          HH = BiddyInv(g); /* h */
+        }
+      }
+    } else {
+      if (BiddyGetMark(g)) {
+        if (BiddyGetMark(f)) {
+          FF = BiddyInv(g);
+          GG = BiddyInv(f); /* h */
+          HH = f;
+        } else {
+          NN = TRUE;
+          FF = BiddyInv(g);
+          GG = f;
+          HH = BiddyInv(f); /* h */
+        }
+      } else {
+        if (BiddyGetMark(f)) {
+          NN = TRUE;
+          FF = g;
+          GG = BiddyInv(f); /* h */
+          HH = f;
+        } else {
+          FF = g;
+          GG = f;
+          HH = BiddyInv(f); /* h */
+        }
+      }
+    }
+
+  }
+
+  else {
+
+    /* THIS IS NOT ITE CACHE! */
+
+    if (((uintptr_t) f) > ((uintptr_t) g)) {
+      FF = f;
+      GG = biddyZero;
+      HH = g;
+    } else {
+      FF = g;
+      GG = biddyZero;
+      HH = f;
+    }
+
+  }
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
 
       /* LOOKING FOR THE SMALLEST TOP VARIABLE */
       /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
@@ -5691,16 +6050,16 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
       v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
 
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
       if (topF == v) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
       } else {
         Fneg_v = Fv = f;
       }
-
       if (topG == v) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
       } else {
         Gneg_v = Gv = g;
       }
@@ -5718,25 +6077,21 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
       topG = BiddyV(g);
       v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
 
-      /* THIS CALL IS NOT INTRODUCING NEW NODES */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      /* IT SEEMS THAT CACHING THIS RESULTS IS NOT A GOOD IDEA */
-      if (topF != v) {
-        r = BiddyManagedGt(MNG,f,BiddyInvCond(BiddyE(g),BiddyGetMark(g)));
-        return r;
-      }
-
       /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* IT IS ALREADY KNOWN THAT topF == v */
       /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      Fv = BiddyT(f);
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = f;
+        Fv = biddyZero;
+      }
       if (topG == v) {
         Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
         Gv = BiddyT(g);
       } else {
-         Gneg_v = g;
-         Gv = biddyZero;
+        Gneg_v = g;
+        Gv = biddyZero;
       }
 
       rtag = v;
@@ -5745,88 +6100,170 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      /* VARIANT 1 */
+      /*
+      tagF = BiddyGetTag(f);
+      tagG = BiddyGetTag(g);
+      if (tagF == tagG) {
+        / * THE SAME TAG * /
+        topF = BiddyV(f);
+        topG = BiddyV(g);
+        v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+        rtag = tagF;
+        w = v;
+        if (topF == v) {
+          Fneg_v = BiddyE(f);
+          Fv = BiddyT(f);
+        } else {
+          Fneg_v = f;
+          BiddySetTag(Fneg_v,v);
+          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+          Fv = biddyZero;
+        }
+        if (topG == v) {
+          Gneg_v = BiddyE(g);
+          Gv = BiddyT(g);
+        } else {
+          Gneg_v = g;
+          BiddySetTag(Gneg_v,v);
+          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+          Gv = biddyZero;
+        }
+      } else {
+        / * DIFFERENT TAG * /
+        rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+        w = rtag;
+        if (tagF == rtag) {
+          if (BiddyV(f) == rtag) {
+            / * TAG AND TOP VARIABLE ARE EQUAL * /
+            Fneg_v = BiddyE(f);
+            Fv = BiddyT(f);
+          } else {
+            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
+            Fneg_v = f;
+            BiddySetTag(Fneg_v,rtag);
+            Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+            Fv = biddyZero;
+          }
+          Gneg_v = Gv = g;
+        } else {
+          if (BiddyV(g) == rtag) {
+            / * TAG AND TOP VARIABLE ARE EQUAL * /
+            Gneg_v = BiddyE(g);
+            Gv = BiddyT(g);
+          } else {
+            / * TAG AND TOP VARIABLE ARE NOT EQUAL * /
+            Gneg_v = g;
+            BiddySetTag(Gneg_v,rtag);
+            Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+            Gv = biddyZero;
+          }
+          Fneg_v = Fv = f;
+        }
+      }
+      */
+
+      /* VARIANT 2 */
+      /**/
       tagF = BiddyGetTag(f);
       tagG = BiddyGetTag(g);
       topF = BiddyV(f);
       topG = BiddyV(g);
       rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
       v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-
-      if (BiddyIsSmaller(biddyOrderingTable,tagG,tagF)) v = rtag;
-
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
-        Fneg_v = Fv = f;
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,topF)) {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
+      if (tagF != tagG) v = rtag;
+      if (tagF == rtag) {
+        if (topF == v) {
+          Fneg_v = BiddyE(f);
+          Fv = BiddyT(f);
+        } else {
+          Fneg_v = f;
+          BiddySetTag(Fneg_v,v);
+          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+          Fv = biddyZero;
+        }
       } else {
-        /* HERE topF == v */
-        /* TO DO: CHECK And FOR OPTIMIZATION */
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
+        Fneg_v = Fv = f;
       }
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
-        Gneg_v = Gv = g;
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,topG)) {
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = biddyZero;
+      if (tagG == rtag) {
+        if (topG == v) {
+          Gneg_v = BiddyE(g);
+          Gv = BiddyT(g);
+        } else {
+          Gneg_v = g;
+          BiddySetTag(Gneg_v,v);
+          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+          Gv = biddyZero;
+        }
       } else {
-        /* HERE topG == v */
-        /* TO DO: CHECK And FOR OPTIMIZATION */
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
+        Gneg_v = Gv = g;
       }
+      /**/
 
     }
 #endif
 
     /* RECURSIVE CALLS */
-    /* using BiddyManagedNot in a recursive call is wrong for ZBDD and ZBDDC, */
+    /* returning biddyOne in a recursive call is wrong for ZBDD and ZBDDC, */
     /* because top variable of the result may be lower (topmore) than top variables of the arguments */
     /* (i.e. because the result depends on domain) */
-
-    if (Fneg_v == biddyZero) {
-      E = biddyZero;
-    } else if (Gneg_v == biddyZero) {
-      E = Fneg_v;
-    } else if (Fneg_v == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      E = BiddyManagedNot(MNG,Gneg_v);
-    } else if (Gneg_v == biddyOne) {
-      E = biddyZero;
-    } else if (Fneg_v == Gneg_v) {
-      E = biddyZero;
-    } else  {
-      E = BiddyManagedGt(MNG,Fneg_v,Gneg_v);
-    }
-    if (Fv == biddyZero) {
-      T = biddyZero;
-    } else if (Gv == biddyZero) {
-      T = Fv;
-    } else if (Fv == biddyOne) {
-      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
-      T = BiddyManagedNot(MNG,Gv);
-    } else if (Gv == biddyOne) {
-      T = biddyZero;
-    } else if (Fv == Gv) {
-      T = biddyZero;
-    } else  {
-      T = BiddyManagedGt(MNG,Fv,Gv);
+#ifdef PARALLELAPPLY
+    /* IF BOTH RECURSIVE CALLS ARE NOT TRIVIAL, THE SECOND ONE MAY BE PERFORMED BY ANOTHER THREAD */
+    if (BiddyApplySpawn(MNG) &&
+        !BiddyIsTerminal(Fneg_v) && !BiddyIsTerminal(Gneg_v) && (Fneg_v != Gneg_v) &&
+        !BiddyIsTerminal(Fv) && !BiddyIsTerminal(Gv) && (Fv != Gv))
+    {
+      BiddyParallelApply(MNG,applyXor,Fneg_v,Gneg_v,biddyNull,&E,Fv,Gv,biddyNull,&T);
+    } else
+#endif
+    {
+      if (Fneg_v == biddyZero) {
+        E = Gneg_v;
+      } else if (Gneg_v == biddyZero) {
+        E = Fneg_v;
+      } else if (Fneg_v == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        E = BiddyManagedNot(MNG,Gneg_v);
+      } else if (Gneg_v == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        E = BiddyManagedNot(MNG,Fneg_v);
+      } else if (Fneg_v == Gneg_v) {
+        E = biddyZero;
+      } else  {
+        E = BiddyManagedXor(MNG,Fneg_v,Gneg_v);
+      }
+      if (Fv == biddyZero) {
+        T = Gv;
+      } else if (Gv == biddyZero) {
+        T = Fv;
+      } else if (Fv == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        T = BiddyManagedNot(MNG,Gv);
+      } else if (Gv == biddyOne) {
+        /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+        T = BiddyManagedNot(MNG,Fv);
+      } else if (Fv == Gv) {
+        T = biddyZero;
+      } else  {
+        T = BiddyManagedXor(MNG,Fv,Gv);
+      }
     }
 
     r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
     BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-    addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+    if (NN) {
+      addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),cindex);
+    } else {
+      addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+    }
 
   } else {
 
+    if (NN) {
+      BiddyInvertMark(r);
+    }
+
     /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
     BiddyRefresh(r);
 
@@ -5836,211 +6273,68 @@ BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedRestrict.
+\brief Function BiddyManagedXnor.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Restrict.
+    See Biddy_Managed_Xnor.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedRestrict(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v,
-                     Biddy_Boolean value)
+BiddyManagedXnor(const Biddy_Manager MNG, const Biddy_Edge f,
+                 const Biddy_Edge g)
 {
-  Biddy_Edge e, t, r;
-  Biddy_Variable fv;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Variable tag;
-#endif
+  Biddy_Edge r;
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( v != 0);
-
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+  assert( g != NULL );
 
   r = biddyNull;
 
-  if (f == biddyZero) return biddyZero;
-
-  FF = f;
-  GG = value?biddyZero:biddyOne;
-  HH = biddyNull;
-
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    HH = biddyVariableTable.table[v].variable;
-  }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    HH = biddyVariableTable.table[v].element;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    HH = biddyVariableTable.table[v].variable;
-  }
-#endif
-
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  /* Result is stored in cache only if recursive calls are needed */
-  /* I am not sure if this is a good strategy! */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
-
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        if (value) {
-          r = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-        } else {
-          r = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-        }
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-      }
-      else {
-        e = BiddyManagedRestrict(MNG,BiddyE(f),v,value);
-        t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
-        r = BiddyInvCond(BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE),BiddyGetMark(f));
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-      }
-    }
-
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        if (value) {
-          t = BiddyT(f);
-          r = BiddyManagedTaggedFoaNode(MNG,v,t,t,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          e = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-          r = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        if (value) {
-          r = biddyZero;
-        } else {
-          r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-      }
-      else {
-        e = BiddyManagedRestrict(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
-        t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-      }
-    }
-
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
-      tag = BiddyGetTag(f);
-      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-      } else {
-        fv = BiddyV(f);
-        if (v == fv) {
-          if (v == tag) {
-            if (value) {
-              r = BiddyT(f);
-              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-            } else {
-              r = BiddyE(f);
-              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-            }
-          } else {
-            if (value) {
-              t = BiddyT(f);
-              r = BiddyManagedTaggedFoaNode(MNG,v,t,t,tag,TRUE);
-              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-            } else {
-              e = BiddyE(f);
-              r = BiddyManagedTaggedFoaNode(MNG,v,e,e,tag,TRUE);
-              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-            }
-          }
-        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-          if (value) {
-            r = biddyZero;
-          } else {
-            if (v == tag) {
-              r = BiddyManagedIncTag(MNG,f);
-            } else {
-              r = f;
-              /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
-              BiddySetTag(r,v);
-              r = BiddyManagedIncTag(MNG,r);
-              r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
-              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-            }
-          }
-        } else {
-          e = BiddyManagedRestrict(MNG,BiddyE(f),v,value);
-          t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
-          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-        }
-      }
-    }
-#endif
-
-  } else {
-
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
 
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    r = BiddyInv(BiddyManagedXor(MNG,f,g));
   }
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedCompose.
+\brief Function BiddyManagedLeq.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Compose.
+    See Biddy_Managed_Leq.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
-                    Biddy_Variable v)
+BiddyManagedLeq(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 {
-  Biddy_Edge e, t, r;
-  Biddy_Variable fv;
+  Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
   Biddy_Edge FF, GG, HH;
+  Biddy_Variable v,rtag;
   unsigned int cindex;
 
+  Biddy_Variable topF;
+  Biddy_Variable topG;
+
 #ifndef COMPACT
-  Biddy_Variable tag;
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
-  assert( v != 0);
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  r = biddyNull;
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -6049,148 +6343,215 @@ BiddyManagedCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  r = biddyNull;
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
 
-  if (f == biddyZero) return biddyZero;
+    /* FOR OBDDC, PROCEED BY CALCULATING NOT-AND */
 
-  FF = f;
-  GG = g;
-  HH = biddyNull;
+    r = BiddyInv(BiddyManagedAnd(MNG,f,BiddyInv(g)));
+    return r;
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    HH = biddyVariableTable.table[v].variable;
   }
+
 #ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    HH = biddyVariableTable.table[v].element;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    HH = biddyVariableTable.table[v].variable;
+  if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+    /* FOR ZBDD AND ZBDDC, PROCEED BY CALCULATING ITE */
+    /* THIS IS NOT DIRECT IMPLEMENTATION (AS FOR OBDD AND TZBDD), */
+    /* BUT IT IS NOT SIGNIFICANTLY SLOWER */
+
+    r = BiddyManagedITE(MNG,f,g,biddyOne);
+    return r;
+
   }
 #endif
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
+  /* LOOKING FOR SIMPLE CASE */
+  /* returning biddyOne in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+  /* using Not in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+  /* because top variable of biddyOne/result may be lower (topmore) than top variables of the arguments */
+  /* (i.e. because biddyOne/result depends on domain) */
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        r = BiddyInvCond(BiddyManagedITE(MNG,g,BiddyT(f),BiddyE(f)),BiddyGetMark(f));
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-      }
-      else {
-        e = BiddyManagedCompose(MNG,BiddyE(f),g,v);
-        t = BiddyManagedCompose(MNG,BiddyT(f),g,v);
-        /* VARIANT A: USE TRUE FOR THE FIRST CONDITION */
-        /* VARIANT B: USE FALSE FOR THE FIRST CONDITION */
-        if (TRUE && BiddyIsSmaller(biddyOrderingTable,fv,BiddyV(e)) && BiddyIsSmaller(biddyOrderingTable,fv,BiddyV(t))) {
-          r = BiddyInvCond(BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE),BiddyGetMark(f));
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          r = BiddyInvCond(BiddyManagedITE(MNG,biddyVariableTable.table[fv].variable,t,e),BiddyGetMark(f));
-        }
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  /* ZBDD AND ZBDDC ARE ALREADY CALCULATED */
+  if (f == biddyZero) {
+    return biddyOne;
+  } else if (g == biddyZero) {
+    return BiddyManagedNot(MNG,f);
+  } else if (f == biddyOne) {
+    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+    return g;
+  } else if (g == biddyOne) {
+    return biddyOne;
+  } else if (f == g) {
+    return biddyOne;
+  }
+
+#ifndef COMPACT
+  if (biddyManagerType == BIDDYTYPETZBDD) {
+    if (BiddyR(f) == BiddyR(g)) {
+      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
+        return biddyOne;
       }
     }
+  }
+#endif
+
+  /* THIS IS NOT A SIMPLE CASE */
+
+  FF = GG = HH = biddyNull;
+  Fneg_v = Fv = biddyNull;
+  Gneg_v = Gv = biddyNull;
+  rtag = 0;
+  v = 0;
+
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* ALREADY CALCULATED */
+  }
 
 #ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      /* TO DO: Biddy_Replace USE DIFFERENT APPROACH */
-      /* TO DO: check if that approach is applicable and more efficient */
-      if ((fv=BiddyV(f)) == v) {
-        e = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        e = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
-        BiddyRefresh(e); /* FoaNode returns an obsolete node! */
-        t = BiddyT(f);
-        t = BiddyManagedTaggedFoaNode(MNG,v,t,t,v,TRUE);
-        BiddyRefresh(t); /* FoaNode returns an obsolete node! */
-        r = BiddyManagedITE(MNG,g,t,e);
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        r = BiddyManagedITE(MNG,g,biddyZero,r);
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    /* ALREADY CALCULATED */
+  }
+#endif
+
+  else {
+
+    if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
+
+    /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
+    /* THIS IS NOT ITE CACHE! */
+
+    FF = f;
+    GG = f;
+    HH = g;
+
+  }
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if (biddyManagerType == BIDDYTYPEOBDD) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = Fv = f;
       }
-      else {
-        e = BiddyManagedCompose(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),g,v);
-        t = BiddyManagedCompose(MNG,BiddyT(f),BiddyManagedChange(MNG,g,fv),v);
-        t = BiddyManagedChange(MNG,t,fv);
-        r = BiddyManagedXor(MNG,e,t);
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+      if (topG == v) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = Gv = g;
       }
+
+      rtag = v;
+
+    }
+
+    else if (biddyManagerType == BIDDYTYPEOBDDC) {
+      /* ALREADY CALCULATED */
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      /* ALREADY CALCULATED */
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
-      /* TO DO: Biddy_Replace USE DIFFERENT APPROACH */
-      /* TO DO: check if that approach is applicable and more efficient */
-      tag = BiddyGetTag(f);
-      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-      } else {
-        if ((fv=BiddyV(f)) == v) {
-          /* VARIANT 1 */
-          /**/
-          if (v == tag) {
-            e = BiddyE(f);
-            t = BiddyT(f);
-          } else {
-            e = BiddyManagedTaggedFoaNode(MNG,v,BiddyE(f),BiddyE(f),tag,TRUE);
-            BiddyRefresh(e); /* FoaNode returns an obsolete node! */
-            t = BiddyManagedTaggedFoaNode(MNG,v,BiddyT(f),BiddyT(f),tag,TRUE);
-            BiddyRefresh(t); /* FoaNode returns an obsolete node! */
-          }
-          r = BiddyManagedITE(MNG,g,t,e);
-          /**/
-          /* VARIANT 2 - THIS COULD BE BETTER FOR SOME EXAMPLES */
-          /*
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyOne,biddyOne,tag,TRUE);
-          BiddyRefresh(r);
-          e = BiddyE(f);
-          t = BiddyT(f);
-          r = BiddyManagedAnd(MNG,r,BiddyManagedITE(MNG,g,t,e));
-          */
-          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      tagF = BiddyGetTag(f);
+      tagG = BiddyGetTag(g);
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      if (tagF != tagG) v = rtag;
+      if (tagF == rtag) {
+        if (topF == v) {
+          Fneg_v = BiddyE(f);
+          Fv = BiddyT(f);
+        } else {
+          Fneg_v = f;
+          BiddySetTag(Fneg_v,v);
+          Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+          Fv = biddyZero;
         }
-        else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-          r = BiddyManagedRestrict(MNG,f,v,FALSE);
-          r = BiddyManagedITE(MNG,g,biddyZero,r);
-          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (tagG == rtag) {
+        if (topG == v) {
+          Gneg_v = BiddyE(g);
+          Gv = BiddyT(g);
         } else {
-          /* VARIANT 1 */
-          /**/
-          r = BiddyManagedTaggedFoaNode(MNG,fv,biddyOne,biddyOne,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          e = BiddyManagedCompose(MNG,BiddyE(f),g,v);
-          t = BiddyManagedCompose(MNG,BiddyT(f),g,v);
-          r = BiddyManagedAnd(MNG,r,BiddyManagedITE(MNG,biddyVariableTable.table[fv].variable,t,e));
-          /**/
-          /* VARIANT 2 - THIS SEEMS TO BE SLOWER */
-          /*
-          e = BiddyManagedTaggedFoaNode(MNG,fv,biddyOne,biddyZero,tag,TRUE);
-          BiddyRefresh(e);
-          t = BiddyManagedTaggedFoaNode(MNG,fv,biddyZero,biddyOne,tag,TRUE);
-          BiddyRefresh(t);
-          e = BiddyManagedAnd(MNG,e,BiddyManagedCompose(MNG,BiddyE(f),g,v));
-          t = BiddyManagedAnd(MNG,t,BiddyManagedCompose(MNG,BiddyT(f),g,v));
-          r = BiddyManagedXor(MNG,e,t);
-          */
-          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+          Gneg_v = g;
+          BiddySetTag(Gneg_v,v);
+          Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+          Gv = biddyZero;
         }
+      } else {
+        Gneg_v = Gv = g;
       }
+
     }
 #endif
 
+    /* RECURSIVE CALLS */
+    /* returning biddyOne in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+    /* using Not in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+    /* because top variable of biddyOne/result may be lower (topmore) than top variables of the arguments */
+    /* (i.e. because biddyOne/result depends on domain) */
+
+    /* ZBDD AND ZBDDC ARE ALREADY CALCULATED */
+    if (Fneg_v == biddyZero) {
+      E = biddyOne;
+    } else if (Gneg_v == biddyZero) {
+      E = BiddyManagedNot(MNG,Fneg_v);
+    } else if (Fneg_v == biddyOne) {
+      E = Gneg_v;
+    } else if (Gneg_v == biddyOne) {
+      E = biddyOne;
+    } else if (Fneg_v == Gneg_v) {
+      E = biddyOne;
+    } else  {
+      E = BiddyManagedLeq(MNG,Fneg_v,Gneg_v);
+    }
+    if (Fv == biddyZero) {
+      T = biddyOne;
+    } else if (Gv == biddyZero) {
+      T = BiddyManagedNot(MNG,Fv);
+    } else if (Fv == biddyOne) {
+      T = Gv;
+    } else if (Gv == biddyOne) {
+      T = biddyOne;
+    } else if (Fv == Gv) {
+      T = biddyOne;
+    } else  {
+      T = BiddyManagedLeq(MNG,Fv,Gv);
+    }
+
+    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
+    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+    addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+
   } else {
 
-    /* IF THE RESULT IS FROM CACHE TABLE, FRESH IT! */
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
     BiddyRefresh(r);
 
   }
@@ -6199,31 +6560,37 @@ BiddyManagedCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedE.
+\brief Function BiddyManagedGt.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_E.
+    See Biddy_Managed_Gt.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedE(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
+BiddyManagedGt(const Biddy_Manager MNG, const Biddy_Edge f, const Biddy_Edge g)
 {
-  Biddy_Edge h;
-  Biddy_Edge e, t, r;
-  Biddy_Variable fv;
-  unsigned int cindex;
-
+  Biddy_Edge r, T, E, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Edge FF, GG, HH;
+  Biddy_Variable v,rtag;
+  unsigned int cindex;
+
+  Biddy_Variable topF;
+  Biddy_Variable topG;
+
 #ifndef COMPACT
-  Biddy_Variable tag;
+  Biddy_Variable tagF;
+  Biddy_Variable tagG;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( v != 0);
+  assert( g != NULL );
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  r = biddyNull;
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -6232,171 +6599,260 @@ BiddyManagedE(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  fv = 0;
-  r = biddyNull;
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
 
-#ifndef COMPACT
-  tag = 0;
-#endif
+    /* FOR OBDDC, PROCEED BY CALCULATING NOT-AND */
 
-  /* LOOKING FOR SIMPLE CASE */
-  if (f == biddyZero) return biddyZero;
+    r = BiddyManagedAnd(MNG,f,BiddyInv(g));
+    return r;
 
-  h = biddyNull;
+  }
 
-  /* h MUST BE COMPATIBLE WITH CUBE */
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    fv = BiddyV(f);
-    if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
-    }
-    h = biddyVariableTable.table[v].variable;
+  /* LOOKING FOR SIMPLE CASE */
+  /* using BiddyManagedNot in a RECURSIVE call is wrong for ZBDD and ZBDDC */
+  /* because top variable of the result may be lower (topmore) than top variables of the arguments */
+  /* (i.e. because the result depends on domain) */
+
+  if (f == biddyZero) {
+    return biddyZero;
+  } else if (g == biddyZero) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  } else if (f == biddyOne) {
+    /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+    return BiddyManagedNot(MNG,g);
+  } else if (g == biddyOne) {
+    return biddyZero;
+  } else if (f == g) {
+    return biddyZero;
   }
+
 #ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    h = biddyVariableTable.table[v].element;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    tag = BiddyGetTag(f);
-    if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
+  if (biddyManagerType == BIDDYTYPETZBDD) {
+    if (BiddyR(f) == BiddyR(g)) {
+      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
+        return biddyZero;
+      }
     }
-    h = biddyVariableTable.table[v].variable;
   }
 #endif
 
+  /* THIS IS NOT A SIMPLE CASE */
+
+  FF = GG = HH = biddyNull;
+  Fneg_v = Fv = biddyNull;
+  Gneg_v = Gv = biddyNull;
+  rtag = 0;
+  v = 0;
+
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* ALREADY CALCULATED */
+  }
+
+  else {
+
+    if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
+
+    /* FF, GG, and HH ARE USED FOR CACHE LOOKUP, ONLY */
+    /* THIS IS NOT ITE CACHE! */
+
+    FF = f;
+    GG = g;
+    HH = g;
+
+  }
+
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
   cindex = 0;
-  if ((((uintptr_t) f) > ((uintptr_t) biddyOne)) ?
-      !findOp3Cache(biddyEACache,biddyOne,f,h,&r,&cindex) :
-      !findOp3Cache(biddyEACache,f,biddyOne,h,&r,&cindex))
+  if ((((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD))
+       && BiddyIsSmaller(biddyOrderingTable,BiddyV(g),BiddyV(f))
+       && (biddyNodeTable.zbddskip != BIDDYZBDDSKIPCACHE)
+      ) || !findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      if (fv == v) {
-        r = BiddyManagedOr(MNG,
-                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
-                           BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
+
+      /* FOR OBDDC THE RESULTS HAS BEEN ALREADY CALCULATED */
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      if (topF == v) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = Fv = f;
       }
-      else {
-        e = BiddyManagedE(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedE(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+      if (topG == v) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = Gv = g;
       }
+
+      rtag = v;
+
     }
 
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        r = BiddyManagedOr(MNG,
-                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
-                           BiddyT(f));
-        r = BiddyManagedTaggedFoaNode(MNG,v,r,r,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-      else {
-        e = BiddyManagedE(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedE(MNG,BiddyT(f),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-    }
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
-      if ((fv=BiddyV(f)) == v) {
-        r = BiddyManagedOr(MNG,BiddyE(f),BiddyT(f));
-        if (v != tag) {
-          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* THIS CALL IS NOT INTRODUCING NEW NODES */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      /* SKIPPING IS THE SAME AS IN BiddyManagedAnd (SEE Biddy_SetZBDDSkip) */
+      if (topF != v) {
+        if (biddyNodeTable.zbddskip == BIDDYZBDDSKIPJUMP) {
+          Gneg_v = g;
+          do {
+            Gneg_v = BiddyInvCond(BiddyE(Gneg_v),BiddyGetMark(Gneg_v));
+          } while ((Gneg_v != biddyZero) &&
+                   BiddyIsSmaller(biddyOrderingTable,BiddyV(Gneg_v),topF));
+          r = BiddyManagedGt(MNG,f,Gneg_v);
+          return r;
         }
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        if (v == tag) {
-          r = BiddyManagedIncTag(MNG,f);
-        } else {
-          r = f;
-          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
-          BiddySetTag(r,v);
-          r = BiddyManagedIncTag(MNG,r);
-          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        r = BiddyManagedGt(MNG,f,BiddyInvCond(BiddyE(g),BiddyGetMark(g)));
+        if (biddyNodeTable.zbddskip == BIDDYZBDDSKIPCACHE) {
+          addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
         }
+        return r;
+      }
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* IT IS ALREADY KNOWN THAT topF == v */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      Fv = BiddyT(f);
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
       } else {
-        e = BiddyManagedE(MNG,BiddyE(f),v);
-        t = BiddyManagedE(MNG,BiddyT(f),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+         Gneg_v = g;
+         Gv = biddyZero;
       }
-    }
-#endif
 
-    /* CACHE FOR Ex(v)(f*1), f*1 <=> 1*f */
-    if (((uintptr_t) f) > ((uintptr_t) biddyOne)) {
-      addOp3Cache(biddyEACache,biddyOne,f,h,r,cindex);
-    } else {
-      addOp3Cache(biddyEACache,f,biddyOne,h,r,cindex);
-    }
+      rtag = v;
 
-  } else {
+    }
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-  }
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      tagF = BiddyGetTag(f);
+      tagG = BiddyGetTag(g);
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG;
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
 
-  return r;
-}
+      if (BiddyIsSmaller(biddyOrderingTable,tagG,tagF)) v = rtag;
 
-/***************************************************************************//*!
-\brief Function BiddyManagedA.
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
+        Fneg_v = Fv = f;
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,topF)) {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+      } else {
+        /* HERE topF == v */
+        /* TO DO: CHECK And FOR OPTIMIZATION */
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
+        Gneg_v = Gv = g;
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,topG)) {
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = biddyZero;
+      } else {
+        /* HERE topG == v */
+        /* TO DO: CHECK And FOR OPTIMIZATION */
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      }
 
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_A.
-*******************************************************************************/
+    }
+#endif
 
-Biddy_Edge
-BiddyManagedA(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
-{
-  Biddy_Edge r;
+    /* RECURSIVE CALLS */
+    /* using BiddyManagedNot in a recursive call is wrong for ZBDD and ZBDDC, */
+    /* because top variable of the result may be lower (topmore) than top variables of the arguments */
+    /* (i.e. because the result depends on domain) */
 
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( v != 0);
+    if (Fneg_v == biddyZero) {
+      E = biddyZero;
+    } else if (Gneg_v == biddyZero) {
+      E = Fneg_v;
+    } else if (Fneg_v == biddyOne) {
+      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+      E = BiddyManagedNot(MNG,Gneg_v);
+    } else if (Gneg_v == biddyOne) {
+      E = biddyZero;
+    } else if (Fneg_v == Gneg_v) {
+      E = biddyZero;
+    } else  {
+      E = BiddyManagedGt(MNG,Fneg_v,Gneg_v);
+    }
+    if (Fv == biddyZero) {
+      T = biddyZero;
+    } else if (Gv == biddyZero) {
+      T = Fv;
+    } else if (Fv == biddyOne) {
+      /* FOR ZBDD AND ZBDDC THIS LINE IS NOT REACHABLE IN RECURSIVE CALLS */
+      T = BiddyManagedNot(MNG,Gv);
+    } else if (Gv == biddyOne) {
+      T = biddyZero;
+    } else if (Fv == Gv) {
+      T = biddyZero;
+    } else  {
+      T = BiddyManagedGt(MNG,Fv,Gv);
+    }
 
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
+    r = BiddyManagedTaggedFoaNode(MNG,v,E,T,rtag,TRUE);
+    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-  /* LOOKING FOR SIMPLE CASE */
-  if (BiddyIsTerminal(f)) return f;
+    addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
 
-  /* PROCEED BY CALCULATING NOT (EX v NOT f) */
-  r = BiddyInv(BiddyManagedE(MNG,BiddyInv(f),v));
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedExistAbstract.
+\brief Function BiddyManagedRestrict.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_ExistAbstract.
+    See Biddy_Managed_Restrict.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedExistAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
+BiddyManagedRestrict(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v,
+                     Biddy_Boolean value)
 {
   Biddy_Edge e, t, r;
-  Biddy_Variable fv,cv;
+  Biddy_Variable fv;
+  Biddy_Edge FF, GG, HH;
   unsigned int cindex;
 
 #ifndef COMPACT
@@ -6405,7 +6861,7 @@ BiddyManagedExistAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( cube != NULL );
+  assert( v != 0);
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -6418,158 +6874,136 @@ BiddyManagedExistAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
 
   r = biddyNull;
 
-  /* LOOKING FOR SIMPLE CASE */
   if (f == biddyZero) return biddyZero;
 
+  FF = f;
+  GG = value?biddyZero:biddyOne;
+  HH = biddyNull;
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    HH = biddyVariableTable.table[v].variable;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    HH = biddyVariableTable.table[v].element;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    HH = biddyVariableTable.table[v].variable;
+  }
+#endif
+
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  /* Result is stored in cache only if recursive calls are needed */
+  /* I am not sure if this is a good strategy! */
   cindex = 0;
-  if ((((uintptr_t) f) > ((uintptr_t) biddyOne)) ?
-      !findOp3Cache(biddyEACache,biddyOne,f,cube,&r,&cindex) :
-      !findOp3Cache(biddyEACache,f,biddyOne,cube,&r,&cindex))
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      fv = BiddyV(f);
-      cv = BiddyV(cube);
-      while (!BiddyIsTerminal(cube) && BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
-        cube = BiddyT(cube);
-        cv = BiddyV(cube);
+      if ((fv=BiddyV(f)) == v) {
+        if (value) {
+          r = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+        } else {
+          r = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+        }
       }
-      if (BiddyIsTerminal(cube)) {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = f;
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
       }
-      if (cv == fv) {
-        e = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),BiddyT(cube));
-        t = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyT(f),BiddyGetMark(f)),BiddyT(cube));
-        r = BiddyManagedOr(MNG,e,t);
-      } else {
-        e = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),cube);
-        t = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyT(f),BiddyGetMark(f)),cube);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+      else {
+        e = BiddyManagedRestrict(MNG,BiddyE(f),v,value);
+        t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
+        r = BiddyInvCond(BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE),BiddyGetMark(f));
         BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
       }
     }
 
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      if (BiddyIsTerminal(cube)) {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
+      if ((fv=BiddyV(f)) == v) {
+        if (value) {
+          t = BiddyT(f);
+          r = BiddyManagedTaggedFoaNode(MNG,v,t,t,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          e = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          r = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
       }
-      cv = BiddyV(cube);
-      fv = BiddyV(f);
-      if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
-        r = BiddyManagedExistAbstract(MNG,f,BiddyT(cube));
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE); /* REMOVE THIS LINE TO GET ElementAbstract */
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        if (value) {
+          r = biddyZero;
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
       }
-      else if (cv == fv) {
-        e = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),BiddyT(cube));
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
-        r = BiddyManagedOr(MNG,e,t);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE); /* REMOVE THIS LINE TO GET ElementAbstract */
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      } else {
-        e = BiddyManagedExistAbstract(MNG,
-              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),cube);
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
+      else {
+        e = BiddyManagedRestrict(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
+        t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
         r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
         BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
       }
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
       tag = BiddyGetTag(f);
-      cv = BiddyV(cube);
-      while (!BiddyIsTerminal(cube) && BiddyIsSmaller(biddyOrderingTable,cv,tag)) {
-        cube = BiddyT(cube);
-        cv = BiddyV(cube);
-      }
-      if (BiddyIsTerminal(cube)) {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
-      }
-      fv = BiddyV(f);
-
-      /* VARIANT 1 */
-      /*
-      if (cv == tag) {
-        if (tag == fv) {
-          e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
-          t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
-          r = BiddyManagedOr(MNG,e,t);
-        } else {
-          r = BiddyManagedIncTag(MNG,f);
-          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
-        }
-      } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
         r = f;
-        / * BiddyRefresh(r); * / / * return non-obsolete node even if the parameter is an obsolete node * /
-        BiddySetTag(r,cv);
-        r = BiddyManagedIncTag(MNG,r);
-        r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      } else if (cv == fv) {
-        e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
-        r = BiddyManagedOr(MNG,e,t);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
       } else {
-        e = BiddyManagedExistAbstract(MNG,BiddyE(f),cube);
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+        fv = BiddyV(f);
+        if (v == fv) {
+          if (v == tag) {
+            if (value) {
+              r = BiddyT(f);
+              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+            } else {
+              r = BiddyE(f);
+              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+            }
+          } else {
+            if (value) {
+              t = BiddyT(f);
+              r = BiddyManagedTaggedFoaNode(MNG,v,t,t,tag,TRUE);
+              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+            } else {
+              e = BiddyE(f);
+              r = BiddyManagedTaggedFoaNode(MNG,v,e,e,tag,TRUE);
+              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+            }
+          }
+        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+          if (value) {
+            r = biddyZero;
+          } else {
+            if (v == tag) {
+              r = BiddyManagedIncTag(MNG,f);
+            } else {
+              r = f;
+              /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
+              BiddySetTag(r,v);
+              r = BiddyManagedIncTag(MNG,r);
+              r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
+              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+            }
+          }
+        } else {
+          e = BiddyManagedRestrict(MNG,BiddyE(f),v,value);
+          t = BiddyManagedRestrict(MNG,BiddyT(f),v,value);
+          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+        }
       }
-      */
-
-      /* VARIANT 2 */
-      /**/
-      if (cv == fv) {
-        e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
-        r = BiddyManagedOr(MNG,e,t);
-        if (cv != tag) {
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-      } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
-        if (cv == tag) {
-          r = BiddyManagedIncTag(MNG,f);
-          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
-        } else {
-          r = f;
-          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
-          BiddySetTag(r,cv);
-          r = BiddyManagedIncTag(MNG,r);
-          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-      } else {
-        e = BiddyManagedExistAbstract(MNG,BiddyE(f),cube);
-        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-      /**/
-
-    }
-#endif
-
-    /* CACHE EVERYTHING */
-    if (((uintptr_t) f) > ((uintptr_t) biddyOne)) {
-      addOp3Cache(biddyEACache,biddyOne,f,cube,r,cindex);
-    } else {
-      addOp3Cache(biddyEACache,f,biddyOne,cube,r,cindex);
-    }
+    }
+#endif
 
   } else {
 
@@ -6582,34 +7016,33 @@ BiddyManagedExistAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedExistAndAbstract.
+\brief Function BiddyManagedCompose.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_ExistAndAbstract.
+    See Biddy_Managed_Compose.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedExistAndAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
-                             Biddy_Edge cube)
+BiddyManagedCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
+                    Biddy_Variable v)
 {
-  Biddy_Edge f0,f1,g0,g1;
   Biddy_Edge e, t, r;
-  Biddy_Variable fv,gv,minv,cv;
+  Biddy_Variable fv;
+  Biddy_Edge FF, GG, HH;
   unsigned int cindex;
 
 #ifndef COMPACT
-  Biddy_Variable ftag,gtag,mintag;
-  Biddy_Boolean cgt;
+  Biddy_Variable tag;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
-  assert( cube != NULL );
+  assert( v != 0);
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -6620,323 +7053,146 @@ BiddyManagedExistAndAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
 
   r = biddyNull;
 
-  /* LOOKING FOR SIMPLE CASE */
-  if ((f == biddyZero) || (g == biddyZero)) {
-    return biddyZero;
-  } else if (BiddyIsTerminal(cube)) {
-    return BiddyManagedAnd(MNG,f,g);
-  } else if (f == biddyOne) {
-    return BiddyManagedExistAbstract(MNG,g,cube);
-  } else if (g == biddyOne) {
-    return BiddyManagedExistAbstract(MNG,f,cube);
-  } else if (f == g) {
-    return BiddyManagedExistAbstract(MNG,f,cube);
-  }
+  if (f == biddyZero) return biddyZero;
 
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyIsEqvPointer(f,g)) {
-      return biddyZero;
-    }
-  }
+  FF = f;
+  GG = g;
+  HH = biddyNull;
 
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    HH = biddyVariableTable.table[v].variable;
+  }
 #ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    HH = biddyVariableTable.table[v].element;
+  }
   else if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (BiddyR(f) == BiddyR(g)) {
-      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
-        return BiddyManagedExistAbstract(MNG,f,cube);
-      } else {
-        return BiddyManagedExistAbstract(MNG,g,cube);
-      }
-    }
+    HH = biddyVariableTable.table[v].variable;
   }
 #endif
 
-  /* NORMALIZATION */
-  if (((uintptr_t) f) > ((uintptr_t) g)) {
-    exchangeEdges(&f,&g);
-  }
-
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
   cindex = 0;
-  if (!findOp3Cache(biddyEACache,f,g,cube,&r,&cindex))
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      fv = BiddyV(f);
-      gv = BiddyV(g);
-      if (BiddyIsSmaller(biddyOrderingTable,fv,gv)) {
-        f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-        g0 = g;
-        g1 = g;
-        minv = fv;
-      } else if (BiddyIsSmaller(biddyOrderingTable,gv,fv)) {
-        f0 = f;
-        f1 = f;
-        g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        g1 = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-        minv = gv;
-      } else {
-        f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-        g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        g1 = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-        minv = fv;
+      if ((fv=BiddyV(f)) == v) {
+        r = BiddyInvCond(BiddyManagedITE(MNG,g,BiddyT(f),BiddyE(f)),BiddyGetMark(f));
       }
-      cv = BiddyV(cube);
-      while (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
-        cube = BiddyT(cube);
-        cv = BiddyV(cube);
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = f;
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
       }
-      /* if (!cv) return BiddyManagedAnd(MNG,f,g); */ /* unnecessary */
-      if (minv == cv) {
-        /* Tricky optimizations are from: */
-        /* B. Yang et al. A Performance Study of BDD-Based Model Checking. 1998. */
-        /* http://fmv.jku.at/papers/YangEtAl-FMCAD98.pdf */
-        e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
-        if (e == biddyOne) return biddyOne;
-        if ((e == f1) || (e == g1)) {
-          r = e;
-          /**/ return r; /**/ /* I AM NOT SURE IF THIS SHOULD BE CACHED */
+      else {
+        e = BiddyManagedCompose(MNG,BiddyE(f),g,v);
+        t = BiddyManagedCompose(MNG,BiddyT(f),g,v);
+        /* VARIANT A: USE TRUE FOR THE FIRST CONDITION */
+        /* VARIANT B: USE FALSE FOR THE FIRST CONDITION */
+        if (TRUE && BiddyIsSmaller(biddyOrderingTable,fv,BiddyV(e)) && BiddyIsSmaller(biddyOrderingTable,fv,BiddyV(t))) {
+          r = BiddyInvCond(BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE),BiddyGetMark(f));
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
         } else {
-          if (e == BiddyInv(f1)) f1 = biddyOne; /* this is useful only for OBDDC, but not wrong for OBDD */
-          if (e == BiddyInv(g1)) g1 = biddyOne; /* this is useful only for OBDDC, but not wrong for OBDD */
-          t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
-          r = BiddyManagedOr(MNG,e,t);
+          r = BiddyInvCond(BiddyManagedITE(MNG,biddyVariableTable.table[fv].variable,t,e),BiddyGetMark(f));
         }
-      } else {
-        e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
-        t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,minv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
       }
     }
 
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      fv = BiddyV(f);
-      gv = BiddyV(g);
-      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
-      if (fv != gv) {
-        if (fv == minv) {
-          if (BiddyGetMark(f)) {
-            r = BiddyManagedExistAndAbstract(MNG,BiddyInv(BiddyE(f)),g,cube);
-            /* return r; */ /* WE ARE CASHING THIS */
-          } else {
-            r = BiddyManagedExistAndAbstract(MNG,BiddyE(f),g,cube);
-            /* return r; */ /* WE ARE CASHING THIS */
-          }
-        } else {
-          if (BiddyGetMark(g)) {
-            r = BiddyManagedExistAndAbstract(MNG,f,BiddyInv(BiddyE(g)),cube);
-            /* return r; */ /* WE ARE CASHING THIS */
-          } else {
-            r = BiddyManagedExistAndAbstract(MNG,f,BiddyE(g),cube);
-            /* return r; */ /* WE ARE CASHING THIS */
-          }
-        }
-      } else {
-        cv = BiddyV(cube);
-        if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
-          r = BiddyManagedExistAndAbstract(MNG,f,g,BiddyT(cube));
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-        else if (cv == minv) {
-          f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-          f1 = BiddyT(f);
-          g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-          g1 = BiddyT(g);
-          e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
-          t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
-          r = BiddyManagedOr(MNG,e,t);
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-          f1 = BiddyT(f);
-          g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-          g1 = BiddyT(g);
-          e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
-          t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
-          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,minv,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
+      /* TO DO: Biddy_Replace USE DIFFERENT APPROACH */
+      /* TO DO: check if that approach is applicable and more efficient */
+      if ((fv=BiddyV(f)) == v) {
+        e = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        e = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
+        BiddyRefresh(e); /* FoaNode returns an obsolete node! */
+        t = BiddyT(f);
+        t = BiddyManagedTaggedFoaNode(MNG,v,t,t,v,TRUE);
+        BiddyRefresh(t); /* FoaNode returns an obsolete node! */
+        r = BiddyManagedITE(MNG,g,t,e);
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+      }
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        r = BiddyManagedITE(MNG,g,biddyZero,r);
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+      }
+      else {
+        e = BiddyManagedCompose(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),g,v);
+        t = BiddyManagedCompose(MNG,BiddyT(f),BiddyManagedChange(MNG,g,fv),v);
+        t = BiddyManagedChange(MNG,t,fv);
+        r = BiddyManagedXor(MNG,e,t);
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
       }
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
-      ftag = BiddyGetTag(f);
-      gtag = BiddyGetTag(g);
-      mintag = BiddyIsSmaller(biddyOrderingTable,ftag,gtag) ? ftag : gtag;
-      cv = BiddyV(cube);
-      while (BiddyIsSmaller(biddyOrderingTable,cv,mintag)) {
-        cube = BiddyT(cube);
-        cv = BiddyV(cube);
-      }
-      /* if (!cv) return BiddyManagedAnd(MNG,f,g); */ /* unnecessary */
-
-      /* VARIANT 1 */
-      /*
-      fv = BiddyV(f);
-      gv = BiddyV(g);
-      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
-      if (BiddyIsSmaller(biddyOrderingTable,fv,gtag)) {
-        f0 = BiddyE(f);
-        f1 = BiddyT(f);
-        g0 = g1 = g;
-      } else if (BiddyIsSmaller(biddyOrderingTable,gv,ftag)) {
-        f0 = f1 = f;
-        g0 = BiddyE(g);
-        g1 = BiddyT(g);
+      /* TO DO: Biddy_Replace USE DIFFERENT APPROACH */
+      /* TO DO: check if that approach is applicable and more efficient */
+      tag = BiddyGetTag(f);
+      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+        r = f;
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
       } else {
-        if (minv == fv) {
-          f0 = BiddyE(f);
-          f1 = BiddyT(f);
-        } else {
-          f0 = f;
-          BiddySetTag(f0,minv);
-          f0 = BiddyManagedIncTag(MNG,f0);
-          f1 = biddyZero;
-        }
-        if (minv == gv) {
-          g0 = BiddyE(g);
-          g1 = BiddyT(g);
-        } else {
-          g0 = g;
-          BiddySetTag(g0,minv);
-          g0 = BiddyManagedIncTag(MNG,g0);
-          g1 = biddyZero;
-        }
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,minv,cv)) {
-        e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
-        t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
-      } else {
-        e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
-        t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
-      }
-      if (cv == mintag) {
-        if (minv == mintag) {
-          r = BiddyManagedOr(MNG,e,t);
-        } else {
-          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
-          BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-          if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
+        if ((fv=BiddyV(f)) == v) {
+          /* VARIANT 1 */
+          /**/
+          if (v == tag) {
+            e = BiddyE(f);
+            t = BiddyT(f);
+          } else {
+            e = BiddyManagedTaggedFoaNode(MNG,v,BiddyE(f),BiddyE(f),tag,TRUE);
+            BiddyRefresh(e); /* FoaNode returns an obsolete node! */
+            t = BiddyManagedTaggedFoaNode(MNG,v,BiddyT(f),BiddyT(f),tag,TRUE);
+            BiddyRefresh(t); /* FoaNode returns an obsolete node! */
+          }
+          r = BiddyManagedITE(MNG,g,t,e);
+          /**/
+          /* VARIANT 2 - THIS COULD BE BETTER FOR SOME EXAMPLES */
+          /*
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyOne,biddyOne,tag,TRUE);
+          BiddyRefresh(r);
+          e = BiddyE(f);
+          t = BiddyT(f);
+          r = BiddyManagedAnd(MNG,r,BiddyManagedITE(MNG,g,t,e));
+          */
+          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
         }
-      } else if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-        r = BiddyManagedIncTag(MNG,r);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      } else if (cv == minv) {
-        r = BiddyManagedOr(MNG,e,t);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      } else {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      }
-      */
-
-      /* VARIANT 2 */
-      fv = BiddyV(f);
-      gv = BiddyV(g);
-      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
-      if (BiddyIsSmaller(biddyOrderingTable,minv,ftag)) {
-        f0 = f1 = f;
-      } else if (minv == fv) {
-        f0 = BiddyE(f);
-        f1 = BiddyT(f);
-      } else {
-        f0 = f;
-        BiddySetTag(f0,minv);
-        f0 = BiddyManagedIncTag(MNG,f0);
-        f1 = biddyZero;
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,minv,gtag)) {
-        g0 = g1 = g;
-      } else if (minv == gv) {
-        g0 = BiddyE(g);
-        g1 = BiddyT(g);
-      } else {
-        g0 = g;
-        BiddySetTag(g0,minv);
-        g0 = BiddyManagedIncTag(MNG,g0);
-        g1 = biddyZero;
-      }
-      cgt = BiddyIsSmaller(biddyOrderingTable,minv,cv);
-      if (f0 == biddyZero) {
-        e = biddyZero;
-      } else if (g0 == biddyZero) {
-        e = biddyZero;
-      } else {
-        e = BiddyManagedExistAndAbstract(MNG,f0,g0,cgt?cube:BiddyT(cube));
-      }
-      if (f1 == biddyZero) {
-        t = biddyZero;
-      } else if (g1 == biddyZero) {
-        t = biddyZero;
-      } else {
-        t = BiddyManagedExistAndAbstract(MNG,f1,g1,cgt?cube:BiddyT(cube));
-      }
-
-      /* VARIANT 2A */
-      /*
-      if (cv == mintag) {
-        if (minv == mintag) {
-          r = BiddyManagedOr(MNG,e,t);
+        else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+          r = BiddyManagedRestrict(MNG,f,v,FALSE);
+          r = BiddyManagedITE(MNG,g,biddyZero,r);
+          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
         } else {
-          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
-          BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-          if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
-        }
-      } else if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-        if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      } else if (cv == minv) {
-        r = BiddyManagedOr(MNG,e,t);
-        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      } else {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
-        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
-      }
-      */
-
-      /* VARIANT 2B */
-      if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
-        if (cv != mintag) {
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
-      } else if (cv == minv) {
-        r = BiddyManagedOr(MNG,e,t);
-        if (cv != mintag) {
-          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+          /* VARIANT 1 */
+          /**/
+          r = BiddyManagedTaggedFoaNode(MNG,fv,biddyOne,biddyOne,tag,TRUE);
           BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          e = BiddyManagedCompose(MNG,BiddyE(f),g,v);
+          t = BiddyManagedCompose(MNG,BiddyT(f),g,v);
+          r = BiddyManagedAnd(MNG,r,BiddyManagedITE(MNG,biddyVariableTable.table[fv].variable,t,e));
+          /**/
+          /* VARIANT 2 - THIS SEEMS TO BE SLOWER */
+          /*
+          e = BiddyManagedTaggedFoaNode(MNG,fv,biddyOne,biddyZero,tag,TRUE);
+          BiddyRefresh(e);
+          t = BiddyManagedTaggedFoaNode(MNG,fv,biddyZero,biddyOne,tag,TRUE);
+          BiddyRefresh(t);
+          e = BiddyManagedAnd(MNG,e,BiddyManagedCompose(MNG,BiddyE(f),g,v));
+          t = BiddyManagedAnd(MNG,t,BiddyManagedCompose(MNG,BiddyT(f),g,v));
+          r = BiddyManagedXor(MNG,e,t);
+          */
+          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
         }
-      } else {
-        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       }
-
     }
 #endif
 
-    /* CACHE EVERYTHING */
-    addOp3Cache(biddyEACache,f,g,cube,r,cindex);
-
   } else {
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    /* IF THE RESULT IS FROM CACHE TABLE, FRESH IT! */
     BiddyRefresh(r);
 
   }
@@ -6945,285 +7201,417 @@ BiddyManagedExistAndAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedUnivAbstract.
+\brief Function BiddyManagedE.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_UnivAbstract.
+    See Biddy_Managed_E.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedUnivAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
+BiddyManagedE(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
 {
-  Biddy_Edge r;
-
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( cube != NULL );
-
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
-
-  /* LOOKING FOR SIMPLE CASE */
-  if (BiddyIsTerminal(f)) return f;
-
-  /* PROCEED BY CALCULATING NOT (EX cube NOT f) */
-  r = BiddyInv(BiddyManagedExistAbstract(MNG,BiddyInv(f),cube));
-
-  return r;
-}
-
-/***************************************************************************//*!
-\brief Function BiddyManagedDiffAbstract.
-
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_DiffAbstract.
-*******************************************************************************/
+  Biddy_Edge h;
+  Biddy_Edge e, t, r;
+  Biddy_Variable fv;
+  unsigned int cindex;
 
-Biddy_Edge
-BiddyManagedDiffAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
-{
-  Biddy_Edge r;
+#ifndef COMPACT
+  Biddy_Variable tag;
+#endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( cube != NULL );
+  assert( v != 0);
 
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
 
-  /* NOT IMPLEMENTED, YET */
+  fv = 0;
   r = biddyNull;
 
-  return r;
-}
+#ifndef COMPACT
+  tag = 0;
+#endif
 
-/***************************************************************************//*!
-\brief Function BiddyManagedYesNoAbstract.
+  /* LOOKING FOR SIMPLE CASE */
+  if (f == biddyZero) return biddyZero;
 
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_YesNoAbstract.
-*******************************************************************************/
+  h = biddyNull;
 
-Biddy_Edge
-BiddyManagedYesNoAbstract(Biddy_Manager MNG, Biddy_Boolean type, Biddy_Edge f, Biddy_Edge cube)
-{
-  Biddy_Edge r;
+  /* h MUST BE COMPATIBLE WITH CUBE */
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    fv = BiddyV(f);
+    if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+    h = biddyVariableTable.table[v].variable;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    h = biddyVariableTable.table[v].element;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    tag = BiddyGetTag(f);
+    if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+    h = biddyVariableTable.table[v].variable;
+  }
+#endif
 
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( cube != NULL );
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if ((((uintptr_t) f) > ((uintptr_t) biddyOne)) ?
+      !findOp3Cache(biddyEACache,biddyOne,f,h,&r,&cindex) :
+      !findOp3Cache(biddyEACache,f,biddyOne,h,&r,&cindex))
+  {
 
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      if (fv == v) {
+        r = BiddyManagedOr(MNG,
+                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
+                           BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
+      }
+      else {
+        e = BiddyManagedE(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedE(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
 
-  /* NOT IMPLEMENTED, YET */
-  r = biddyNull;
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      if ((fv=BiddyV(f)) == v) {
+        r = BiddyManagedOr(MNG,
+                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
+                           BiddyT(f));
+        r = BiddyManagedTaggedFoaNode(MNG,v,r,r,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,v,f,f,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      else {
+        e = BiddyManagedE(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedE(MNG,BiddyT(f),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      if ((fv=BiddyV(f)) == v) {
+        r = BiddyManagedOr(MNG,BiddyE(f),BiddyT(f));
+        if (v != tag) {
+          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        if (v == tag) {
+          r = BiddyManagedIncTag(MNG,f);
+        } else {
+          r = f;
+          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
+          BiddySetTag(r,v);
+          r = BiddyManagedIncTag(MNG,r);
+          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        e = BiddyManagedE(MNG,BiddyE(f),v);
+        t = BiddyManagedE(MNG,BiddyT(f),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+#endif
+
+    /* CACHE FOR Ex(v)(f*1), f*1 <=> 1*f */
+    if (((uintptr_t) f) > ((uintptr_t) biddyOne)) {
+      addOp3Cache(biddyEACache,biddyOne,f,h,r,cindex);
+    } else {
+      addOp3Cache(biddyEACache,f,biddyOne,h,r,cindex);
+    }
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedConstrain.
+\brief Function BiddyManagedA.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Constrain.
+    See Biddy_Managed_A.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedConstrain(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge c)
+BiddyManagedA(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
 {
-  Biddy_Edge f0,f1,c0,c1;
-  Biddy_Edge e, t, r;
-  Biddy_Variable fv,cv,minv;
+  Biddy_Edge r;
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( c != NULL );
-
-  /* IMPLEMENTED FOR OBDD AND OBDDC */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC)
-  );
+  assert( v != 0);
 
-  r = biddyNull;
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
 
   /* LOOKING FOR SIMPLE CASE */
-  if (c == biddyZero) {
-    return biddyZero;
-  } else if (c == biddyOne) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  } else if (BiddyIsTerminal(f)) {
-    return f;
-  }
-
-  fv = BiddyV(f);
-  cv = BiddyV(c);
-
-  if (BiddyIsSmaller(biddyOrderingTable,fv,cv)) {
-    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-    c0 = c;
-    c1 = c;
-    minv = fv;
-  } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
-    f0 = f;
-    f1 = f;
-    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
-    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
-    minv = cv;
-  } else {
-    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
-    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
-    minv = cv;
-  }
-
-  if (c0 == biddyZero) return BiddyManagedConstrain(MNG,f1,c1);
-  if (c1 == biddyZero) return BiddyManagedConstrain(MNG,f0,c0);
+  if (BiddyIsTerminal(f)) return f;
 
-  e = BiddyManagedConstrain(MNG,f0,c0);
-  t = BiddyManagedConstrain(MNG,f1,c1);
-  r = BiddyManagedITE(MNG,biddyVariableTable.table[minv].variable,t,e);
+  /* PROCEED BY CALCULATING NOT (EX v NOT f) */
+  r = BiddyInv(BiddyManagedE(MNG,BiddyInv(f),v));
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedSimplify.
+\brief Function BiddyManagedExistAbstract.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Simplify.
+    See Biddy_Managed_ExistAbstract.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedSimplify(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge c)
+BiddyManagedExistAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
 {
-  Biddy_Edge f0,f1,c0,c1;
   Biddy_Edge e, t, r;
-  Biddy_Variable fv,cv,minv;
+  Biddy_Variable fv,cv;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tag;
+#endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( c != NULL );
+  assert( cube != NULL );
 
-  /* IMPLEMENTED FOR OBDD AND OBDDC */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC)
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
   );
 
   r = biddyNull;
 
   /* LOOKING FOR SIMPLE CASE */
-  if (c == biddyZero) return biddyNull;
-  if (c == biddyOne) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  } else if (BiddyIsTerminal(f)) {
-    return f;
-  }
-
-  /* THIS IS FROM 20-CS-626-001 */
-  /* http://gauss.ececs.uc.edu/Courses/c626/lectures/BDD/bdd-desc.pdf */
-  if (f == c) return biddyOne;
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (BiddyIsEqvPointer(f,c)) {
-      return biddyZero;
-    }
-  }
+  if (f == biddyZero) return biddyZero;
 
-  fv = BiddyV(f);
-  cv = BiddyV(c);
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if ((((uintptr_t) f) > ((uintptr_t) biddyOne)) ?
+      !findOp3Cache(biddyEACache,biddyOne,f,cube,&r,&cindex) :
+      !findOp3Cache(biddyEACache,f,biddyOne,cube,&r,&cindex))
+  {
 
-  /* SPECIAL CASE: f/~a == f/a */
-  if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
-    return BiddyManagedSimplify(MNG,f,BiddyManagedE(MNG,c,cv));
-  }
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      fv = BiddyV(f);
+      cv = BiddyV(cube);
+      while (!BiddyIsTerminal(cube) && BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+        cube = BiddyT(cube);
+        cv = BiddyV(cube);
+      }
+      if (BiddyIsTerminal(cube)) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      }
+      if (cv == fv) {
+        e = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),BiddyT(cube));
+        t = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyT(f),BiddyGetMark(f)),BiddyT(cube));
+        r = BiddyManagedOr(MNG,e,t);
+      } else {
+        e = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),cube);
+        t = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyT(f),BiddyGetMark(f)),cube);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
 
-  if (BiddyIsSmaller(biddyOrderingTable,fv,cv)) {
-    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-    c0 = c;
-    c1 = c;
-    minv = fv;
-  } else {
-    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
-    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
-    minv = cv;
-  }
-
-  if (c0 == biddyZero) return BiddyManagedSimplify(MNG,f1,c1);
-  if (c1 == biddyZero) return BiddyManagedSimplify(MNG,f0,c0);
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      if (BiddyIsTerminal(cube)) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      }
+      cv = BiddyV(cube);
+      fv = BiddyV(f);
+      if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+        r = BiddyManagedExistAbstract(MNG,f,BiddyT(cube));
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE); /* REMOVE THIS LINE TO GET ElementAbstract */
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      else if (cv == fv) {
+        e = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),BiddyT(cube));
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
+        r = BiddyManagedOr(MNG,e,t);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE); /* REMOVE THIS LINE TO GET ElementAbstract */
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      } else {
+        e = BiddyManagedExistAbstract(MNG,
+              BiddyInvCond(BiddyE(f),BiddyGetMark(f)),cube);
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
 
-  e = BiddyManagedSimplify(MNG,f0,c0);
-  t = BiddyManagedSimplify(MNG,f1,c1);
-  r = BiddyManagedITE(MNG,biddyVariableTable.table[minv].variable,t,e);
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      tag = BiddyGetTag(f);
+      cv = BiddyV(cube);
+      while (!BiddyIsTerminal(cube) && BiddyIsSmaller(biddyOrderingTable,cv,tag)) {
+        cube = BiddyT(cube);
+        cv = BiddyV(cube);
+      }
+      if (BiddyIsTerminal(cube)) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      }
+      fv = BiddyV(f);
 
-  return r;
-}
+      /* VARIANT 1 */
+      /*
+      if (cv == tag) {
+        if (tag == fv) {
+          e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
+          t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
+          r = BiddyManagedOr(MNG,e,t);
+        } else {
+          r = BiddyManagedIncTag(MNG,f);
+          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+        r = f;
+        / * BiddyRefresh(r); * / / * return non-obsolete node even if the parameter is an obsolete node * /
+        BiddySetTag(r,cv);
+        r = BiddyManagedIncTag(MNG,r);
+        r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else if (cv == fv) {
+        e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
+        r = BiddyManagedOr(MNG,e,t);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else {
+        e = BiddyManagedExistAbstract(MNG,BiddyE(f),cube);
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      }
+      */
 
-/***************************************************************************//*!
-\brief Function BiddyManagedMedian.
+      /* VARIANT 2 */
+      /**/
+      if (cv == fv) {
+        e = BiddyManagedExistAbstract(MNG,BiddyE(f),BiddyT(cube));
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),BiddyT(cube));
+        r = BiddyManagedOr(MNG,e,t);
+        if (cv != tag) {
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+        if (cv == tag) {
+          r = BiddyManagedIncTag(MNG,f);
+          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
+        } else {
+          r = f;
+          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
+          BiddySetTag(r,cv);
+          r = BiddyManagedIncTag(MNG,r);
+          r = BiddyManagedExistAbstract(MNG,r,BiddyT(cube));
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        e = BiddyManagedExistAbstract(MNG,BiddyE(f),cube);
+        t = BiddyManagedExistAbstract(MNG,BiddyT(f),cube);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      /**/
 
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_Median.
-*******************************************************************************/
+    }
+#endif
 
-Biddy_Edge
-BiddyManagedMedian(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
-{
-  Biddy_Edge r;
+    /* CACHE EVERYTHING */
+    if (((uintptr_t) f) > ((uintptr_t) biddyOne)) {
+      addOp3Cache(biddyEACache,biddyOne,f,cube,r,cindex);
+    } else {
+      addOp3Cache(biddyEACache,f,biddyOne,cube,r,cindex);
+    }
 
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-  assert( h != NULL );
+  } else {
 
-  /* IMPLEMENTED FOR OBDDC, ONLY */
-  assert( biddyManagerType == BIDDYTYPEOBDDC );
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
 
-  /* NOT IMPLEMENTED, YET */
-  r = biddyNull;
+  }
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedSupport.
+\brief Function BiddyManagedExistAndAbstract.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Support.
+    See Biddy_Managed_ExistAndAbstract.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedSupport(Biddy_Manager MNG, Biddy_Edge f)
+BiddyManagedExistAndAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g,
+                             Biddy_Edge cube)
 {
-  Biddy_Variable v;
-  unsigned int n;
-  Biddy_Edge s;
+  Biddy_Edge f0,f1,g0,g1;
+  Biddy_Edge e, t, r;
+  Biddy_Variable fv,gv,minv,cv;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable ftag,gtag,mintag;
+  Biddy_Boolean cgt;
+#endif
 
   assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+  assert( cube != NULL );
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDDC, and TZBDD */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDDC */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
@@ -7232,232 +7620,2180 @@ BiddyManagedSupport(Biddy_Manager MNG, Biddy_Edge f)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  if (BiddyIsNull(f)) return biddyNull;
-  if (BiddyIsTerminal(f)) return biddyZero;
-
-  /* MAKE VARIABLES UNSELECTED */
-  /*
-  for (v=1;v<biddyVariableTable.num;v++) {
-    biddyVariableTable.table[v].selected = FALSE;
+  if (BiddyIterativeApply(MNG)) {
+    return applyIterative(MNG,APPLYEXISTAND,f,g,cube);
   }
-  */
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
-    BiddyManagedSelectNode(MNG,biddyTerminal); /* for OBDDs, this is needed for BiddyNodeVarNumber */
-    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, all nodes are selected */
-    BiddyManagedDeselectAll(MNG);
-  }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    BiddyCreateLocalInfo(MNG,f); /* FOR ZBDDs, localinfo IS USED BY BiddyNodeVarNumber */
-    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
-    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, selects all except terminal node */
-    BiddyDeleteLocalInfo(MNG,f); /* FOR ZBDDs, localinfo IS USED BY BiddyNodeVarNumber */
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
-    BiddyManagedSelectNode(MNG,biddyTerminal); /* for TZBDDs, this is needed for BiddyNodeVarNumber */
-    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, all nodes are selected */
-    BiddyManagedDeselectAll(MNG);
+  r = biddyNull;
+
+  /* LOOKING FOR SIMPLE CASE */
+  if ((f == biddyZero) || (g == biddyZero)) {
+    return biddyZero;
+  } else if (BiddyIsTerminal(cube)) {
+    return BiddyManagedAnd(MNG,f,g);
+  } else if (f == biddyOne) {
+    return BiddyManagedExistAbstract(MNG,g,cube);
+  } else if (g == biddyOne) {
+    return BiddyManagedExistAbstract(MNG,f,cube);
+  } else if (f == g) {
+    return BiddyManagedExistAbstract(MNG,f,cube);
   }
-#endif
 
-  s = biddyNull;
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    s = biddyOne;
-    for (v=1;v<biddyVariableTable.num;v++) {
-      if (biddyVariableTable.table[v].selected == TRUE) {
-        s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
-        biddyVariableTable.table[v].selected = FALSE;
-      }
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyIsEqvPointer(f,g)) {
+      return biddyZero;
     }
   }
+
 #ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    s = biddyTerminal; /* this is base set */
-    for (v=1;v<biddyVariableTable.num;v++) {
-      /* variables above the top variable (which are always all dependent) are not selected, yet */
-      if (BiddyIsSmaller(biddyOrderingTable,v,BiddyV(f))) biddyVariableTable.table[v].selected = TRUE;
-      if (biddyVariableTable.table[v].selected == TRUE)
-      {
-        s = BiddyManagedChange(MNG,s,v);
-        biddyVariableTable.table[v].selected = FALSE;
-      }
-    }
-  }
   else if (biddyManagerType == BIDDYTYPETZBDD) {
-    s = biddyOne;
-    for (v=1;v<biddyVariableTable.num;v++) {
-      if (biddyVariableTable.table[v].selected == TRUE) {
-        s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
-        biddyVariableTable.table[v].selected = FALSE;
+    if (BiddyR(f) == BiddyR(g)) {
+      if (BiddyIsSmaller(biddyOrderingTable,BiddyGetTag(f),BiddyGetTag(g))) {
+        return BiddyManagedExistAbstract(MNG,f,cube);
+      } else {
+        return BiddyManagedExistAbstract(MNG,g,cube);
       }
     }
-    /* variables above the top variable which are equal or greater than the top tag are also dependent */
-    v = BiddyGetTag(f);
-    while (BiddyIsSmaller(biddyOrderingTable,v,BiddyV(f))) {
-      s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
-      v = biddyVariableTable.table[v].next;
-    }
   }
 #endif
 
-  return s;
-}
-
+  /* NORMALIZATION */
+  if (((uintptr_t) f) > ((uintptr_t) g)) {
+    exchangeEdges(&f,&g);
+  }
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyEACache,f,g,cube,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      fv = BiddyV(f);
+      gv = BiddyV(g);
+      if (BiddyIsSmaller(biddyOrderingTable,fv,gv)) {
+        f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+        g0 = g;
+        g1 = g;
+        minv = fv;
+      } else if (BiddyIsSmaller(biddyOrderingTable,gv,fv)) {
+        f0 = f;
+        f1 = f;
+        g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        g1 = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+        minv = gv;
+      } else {
+        f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+        g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        g1 = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+        minv = fv;
+      }
+      cv = BiddyV(cube);
+      while (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
+        cube = BiddyT(cube);
+        cv = BiddyV(cube);
+      }
+      /* if (!cv) return BiddyManagedAnd(MNG,f,g); */ /* unnecessary */
+      if (minv == cv) {
+        /* Tricky optimizations are from: */
+        /* B. Yang et al. A Performance Study of BDD-Based Model Checking. 1998. */
+        /* http://fmv.jku.at/papers/YangEtAl-FMCAD98.pdf */
+        e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
+        if (e == biddyOne) return biddyOne;
+        if ((e == f1) || (e == g1)) {
+          r = e;
+          /**/ return r; /**/ /* I AM NOT SURE IF THIS SHOULD BE CACHED */
+        } else {
+          if (e == BiddyInv(f1)) f1 = biddyOne; /* this is useful only for OBDDC, but not wrong for OBDD */
+          if (e == BiddyInv(g1)) g1 = biddyOne; /* this is useful only for OBDDC, but not wrong for OBDD */
+          t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
+          r = BiddyManagedOr(MNG,e,t);
+        }
+      } else {
+#ifdef PARALLELAPPLY
+        /* THE SECOND RECURSIVE CALL MAY BE PERFORMED BY ANOTHER THREAD */
+        if (BiddyApplySpawn(MNG)) {
+          BiddyParallelApply(MNG,BiddyManagedExistAndAbstract,f0,g0,cube,&e,f1,g1,cube,&t);
+        } else
+#endif
+        {
+          e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
+          t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
+        }
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,minv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      fv = BiddyV(f);
+      gv = BiddyV(g);
+      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
+      if (fv != gv) {
+        if (fv == minv) {
+          if (BiddyGetMark(f)) {
+            r = BiddyManagedExistAndAbstract(MNG,BiddyInv(BiddyE(f)),g,cube);
+            /* return r; */ /* WE ARE CASHING THIS */
+          } else {
+            r = BiddyManagedExistAndAbstract(MNG,BiddyE(f),g,cube);
+            /* return r; */ /* WE ARE CASHING THIS */
+          }
+        } else {
+          if (BiddyGetMark(g)) {
+            r = BiddyManagedExistAndAbstract(MNG,f,BiddyInv(BiddyE(g)),cube);
+            /* return r; */ /* WE ARE CASHING THIS */
+          } else {
+            r = BiddyManagedExistAndAbstract(MNG,f,BiddyE(g),cube);
+            /* return r; */ /* WE ARE CASHING THIS */
+          }
+        }
+      } else {
+        cv = BiddyV(cube);
+        if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
+          r = BiddyManagedExistAndAbstract(MNG,f,g,BiddyT(cube));
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+        else if (cv == minv) {
+          f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          f1 = BiddyT(f);
+          g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+          g1 = BiddyT(g);
+#ifdef PARALLELAPPLY
+          /* THE SECOND RECURSIVE CALL MAY BE PERFORMED BY ANOTHER THREAD */
+          if (BiddyApplySpawn(MNG)) {
+            BiddyParallelApply(MNG,BiddyManagedExistAndAbstract,f0,g0,BiddyT(cube),&e,f1,g1,BiddyT(cube),&t);
+          } else
+#endif
+          {
+            e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
+            t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
+          }
+          r = BiddyManagedOr(MNG,e,t);
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,cv,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          f1 = BiddyT(f);
+          g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+          g1 = BiddyT(g);
+#ifdef PARALLELAPPLY
+          /* THE SECOND RECURSIVE CALL MAY BE PERFORMED BY ANOTHER THREAD */
+          if (BiddyApplySpawn(MNG)) {
+            BiddyParallelApply(MNG,BiddyManagedExistAndAbstract,f0,g0,cube,&e,f1,g1,cube,&t);
+          } else
+#endif
+          {
+            e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
+            t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
+          }
+          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,minv,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      ftag = BiddyGetTag(f);
+      gtag = BiddyGetTag(g);
+      mintag = BiddyIsSmaller(biddyOrderingTable,ftag,gtag) ? ftag : gtag;
+      cv = BiddyV(cube);
+      while (BiddyIsSmaller(biddyOrderingTable,cv,mintag)) {
+        cube = BiddyT(cube);
+        cv = BiddyV(cube);
+      }
+      /* if (!cv) return BiddyManagedAnd(MNG,f,g); */ /* unnecessary */
+
+      /* VARIANT 1 */
+      /*
+      fv = BiddyV(f);
+      gv = BiddyV(g);
+      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
+      if (BiddyIsSmaller(biddyOrderingTable,fv,gtag)) {
+        f0 = BiddyE(f);
+        f1 = BiddyT(f);
+        g0 = g1 = g;
+      } else if (BiddyIsSmaller(biddyOrderingTable,gv,ftag)) {
+        f0 = f1 = f;
+        g0 = BiddyE(g);
+        g1 = BiddyT(g);
+      } else {
+        if (minv == fv) {
+          f0 = BiddyE(f);
+          f1 = BiddyT(f);
+        } else {
+          f0 = f;
+          BiddySetTag(f0,minv);
+          f0 = BiddyManagedIncTag(MNG,f0);
+          f1 = biddyZero;
+        }
+        if (minv == gv) {
+          g0 = BiddyE(g);
+          g1 = BiddyT(g);
+        } else {
+          g0 = g;
+          BiddySetTag(g0,minv);
+          g0 = BiddyManagedIncTag(MNG,g0);
+          g1 = biddyZero;
+        }
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,minv,cv)) {
+        e = BiddyManagedExistAndAbstract(MNG,f0,g0,cube);
+        t = BiddyManagedExistAndAbstract(MNG,f1,g1,cube);
+      } else {
+        e = BiddyManagedExistAndAbstract(MNG,f0,g0,BiddyT(cube));
+        t = BiddyManagedExistAndAbstract(MNG,f1,g1,BiddyT(cube));
+      }
+      if (cv == mintag) {
+        if (minv == mintag) {
+          r = BiddyManagedOr(MNG,e,t);
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
+          BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+          if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+        r = BiddyManagedIncTag(MNG,r);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else if (cv == minv) {
+        r = BiddyManagedOr(MNG,e,t);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      }
+      */
+
+      /* VARIANT 2 */
+      fv = BiddyV(f);
+      gv = BiddyV(g);
+      minv = BiddyIsSmaller(biddyOrderingTable,fv,gv) ? fv : gv;
+      if (BiddyIsSmaller(biddyOrderingTable,minv,ftag)) {
+        f0 = f1 = f;
+      } else if (minv == fv) {
+        f0 = BiddyE(f);
+        f1 = BiddyT(f);
+      } else {
+        f0 = f;
+        BiddySetTag(f0,minv);
+        f0 = BiddyManagedIncTag(MNG,f0);
+        f1 = biddyZero;
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,minv,gtag)) {
+        g0 = g1 = g;
+      } else if (minv == gv) {
+        g0 = BiddyE(g);
+        g1 = BiddyT(g);
+      } else {
+        g0 = g;
+        BiddySetTag(g0,minv);
+        g0 = BiddyManagedIncTag(MNG,g0);
+        g1 = biddyZero;
+      }
+      cgt = BiddyIsSmaller(biddyOrderingTable,minv,cv);
+      if (f0 == biddyZero) {
+        e = biddyZero;
+      } else if (g0 == biddyZero) {
+        e = biddyZero;
+      } else {
+        e = BiddyManagedExistAndAbstract(MNG,f0,g0,cgt?cube:BiddyT(cube));
+      }
+      if (f1 == biddyZero) {
+        t = biddyZero;
+      } else if (g1 == biddyZero) {
+        t = biddyZero;
+      } else {
+        t = BiddyManagedExistAndAbstract(MNG,f1,g1,cgt?cube:BiddyT(cube));
+      }
+
+      /* VARIANT 2A */
+      /*
+      if (cv == mintag) {
+        if (minv == mintag) {
+          r = BiddyManagedOr(MNG,e,t);
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
+          BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+          if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+        if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else if (cv == minv) {
+        r = BiddyManagedOr(MNG,e,t);
+        r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      } else {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
+        BiddyRefresh(r); / * FoaNode returns an obsolete node! * /
+      }
+      */
+
+      /* VARIANT 2B */
+      if (BiddyIsSmaller(biddyOrderingTable,cv,minv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,cv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        if (r != biddyZero) r = BiddyManagedIncTag(MNG,r);
+        if (cv != mintag) {
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else if (cv == minv) {
+        r = BiddyManagedOr(MNG,e,t);
+        if (cv != mintag) {
+          r = BiddyManagedTaggedFoaNode(MNG,cv,r,r,mintag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        r = BiddyManagedTaggedFoaNode(MNG,minv,e,t,mintag,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+
+    }
+#endif
+
+    /* CACHE EVERYTHING */
+    addOp3Cache(biddyEACache,f,g,cube,r,cindex);
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedUnivAbstract.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_UnivAbstract.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedUnivAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( cube != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  /* LOOKING FOR SIMPLE CASE */
+  if (BiddyIsTerminal(f)) return f;
+
+  /* PROCEED BY CALCULATING NOT (EX cube NOT f) */
+  r = BiddyInv(BiddyManagedExistAbstract(MNG,BiddyInv(f),cube));
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedDiffAbstract.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_DiffAbstract.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedDiffAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( cube != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  /* NOT IMPLEMENTED, YET */
+  r = biddyNull;
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedYesNoAbstract.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_YesNoAbstract.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedYesNoAbstract(Biddy_Manager MNG, Biddy_Boolean type, Biddy_Edge f, Biddy_Edge cube)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( cube != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  /* NOT IMPLEMENTED, YET */
+  r = biddyNull;
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedConstrain.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Constrain.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedConstrain(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge c)
+{
+  Biddy_Edge f0,f1,c0,c1;
+  Biddy_Edge e, t, r;
+  Biddy_Variable fv,cv,minv;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( c != NULL );
+
+  /* IMPLEMENTED FOR OBDD AND OBDDC */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC)
+  );
+
+  r = biddyNull;
+
+  /* LOOKING FOR SIMPLE CASE */
+  if (c == biddyZero) {
+    return biddyZero;
+  } else if (c == biddyOne) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  } else if (BiddyIsTerminal(f)) {
+    return f;
+  }
+
+  fv = BiddyV(f);
+  cv = BiddyV(c);
+
+  if (BiddyIsSmaller(biddyOrderingTable,fv,cv)) {
+    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+    c0 = c;
+    c1 = c;
+    minv = fv;
+  } else if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+    f0 = f;
+    f1 = f;
+    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
+    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
+    minv = cv;
+  } else {
+    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
+    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
+    minv = cv;
+  }
+
+  if (c0 == biddyZero) return BiddyManagedConstrain(MNG,f1,c1);
+  if (c1 == biddyZero) return BiddyManagedConstrain(MNG,f0,c0);
+
+  e = BiddyManagedConstrain(MNG,f0,c0);
+  t = BiddyManagedConstrain(MNG,f1,c1);
+  r = BiddyManagedITE(MNG,biddyVariableTable.table[minv].variable,t,e);
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSimplify.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Simplify.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedSimplify(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge c)
+{
+  Biddy_Edge f0,f1,c0,c1;
+  Biddy_Edge e, t, r;
+  Biddy_Variable fv,cv,minv;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( c != NULL );
+
+  /* IMPLEMENTED FOR OBDD AND OBDDC */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC)
+  );
+
+  r = biddyNull;
+
+  /* LOOKING FOR SIMPLE CASE */
+  if (c == biddyZero) return biddyNull;
+  if (c == biddyOne) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  } else if (BiddyIsTerminal(f)) {
+    return f;
+  }
+
+  /* THIS IS FROM 20-CS-626-001 */
+  /* http://gauss.ececs.uc.edu/Courses/c626/lectures/BDD/bdd-desc.pdf */
+  if (f == c) return biddyOne;
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyIsEqvPointer(f,c)) {
+      return biddyZero;
+    }
+  }
+
+  fv = BiddyV(f);
+  cv = BiddyV(c);
+
+  /* SPECIAL CASE: f/~a == f/a */
+  if (BiddyIsSmaller(biddyOrderingTable,cv,fv)) {
+    return BiddyManagedSimplify(MNG,f,BiddyManagedE(MNG,c,cv));
+  }
+
+  if (BiddyIsSmaller(biddyOrderingTable,fv,cv)) {
+    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+    c0 = c;
+    c1 = c;
+    minv = fv;
+  } else {
+    f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    f1 = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+    c0 = BiddyInvCond(BiddyE(c),BiddyGetMark(c));
+    c1 = BiddyInvCond(BiddyT(c),BiddyGetMark(c));
+    minv = cv;
+  }
+
+  if (c0 == biddyZero) return BiddyManagedSimplify(MNG,f1,c1);
+  if (c1 == biddyZero) return BiddyManagedSimplify(MNG,f0,c0);
+
+  e = BiddyManagedSimplify(MNG,f0,c0);
+  t = BiddyManagedSimplify(MNG,f1,c1);
+  r = BiddyManagedITE(MNG,biddyVariableTable.table[minv].variable,t,e);
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedMedian.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Median.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedMedian(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
+{
+  Biddy_Edge r;
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+  assert( h != NULL );
+
+  /* IMPLEMENTED FOR OBDDC, ONLY */
+  assert( biddyManagerType == BIDDYTYPEOBDDC );
+
+  /* NOT IMPLEMENTED, YET */
+  r = biddyNull;
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSupport.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Support.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedSupport(Biddy_Manager MNG, Biddy_Edge f)
+{
+  Biddy_Variable v;
+  unsigned int n;
+  Biddy_Edge s;
+
+  assert( MNG != NULL );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDDC, and TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  if (BiddyIsNull(f)) return biddyNull;
+  if (BiddyIsTerminal(f)) return biddyZero;
+
+  /* MAKE VARIABLES UNSELECTED */
+  /*
+  for (v=1;v<biddyVariableTable.num;v++) {
+    biddyVariableTable.table[v].selected = FALSE;
+  }
+  */
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
+    BiddyManagedSelectNode(MNG,biddyTerminal); /* for OBDDs, this is needed for BiddyNodeVarNumber */
+    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, all nodes are selected */
+    BiddyManagedDeselectAll(MNG);
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    BiddyCreateLocalInfo(MNG,f); /* FOR ZBDDs, localinfo IS USED BY BiddyNodeVarNumber */
+    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
+    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, selects all except terminal node */
+    BiddyDeleteLocalInfo(MNG,f); /* FOR ZBDDs, localinfo IS USED BY BiddyNodeVarNumber */
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    n = 1; /* NUMBER OF NODES NOT NEEDED, BUT NODES ARE COUNTED BY BiddyNodeVarNumber */
+    BiddyManagedSelectNode(MNG,biddyTerminal); /* for TZBDDs, this is needed for BiddyNodeVarNumber */
+    BiddyNodeVarNumber(MNG,f,&n); /* DEPENDENT VARIABLES ARE MARKED, all nodes are selected */
+    BiddyManagedDeselectAll(MNG);
+  }
+#endif
+
+  s = biddyNull;
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    s = biddyOne;
+    for (v=1;v<biddyVariableTable.num;v++) {
+      if (biddyVariableTable.table[v].selected == TRUE) {
+        s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
+        biddyVariableTable.table[v].selected = FALSE;
+      }
+    }
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    s = biddyTerminal; /* this is base set */
+    for (v=1;v<biddyVariableTable.num;v++) {
+      /* variables above the top variable (which are always all dependent) are not selected, yet */
+      if (BiddyIsSmaller(biddyOrderingTable,v,BiddyV(f))) biddyVariableTable.table[v].selected = TRUE;
+      if (biddyVariableTable.table[v].selected == TRUE)
+      {
+        s = BiddyManagedChange(MNG,s,v);
+        biddyVariableTable.table[v].selected = FALSE;
+      }
+    }
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    s = biddyOne;
+    for (v=1;v<biddyVariableTable.num;v++) {
+      if (biddyVariableTable.table[v].selected == TRUE) {
+        s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
+        biddyVariableTable.table[v].selected = FALSE;
+      }
+    }
+    /* variables above the top variable which are equal or greater than the top tag are also dependent */
+    v = BiddyGetTag(f);
+    while (BiddyIsSmaller(biddyOrderingTable,v,BiddyV(f))) {
+      s = BiddyManagedAnd(MNG,s,biddyVariableTable.table[v].variable);
+      v = biddyVariableTable.table[v].next;
+    }
+  }
+#endif
+
+  return s;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedReplaceByKeyword.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_ReplaceByKeyword.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedReplaceByKeyword(Biddy_Manager MNG, Biddy_Edge f,
+                             Biddy_String keyword)
+{
+  Biddy_Edge r;
+  unsigned int key;
+  Biddy_Boolean OK;
+  int cc;
+  const Biddy_Boolean disableCache = FALSE;
+
+  assert( MNG != NULL );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, and TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  if (f == biddyZero) return biddyZero;
+  if (f == biddyOne) return biddyOne;
+
+  r = biddyNull;
+
+  /* find keyword in keywordList */
+
+  /* VARIANT A: LINEAR SEARCH */
+  key = 0;
+  if (!disableCache && keyword) {
+    OK = FALSE;
+    if (biddyReplaceCache.keywordList) {
+      for (key = 0; !OK && (key < biddyReplaceCache.keywordNum); key++) {
+        cc = strcmp(keyword,biddyReplaceCache.keywordList[key]);
+        if (cc == 0) {
+          OK = TRUE;
+          break;
+        }
+        if (cc < 0) break;
+      }
+    }
+  }
+
+  /* TO DO: BINARY SEARCH */
+  /* NOT IMPORTANT BECAUSE NUMBER OF KEYWORDS IS VERY SMALL IN THE PRACTICE */
+
+  if (disableCache || !keyword) {
+    /* keyword not given */
+    key = ++biddyReplaceCache.keyNum;
+  } else {
+    /* keyword given but not found - it will be added */
+    if (!OK) {
+      Biddy_String *tmp1;
+      unsigned int *tmp2;
+
+      biddyReplaceCache.keywordNum++;
+      if (!(tmp1 = (Biddy_String *)
+         realloc(biddyReplaceCache.keywordList,biddyReplaceCache.keywordNum*sizeof(Biddy_String))))
+      {
+        fprintf(stderr,"BiddyManagedReplaceByKeyword: Out of memoy!\n");
+        exit(1);
+      }
+      biddyReplaceCache.keywordList = tmp1;
+      if (!(tmp2 = (unsigned int *)
+         realloc(biddyReplaceCache.keyList,biddyReplaceCache.keywordNum*sizeof(unsigned int))))
+      {
+        fprintf(stderr,"BiddyManagedReplaceByKeyword: Out of memoy!\n");
+        exit(1);
+      }
+      biddyReplaceCache.keyList = tmp2;
+
+      memmove(&biddyReplaceCache.keywordList[key+1],&biddyReplaceCache.keywordList[key],(biddyReplaceCache.keywordNum-key-1)*sizeof(Biddy_String));
+      memmove(&biddyReplaceCache.keyList[key+1],&biddyReplaceCache.keyList[key],(biddyReplaceCache.keywordNum-key-1)*sizeof(unsigned int));
+      /*
+      for (i = biddyReplaceCache.keywordNum-1; i > key; i--) {
+        biddyReplaceCache.keywordList[i] = biddyReplaceCache.keywordList[i-1];
+        biddyReplaceCache.keyList[i] = biddyReplaceCache.keyList[i-1];
+      }
+      */
+
+      biddyReplaceCache.keywordList[key] = strdup(keyword);
+      biddyReplaceCache.keyList[key] = ++biddyReplaceCache.keyNum;
+    }
+    key = biddyReplaceCache.keyList[key];
+  }
+
+  /* DEBUGGING */
+  /*
+  fprintf(stderr,"ReplaceByKeyword: keyword = %s, key = %u\n",keyword,key);
+  */
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
+    r = replaceByKeyword(MNG,f,0,key);
+  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
+    r = replaceByKeyword(MNG,f,0,key);
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* NOT COMPLETELY IMPLEMENTED, YET */
+    /*
+    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); / * purge Replace cache * /
+    r = replaceByKeyword(MNG,f,BiddyManagedGetLowestVariable(MNG),key);
+    */
+  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* NOT COMPLETELY IMPLEMENTED, YET */
+    /*
+    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); / * purge Replace cache * /
+    r = replaceByKeyword(MNG,f,BiddyManagedGetLowestVariable(MNG),key);
+    */
+  } else if (biddyManagerType == BIDDYTYPETZBDD) {
+    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
+    r = replaceByKeyword(MNG,f,0,key);
+  }
+#endif
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedChange.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Change.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedChange(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
+{
+  Biddy_Edge e,t,r;
+  Biddy_Variable fv;
+  Biddy_Edge FF, GG, HH;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tag;
+#endif
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( v != 0);
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  if (f == biddyZero) return biddyZero;
+
+  r = biddyNull;
+
+  FF = f;
+  GG = biddyNull;
+  HH = biddyNull;
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    HH = biddyVariableTable.table[v].variable;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    HH = biddyVariableTable.table[v].element;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    HH = biddyVariableTable.table[v].variable;
+  }
+#endif
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
+  cindex = 0;
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      fv = BiddyV(f);
+      if (v == fv) {
+        e = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+        t = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = f;
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+      } else {
+        e = BiddyManagedChange(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedChange(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+      }
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      fv = BiddyV(f);
+      if (v == fv) {
+        e = BiddyT(f);
+        t = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      } else {
+        e = BiddyManagedChange(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedChange(MNG,BiddyT(f),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      tag = BiddyGetTag(f);
+      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+        r = f;
+        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+      } else {
+        fv = BiddyV(f);
+        if (v == fv) {
+          e = BiddyT(f);
+          t = BiddyE(f);
+          r = BiddyManagedTaggedFoaNode(MNG,v,e,t,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+          r = f;
+          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
+          BiddySetTag(r,v);
+          r = BiddyManagedIncTag(MNG,r);
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          e = BiddyManagedChange(MNG,BiddyE(f),v);
+          t = BiddyManagedChange(MNG,BiddyT(f),v);
+          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+        }
+      }
+    }
+#endif
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedVarSubset.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_VarSubset.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedVarSubset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v,
+                      Biddy_Boolean value)
+{
+  Biddy_Edge h;
+  Biddy_Edge e, t, r;
+  Biddy_Variable fv;
+  Biddy_Edge FF, GG, HH;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tag,ntag;
+#endif
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( v != 0);
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  if (f == biddyZero) return biddyZero;
+
+  r = biddyNull;
+
+  FF = biddyNull;
+  GG = biddyNull;
+  HH = biddyNull;
+  h = biddyNull;
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    h = biddyVariableTable.table[v].variable;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    h = biddyVariableTable.table[v].element;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    h = biddyVariableTable.table[v].variable;
+  }
+#endif
+
+  if (!value) {
+    h = BiddyManagedNot(MNG,h);
+  }
+
+  /* TO DO: CACHE TABLE FOR OBDDC COULD BE OPTIMIZED BY USING COMPLEMENTED EDGES */
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (((uintptr_t) f) > ((uintptr_t) h)) {
+      FF = f;
+      GG = h;
+      HH = biddyZero;
+    } else {
+      FF = h;
+      GG = f;
+      HH = biddyZero;
+    }
+  }
+  else {
+    if (((uintptr_t) f) > ((uintptr_t) h)) {
+      FF = f;
+      GG = h;
+      HH = biddyZero;
+    } else {
+      FF = h;
+      GG = f;
+      HH = biddyZero;
+    }
+  }
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
+  cindex = 0;
+  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
+  {
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      if ((fv=BiddyV(f)) == v) {
+        if (value) {
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,v,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),biddyZero,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      }
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        if (value) {
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        e = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
+        t = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v,value);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+      }
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      if ((fv=BiddyV(f)) == v) {
+        if (value) {
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyT(f),v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          r = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+        }
+      }
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        if (value) {
+          r = biddyZero;
+        } else {
+          r = f;
+          BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+        }
+      } else {
+        e = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
+        t = BiddyManagedVarSubset(MNG,BiddyT(f),v,value);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      tag = BiddyGetTag(f);
+      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+        if (value) {
+          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          ntag = biddyVariableTable.table[v].next;
+          if (tag == ntag) {
+            r = f;
+            BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+            BiddySetTag(r,v);
+          } else {
+            r = BiddyManagedTaggedFoaNode(MNG,ntag,f,f,v,TRUE);
+            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          }
+        }
+      } else {
+        fv = BiddyV(f);
+        if (v == fv) {
+          if (value) {
+            r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyT(f),tag,TRUE);
+            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          } else {
+            ntag = biddyVariableTable.table[v].next;
+            e = BiddyE(f);
+            if (ntag == BiddyGetTag(e)) {
+              r = e;
+              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
+              if (r != biddyZero) {
+                BiddySetTag(r,tag);
+              }
+            } else {
+              r = BiddyManagedTaggedFoaNode(MNG,ntag,e,e,tag,TRUE);
+              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+            }
+          }
+        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+          if (value) {
+            r = biddyZero;
+          } else {
+            r = f;
+            BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+          }
+        } else {
+          e = BiddyManagedVarSubset(MNG,BiddyE(f),v,value);
+          t = BiddyManagedVarSubset(MNG,BiddyT(f),v,value);
+          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+        }
+      }
+    }
+#endif
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedElementAbstract.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_ElementAbstract.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedElementAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
+{
+  Biddy_Edge h;
+  Biddy_Edge r;
+  unsigned int cindex;
+  Biddy_Edge e, t;
+  Biddy_Variable fv;
+
+#ifndef COMPACT
+  Biddy_Variable tag;
+#endif
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( v != 0);
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  r = biddyNull;
+
+  /* LOOKING FOR SIMPLE CASE */
+  if (f == biddyZero) return biddyZero;
+
+  h = biddyNull;
+
+#ifndef COMPACT
+  fv = tag = 0;
+#endif
+
+  /* h MUST BE COMPATIBLE WITH CUBE */
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    h = biddyVariableTable.table[v].variable;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    fv = BiddyV(f);
+    if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+    h = biddyVariableTable.table[v].element;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    fv = BiddyV(f);
+    tag = BiddyGetTag(f);
+    if (BiddyIsSmaller(biddyOrderingTable,v,fv) && !BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+    h = biddyVariableTable.table[v].variable;
+  }
+#endif
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyEACache,f,biddyZero,h,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      if ((fv=BiddyV(f)) == v) {
+        r = BiddyManagedOr(MNG,
+                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
+                           BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
+        r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyZero,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+      else {
+        e = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      if (fv == v) {
+        r = BiddyManagedOr(MNG,
+                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
+                           BiddyT(f));
+      }
+      else {
+        e = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
+        t = BiddyManagedElementAbstract(MNG,BiddyT(f),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+
+      if (fv == v) {
+        r = BiddyManagedOr(MNG,BiddyE(f),BiddyT(f));
+        v = BiddyManagedGetNextVariable(MNG,v);
+        if (v == BiddyGetTag(r)) {
+          BiddySetTag(r,tag);
+        } else {
+          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
+        /* the case !BiddyIsSmaller(biddyOrderingTable,v,tag) is already solved */
+        r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      } else {
+        e = BiddyManagedElementAbstract(MNG,BiddyE(f),v);
+        t = BiddyManagedElementAbstract(MNG,BiddyT(f),v);
+        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+#endif
+
+    addOp3Cache(biddyEACache,f,biddyZero,h,r,cindex);
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedProduct.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Product.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
+{
+  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Variable v, topF, topG;
+  Biddy_Edge FF, GG, HH;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tagF, tagG, rtag;
+#endif
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  /* DEBUGGING */
+  /*
+  tagF = BiddyGetTag(f);
+  tagG = BiddyGetTag(g);
+  topF = BiddyV(f);
+  topG = BiddyV(g);
+  printf("\n");
+  if (f == biddyZero) printf("Product: F = 0\n");
+  if (g == biddyZero) printf("Product: G = 0\n");
+  printf("Product: tagF = %u (%s)\n",tagF,BiddyManagedGetVariableName(MNG,tagF));
+  printf("Product: topF = %u (%s)\n",topF,BiddyManagedGetVariableName(MNG,topF));
+  printf("Product: tagG = %u (%s)\n",tagG,BiddyManagedGetVariableName(MNG,tagG));
+  printf("Product: topG = %u (%s)\n",topG,BiddyManagedGetVariableName(MNG,topG));
+  */
+
+  if (f == biddyZero) return biddyZero;
+  if (g == biddyZero) return biddyZero;
+
+  topF = topG = 0;
+
+#ifndef COMPACT
+  tagF = tagG = 0;
+#endif
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    if ((f == biddyOne) && (g == biddyOne)) return biddyOne;
+    /* if ((f == biddyOne) && (g includes empty combination)) return biddyOne; */
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    if (f == biddyTerminal) {
+      BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+      return g;
+    }
+    if (g == biddyTerminal) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    tagF = BiddyGetTag(f);
+    tagG = BiddyGetTag(g);
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    if ((topF == 0) && (!BiddyIsSmaller(biddyOrderingTable,tagG,tagF))) {
+      BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+      return g;
+    }
+    if ((topG == 0) && (!BiddyIsSmaller(biddyOrderingTable,tagF,tagG))) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+  }
+#endif
+
+  r = biddyNull;
+
+  if (((uintptr_t) f) > ((uintptr_t) g)) {
+    FF = g;
+    GG = f;
+  } else {
+    FF = f;
+    GG = g;
+  }
+  HH = biddyZero;
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      if (topF == topG) {
+        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedProduct(MNG,Fv,Gv);
+        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
+        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
+      } else {
+        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedOr(MNG,e,BiddyManagedProduct(MNG,Fv,Gv)); /* e=Product(Fneg_v,G) or e=Product(F,Gneg_v) */
+      }
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
+      } else {
+        Fv = Fneg_v = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
+      } else {
+        Gv = Gneg_v = g;
+      }
+
+      if (topF == topG) {
+        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedProduct(MNG,Fv,Gv);
+        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
+        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
+      } else {
+        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedProduct(MNG,Fv,Gv);
+      }
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      /* tagF = BiddyGetTag(f); */ /* already set */
+      /* tagG = BiddyGetTag(g); */ /* already set */
+      /* topF = BiddyV(f); */ /* already set */
+      /* topG = BiddyV(g); */ /* already set */
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagG : tagF; /* max tag! */
+      if (BiddyIsSmaller(biddyOrderingTable,v,rtag)) rtag = v;
+
+      /*
+      printf("Product: rtag = %u (%s)\n",rtag,BiddyManagedGetVariableName(MNG,rtag));
+      printf("Product: v = %u (%s)\n",v,BiddyManagedGetVariableName(MNG,v));
+      */
+
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
+        Fneg_v = Fv = f;
+      } else if (v == topF) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
+        Gneg_v = Gv = g;
+      } else if (v == topG) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = biddyZero;
+      }
+
+      /*
+      printf("Product: Fneg_v = %u (%s)\n",BiddyV(Fneg_v),BiddyManagedGetVariableName(MNG,BiddyV(Fneg_v)));
+      printf("Product: Fv = %u (%s)\n",BiddyV(Fv),BiddyManagedGetVariableName(MNG,BiddyV(Fv)));
+      printf("Product: Gneg_v = %u (%s)\n",BiddyV(Gneg_v),BiddyManagedGetVariableName(MNG,BiddyV(Gneg_v)));
+      printf("Product: Gv = %u (%s)\n",BiddyV(Gv),BiddyManagedGetVariableName(MNG,BiddyV(Gv)));
+      */
+
+      e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
+      t = BiddyManagedProduct(MNG,Fv,Gv);
+      t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
+      t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+#endif
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSelectiveProduct.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_SelectiveProduct.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedSelectiveProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge pncube)
+{
+  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v, nextcube;
+  Biddy_Variable v, topF, topG;
+  Biddy_Edge FF, GG, HH;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tagF, tagG, rtag;
+#endif
+
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
+  assert( pncube != NULL );
+
+  assert( (f == biddyZero) ||
+          (g == biddyZero) ||
+          ((f == biddyTerminal) && (g == biddyTerminal)) ||
+          (pncube != biddyZero)
+        );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  /* DEBUGGING TZBDD */
+  /*
+  if (biddyManagerType == BIDDYTYPETZBDD) {
+    tagF = BiddyGetTag(f);
+    tagG = BiddyGetTag(g);
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    printf("\n");
+    if (f == biddyZero) printf("SelectiveProduct: F = 0\n");
+    else if (g == biddyZero) printf("SelectiveProduct: G = 0\n");
+    else {
+      printf("SelectiveProduct: tagCube = %u (%s)\n",BiddyGetTag(pncube),BiddyManagedGetVariableName(MNG,BiddyGetTag(pncube)));
+      printf("SelectiveProduct: cube = %u (%s)\n",BiddyV(pncube),BiddyManagedGetVariableName(MNG,BiddyV(pncube)));
+      printf("SelectiveProduct: tagF = %u (%s)\n",tagF,BiddyManagedGetVariableName(MNG,tagF));
+      printf("SelectiveProduct: topF = %u (%s)\n",topF,BiddyManagedGetVariableName(MNG,topF));
+      printf("SelectiveProduct: tagG = %u (%s)\n",tagG,BiddyManagedGetVariableName(MNG,tagG));
+      printf("SelectiveProduct: topG = %u (%s)\n",topG,BiddyManagedGetVariableName(MNG,topG));
+    }
+  }
+  */
+
+  if (f == biddyZero) return biddyZero;
+  if (g == biddyZero) return biddyZero;
+
+  v = 0;
+  topF = topG = 0;
+
+#ifndef COMPACT
+  tagF = tagG = rtag = 0;
+#endif
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    if ((f == biddyOne) && (g == biddyOne)) return biddyOne;
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),topF)) {
+      r = BiddyInvCond(BiddyT(pncube),BiddyGetMark(pncube)); /* r is used here as a tmp variable */
+      if (r != biddyZero) {
+        pncube = r;
+      } else {
+        pncube = BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube));
+      }
+    }
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    if (g == biddyTerminal) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),topG)) pncube = BiddyT(pncube);
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    tagF = BiddyGetTag(f);
+    tagG = BiddyGetTag(g);
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    if ((topF == 0) && (topG == 0)) {
+      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
+        while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagF)) pncube = BiddyT(pncube);
+        while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagG) && (BiddyE(pncube) != biddyZero)) pncube = BiddyT(pncube);
+        if (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagG)) { /* smallest positive >= tagF is smaller as tagG */
+          if (BiddyManagedGetNextVariable(MNG,BiddyV(pncube)) == tagG) { /* smallest positive is previous of tagG */
+            BiddySetTag(g,BiddyV(pncube));
+            return g;
+		  } else {
+            rtag = BiddyV(pncube);
+            v = BiddyManagedGetNextVariable(MNG,rtag);
+            pncube = BiddyT(pncube);
+            /* THIS PART IS OPTIONAL - WE PREFER TO USE IT ALTHOUGH NO REAL DIFFERENCE IS OBSERVED */
+            /**/
+            if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
+            BiddySetTag(f,BiddyManagedGetNextVariable(MNG,v));
+            r = BiddyManagedSelectiveProduct(MNG,f,g,nextcube);
+            if ((v == BiddyV(pncube)) && (BiddyE(pncube) == biddyZero)) { // v in positive set
+              r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyZero,rtag,TRUE);
+            } else {
+              r = BiddyManagedTaggedFoaNode(MNG,v,r,r,rtag,TRUE);
+            }
+            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+            return r;
+            /**/
+		  }
+	    } else {
+          BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+          return g;
+	    }
+	  } else {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+	  }
+	} else if ((topG == 0) && !BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+	} else {
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagG : tagF; /* max tag! */
+      while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagF)) pncube = BiddyT(pncube);
+      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG) && (BiddyV(pncube) == tagF) && (BiddyE(pncube) == biddyZero)) {
+        rtag = tagF;
+        if ((tagF != topF) && BiddyIsSmaller(biddyOrderingTable,BiddyManagedGetNextVariable(MNG,tagF),tagG)) {
+          v = BiddyManagedGetNextVariable(MNG,tagF);
+        }
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,v,rtag)) rtag = v;
+      while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),v)) pncube = BiddyT(pncube);
+    }
+  }
+#endif
+
+  r = biddyNull;
+
+  FF = f;
+  GG = g;
+  HH = pncube;
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      if (v == BiddyV(pncube)) {
+        r = BiddyInvCond(BiddyT(pncube),BiddyGetMark(pncube)); /* r is used here as a tmp variable */
+        if (r != biddyZero) {
+          nextcube = r;
+        } else {
+          nextcube = BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube));
+        }
+      } else {
+        nextcube = pncube;
+      }
+      if (topF == topG) {
+        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
+        if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero))) { /* v in positive set */
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        } else if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) != biddyZero))) { /* v in negative set */
+          t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        } else {
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        }
+      } else {
+        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
+        if ((topF == v) && (v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero)) {
+          /* topF < topG (because topF == v) and v in positive set */
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+        } else {
+          /* all other cases, checking if v is in positive set is not needed */
+          t = BiddyManagedOr(MNG,e,BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube));
+        }
+      }
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
+      } else {
+        Fv = Fneg_v = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
+      } else {
+        Gv = Gneg_v = g;
+      }
+
+      if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
+      if (topF == topG) {
+        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
+        if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero))) { /* v in positive set */
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        } else if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) != biddyZero))) { /* v in negative set */
+          t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        } else {
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
+          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        }
+      } else {
+        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
+        if ((topG == v) && (v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero)) {
+          /* topG < topF (because topG == v) and v in positive set */
+          t = BiddyManagedGetEmptySet(MNG);
+        } else {
+          /* all other cases, checking if v is in positive set is not needed */
+          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+        }
+      }
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      /* topF = BiddyV(f); */ /* already set */
+      /* topG = BiddyV(g); */ /* already set */
+      /* tagF = BiddyGetTag(f); */ /* already set */
+      /* tagG = BiddyGetTag(g); */ /* already set */
+      /* v  */ /* already set */
+      /* rtag */ /* already set */
+
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
+        Fneg_v = Fv = f;
+      } else if (v == topF) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+      }
+      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
+        Gneg_v = Gv = g;
+      } else if (v == topG) {
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = biddyZero;
+      }
+
+      if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
+      e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
+      if ((v == BiddyV(pncube)) && (BiddyE(pncube) == biddyZero)) { // v in positive set
+        /* printf("\nPOSITIVE"); */
+        t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+      } else if ((v != BiddyV(pncube)) && !BiddyIsSmaller(biddyOrderingTable,v,BiddyGetTag(pncube))) { // v in negative set
+        /* printf("\nNEGATIVE"); */
+        t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
+        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+      } else {
+        /* printf("\nNEUTRAL"); */
+        t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
+        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
+        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+      }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+    }
+#endif
+
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
+  }
+
+  /* DEBUGGING */
+  /*
+  printf("SelectiveProduct: RESULT = %u (%s)\n",BiddyV(r),BiddyManagedGetVariableName(MNG,BiddyV(r)));
+  */
+
+  return r;
+}
+
 /***************************************************************************//*!
-\brief Function BiddyManagedReplaceByKeyword.
+\brief Function BiddyManagedSupset.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_ReplaceByKeyword.
+    See Biddy_Managed_Supset.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedReplaceByKeyword(Biddy_Manager MNG, Biddy_Edge f,
-                             Biddy_String keyword)
+BiddyManagedSupset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
 {
-  Biddy_Edge r;
-  unsigned int key;
-  Biddy_Boolean OK;
-  int cc;
-  const Biddy_Boolean disableCache = FALSE;
+  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Variable v, topF, topG;
+  Biddy_Edge FF, GG, HH;
+  unsigned int cindex;
+
+#ifndef COMPACT
+  Biddy_Variable tagF, tagG, rtag;
+#endif
 
   assert( MNG != NULL );
+  assert( f != NULL );
+  assert( g != NULL );
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, and TZBDD */
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
     (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
   if (f == biddyZero) return biddyZero;
-  if (f == biddyOne) return biddyOne;
+  if (g == biddyZero) return biddyZero;
+  if (f == g) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  }
+
+#ifndef COMPACT
+  tagF = tagG = topF = topG = 0; /* to make compiler happy */
+  if (biddyManagerType == BIDDYTYPETZBDD) {
+    tagF = BiddyGetTag(f);
+    tagG = BiddyGetTag(g);
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    if ((topF == 0) && ((topG == 0))) {
+      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+      return f;
+    }
+  }
+#endif
 
   r = biddyNull;
 
-  /* find keyword in keywordList */
+  FF = biddyNull;
+  GG = f;
+  HH = g;
 
-  /* VARIANT A: LINEAR SEARCH */
-  key = 0;
-  if (!disableCache && keyword) {
-    OK = FALSE;
-    if (biddyReplaceCache.keywordList) {
-      for (key = 0; !OK && (key < biddyReplaceCache.keywordNum); key++) {
-        cc = strcmp(keyword,biddyReplaceCache.keywordList[key]);
-        if (cc == 0) {
-          OK = TRUE;
-          break;
-        }
-        if (cc < 0) break;
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
+      t = BiddyManagedSupset(MNG,Fv,Gv);
+      if (v == topG) {
+        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
+      }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
+      } else {
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      if (topF == topG) {
+        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedSupset(MNG,Fv,Gv);
+        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
+      } else if (v == topF) {
+        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
+        t = BiddyManagedSupset(MNG,Fv,Gv);
+      } else {
+        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
+        t = biddyZero;
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
-  }
 
-  /* TO DO: BINARY SEARCH */
-  /* NOT IMPORTANT BECAUSE NUMBER OF KEYWORDS IS VERY SMALL IN THE PRACTICE */
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-  if (disableCache || !keyword) {
-    /* keyword not given */
-    key = ++biddyReplaceCache.keyNum;
-  } else {
-    /* keyword given but not found - it will be added */
-    if (!OK) {
-      Biddy_String *tmp1;
-      unsigned int *tmp2;
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      /* tagF = BiddyGetTag(f); */ /* already set */
+      /* tagG = BiddyGetTag(g); */ /* already set */
+      /* topF = BiddyV(f); */ /* already set */
+      /* topG = BiddyV(g); */ /* already set */
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,topG) ? tagF : topG; /* min(tagF,topG) */
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG; /* min(topF,topG) */
 
-      biddyReplaceCache.keywordNum++;
-      if (!(tmp1 = (Biddy_String *)
-         realloc(biddyReplaceCache.keywordList,biddyReplaceCache.keywordNum*sizeof(Biddy_String))))
-      {
-        fprintf(stderr,"BiddyManagedReplaceByKeyword: Out of memoy!\n");
-        exit(1);
-      }
-      biddyReplaceCache.keywordList = tmp1;
-      if (!(tmp2 = (unsigned int *)
-         realloc(biddyReplaceCache.keyList,biddyReplaceCache.keywordNum*sizeof(unsigned int))))
-      {
-        fprintf(stderr,"BiddyManagedReplaceByKeyword: Out of memoy!\n");
-        exit(1);
+      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
+        Fneg_v = Fv = f;
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+        Gneg_v = BiddyE(g);
+        Gv = biddyZero;
+      } else if (topG == topF) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = Gv = g;
+      } else {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = Gneg_v;
       }
-      biddyReplaceCache.keyList = tmp2;
 
-      memmove(&biddyReplaceCache.keywordList[key+1],&biddyReplaceCache.keywordList[key],(biddyReplaceCache.keywordNum-key-1)*sizeof(Biddy_String));
-      memmove(&biddyReplaceCache.keyList[key+1],&biddyReplaceCache.keyList[key],(biddyReplaceCache.keywordNum-key-1)*sizeof(unsigned int));
+      e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
+      t = BiddyManagedSupset(MNG,Fv,Gv);
       /*
-      for (i = biddyReplaceCache.keywordNum-1; i > key; i--) {
-        biddyReplaceCache.keywordList[i] = biddyReplaceCache.keywordList[i-1];
-        biddyReplaceCache.keyList[i] = biddyReplaceCache.keyList[i-1];
+      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
+        t = BiddyManagedOr(MNG,t,e);
+      } else if (topG == topF) {
+        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
       }
       */
+      if (v == topG) {
+        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
+      }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
 
-      biddyReplaceCache.keywordList[key] = strdup(keyword);
-      biddyReplaceCache.keyList[key] = ++biddyReplaceCache.keyNum;
     }
-    key = biddyReplaceCache.keyList[key];
-  }
+#endif
 
-  /* DEBUGGING */
-  /*
-  fprintf(stderr,"ReplaceByKeyword: keyword = %s, key = %u\n",keyword,key);
-  */
+  } else {
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
 
-  if (biddyManagerType == BIDDYTYPEOBDD) {
-    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
-    r = replaceByKeyword(MNG,f,0,key);
-  } else if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
-    r = replaceByKeyword(MNG,f,0,key);
-  }
-#ifndef COMPACT
-  else if (biddyManagerType == BIDDYTYPEZBDD) {
-    /* NOT COMPLETELY IMPLEMENTED, YET */
-    /*
-    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); / * purge Replace cache * /
-    r = replaceByKeyword(MNG,f,BiddyManagedGetLowestVariable(MNG),key);
-    */
-  } else if (biddyManagerType == BIDDYTYPEZBDDC) {
-    /* NOT COMPLETELY IMPLEMENTED, YET */
-    /*
-    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); / * purge Replace cache * /
-    r = replaceByKeyword(MNG,f,BiddyManagedGetLowestVariable(MNG),key);
-    */
-  } else if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (!disableCache && !key) BiddyReplaceGarbageDeleteAll(MNG); /* purge Replace cache */
-    r = replaceByKeyword(MNG,f,0,key);
   }
-#endif
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedChange.
+\brief Function BiddyManagedSubset.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Change.
+    See Biddy_Managed_Subset.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedChange(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
+BiddyManagedSubset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
 {
-  Biddy_Edge e,t,r;
-  Biddy_Variable fv;
+  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
+  Biddy_Variable v, topF, topG;
   Biddy_Edge FF, GG, HH;
   unsigned int cindex;
 
 #ifndef COMPACT
-  Biddy_Variable tag;
+  Biddy_Variable tagF, tagG, rtag;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( v != 0);
+  assert( g != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -7469,97 +9805,179 @@ BiddyManagedChange(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
   );
 
   if (f == biddyZero) return biddyZero;
+  if (g == biddyZero) return biddyZero;
+  if (f == g) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    return f;
+  }
+
+#ifndef COMPACT
+  tagF = tagG = topF = topG = 0; /* to make compiler happy */
+  if (biddyManagerType == BIDDYTYPETZBDD) {
+    tagF = BiddyGetTag(f);
+    tagG = BiddyGetTag(g);
+    topF = BiddyV(f);
+    topG = BiddyV(g);
+    if ((topF == 0) && ((topG == 0))) {
+      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      }
+    }
+  }
+#endif
 
   r = biddyNull;
 
   FF = f;
-  GG = biddyNull;
+  GG = g;
   HH = biddyNull;
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    HH = biddyVariableTable.table[v].variable;
-  }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    HH = biddyVariableTable.table[v].element;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    HH = biddyVariableTable.table[v].variable;
-  }
-#endif
-
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
   cindex = 0;
   if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      fv = BiddyV(f);
-      if (v == fv) {
-        e = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-        t = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
       } else {
-        e = BiddyManagedChange(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedChange(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
+      t = BiddyManagedSubset(MNG,Fv,Gv);
+      if (v == topG) {
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      fv = BiddyV(f);
-      if (v == fv) {
-        e = BiddyT(f);
-        t = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      topF = BiddyV(f);
+      topG = BiddyV(g);
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      if (topF == v) {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyT(f);
       } else {
-        e = BiddyManagedChange(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedChange(MNG,BiddyT(f),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+        Fneg_v = Fv = f;
+      }
+      if (topG == v) {
+        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+        Gv = BiddyT(g);
+      } else {
+        Gneg_v = Gv = g;
+      }
+
+      if (topF == topG) {
+        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
+        t = BiddyManagedSubset(MNG,Fv,Gv);
+      } else if (v == topF) {
+        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
+        t = biddyZero;
+      } else {
+        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fv,Gv));
+        t = biddyZero;
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
-      tag = BiddyGetTag(f);
-      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
-        r = f;
-        BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+
+      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
+      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+      /* tagF = BiddyGetTag(f); */ /* already set */
+      /* tagG = BiddyGetTag(g); */ /* already set */
+      /* topF = BiddyV(f); */ /* already set */
+      /* topG = BiddyV(g); */ /* already set */
+      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG; /* min(tagF,topG) */
+      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG; /* min(topF,topG) */
+
+      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
+        Fneg_v = Fv = f;
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
+        Fneg_v = f;
+        BiddySetTag(Fneg_v,v);
+        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
+        Fv = biddyZero;
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else if (topG == topF) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = BiddyE(g);
+        Gv = BiddyT(g);
+      } else if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        Gneg_v = Gv = g;
       } else {
-        fv = BiddyV(f);
-        if (v == fv) {
-          e = BiddyT(f);
-          t = BiddyE(f);
-          r = BiddyManagedTaggedFoaNode(MNG,v,e,t,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-          r = f;
-          /* BiddyRefresh(r); */ /* f may be an obsolete node but this is not a problem here */
-          BiddySetTag(r,v);
-          r = BiddyManagedIncTag(MNG,r);
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          e = BiddyManagedChange(MNG,BiddyE(f),v);
-          t = BiddyManagedChange(MNG,BiddyT(f),v);
-          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-        }
+        Fneg_v = BiddyE(f);
+        Fv = biddyZero;
+        Gneg_v = g;
+        BiddySetTag(Gneg_v,v);
+        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
+        Gv = biddyZero;
+      }
+
+      e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
+      t = BiddyManagedSubset(MNG,Fv,Gv);
+      /*
+      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
+        e = BiddyManagedOr(MNG,e,t);
+      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
+      } else if (topG == topF) {
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
+      }
+      */
+      if (v == topG) {
+        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 #endif
 
@@ -7574,31 +9992,27 @@ BiddyManagedChange(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedVarSubset.
+\brief Function BiddyManagedPermitsym.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_VarSubset.
+    See Biddy_Managed_Permitsym.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedVarSubset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v,
-                      Biddy_Boolean value)
+BiddyManagedPermitsym(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable lowest,
+                      unsigned int n)
 {
-  Biddy_Edge h;
-  Biddy_Edge e, t, r;
-  Biddy_Variable fv;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
+  Biddy_Edge e, t, r, Fv, Fneg_v;
+  Biddy_Variable v;
 
 #ifndef COMPACT
-  Biddy_Variable tag,ntag;
+  Biddy_Variable tag;
 #endif
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( v != 0);
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -7609,196 +10023,139 @@ BiddyManagedVarSubset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v,
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
+  /* argument lowest is not used for ZBDD and ZBDDC */
+
   if (f == biddyZero) return biddyZero;
 
   r = biddyNull;
 
-  FF = biddyNull;
-  GG = biddyNull;
-  HH = biddyNull;
-  h = biddyNull;
-
   if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    h = biddyVariableTable.table[v].variable;
-  }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    h = biddyVariableTable.table[v].element;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    h = biddyVariableTable.table[v].variable;
-  }
-#endif
-
-  if (!value) {
-    h = BiddyManagedNot(MNG,h);
-  }
 
-  /* TO DO: CACHE TABLE FOR OBDDC COULD BE OPTIMIZED BY USING COMPLEMENTED EDGES */
-  if (biddyManagerType == BIDDYTYPEOBDDC) {
-    if (((uintptr_t) f) > ((uintptr_t) h)) {
-      FF = f;
-      GG = h;
-      HH = biddyZero;
-    } else {
-      FF = h;
-      GG = f;
-      HH = biddyZero;
+    v = BiddyV(f);
+    if (lowest == 0) {
+      assert( v == 0 );
+      return f;  /* refresh not needed because biddyV(f) is 0 */
     }
-  }
-  else {
-    if (((uintptr_t) f) > ((uintptr_t) h)) {
-      FF = f;
-      GG = h;
-      HH = biddyZero;
-    } else {
-      FF = h;
-      GG = f;
-      HH = biddyZero;
+
+    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS - NOT ALWAYS NEEDED */
+    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+    if (v == lowest) {
+      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
     }
-  }
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  /* TO DO: CHECK ONLY IF IT IS POSSIBLE TO EXIST IN THE CACHE */
-  cindex = 0;
-  if (!findOp3Cache(biddyOPCache,FF,GG,HH,&r,&cindex))
-  {
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        if (value) {
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          r = BiddyManagedTaggedFoaNode(MNG,v,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),biddyZero,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
+    if (v == lowest) {
+      e = BiddyManagedPermitsym(MNG,Fneg_v,biddyVariableTable.table[lowest].next,n);
+      if (n == 0) {
+        t = biddyZero;
+      } else {
+        t = BiddyManagedPermitsym(MNG,Fv,biddyVariableTable.table[lowest].next,n-1);
       }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        if (value) {
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        }
+    } else {
+      e = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[lowest].next,n);
+      if (n == 0) {
+        t = biddyZero;
       } else {
-        e = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
-        t = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v,value);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
+        t = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[lowest].next,n-1);
       }
     }
 
+    r = BiddyManagedTaggedFoaNode(MNG,lowest,e,t,lowest,TRUE);
+    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+  }
+
 #ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        if (value) {
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyT(f),v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          r = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-          BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-        }
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        if (value) {
-          r = biddyZero;
-        } else {
-          r = f;
-          BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-        }
-      } else {
-        e = BiddyManagedVarSubset(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v,value);
-        t = BiddyManagedVarSubset(MNG,BiddyT(f),v,value);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
-      }
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+    v = BiddyV(f);
+    if (v == 0) {
+      return f; /* refresh not needed because biddyV(f) is 0 */
+    }
+
+    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+    Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    Fv = BiddyT(f);
+
+    e = BiddyManagedPermitsym(MNG,Fneg_v,0,n); /* lowest is not used */
+    if (n == 0) {
+      t = biddyZero;
+    } else {
+      t = BiddyManagedPermitsym(MNG,Fv,0,n-1); /* lowest is not used */
+    }
+
+    r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+  }
+
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+
+    v = BiddyV(f);
+    tag = BiddyGetTag(f);
+    /* not needed */
+    /*
+    if (lowest == 0) {
+      assert( v == 0 );
+      return f;
+    }
+    */
+    if ((tag == lowest) && (v == 0)) {
+      return f;  /* refresh not needed because biddyV(f) is 0 */
     }
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
-      tag = BiddyGetTag(f);
-      if (BiddyIsSmaller(biddyOrderingTable,v,tag)) {
-        if (value) {
-          r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,f,v,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-        } else {
-          ntag = biddyVariableTable.table[v].next;
-          if (tag == ntag) {
-            r = f;
-            BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-            BiddySetTag(r,v);
-          } else {
-            r = BiddyManagedTaggedFoaNode(MNG,ntag,f,f,v,TRUE);
-            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          }
-        }
+    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS - NOT ALWAYS NEEDED */
+    if (tag == lowest) {
+      Fneg_v = BiddyE(f);
+      Fv = BiddyT(f);
+    }
+
+    if (tag == lowest) {
+      assert( v != 0 );
+      e = BiddyManagedPermitsym(MNG,Fneg_v,biddyVariableTable.table[v].next,n);
+      if (n == 0) {
+        t = biddyZero;
       } else {
-        fv = BiddyV(f);
-        if (v == fv) {
-          if (value) {
-            r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,BiddyT(f),tag,TRUE);
-            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          } else {
-            ntag = biddyVariableTable.table[v].next;
-            e = BiddyE(f);
-            if (ntag == BiddyGetTag(e)) {
-              r = e;
-              BiddyRefresh(r); /* subnode may be marked as an obsolete node! */
-              if (r != biddyZero) {
-                BiddySetTag(r,tag);
-              }
-            } else {
-              r = BiddyManagedTaggedFoaNode(MNG,ntag,e,e,tag,TRUE);
-              BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-            }
-          }
-        } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-          if (value) {
-            r = biddyZero;
-          } else {
-            r = f;
-            BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
-          }
-        } else {
-          e = BiddyManagedVarSubset(MNG,BiddyE(f),v,value);
-          t = BiddyManagedVarSubset(MNG,BiddyT(f),v,value);
-          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-          addOp3Cache(biddyOPCache,FF,GG,HH,r,cindex);
-        }
+        t = BiddyManagedPermitsym(MNG,Fv,biddyVariableTable.table[v].next,n-1);
+      }
+    } else {
+      v = lowest;
+      e = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[v].next,n);
+      if (n == 0) {
+        t = biddyZero;
+      } else {
+        t = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[v].next,n-1);
       }
     }
-#endif
-
-  } else {
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+    /* result tag = (tag == lowest) keep the same or (else) change to v */
+    r = BiddyManagedTaggedFoaNode(MNG,v,e,t,lowest,TRUE);
+    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
   }
+#endif
 
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedElementAbstract.
+\brief Function BiddyManagedStretch.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_ElementAbstract.
+    See Biddy_Managed_Stretch.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedElementAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
+BiddyManagedStretch(Biddy_Manager MNG, Biddy_Edge support, Biddy_Edge f)
 {
-  Biddy_Edge h;
+  Biddy_Edge e, t, Fv, Fneg_v;
+  Biddy_Variable v;
   Biddy_Edge r;
+  Biddy_Edge FF, GG, HH;
   unsigned int cindex;
-  Biddy_Edge e, t;
-  Biddy_Variable fv;
 
 #ifndef COMPACT
   Biddy_Variable tag;
@@ -7806,7 +10163,6 @@ BiddyManagedElementAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( v != 0);
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -7817,107 +10173,150 @@ BiddyManagedElementAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  r = biddyNull;
-
-  /* LOOKING FOR SIMPLE CASE */
-  if (f == biddyZero) return biddyZero;
-
-  h = biddyNull;
-
 #ifndef COMPACT
-  fv = tag = 0;
+  tag = 0;
 #endif
 
-  /* h MUST BE COMPATIBLE WITH CUBE */
   if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    h = biddyVariableTable.table[v].variable;
+    if (f == biddyZero) return biddyZero;
+    if (f == biddyOne) {
+      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
+      return support;
+    }
+    if (f == support) {
+      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
+      return support;
+    }
   }
+
 #ifndef COMPACT
   else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    fv = BiddyV(f);
-    if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
-    }
-    h = biddyVariableTable.table[v].element;
+    if (BiddyIsTerminal(f)) return f;
   }
   else if (biddyManagerType == BIDDYTYPETZBDD) {
-    fv = BiddyV(f);
-    tag = BiddyGetTag(f);
-    if (BiddyIsSmaller(biddyOrderingTable,v,fv) && !BiddyIsSmaller(biddyOrderingTable,v,tag)) {
+    if (f == biddyZero) return biddyZero;
+    if (f == biddyOne) {
+      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
+      return support;
+    }
+    if (f == support) {
+      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
+      return support;
+    }
+    if (((tag = BiddyGetTag(f)) == BiddyV(support)) && (BiddyIsTerminal(f))) {
       BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
       return f;
     }
-    h = biddyVariableTable.table[v].variable;
   }
 #endif
 
+  r = biddyNull;
+
+  FF = f;
+  GG = biddyNull;
+  HH = biddyOne;
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    GG = support;
+  }
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    HH = biddyNull;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    GG = support;
+  }
+
   /* IF RESULT IS NOT IN THE CACHE TABLE... */
   cindex = 0;
-  if (!findOp3Cache(biddyEACache,f,biddyZero,h,&r,&cindex))
+  if (TRUE || !findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
   {
 
     if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-      if ((fv=BiddyV(f)) == v) {
-        r = BiddyManagedOr(MNG,
-                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
-                           BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
-        r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyZero,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-      else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      }
-      else {
-        e = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+
+      if ((v = BiddyV(f)) != BiddyV(support)) {
+        v = BiddyV(support);
+        e = biddyZero;
+        t = BiddyManagedStretch(MNG,BiddyT(support),f);
+      } else {
+        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+        if (Fneg_v == biddyZero) {
+          e = biddyZero;
+          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
+        } else {
+          e = BiddyManagedStretch(MNG,BiddyT(support),Fneg_v);
+          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
+          e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
+        }
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 
 #ifndef COMPACT
     else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-      if (fv == v) {
-        r = BiddyManagedOr(MNG,
-                           BiddyInvCond(BiddyE(f),BiddyGetMark(f)),
-                           BiddyT(f));
-      }
-      else {
-        e = BiddyManagedElementAbstract(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),v);
-        t = BiddyManagedElementAbstract(MNG,BiddyT(f),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+
+      /* argument support is not used for ZBDD and ZBDDC */
+      /* TO DO: by introducing support, the efficency may be improve due to additional simple case */
+
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+      v = BiddyV(f);
+      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      Fv = BiddyT(f);
+
+      if (BiddyIsTerminal(Fneg_v) || (Fneg_v == Fv)) {
+        e = biddyZero;
+        t = BiddyManagedStretch(MNG,support,Fv);
+      } else {
+        e = BiddyManagedStretch(MNG,support,Fneg_v);
+        t = BiddyManagedStretch(MNG,support,Fv);
+        e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 
     else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-      if (fv == v) {
-        r = BiddyManagedOr(MNG,BiddyE(f),BiddyT(f));
-        v = BiddyManagedGetNextVariable(MNG,v);
-        if (v == BiddyGetTag(r)) {
-          BiddySetTag(r,tag);
+      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
+      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+
+      if (tag != BiddyV(support)) {
+        tag = v = BiddyV(support);
+        e = biddyZero;
+        t = BiddyManagedStretch(MNG,BiddyT(support),f);
+      } else {
+        v = BiddyV(f);
+        Fneg_v = BiddyE(f);
+        Fv = BiddyT(f);
+        while (BiddyV(support) != v) support = BiddyT(support);
+        if ((Fneg_v == biddyZero) || (Fneg_v == Fv)) {
+          e = biddyZero;
+          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
         } else {
-          r = BiddyManagedTaggedFoaNode(MNG,v,r,r,tag,TRUE);
-          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+          e = BiddyManagedStretch(MNG,BiddyT(support),Fneg_v);
+          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
+          e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
         }
-      } else if (BiddyIsSmaller(biddyOrderingTable,v,fv)) {
-        /* the case !BiddyIsSmaller(biddyOrderingTable,v,tag) is already solved */
-        r = BiddyManagedTaggedFoaNode(MNG,v,f,biddyZero,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      } else {
-        e = BiddyManagedElementAbstract(MNG,BiddyE(f),v);
-        t = BiddyManagedElementAbstract(MNG,BiddyT(f),v);
-        r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,tag,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       }
+
+      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,tag,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+
     }
 #endif
 
-    addOp3Cache(biddyEACache,f,biddyZero,h,r,cindex);
-
   } else {
 
     /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
@@ -7929,29 +10328,23 @@ BiddyManagedElementAbstract(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v)
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedProduct.
+\brief Function BiddyManagedCreateMinterm.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Product.
+    See Biddy_Managed_CreateMinterm.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
+BiddyManagedCreateMinterm(Biddy_Manager MNG, Biddy_Edge support,
+                          long long unsigned int x)
 {
-  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
-  Biddy_Variable v, topF, topG;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Variable tagF, tagG, rtag;
-#endif
+  long long unsigned int n;
+  Biddy_Edge tmp;
 
   assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
+  assert( support != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -7962,254 +10355,198 @@ BiddyManagedProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  /* DEBUGGING */
-  /*
-  tagF = BiddyGetTag(f);
-  tagG = BiddyGetTag(g);
-  topF = BiddyV(f);
-  topG = BiddyV(g);
-  printf("\n");
-  if (f == biddyZero) printf("Product: F = 0\n");
-  if (g == biddyZero) printf("Product: G = 0\n");
-  printf("Product: tagF = %u (%s)\n",tagF,BiddyManagedGetVariableName(MNG,tagF));
-  printf("Product: topF = %u (%s)\n",topF,BiddyManagedGetVariableName(MNG,topF));
-  printf("Product: tagG = %u (%s)\n",tagG,BiddyManagedGetVariableName(MNG,tagG));
-  printf("Product: topG = %u (%s)\n",topG,BiddyManagedGetVariableName(MNG,topG));
-  */
+  n = 1;
+  tmp = support;
+  while (!BiddyIsTerminal(tmp)) {
 
-  if (f == biddyZero) return biddyZero;
-  if (g == biddyZero) return biddyZero;
+    if (!(n<(2*n))) {
+      /* support has to many variables */
+      return biddyNull;
+    }
 
-  topF = topG = 0;
+    n = 2 * n;
+    tmp = BiddyT(tmp);
+  }
 
-#ifndef COMPACT
-  tagF = tagG = 0;
-#endif
+  return createMinterm(MNG,support,n,x);
+}
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    if ((f == biddyOne) && (g == biddyOne)) return biddyOne;
-    /* if ((f == biddyOne) && (g includes empty combination)) return biddyOne; */
-  }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    if (f == biddyTerminal) {
-      BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-      return g;
-    }
-    if (g == biddyTerminal) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
+/***************************************************************************//*!
+\brief Function BiddyManagedCreateFunction.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_CreateFunction.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedCreateFunction(Biddy_Manager MNG, Biddy_Edge support,
+                           long long unsigned int x)
+{
+  long long unsigned int n,m,q;
+  Biddy_Edge tmp;
+
+  assert( MNG != NULL );
+  assert( support != NULL );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  n = 1;
+  tmp = support;
+  while (!BiddyIsTerminal(tmp)) {
+
+    if (!(n<(2*n))) {
+      /* support has to many variables */
+      return biddyNull;
     }
+
+    n = 2 * n;
+    tmp = BiddyT(tmp);
   }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    tagF = BiddyGetTag(f);
-    tagG = BiddyGetTag(g);
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    if ((topF == 0) && (!BiddyIsSmaller(biddyOrderingTable,tagG,tagF))) {
-      BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-      return g;
-    }
-    if ((topG == 0) && (!BiddyIsSmaller(biddyOrderingTable,tagF,tagG))) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
+
+  m = 1;
+  q = n;
+  while (q>0) {
+
+    if (!(m<(2*m))) {
+      /* support has to many variables */
+      return biddyNull;
     }
+
+    m = 2 * m;
+    q--;
   }
-#endif
 
-  r = biddyNull;
+  return createFunction(MNG,support,n,m,x);
+}
 
-  if (((uintptr_t) f) > ((uintptr_t) g)) {
-    FF = g;
-    GG = f;
-  } else {
-    FF = f;
-    GG = g;
-  }
-  HH = biddyZero;
+/***************************************************************************//*!
+\brief Function BiddyManagedRandomFunction.
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_RandomFunction.
+*******************************************************************************/
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+Biddy_Edge
+BiddyManagedRandomFunction(Biddy_Manager MNG, Biddy_Edge support, double ratio)
+{
+  long long unsigned int n,m,x;
+  Biddy_Edge tmp,result;
+  Biddy_Boolean opposite;
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  assert( MNG != NULL );
+  assert( support != NULL );
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-      } else {
-        Gneg_v = Gv = g;
-      }
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
 
-      if (topF == topG) {
-        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedProduct(MNG,Fv,Gv);
-        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
-        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
-      } else {
-        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedOr(MNG,e,BiddyManagedProduct(MNG,Fv,Gv)); /* e=Product(Fneg_v,G) or e=Product(F,Gneg_v) */
-      }
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  if ((ratio < 0.0) || (ratio > 1.0)) {
+    return biddyNull;
+  }
 
-    }
+  n = 1;
+  tmp = support;
+  while (!BiddyIsTerminal(tmp)) {
 
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    if (!(n<(2*n))) {
+      /* support has to many variables */
+      return biddyNull;
+    }
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+    n = 2 * n;
+    tmp = BiddyT(tmp);
+  }
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fv = Fneg_v = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gv = Gneg_v = g;
-      }
+  opposite = FALSE;
+  if (ratio > 0.5) {
+    ratio = 1.0 - ratio;
+    opposite = TRUE;
+  }
 
-      if (topF == topG) {
-        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedProduct(MNG,Fv,Gv);
-        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
-        t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
-      } else {
-        e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedProduct(MNG,Fv,Gv);
-      }
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  m = (long long unsigned int) (0.5 + n * ratio);
 
+  if (m == 0) {
+    if (opposite) {
+      return biddyOne;
+    } else {
+      return biddyZero;
     }
+  }
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
-
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      /* tagF = BiddyGetTag(f); */ /* already set */
-      /* tagG = BiddyGetTag(g); */ /* already set */
-      /* topF = BiddyV(f); */ /* already set */
-      /* topG = BiddyV(g); */ /* already set */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagG : tagF; /* max tag! */
-      if (BiddyIsSmaller(biddyOrderingTable,v,rtag)) rtag = v;
+  result = biddyZero;
+  while (m != 0) {
 
-      /*
-      printf("Product: rtag = %u (%s)\n",rtag,BiddyManagedGetVariableName(MNG,rtag));
-      printf("Product: v = %u (%s)\n",v,BiddyManagedGetVariableName(MNG,v));
-      */
+    /* DEBUGGING */
+    /*
+    printf("RANDOM: m=%llu\n",m);
+    */
 
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
-        Fneg_v = Fv = f;
-      } else if (v == topF) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
-        Gneg_v = Gv = g;
-      } else if (v == topG) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = biddyZero;
-      }
+    /* GENERATE RANDOM NUMBER */
+    x = rand();
 
-      /*
-      printf("Product: Fneg_v = %u (%s)\n",BiddyV(Fneg_v),BiddyManagedGetVariableName(MNG,BiddyV(Fneg_v)));
-      printf("Product: Fv = %u (%s)\n",BiddyV(Fv),BiddyManagedGetVariableName(MNG,BiddyV(Fv)));
-      printf("Product: Gneg_v = %u (%s)\n",BiddyV(Gneg_v),BiddyManagedGetVariableName(MNG,BiddyV(Gneg_v)));
-      printf("Product: Gv = %u (%s)\n",BiddyV(Gv),BiddyManagedGetVariableName(MNG,BiddyV(Gv)));
-      */
+    /* DEBUGGING */
+    /*
+    printf("RANDOM NUMBER: x=%llu, n=%llu, RAND_MAX=%llu\n",x,n,RAND_MAX);
+    */
 
-      e = BiddyManagedProduct(MNG,Fneg_v,Gneg_v);
-      t = BiddyManagedProduct(MNG,Fv,Gv);
-      t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fneg_v,Gv));
-      t = BiddyManagedOr(MNG,t,BiddyManagedProduct(MNG,Fv,Gneg_v));
+    x = (n*x)/RAND_MAX;
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+    /* DEBUGGING */
+    /*
+    printf("RANDOM NUMBER = %llu\n",x);
+    */
 
+    tmp = createMinterm(MNG,support,n,x);
+    tmp = BiddyManagedOr(MNG,result,tmp);
+    if (tmp != result) {
+      result = tmp;
+      m--;
     }
-#endif
 
-  } else {
-
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  }
 
+  if (opposite) {
+    result = BiddyManagedNot(MNG,result);
   }
 
-  return r;
+  return result;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedSelectiveProduct.
+\brief Function BiddyManagedRandomSet.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_SelectiveProduct.
+    See Biddy_Managed_RandomSet.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedSelectiveProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge pncube)
+BiddyManagedRandomSet(Biddy_Manager MNG, Biddy_Edge unit, double ratio)
 {
-  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v, nextcube;
-  Biddy_Variable v, topF, topG;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Variable tagF, tagG, rtag;
-#endif
+  long long unsigned int n,m,x,z;
+  Biddy_Edge p,q,tmp,result;
+  Biddy_Boolean opposite;
+  Biddy_Variable one;
 
   assert( MNG != NULL );
-  assert( f != NULL );
-  assert( g != NULL );
-  assert( pncube != NULL );
-
-  assert( (f == biddyZero) ||
-          (g == biddyZero) ||
-          ((f == biddyTerminal) && (g == biddyTerminal)) ||
-          (pncube != biddyZero)
-        );
+  assert( unit != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -8220,337 +10557,236 @@ BiddyManagedSelectiveProduct(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Bidd
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  /* DEBUGGING TZBDD */
-  /*
-  if (biddyManagerType == BIDDYTYPETZBDD) {
-    tagF = BiddyGetTag(f);
-    tagG = BiddyGetTag(g);
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    printf("\n");
-    if (f == biddyZero) printf("SelectiveProduct: F = 0\n");
-    else if (g == biddyZero) printf("SelectiveProduct: G = 0\n");
-    else {
-      printf("SelectiveProduct: tagCube = %u (%s)\n",BiddyGetTag(pncube),BiddyManagedGetVariableName(MNG,BiddyGetTag(pncube)));
-      printf("SelectiveProduct: cube = %u (%s)\n",BiddyV(pncube),BiddyManagedGetVariableName(MNG,BiddyV(pncube)));
-      printf("SelectiveProduct: tagF = %u (%s)\n",tagF,BiddyManagedGetVariableName(MNG,tagF));
-      printf("SelectiveProduct: topF = %u (%s)\n",topF,BiddyManagedGetVariableName(MNG,topF));
-      printf("SelectiveProduct: tagG = %u (%s)\n",tagG,BiddyManagedGetVariableName(MNG,tagG));
-      printf("SelectiveProduct: topG = %u (%s)\n",topG,BiddyManagedGetVariableName(MNG,topG));
-    }
+  if ((ratio < 0.0) || (ratio > 1.0)) {
+    return biddyNull;
   }
-  */
 
-  if (f == biddyZero) return biddyZero;
-  if (g == biddyZero) return biddyZero;
+  n = 1;
+  p = unit;
+  while (!BiddyIsTerminal(p)) {
 
-  v = 0;
-  topF = topG = 0;
+    if (!(n<(2*n))) {
+      /* unit has to many variables */
+      return biddyNull;
+    }
 
-#ifndef COMPACT
-  tagF = tagG = rtag = 0;
-#endif
+    n = 2 * n;
+    p = BiddyT(p);
+  }
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    if ((f == biddyOne) && (g == biddyOne)) return biddyOne;
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),topF)) {
-      r = BiddyInvCond(BiddyT(pncube),BiddyGetMark(pncube)); /* r is used here as a tmp variable */
-      if (r != biddyZero) {
-        pncube = r;
-      } else {
-        pncube = BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube));
-      }
-    }
+  opposite = FALSE;
+  if (ratio > 0.5) {
+    ratio = 1.0 - ratio;
+    opposite = TRUE;
   }
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    if (g == biddyTerminal) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
+
+  m = (long long unsigned int) (0.5 + n * ratio);
+
+  if (m == 0) {
+    if (opposite) {
+      return biddyOne;
+    } else {
+      return biddyZero;
     }
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),topG)) pncube = BiddyT(pncube);
   }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    tagF = BiddyGetTag(f);
-    tagG = BiddyGetTag(g);
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    if ((topF == 0) && (topG == 0)) {
-      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
-        while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagF)) pncube = BiddyT(pncube);
-        while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagG) && (BiddyE(pncube) != biddyZero)) pncube = BiddyT(pncube);
-        if (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagG)) { /* smallest positive >= tagF is smaller as tagG */
-          if (BiddyManagedGetNextVariable(MNG,BiddyV(pncube)) == tagG) { /* smallest positive is previous of tagG */
-            BiddySetTag(g,BiddyV(pncube));
-            return g;
-		  } else {
-            rtag = BiddyV(pncube);
-            v = BiddyManagedGetNextVariable(MNG,rtag);
-            pncube = BiddyT(pncube);
-            /* THIS PART IS OPTIONAL - WE PREFER TO USE IT ALTHOUGH NO REAL DIFFERENCE IS OBSERVED */
-            /**/
-            if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
-            BiddySetTag(f,BiddyManagedGetNextVariable(MNG,v));
-            r = BiddyManagedSelectiveProduct(MNG,f,g,nextcube);
-            if ((v == BiddyV(pncube)) && (BiddyE(pncube) == biddyZero)) { // v in positive set
-              r = BiddyManagedTaggedFoaNode(MNG,v,r,biddyZero,rtag,TRUE);
-            } else {
-              r = BiddyManagedTaggedFoaNode(MNG,v,r,r,rtag,TRUE);
-            }
-            BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-            return r;
-            /**/
-		  }
-	    } else {
-          BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-          return g;
-	    }
-	  } else {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
-	  }
-	} else if ((topG == 0) && !BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
-	} else {
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagG : tagF; /* max tag! */
-      while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),tagF)) pncube = BiddyT(pncube);
-      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG) && (BiddyV(pncube) == tagF) && (BiddyE(pncube) == biddyZero)) {
-        rtag = tagF;
-        if ((tagF != topF) && BiddyIsSmaller(biddyOrderingTable,BiddyManagedGetNextVariable(MNG,tagF),tagG)) {
-          v = BiddyManagedGetNextVariable(MNG,tagF);
-        }
+
+  /* DEBUGGING */
+  /*
+  printf("BASE SET:\n");
+  BiddyManagedPrintfSOP(MNG,BiddyManagedGetBaseSet(MNG));
+  BiddyManagedPrintfBDD(MNG,BiddyManagedGetBaseSet(MNG));
+  printf("BASE SET - CHANGED FIRST VARIABLE:\n");
+  BiddyManagedPrintfSOP(MNG,BiddyManagedChange(MNG,BiddyManagedGetBaseSet(MNG),1));
+  BiddyManagedPrintfBDD(MNG,BiddyManagedChange(MNG,BiddyManagedGetBaseSet(MNG),1));
+  */
+
+  result = biddyZero;
+  while (m != 0) {
+
+    /* GENERATE RANDOM NUMBER */
+    x = rand();
+    x = (n*x)/RAND_MAX;
+
+    /* DEBUGGING */
+    /*
+    printf("RANDOM SET: m=%llu\n",m);
+    printf("RANDOM SET: x = %llu\n",x);
+    */
+
+    p = unit;
+    z = n;
+    q = BiddyManagedGetBaseSet(MNG);
+    while (z != 1) {
+      one = BiddyV(p);
+      p = BiddyT(p);
+      if (x <= ((z - 0.5) / 2)) {
+        z = (long long unsigned int) (z + 0.5) / 2;
+      } else {
+        z = (long long unsigned int) (z + 0.5) / 2;
+        x = x - z;
+        q = BiddyManagedChange(MNG,q,one);
       }
-      if (BiddyIsSmaller(biddyOrderingTable,v,rtag)) rtag = v;
-      while (BiddyIsSmaller(biddyOrderingTable,BiddyV(pncube),v)) pncube = BiddyT(pncube);
     }
-  }
-#endif
 
-  r = biddyNull;
+    tmp = BiddyManagedUnion(MNG,result,q);
+    if (tmp != result) {
+      result = tmp;
+      m--;
+    }
 
-  FF = f;
-  GG = g;
-  HH = pncube;
+    /* DEBUGGING */
+    /*
+    printf("q:\n");
+    BiddyManagedPrintfSOP(MNG,q);
+    BiddyManagedPrintfBDD(MNG,q);
+    printf("result:\n");
+    BiddyManagedPrintfSOP(MNG,result);
+    BiddyManagedPrintfBDD(MNG,result);
+    */
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
+  }
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+  if (opposite) {
+    result = BiddyManagedNot(MNG,result);
+  }
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  return result;
+}
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-      } else {
-        Gneg_v = Gv = g;
-      }
+/***************************************************************************//*!
+\brief Function BiddyManagedExtractMinterm.
 
-      if (v == BiddyV(pncube)) {
-        r = BiddyInvCond(BiddyT(pncube),BiddyGetMark(pncube)); /* r is used here as a tmp variable */
-        if (r != biddyZero) {
-          nextcube = r;
-        } else {
-          nextcube = BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube));
-        }
-      } else {
-        nextcube = pncube;
-      }
-      if (topF == topG) {
-        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
-        if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero))) { /* v in positive set */
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        } else if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) != biddyZero))) { /* v in negative set */
-          t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        } else {
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        }
-      } else {
-        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
-        if ((topF == v) && (v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero)) {
-          /* topF < topG (because topF == v) and v in positive set */
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-        } else {
-          /* all other cases, checking if v is in positive set is not needed */
-          t = BiddyManagedOr(MNG,e,BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube));
-        }
-      }
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_ExtractMinterm.
+*******************************************************************************/
 
-    }
+Biddy_Edge
+BiddyManagedExtractMinterm(Biddy_Manager MNG, Biddy_Edge support, Biddy_Edge f)
+{
+  Biddy_Edge g,m,r;
+  Biddy_Variable v;
+  Biddy_Variable vs;
 
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+  assert( MNG != NULL );
+  assert( f != NULL );
+  assert( support != biddyZero);
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fv = Fneg_v = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gv = Gneg_v = g;
-      }
+  if (f == biddyZero) return biddyZero;
 
-      if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
-      if (topF == topG) {
-        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
-        if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero))) { /* v in positive set */
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        } else if (((v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) != biddyZero))) { /* v in negative set */
-          t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        } else {
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
-          t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-        }
-      } else {
-        e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
-        if ((topG == v) && (v == BiddyV(pncube)) && (BiddyInvCond(BiddyE(pncube),BiddyGetMark(pncube)) == biddyZero)) {
-          /* topG < topF (because topG == v) and v in positive set */
-          t = BiddyManagedGetEmptySet(MNG);
-        } else {
-          /* all other cases, checking if v is in positive set is not needed */
-          t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-        }
-      }
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  r = biddyNull;
 
-    }
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* this generates the smallest minterm */
 
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      /* topF = BiddyV(f); */ /* already set */
-      /* topG = BiddyV(g); */ /* already set */
-      /* tagF = BiddyGetTag(f); */ /* already set */
-      /* tagG = BiddyGetTag(g); */ /* already set */
-      /* v  */ /* already set */
-      /* rtag */ /* already set */
+    if (Biddy_IsTerminal(support)) return biddyOne;
 
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagF)) {
-        Fneg_v = Fv = f;
-      } else if (v == topF) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
-      }
-      if (BiddyIsSmaller(biddyOrderingTable,v,tagG)) {
-        Gneg_v = Gv = g;
-      } else if (v == topG) {
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = biddyZero;
-      }
+    v = BiddyV(f);
+    vs = BiddyV(support);
 
-      if (v == BiddyV(pncube)) nextcube = BiddyT(pncube); else nextcube = pncube;
-      e = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gneg_v,nextcube);
-      if ((v == BiddyV(pncube)) && (BiddyE(pncube) == biddyZero)) { // v in positive set
-        /* printf("\nPOSITIVE"); */
-        t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
-      } else if ((v != BiddyV(pncube)) && !BiddyIsSmaller(biddyOrderingTable,v,BiddyGetTag(pncube))) { // v in negative set
-        /* printf("\nNEGATIVE"); */
-        t = BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube);
-        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+    if (v != vs) {
+      m = BiddyManagedExtractMinterm(MNG,BiddyT(support),f);
+      r = BiddyManagedTaggedFoaNode(MNG,vs,m,biddyZero,vs,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+    } else {
+      g = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+      if (g == biddyZero) {
+        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
+        r = BiddyManagedTaggedFoaNode(MNG,vs,biddyZero,m,vs,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       } else {
-        /* printf("\nNEUTRAL"); */
-        t = BiddyManagedSelectiveProduct(MNG,Fv,Gv,nextcube);
-        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fneg_v,Gv,nextcube));
-        t = BiddyManagedOr(MNG,t,BiddyManagedSelectiveProduct(MNG,Fv,Gneg_v,nextcube));
+        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),g);
+        r = BiddyManagedTaggedFoaNode(MNG,vs,m,biddyZero,vs,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       }
+    }
+
+  }
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+
+    /* this generates the smallest minterm */
+    /* argument support is not used for ZBDD and ZBDDC */
+
+    if (Biddy_IsTerminal(f)) return f;
+
+    v = BiddyV(f);
+
+    g = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+    if (g == biddyZero) {
+      m = BiddyManagedExtractMinterm(MNG,support,BiddyT(f));
+      r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,m,v,TRUE);
       BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+    } else {
+      r = BiddyManagedExtractMinterm(MNG,support,g);
     }
-#endif
 
-  } else {
+  }
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
 
-  }
+    /* this generates the smallest minterm */
 
-  /* DEBUGGING */
-  /*
-  printf("SelectiveProduct: RESULT = %u (%s)\n",BiddyV(r),BiddyManagedGetVariableName(MNG,BiddyV(r)));
-  */
+    v = BiddyV(f);
+    vs = BiddyV(support);
+
+    if (Biddy_IsTerminal(f)) {
+      Biddy_SetTag(f,vs);
+      return f;
+    }
+
+    while (BiddyV(support) != v) {
+      support = BiddyT(support);
+    }
+
+    g = BiddyE(f);
+    if (g == biddyZero) {
+        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),BiddyT(f));
+        r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,m,vs,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+    } else {
+      r = BiddyManagedExtractMinterm(MNG,BiddyT(support),g);
+      Biddy_SetTag(r,vs);
+    }
+
+  }
+#endif
 
   return r;
 }
 
+
+
 /***************************************************************************//*!
-\brief Function BiddyManagedSupset.
+\brief Function BiddyManagedDual.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Supset.
+    See Biddy_Managed_Dual.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedSupset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
+BiddyManagedDual(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean neg)
 {
-  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
-  Biddy_Variable v, topF, topG;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Variable tagF, tagG, rtag;
-#endif
+  Biddy_Edge e, t;
+  Biddy_Variable v;
+  Biddy_Edge r;
 
   assert( MNG != NULL );
   assert( f != NULL );
-  assert( g != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -8561,428 +10797,635 @@ BiddyManagedSupset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  if (f == biddyZero) return biddyZero;
-  if (g == biddyZero) return biddyZero;
-  if (f == g) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
-  }
-
-#ifndef COMPACT
-  tagF = tagG = topF = topG = 0; /* to make compiler happy */
-  if (biddyManagerType == BIDDYTYPETZBDD) {
-    tagF = BiddyGetTag(f);
-    tagG = BiddyGetTag(g);
-    topF = BiddyV(f);
-    topG = BiddyV(g);
-    if ((topF == 0) && ((topG == 0))) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
-    }
-  }
-#endif
-
   r = biddyNull;
 
-  FF = biddyNull;
-  GG = f;
-  HH = g;
-
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
-
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    if (f == biddyZero) r = biddyOne;
+    else if (f == biddyOne) r = biddyZero;
+    else {
+      v = BiddyV(f);
+      e = BiddyManagedDual(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),neg);
+      t = BiddyManagedDual(MNG,BiddyT(f),neg);
+      if (neg) {
+        r = BiddyManagedTaggedFoaNode(MNG,v,t,e,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       } else {
-        Gneg_v = Gv = g;
-      }
-
-      e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
-      t = BiddyManagedSupset(MNG,Fv,Gv);
-      if (v == topG) {
-        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
+        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
       }
-
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
-
     }
+  }
 
 #ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
-
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = Gv = g;
-      }
-
-      if (topF == topG) {
-        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedSupset(MNG,Fv,Gv);
-        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
-      } else if (v == topF) {
-        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
-        t = BiddyManagedSupset(MNG,Fv,Gv);
-      } else {
-        e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
-        t = biddyZero;
-      }
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+  }
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+  }
+#endif
 
-    }
+  return r;
+}
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
+/***************************************************************************//*!
+\brief Function BiddyManagedAndN.
 
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      /* tagF = BiddyGetTag(f); */ /* already set */
-      /* tagG = BiddyGetTag(g); */ /* already set */
-      /* topF = BiddyV(f); */ /* already set */
-      /* topG = BiddyV(g); */ /* already set */
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,topG) ? tagF : topG; /* min(tagF,topG) */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG; /* min(topF,topG) */
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_AndN.
+*******************************************************************************/
 
-      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
-        Fneg_v = Fv = f;
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
-        Gneg_v = BiddyE(g);
-        Gv = biddyZero;
-      } else if (topG == topF) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = Gv = g;
-      } else {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = Gneg_v;
-      }
+Biddy_Edge
+BiddyManagedAndN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule)
+{
+  assert( MNG != NULL );
 
-      e = BiddyManagedSupset(MNG,Fneg_v,Gneg_v);
-      t = BiddyManagedSupset(MNG,Fv,Gv);
-      /*
-      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
-        t = BiddyManagedOr(MNG,t,e);
-      } else if (topG == topF) {
-        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
-      }
-      */
-      if (v == topG) {
-        t = BiddyManagedOr(MNG,t,BiddyManagedSupset(MNG,Fv,Gneg_v));
-      }
+  if ((schedule != BIDDYSCHEDULELINEAR) && (schedule != BIDDYSCHEDULETREE) &&
+      (schedule != BIDDYSCHEDULESMALLEST) && (schedule != BIDDYSCHEDULESUPPORT))
+  {
+    fprintf(stderr,"Biddy_AndN: Unsupported schedule!\n");
+    return biddyNull;
+  }
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  return applyN(MNG,f,n,schedule,TRUE);
+}
 
-    }
-#endif
+/***************************************************************************//*!
+\brief Function BiddyManagedOrN.
 
-  } else {
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_OrN.
+*******************************************************************************/
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+Biddy_Edge
+BiddyManagedOrN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule)
+{
+  assert( MNG != NULL );
 
+  if ((schedule != BIDDYSCHEDULELINEAR) && (schedule != BIDDYSCHEDULETREE) &&
+      (schedule != BIDDYSCHEDULESMALLEST) && (schedule != BIDDYSCHEDULESUPPORT))
+  {
+    fprintf(stderr,"Biddy_OrN: Unsupported schedule!\n");
+    return biddyNull;
   }
 
-  return r;
+  return applyN(MNG,f,n,schedule,FALSE);
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedSubset.
+\brief Function BiddyManagedAndBF.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Subset.
+    See Biddy_Managed_AndBF.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedSubset(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
+BiddyManagedAndBF(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g)
 {
-  Biddy_Edge e, t, r, Fv, Gv, Fneg_v, Gneg_v;
-  Biddy_Variable v, topF, topG;
+  BiddyBFQueue q;
+  BiddyBFRequest *rq;
+  Biddy_Edge r, E, T, Fv, Gv, Fneg_v, Gneg_v;
   Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
-
-#ifndef COMPACT
-  Biddy_Variable tagF, tagG, rtag;
-#endif
+  Biddy_Variable top, bottom, v, topF, topG;
+  unsigned int i, j, root;
 
   assert( MNG != NULL );
   assert( f != NULL );
   assert( g != NULL );
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+  if ((biddyManagerType != BIDDYTYPEOBDDC) && (biddyManagerType != BIDDYTYPEOBDD)) {
+    return BiddyManagedAnd(MNG,f,g);
+  }
 
-  if (f == biddyZero) return biddyZero;
-  if (g == biddyZero) return biddyZero;
-  if (f == g) {
-    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-    return f;
+  q.size = BIDDYBFREQUESTS;
+  q.num = 1;
+  q.hashsize = BIDDYBFREQUESTS - 1;
+  if (!(q.table = (BiddyBFRequest *) malloc(q.size * sizeof(BiddyBFRequest))) ||
+      !(q.hash = (unsigned int *) calloc(q.hashsize + 1,sizeof(unsigned int))) ||
+      !(q.first = (unsigned int *) calloc(biddyVariableTable.num,sizeof(unsigned int))) ||
+      !(q.last = (unsigned int *) calloc(biddyVariableTable.num,sizeof(unsigned int))))
+  {
+    fprintf(stderr,"BiddyManagedAndBF: Out of memoy!\n");
+    exit(1);
   }
 
-#ifndef COMPACT
-  tagF = tagG = topF = topG = 0; /* to make compiler happy */
-  if (biddyManagerType == BIDDYTYPETZBDD) {
-    tagF = BiddyGetTag(f);
-    tagG = BiddyGetTag(g);
+  r = biddyNull;
+  if ((root = bfAndRequest(MNG,&q,f,g,&r))) {
+
+    /* THE FIRST PASS: REQUESTS ARE EXPANDED FROM THE TOP TO THE BOTTOM */
+    /* ALL NEW REQUESTS HAVE A LOWER TOP VARIABLE THAN THE EXPANDED ONE */
     topF = BiddyV(f);
     topG = BiddyV(g);
-    if ((topF == 0) && ((topG == 0))) {
-      if (BiddyIsSmaller(biddyOrderingTable,tagF,tagG)) {
-        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-        return f;
-      } else {
-        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
-        return g;
+    top = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+    bottom = top;
+    for (v = top; v != 0; v = biddyVariableTable.table[v].next) {
+      if (q.first[v]) bottom = v;
+      for (j = q.first[v]; j; j = q.table[j].next) {
+
+        /* DETERMINING PARAMETERS FOR BOTH SUCCESSORS */
+        /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+        f = q.table[j].f;
+        g = q.table[j].g;
+        if (BiddyV(f) == v) {
+          Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+          Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+        } else {
+          Fneg_v = Fv = f;
+        }
+        if (BiddyV(g) == v) {
+          Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+          Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+        } else {
+          Gneg_v = Gv = g;
+        }
+
+        /* THE TABLE MAY BE REALLOCATED BY bfAndRequest */
+        i = bfAndRequest(MNG,&q,Fneg_v,Gneg_v,&E);
+        q.table[j].e = i;
+        q.table[j].E = E;
+        i = bfAndRequest(MNG,&q,Fv,Gv,&T);
+        q.table[j].t = i;
+        q.table[j].T = T;
+
+      }
+    }
+
+    /* THE SECOND PASS: REQUESTS ARE REDUCED FROM THE BOTTOM TO THE TOP */
+    /* NODES WITH THE SAME VARIABLE ARE CREATED ONE AFTER ANOTHER */
+    for (v = bottom; ; v = biddyVariableTable.table[v].prev) {
+      for (j = q.first[v]; j; j = rq->next) {
+        rq = &q.table[j];
+        E = rq->e ? q.table[rq->e].r : rq->E;
+        T = rq->t ? q.table[rq->t].r : rq->T;
+        r = BiddyManagedTaggedFoaNode(MNG,v,E,T,v,TRUE);
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        if (bfAndKey(MNG,rq->f,rq->g,&FF,&GG,&HH)) {
+          addOp3Cache(biddyOPCache,FF,GG,HH,BiddyInv(r),rq->cindex);
+        } else {
+          addOp3Cache(biddyOPCache,FF,GG,HH,r,rq->cindex);
+        }
+        rq->r = r;
       }
+      if (v == top) break;
     }
+
+    r = q.table[root].r;
+
   }
-#endif
 
-  r = biddyNull;
+  free(q.table);
+  free(q.hash);
+  free(q.first);
+  free(q.last);
 
-  FF = f;
-  GG = g;
-  HH = biddyNull;
+  return r;
+}
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (!findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
+/***************************************************************************//*!
+\brief Function BiddyManagedCreateRelation.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_CreateRelation.
+*******************************************************************************/
+
+Biddy_Relation
+BiddyManagedCreateRelation(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n,
+                           Biddy_Variable *cur, Biddy_Variable *next,
+                           unsigned int m, unsigned int clustersize)
+{
+  BiddyRelation *rel;
+  BiddyRelationSchedule s;
+  Biddy_Variable **supp;
+  unsigned int *nsupp,*size;
+  Biddy_Boolean *quant;
+  Biddy_Edge c,tmp;
+  char name[64];
+  unsigned int i;
+  static unsigned int num = 0; /* names must be unique because of Replace cache */
+
+  assert( MNG != NULL );
+
+  if (!(rel = (BiddyRelation *) malloc(sizeof(BiddyRelation))) ||
+      !(rel->cluster = (Biddy_Edge *) malloc((n+1) * sizeof(Biddy_Edge))) ||
+      !(rel->cur = (Biddy_Variable *) malloc((m+1) * sizeof(Biddy_Variable))) ||
+      !(rel->next = (Biddy_Variable *) malloc((m+1) * sizeof(Biddy_Variable))) ||
+      !(supp = (Biddy_Variable **) malloc((n+1) * sizeof(Biddy_Variable *))) ||
+      !(nsupp = (unsigned int *) malloc((n+1) * sizeof(unsigned int))) ||
+      !(size = (unsigned int *) malloc((n+1) * sizeof(unsigned int))) ||
+      !(quant = (Biddy_Boolean *) calloc(biddyVariableTable.num,sizeof(Biddy_Boolean))))
   {
+    fprintf(stderr,"BiddyManagedCreateRelation: Out of memoy!\n");
+    exit(1);
+  }
+  memcpy(rel->cur,cur,m * sizeof(Biddy_Variable));
+  memcpy(rel->next,next,m * sizeof(Biddy_Variable));
+  rel->m = m;
+
+  /* PARTITIONS ARE ORDERED BY THE SCHEDULE FOR FORWARD IMAGE */
+  for (i = 0; i < n; i++) {
+    supp[i] = scheduleSupport(MNG,T[i],&nsupp[i]);
+    size[i] = BiddyManagedCountNodes(MNG,T[i]);
+  }
+  for (i = 0; i < m; i++) quant[cur[i]] = TRUE;
+  relationSchedule(MNG,supp,nsupp,size,n,quant,&s);
+
+  /* ADJACENT PARTITIONS ARE CONJOINED INTO CLUSTERS */
+  rel->n = 0;
+  c = biddyNull;
+  for (i = 0; i < n; i++) {
+    if (c == biddyNull) {
+      c = T[s.order[i]];
+      continue;
+    }
+    tmp = biddyNull;
+    if (clustersize) {
+      tmp = BiddyManagedAnd(MNG,c,T[s.order[i]]);
+      if (BiddyManagedCountNodes(MNG,tmp) > clustersize) tmp = biddyNull;
+    }
+    if (tmp == biddyNull) {
+      rel->cluster[rel->n++] = c;
+      c = T[s.order[i]];
+    } else {
+      c = tmp;
+    }
+  }
+  if (c != biddyNull) rel->cluster[rel->n++] = c;
+  free(s.order);
+  free(s.qstart);
+  free(s.qvar);
+  for (i = 0; i < n; i++) free(supp[i]);
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+  /* CLUSTERS ARE PRESERVED AS PERSISTENT FORMULAE */
+  sprintf(name,"biddyRelation%u",++num);
+  if (!(rel->name = strdup(name))) {
+    fprintf(stderr,"BiddyManagedCreateRelation: Out of memoy!\n");
+    exit(1);
+  }
+  for (i = 0; i < rel->n; i++) {
+    sprintf(name,"%s_%u",rel->name,i);
+    BiddyManagedAddPersistentFormula(MNG,(Biddy_String) name,rel->cluster[i]);
+    supp[i] = scheduleSupport(MNG,rel->cluster[i],&nsupp[i]);
+    size[i] = BiddyManagedCountNodes(MNG,rel->cluster[i]);
+  }
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  /* SCHEDULES FOR FORWARD AND BACKWARD IMAGE */
+  relationSchedule(MNG,supp,nsupp,size,rel->n,quant,&rel->image);
+  for (i = 0; i < m; i++) quant[cur[i]] = FALSE;
+  for (i = 0; i < m; i++) quant[next[i]] = TRUE;
+  relationSchedule(MNG,supp,nsupp,size,rel->n,quant,&rel->preimage);
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
-      } else {
-        Gneg_v = Gv = g;
-      }
+  for (i = 0; i < rel->n; i++) free(supp[i]);
+  free(supp);
+  free(nsupp);
+  free(size);
+  free(quant);
 
-      e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
-      t = BiddyManagedSubset(MNG,Fv,Gv);
-      if (v == topG) {
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
-      }
+  return (Biddy_Relation) rel;
+}
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+/***************************************************************************//*!
+\brief Function BiddyManagedDeleteRelation.
 
-    }
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_DeleteRelation.
+*******************************************************************************/
 
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+void
+BiddyManagedDeleteRelation(Biddy_Manager MNG, Biddy_Relation rel)
+{
+  BiddyRelation *r;
+  char name[64];
+  unsigned int i;
 
-      /* LOOKING FOR THE SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      topF = BiddyV(f);
-      topG = BiddyV(g);
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  assert( MNG != NULL );
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      if (topF == v) {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyT(f);
-      } else {
-        Fneg_v = Fv = f;
-      }
-      if (topG == v) {
-        Gneg_v = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
-        Gv = BiddyT(g);
-      } else {
-        Gneg_v = Gv = g;
-      }
+  r = (BiddyRelation *) rel;
+  for (i = 0; i < r->n; i++) {
+    sprintf(name,"%s_%u",r->name,i);
+    BiddyManagedDeleteFormula(MNG,(Biddy_String) name);
+  }
 
-      if (topF == topG) {
-        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
-        t = BiddyManagedSubset(MNG,Fv,Gv);
-      } else if (v == topF) {
-        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
-        t = biddyZero;
-      } else {
-        e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fv,Gv));
-        t = biddyZero;
-      }
+  free(r->image.order);
+  free(r->image.qstart);
+  free(r->image.qvar);
+  free(r->preimage.order);
+  free(r->preimage.qstart);
+  free(r->preimage.qvar);
+  free(r->cluster);
+  free(r->cur);
+  free(r->next);
+  free(r->name);
+  free(r);
+}
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+/***************************************************************************//*!
+\brief Function BiddyManagedImage.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Image.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedImage(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                  Biddy_Edge R)
+{
+  BiddyRelation *r;
+  Biddy_Edge img,result;
+  unsigned int i;
+
+  assert( MNG != NULL );
+
+  result = biddyZero;
+  for (i = 0; i < k; i++) {
+    r = (BiddyRelation *) rel[i];
+    img = relationImage(MNG,r,&r->image,R);
+    img = relationRename(MNG,r,img,TRUE);
+    result = BiddyManagedOr(MNG,result,img);
+  }
+
+  return result;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedPreImage.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_PreImage.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedPreImage(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                     Biddy_Edge R)
+{
+  BiddyRelation *r;
+  Biddy_Edge img,result;
+  unsigned int i;
+
+  assert( MNG != NULL );
+
+  result = biddyZero;
+  for (i = 0; i < k; i++) {
+    r = (BiddyRelation *) rel[i];
+    img = relationRename(MNG,r,R,FALSE);
+    img = relationImage(MNG,r,&r->preimage,img);
+    result = BiddyManagedOr(MNG,result,img);
+  }
+
+  return result;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedReachable.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Reachable.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedReachable(Biddy_Manager MNG, Biddy_Relation *rel, unsigned int k,
+                      Biddy_Edge I, Biddy_Edge target, unsigned int *steps)
+{
+  Biddy_Edge R,F;
+  unsigned int n;
+
+  assert( MNG != NULL );
 
+  R = F = I;
+  n = 0;
+  while (TRUE) {
+    if (target && (BiddyManagedAnd(MNG,R,target) != biddyZero)) break;
+    F = BiddyManagedImage(MNG,rel,k,F);
+    n++;
+    F = BiddyManagedAnd(MNG,F,BiddyManagedNot(MNG,R));
+    if (F == biddyZero) break;
+    R = BiddyManagedOr(MNG,R,F);
+
+    /* INTERMEDIATE RESULTS ARE REMOVED BY THE NEXT GARBAGE COLLECTION */
+    BiddyManagedKeepFormula(MNG,I);
+    if (target) BiddyManagedKeepFormula(MNG,target);
+    BiddyManagedKeepFormula(MNG,R);
+    BiddyManagedKeepFormula(MNG,F);
+    BiddyManagedClean(MNG);
+  }
+  if (steps) *steps = n;
+
+  return R;
+}
+
+
+/***************************************************************************//*!
+\brief Function BiddyManagedSaturate.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_Saturate.
+*******************************************************************************/
+
+Biddy_Edge
+BiddyManagedSaturate(Biddy_Manager MNG, Biddy_Edge *T, unsigned int n,
+                     Biddy_Variable *cur, Biddy_Variable *next,
+                     unsigned int m, Biddy_Edge I)
+{
+  BiddySaturation sat;
+  BiddySatEvent *e;
+  Biddy_Variable *supp,v;
+  unsigned int *curlevel,*nextlevel;
+  unsigned int i,j,k,top,num;
+  Biddy_Edge r;
+  char keyword[64];
+  static unsigned int key = 0; /* keywords must be unique because of Replace cache */
+
+  assert( MNG != NULL );
+
+  if (!(sat.event = (BiddySatEvent *) malloc((n+1) * sizeof(BiddySatEvent))) ||
+      !(sat.first = (unsigned int *) calloc(m+1,sizeof(unsigned int))) ||
+      !(sat.level = (Biddy_Variable *) malloc((m+1) * sizeof(Biddy_Variable))) ||
+      !(sat.cache = (BiddySatCache *) calloc(BIDDYSATCACHESIZE+1,sizeof(BiddySatCache))) ||
+      !(curlevel = (unsigned int *) malloc(biddyVariableTable.num * sizeof(unsigned int))) ||
+      !(nextlevel = (unsigned int *) malloc(biddyVariableTable.num * sizeof(unsigned int))))
+  {
+    fprintf(stderr,"BiddyManagedSaturate: Out of memoy!\n");
+    exit(1);
+  }
+  sat.cur = cur;
+  sat.next = next;
+  sat.m = m;
+
+  /* LEVELS ARE ORDERED BY CURRENT STATE VARIABLES, THE TOPMOST IS LEVEL 0 */
+  /* sat.level contains indices of state variables during sorting */
+  for (i = 0; i < m; i++) {
+    for (j = i; (j > 0) && BiddyIsSmaller(biddyOrderingTable,cur[i],cur[sat.level[j-1]]); j--) {
+      sat.level[j] = sat.level[j-1];
+    }
+    sat.level[j] = i;
+  }
+  for (v = 0; v < biddyVariableTable.num; v++) {
+    curlevel[v] = nextlevel[v] = m;
+  }
+  for (k = 0; k < m; k++) {
+    curlevel[cur[sat.level[k]]] = k;
+    nextlevel[next[sat.level[k]]] = k;
+  }
+
+  /* EVENTS ARE GROUPED BY THE TOP LEVEL */
+  /* events which do not change any state variable are not used */
+  sat.last = 0;
+  num = 0;
+  key++;
+  for (i = 0; i < n; i++) {
+    e = &sat.event[num+1];
+    supp = scheduleSupport(MNG,T[i],&j);
+    if (!(e->write = (unsigned int *) malloc((j+1) * sizeof(unsigned int)))) {
+      fprintf(stderr,"BiddyManagedSaturate: Out of memoy!\n");
+      exit(1);
+    }
+    e->rel = T[i];
+    e->cube = biddyOne;
+    e->wnum = 0;
+    top = m;
+    while (j--) {
+      v = supp[j];
+      if (nextlevel[v] != m) {
+        e->write[e->wnum++] = sat.level[nextlevel[v]];
+        e->cube = BiddyManagedAnd(MNG,e->cube,biddyVariableTable.table[cur[sat.level[nextlevel[v]]]].variable);
+        if (nextlevel[v] < top) top = nextlevel[v];
+      } else if (curlevel[v] != m) {
+        if (curlevel[v] < top) top = curlevel[v];
+      } else {
+        e->cube = BiddyManagedAnd(MNG,e->cube,biddyVariableTable.table[v].variable);
+      }
+    }
+    free(supp);
+    if (!e->wnum) {
+      free(e->write);
+      continue;
+    }
+    sprintf(keyword,"biddySaturate%u_%u",key,num+1);
+    if (!(e->keyword = strdup(keyword))) {
+      fprintf(stderr,"BiddyManagedSaturate: Out of memoy!\n");
+      exit(1);
     }
+    num++;
+    e->next = sat.first[top];
+    sat.first[top] = num;
+    if (top + 1 > sat.last) sat.last = top + 1;
+  }
+  for (k = 0; k < m; k++) {
+    sat.level[k] = cur[sat.level[k]];
+  }
+  free(curlevel);
+  free(nextlevel);
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
+  BiddyManagedResetVariablesValue(MNG);
+  r = saturate(MNG,&sat,I,0);
+
+  for (i = 1; i <= num; i++) {
+    free(sat.event[i].write);
+    free(sat.event[i].keyword);
+  }
+  free(sat.event);
+  free(sat.first);
+  free(sat.level);
+  free(sat.cache);
+
+  return r;
+}
+
+/***************************************************************************//*!
+\brief Function BiddyManagedVectorCompose.
 
-      /* LOOKING FOR THE SMALLEST TAG AND SMALLEST TOP VARIABLE */
-      /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
-      /* tagF = BiddyGetTag(f); */ /* already set */
-      /* tagG = BiddyGetTag(g); */ /* already set */
-      /* topF = BiddyV(f); */ /* already set */
-      /* topG = BiddyV(g); */ /* already set */
-      rtag = BiddyIsSmaller(biddyOrderingTable,tagF,tagG) ? tagF : tagG; /* min(tagF,topG) */
-      v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG; /* min(topF,topG) */
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_VectorCompose.
+*******************************************************************************/
 
-      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
-        Fneg_v = Fv = f;
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
-        Fneg_v = f;
-        BiddySetTag(Fneg_v,v);
-        Fneg_v = BiddyManagedIncTag(MNG,Fneg_v);
-        Fv = biddyZero;
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else if (topG == topF) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = BiddyE(g);
-        Gv = BiddyT(g);
-      } else if (BiddyIsSmaller(biddyOrderingTable,topF,tagG)) {
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        Gneg_v = Gv = g;
-      } else {
-        Fneg_v = BiddyE(f);
-        Fv = biddyZero;
-        Gneg_v = g;
-        BiddySetTag(Gneg_v,v);
-        Gneg_v = BiddyManagedIncTag(MNG,Gneg_v);
-        Gv = biddyZero;
-      }
+Biddy_Edge
+BiddyManagedVectorCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable *v,
+                          Biddy_Edge *g, unsigned int n)
+{
+  Biddy_Edge r;
+  Biddy_Edge *subst;
+  Biddy_Variable last;
+  unsigned int i;
 
-      e = BiddyManagedSubset(MNG,Fneg_v,Gneg_v);
-      t = BiddyManagedSubset(MNG,Fv,Gv);
-      /*
-      if (BiddyIsSmaller(biddyOrderingTable,topG,tagF)) {
-        e = BiddyManagedOr(MNG,e,t);
-      } else if (BiddyIsSmaller(biddyOrderingTable,topG,topF)) {
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
-      } else if (topG == topF) {
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
-      }
-      */
-      if (v == topG) {
-        e = BiddyManagedOr(MNG,e,BiddyManagedSubset(MNG,Fneg_v,Gv));
-      }
+  assert( MNG != NULL );
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,rtag,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+  /* IMPLEMENTED FOR OBDD AND OBDDC */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC)
+  );
 
-    }
-#endif
+  if (f == biddyZero) return biddyZero;
+  if (!n) return f;
 
-  } else {
+  if (!(subst = (Biddy_Edge *) malloc(biddyVariableTable.num * sizeof(Biddy_Edge)))) {
+    fprintf(stderr,"BiddyManagedVectorCompose: Out of memoy!\n");
+    exit(1);
+  }
+  for (i = 0; i < biddyVariableTable.num; i++) {
+    subst[i] = biddyNull;
+  }
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  /* THE LAST SUBSTITUTED VARIABLE IN THE ORDERING LIMITS THE RECURSION */
+  /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+  for (i = 0; i < n; i++) {
+    assert( (v[i] != 0) && (v[i] < biddyVariableTable.num) );
+    assert( BiddyIsOK(g[i]) == TRUE );
+    subst[v[i]] = (g[i] == biddyVariableTable.table[v[i]].variable) ? biddyNull : g[i];
+  }
+  last = 0;
+  for (i = 1; i < biddyVariableTable.num; i++) {
+    if (subst[i] && (!last || BiddyIsSmaller(biddyOrderingTable,last,i))) last = i;
+  }
 
+  if (!last) {
+    r = f;
+  } else {
+    r = vectorCompose(MNG,f,subst,last,++biddyReplaceCache.keyNum);
   }
 
+  free(subst);
+
   return r;
 }
 
 /***************************************************************************//*!
-\brief Function BiddyManagedPermitsym.
+\brief Function BiddyManagedRestrictCube.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Permitsym.
+    See Biddy_Managed_RestrictCube.
 *******************************************************************************/
 
 Biddy_Edge
-BiddyManagedPermitsym(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable lowest,
-                      unsigned int n)
+BiddyManagedRestrictCube(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge cube)
 {
-  Biddy_Edge e, t, r, Fv, Fneg_v;
-  Biddy_Variable v;
-
-#ifndef COMPACT
-  Biddy_Variable tag;
-#endif
+  Biddy_Edge r;
+  Biddy_Edge *lit;
+  Biddy_Variable v,top,last;
 
   assert( MNG != NULL );
   assert( f != NULL );
+  assert( cube != NULL );
 
   /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
@@ -8993,1203 +11436,2134 @@ BiddyManagedPermitsym(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable lowest,
     (biddyManagerType == BIDDYTYPETZBDD)
   );
 
-  /* argument lowest is not used for ZBDD and ZBDDC */
+  if (cube == biddyOne) return f;
 
-  if (f == biddyZero) return biddyZero;
+  /* lit[v] IS biddyOne FOR POSITIVE LITERAL, biddyZero FOR NEGATIVE LITERAL, */
+  /* AND biddyNull IF VARIABLE v IS NOT IN THE CUBE */
+  if (!(lit = (Biddy_Edge *) malloc(biddyVariableTable.num * sizeof(Biddy_Edge)))) {
+    fprintf(stderr,"BiddyManagedRestrictCube: Out of memoy!\n");
+    exit(1);
+  }
+  for (v = 0; v < biddyVariableTable.num; v++) {
+    lit[v] = biddyNull;
+  }
 
-  r = biddyNull;
+  top = BiddyManagedGetLowestVariable(MNG);
+  if (!restrictCubeLiterals(MNG,cube,top,lit)) {
+    fprintf(stderr,"Biddy_RestrictCube: the given function is not a cube!\n");
+    free(lit);
+    return biddyNull;
+  }
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+  /* THE LAST VARIABLE FROM THE CUBE IN THE ORDERING LIMITS THE RECURSION */
+  last = 0;
+  for (v = top; v != 0; v = biddyVariableTable.table[v].next) {
+    if (lit[v]) last = v;
+  }
 
-    v = BiddyV(f);
-    if (lowest == 0) {
-      assert( v == 0 );
-      return f;  /* refresh not needed because biddyV(f) is 0 */
+  if (!last) {
+    r = f;
+  } else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    r = restrictCube(MNG,f,top,lit,last,cube);
+  } else {
+    r = restrictCube(MNG,f,0,lit,last,cube);
+  }
+
+  free(lit);
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Definition of other internal functions                                     */
+/*----------------------------------------------------------------------------*/
+
+/*******************************************************************************
+\brief Function BiddyOPGarbage performs Garbage Collection for the OP cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyOPGarbage(Biddy_Manager MNG)
+{
+  if (biddyOPCache.disabled) return;
+  if (*biddyOPCache.notusedyet) return;
+
+  /* IF THE CACHE TABLE IS RESIZED THEN IT IS ALSO CLEANED */
+  if (resizeOp3Cache(MNG,&biddyOPCache)) return;
+
+#ifdef LAZYCACHE
+  /* ENTRIES FROM THE PREVIOUS EPOCHS ARE IGNORED, THE TABLE IS NOT CHECKED */
+  if (!++biddyOPCache.epoch) {
+    memset(biddyOPCache.table,0,(biddyOPCache.size+1)*sizeof(BiddyOp3Cache));
+    biddyOPCache.epoch = 1;
+  }
+#else
+  BiddyParallelFor(MNG,opGarbage,NULL,biddyOPCache.size+1,biddyOPCache.size+1);
+#endif
+}
+
+/*******************************************************************************
+\brief Function BiddyOPGarbageNewVariable is used to clean the OP cache after
+        the adding new variable.
+
+### Description
+    This function is needed for BDD types where adding new variable below
+    the existing one changes the meaning of the existing formulae.
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyOPGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
+
+  if (biddyOPCache.disabled) return;
+  if (*biddyOPCache.notusedyet) return;
+
+  for (j=0; j<=biddyOPCache.size; j++) {
+    if (BiddyCacheEntryValid(biddyOPCache,&biddyOPCache.table[j])) {
+      c = &biddyOPCache.table[j];
+      if ((BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyOPCache,c->f)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyOPCache,c->g)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyOPCache,c->h)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyOPCache,c->result)->v,v)))
+      {
+        c->result = BiddyCacheNull;
+      }
     }
+  }
+}
 
-    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS - NOT ALWAYS NEEDED */
-    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-    if (v == lowest) {
-      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+/*******************************************************************************
+\brief Function BiddyOPGarbageDeleteAll deletes all entries in the OP cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyOPGarbageDeleteAll(Biddy_Manager MNG)
+{
+  /*
+  unsigned int j;
+  BiddyOp3Cache *c;
+  */
+
+  if (biddyOPCache.disabled) return;
+  if (*biddyOPCache.notusedyet) return;
+
+  /**/
+  memset(biddyOPCache.table,0,(biddyOPCache.size+1)*sizeof(BiddyOp3Cache));
+  /**/
+
+  /*
+  bzero(biddyOPCache.table, (biddyOPCache.size+1) * sizeof(BiddyOp3Cache));
+  */
+
+  /*
+  for (j=0; j<=biddyOPCache.size; j++) {
+    if (!BiddyCacheIsNull(biddyOPCache.table[j].result)) {
+      c = &biddyOPCache.table[j];
+      c->result = BiddyCacheNull;
     }
+  }
+  */
 
-    if (v == lowest) {
-      e = BiddyManagedPermitsym(MNG,Fneg_v,biddyVariableTable.table[lowest].next,n);
-      if (n == 0) {
-        t = biddyZero;
-      } else {
-        t = BiddyManagedPermitsym(MNG,Fv,biddyVariableTable.table[lowest].next,n-1);
-      }
-    } else {
-      e = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[lowest].next,n);
-      if (n == 0) {
-        t = biddyZero;
-      } else {
-        t = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[lowest].next,n-1);
+  *biddyOPCache.notusedyet = TRUE;
+}
+
+/*******************************************************************************
+\brief Function BiddyEAGarbage performs Garbage Collection for the EA cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyEAGarbage(Biddy_Manager MNG)
+{
+  if (biddyEACache.disabled) return;
+  if (*biddyEACache.notusedyet) return;
+
+  /* IF THE CACHE TABLE IS RESIZED THEN IT IS ALSO CLEANED */
+  if (resizeOp3Cache(MNG,&biddyEACache)) return;
+
+#ifdef LAZYCACHE
+  /* ENTRIES FROM THE PREVIOUS EPOCHS ARE IGNORED, THE TABLE IS NOT CHECKED */
+  if (!++biddyEACache.epoch) {
+    memset(biddyEACache.table,0,(biddyEACache.size+1)*sizeof(BiddyOp3Cache));
+    biddyEACache.epoch = 1;
+  }
+#else
+  BiddyParallelFor(MNG,eaGarbage,NULL,biddyEACache.size+1,biddyEACache.size+1);
+#endif
+}
+
+/*******************************************************************************
+\brief Function BiddyEAGarbageNewVariable is used to clean the EA cache after
+        the adding new variable.
+
+### Description
+    This function is needed for BDD types where adding new variable below
+    the existing one changes the meaning of the existing formulae.
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyEAGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
+
+  if (biddyEACache.disabled) return;
+  if (*biddyEACache.notusedyet) return;
+
+  for (j=0; j<=biddyEACache.size; j++) {
+    if (BiddyCacheEntryValid(biddyEACache,&biddyEACache.table[j])) {
+      c = &biddyEACache.table[j];
+      if ((BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyEACache,c->f)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyEACache,c->g)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyEACache,c->h)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyEACache,c->result)->v,v)))
+      {
+        c->result = BiddyCacheNull;
       }
     }
+  }
+}
 
-    r = BiddyManagedTaggedFoaNode(MNG,lowest,e,t,lowest,TRUE);
-    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+/*******************************************************************************
+\brief Function BiddyEAGarbageDeleteAll deletes all entries in the EA cache.
 
-  }
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+void
+BiddyEAGarbageDeleteAll(Biddy_Manager MNG)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
 
-    v = BiddyV(f);
-    if (v == 0) {
-      return f; /* refresh not needed because biddyV(f) is 0 */
-    }
+  if (biddyEACache.disabled) return;
+  if (*biddyEACache.notusedyet) return;
 
-    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-    /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-    Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    Fv = BiddyT(f);
+  for (j=0; j<=biddyEACache.size; j++) {
+    c = &biddyEACache.table[j];
+    c->result = BiddyCacheNull;
+  }
+  *biddyEACache.notusedyet = TRUE;
+}
 
-    e = BiddyManagedPermitsym(MNG,Fneg_v,0,n); /* lowest is not used */
-    if (n == 0) {
-      t = biddyZero;
-    } else {
-      t = BiddyManagedPermitsym(MNG,Fv,0,n-1); /* lowest is not used */
-    }
+/*******************************************************************************
+\brief Function BiddyRCGarbage performs Garbage Collection for the RC cache.
 
-    r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyRCGarbage(Biddy_Manager MNG)
+{
+  if (biddyRCCache.disabled) return;
+  if (*biddyRCCache.notusedyet) return;
 
+  /* IF THE CACHE TABLE IS RESIZED THEN IT IS ALSO CLEANED */
+  if (resizeOp3Cache(MNG,&biddyRCCache)) return;
+
+#ifdef LAZYCACHE
+  /* ENTRIES FROM THE PREVIOUS EPOCHS ARE IGNORED, THE TABLE IS NOT CHECKED */
+  if (!++biddyRCCache.epoch) {
+    memset(biddyRCCache.table,0,(biddyRCCache.size+1)*sizeof(BiddyOp3Cache));
+    biddyRCCache.epoch = 1;
   }
+#else
+  BiddyParallelFor(MNG,rcGarbage,NULL,biddyRCCache.size+1,biddyRCCache.size+1);
+#endif
+}
 
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
+/*******************************************************************************
+\brief Function BiddyRCGarbageNewVariable is used to clean the RC cache after
+        the adding new variable.
 
-    v = BiddyV(f);
-    tag = BiddyGetTag(f);
-    /* not needed */
-    /*
-    if (lowest == 0) {
-      assert( v == 0 );
-      return f;
-    }
-    */
-    if ((tag == lowest) && (v == 0)) {
-      return f;  /* refresh not needed because biddyV(f) is 0 */
-    }
+### Description
+    This function is needed for BDD types where adding new variable below
+    the existing one changes the meaning of the existing formulae.
+### Side effects
+### More info
+*******************************************************************************/
 
-    /* DETERMINING PARAMETERS FOR RECURSIVE CALLS - NOT ALWAYS NEEDED */
-    if (tag == lowest) {
-      Fneg_v = BiddyE(f);
-      Fv = BiddyT(f);
-    }
+void
+BiddyRCGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
 
-    if (tag == lowest) {
-      assert( v != 0 );
-      e = BiddyManagedPermitsym(MNG,Fneg_v,biddyVariableTable.table[v].next,n);
-      if (n == 0) {
-        t = biddyZero;
-      } else {
-        t = BiddyManagedPermitsym(MNG,Fv,biddyVariableTable.table[v].next,n-1);
-      }
-    } else {
-      v = lowest;
-      e = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[v].next,n);
-      if (n == 0) {
-        t = biddyZero;
-      } else {
-        t = BiddyManagedPermitsym(MNG,f,biddyVariableTable.table[v].next,n-1);
+  if (biddyRCCache.disabled) return;
+  if (*biddyRCCache.notusedyet) return;
+
+  for (j=0; j<=biddyRCCache.size; j++) {
+    if (BiddyCacheEntryValid(biddyRCCache,&biddyRCCache.table[j])) {
+      c = &biddyRCCache.table[j];
+      if ((!BiddyCacheIsNull(c->f) && BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyRCCache,c->f)->v,v)) ||
+          (!BiddyCacheIsNull(c->g) && BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyRCCache,c->g)->v,v)) ||
+          (!BiddyCacheIsNull(c->h) && BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyRCCache,c->h)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyCacheN(biddyRCCache,c->result)->v,v)))
+      {
+        c->result = BiddyCacheNull;
       }
     }
+  }
+}
 
-    /* result tag = (tag == lowest) keep the same or (else) change to v */
-    r = BiddyManagedTaggedFoaNode(MNG,v,e,t,lowest,TRUE);
-    BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+/*******************************************************************************
+\brief Function BiddyRCGarbageDeleteAll deletes all entries in the RC cache.
 
-  }
-#endif
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
-  return r;
+void
+BiddyRCGarbageDeleteAll(Biddy_Manager MNG)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
+
+  if (biddyRCCache.disabled) return;
+  if (*biddyRCCache.notusedyet) return;
+
+  for (j=0; j<=biddyRCCache.size; j++) {
+    c = &biddyRCCache.table[j];
+    c->result = BiddyCacheNull;
+  }
+  *biddyRCCache.notusedyet = TRUE;
 }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedStretch.
+/*******************************************************************************
+\brief Function BiddyReplaceGarbage performs Garbage Collection for the Replace
+        cache.
 
 ### Description
 ### Side effects
 ### More info
-    See Biddy_Managed_Stretch.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedStretch(Biddy_Manager MNG, Biddy_Edge support, Biddy_Edge f)
+void
+BiddyReplaceGarbage(Biddy_Manager MNG)
 {
-  Biddy_Edge e, t, Fv, Fneg_v;
-  Biddy_Variable v;
-  Biddy_Edge r;
-  Biddy_Edge FF, GG, HH;
-  unsigned int cindex;
+  if (biddyReplaceCache.disabled) return;
+  if (*biddyReplaceCache.notusedyet) return;
 
-#ifndef COMPACT
-  Biddy_Variable tag;
+  /* IF THE CACHE TABLE IS RESIZED THEN IT IS ALSO CLEANED */
+  if (resizeKeywordCache(MNG,&biddyReplaceCache)) return;
+
+#ifdef LAZYCACHE
+  /* ENTRIES FROM THE PREVIOUS EPOCHS ARE IGNORED, THE TABLE IS NOT CHECKED */
+  if (!++biddyReplaceCache.epoch) {
+    memset(biddyReplaceCache.table,0,(biddyReplaceCache.size+1)*sizeof(BiddyKeywordCache));
+    biddyReplaceCache.epoch = 1;
+  }
+#else
+  BiddyParallelFor(MNG,replaceGarbage,NULL,biddyReplaceCache.size+1,biddyReplaceCache.size+1);
 #endif
+}
 
-  assert( MNG != NULL );
-  assert( f != NULL );
+/*******************************************************************************
+\brief Function BiddyReplaceGarbageNewVariable is used to clean the Replace
+        cache after the adding new variable.
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+### Description
+    This function is needed for BDD types where adding new variable below
+    the existing one changes the meaning of the existing formulae.
+### Side effects
+### More info
+*******************************************************************************/
 
-#ifndef COMPACT
-  tag = 0;
-#endif
+void
+BiddyReplaceGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+{
+  unsigned int j;
+  BiddyKeywordCache *c;
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    if (f == biddyZero) return biddyZero;
-    if (f == biddyOne) {
-      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
-      return support;
-    }
-    if (f == support) {
-      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
-      return support;
-    }
-  }
+  if (biddyReplaceCache.disabled) return;
+  if (*biddyReplaceCache.notusedyet) return;
 
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    if (BiddyIsTerminal(f)) return f;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    if (f == biddyZero) return biddyZero;
-    if (f == biddyOne) {
-      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
-      return support;
-    }
-    if (f == support) {
-      BiddyRefresh(support); /* return non-obsolete node even if the parameter is an obsolete node */
-      return support;
-    }
-    if (((tag = BiddyGetTag(f)) == BiddyV(support)) && (BiddyIsTerminal(f))) {
-      BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
-      return f;
+  for (j=0; j<=biddyReplaceCache.size; j++) {
+    if (BiddyCacheEntryValid(biddyReplaceCache,&biddyReplaceCache.table[j])) {
+      c = &biddyReplaceCache.table[j];
+      if ((BiddyIsSmaller(biddyOrderingTable,BiddyN(c->f)->v,v)) ||
+          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->result)->v,v)))
+      {
+        c->result = biddyNull;
+      }
     }
   }
-#endif
+}
 
-  r = biddyNull;
+/*******************************************************************************
+\brief Function BiddyReplaceGarbageDeleteAll deletes all entries in the Replace
+        cache.
 
-  FF = f;
-  GG = biddyNull;
-  HH = biddyOne;
+### Description
+### Side effects
+### More info
+*******************************************************************************/
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    GG = support;
-  }
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
-    HH = biddyNull;
-  }
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-    GG = support;
+void
+BiddyReplaceGarbageDeleteAll(Biddy_Manager MNG)
+{
+  unsigned int j;
+  BiddyKeywordCache *c;
+
+  if (biddyReplaceCache.disabled) return;
+  if (*biddyReplaceCache.notusedyet) return;
+
+  for (j=0; j<=biddyReplaceCache.size; j++) {
+    c = &biddyReplaceCache.table[j];
+    c->result = biddyNull;
   }
+  *biddyReplaceCache.notusedyet = TRUE;
+}
 
-  /* IF RESULT IS NOT IN THE CACHE TABLE... */
-  cindex = 0;
-  if (TRUE || !findOp3Cache(biddyRCCache,FF,GG,HH,&r,&cindex))
-  {
+/*----------------------------------------------------------------------------*/
+/* Definition of static functions                                             */
+/*----------------------------------------------------------------------------*/
 
-    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+#ifndef LAZYCACHE
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+/*******************************************************************************
+\brief Function opGarbage checks the given part of the OP cache.
 
-      if ((v = BiddyV(f)) != BiddyV(support)) {
-        v = BiddyV(support);
-        e = biddyZero;
-        t = BiddyManagedStretch(MNG,BiddyT(support),f);
-      } else {
-        Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-        Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
-        if (Fneg_v == biddyZero) {
-          e = biddyZero;
-          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
-        } else {
-          e = BiddyManagedStretch(MNG,BiddyT(support),Fneg_v);
-          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
-          e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
-        }
-      }
+### Description
+    Used in BiddyOPGarbage via BiddyParallelFor.
+### Side effects
+### More info
+*******************************************************************************/
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+static void
+opGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+          unsigned int hi)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
 
+  (void)(data); // to avoid the unused warning
+  (void)(t); // to avoid the unused warning
+
+  for (j=lo; j<hi; j++) {
+    if (!BiddyCacheIsNull(biddyOPCache.table[j].result)) {
+      c = &biddyOPCache.table[j];
+      /* VARIANT A */
+      /*
+      if (((BiddyCacheN(biddyOPCache,c->f)->expiry) && ((BiddyCacheN(biddyOPCache,c->f)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->g)->expiry) && ((BiddyCacheN(biddyOPCache,c->g)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->h)->expiry) && ((BiddyCacheN(biddyOPCache,c->h)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->result)->expiry) && ((BiddyCacheN(biddyOPCache,c->result)->expiry) < biddySystemAge)))
+      */
+      /* VARIANT B */
+      /*
+      if (((BiddyCacheN(biddyOPCache,c->result)->expiry) && ((BiddyCacheN(biddyOPCache,c->result)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->f)->expiry) && ((BiddyCacheN(biddyOPCache,c->f)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->g)->expiry) && ((BiddyCacheN(biddyOPCache,c->g)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->h)->expiry) && ((BiddyCacheN(biddyOPCache,c->h)->expiry) < biddySystemAge)))
+      */
+      /* VARIANT C */
+      /**/
+      if (((BiddyCacheN(biddyOPCache,c->f)->expiry) && ((BiddyCacheN(biddyOPCache,c->f)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->result)->expiry) && ((BiddyCacheN(biddyOPCache,c->result)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->g)->expiry) && ((BiddyCacheN(biddyOPCache,c->g)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyOPCache,c->h)->expiry) && ((BiddyCacheN(biddyOPCache,c->h)->expiry) < biddySystemAge)))
+      /**/
+      {
+        c->result = BiddyCacheNull;
+      }
     }
+  }
+}
 
-#ifndef COMPACT
-    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+/*******************************************************************************
+\brief Function eaGarbage checks the given part of the EA cache.
 
-      /* argument support is not used for ZBDD and ZBDDC */
-      /* TO DO: by introducing support, the efficency may be improve due to additional simple case */
+### Description
+    Used in BiddyEAGarbage via BiddyParallelFor.
+### Side effects
+### More info
+*******************************************************************************/
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
-      v = BiddyV(f);
-      Fneg_v = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      Fv = BiddyT(f);
+static void
+eaGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+          unsigned int hi)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
 
-      if (BiddyIsTerminal(Fneg_v) || (Fneg_v == Fv)) {
-        e = biddyZero;
-        t = BiddyManagedStretch(MNG,support,Fv);
-      } else {
-        e = BiddyManagedStretch(MNG,support,Fneg_v);
-        t = BiddyManagedStretch(MNG,support,Fv);
-        e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
+  (void)(data); // to avoid the unused warning
+  (void)(t); // to avoid the unused warning
+
+  for (j=lo; j<hi; j++) {
+    if (!BiddyCacheIsNull(biddyEACache.table[j].result)) {
+      c = &biddyEACache.table[j];
+      if (((BiddyCacheN(biddyEACache,c->f)->expiry) && ((BiddyCacheN(biddyEACache,c->f)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyEACache,c->g)->expiry) && ((BiddyCacheN(biddyEACache,c->g)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyEACache,c->h)->expiry) && ((BiddyCacheN(biddyEACache,c->h)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyEACache,c->result)->expiry) && ((BiddyCacheN(biddyEACache,c->result)->expiry) < biddySystemAge)))
+      {
+        c->result = BiddyCacheNull;
       }
+    }
+  }
+}
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+/*******************************************************************************
+\brief Function rcGarbage checks the given part of the RC cache.
 
-    }
+### Description
+    Used in BiddyRCGarbage via BiddyParallelFor.
+### Side effects
+### More info
+*******************************************************************************/
 
-    else if (biddyManagerType == BIDDYTYPETZBDD) {
+static void
+rcGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+          unsigned int hi)
+{
+  unsigned int j;
+  BiddyOp3Cache *c;
 
-      /* DETERMINING PARAMETERS FOR RECURSIVE CALLS */
-      /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+  (void)(data); // to avoid the unused warning
+  (void)(t); // to avoid the unused warning
 
-      if (tag != BiddyV(support)) {
-        tag = v = BiddyV(support);
-        e = biddyZero;
-        t = BiddyManagedStretch(MNG,BiddyT(support),f);
-      } else {
-        v = BiddyV(f);
-        Fneg_v = BiddyE(f);
-        Fv = BiddyT(f);
-        while (BiddyV(support) != v) support = BiddyT(support);
-        if ((Fneg_v == biddyZero) || (Fneg_v == Fv)) {
-          e = biddyZero;
-          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
-        } else {
-          e = BiddyManagedStretch(MNG,BiddyT(support),Fneg_v);
-          t = BiddyManagedStretch(MNG,BiddyT(support),Fv);
-          e = BiddyManagedDiff(MNG,e,BiddyManagedSubset(MNG,e,t));
-        }
+  for (j=lo; j<hi; j++) {
+    if (!BiddyCacheIsNull(biddyRCCache.table[j].result)) {
+      c = &biddyRCCache.table[j];
+      if ((!BiddyCacheIsNull(c->f) && (BiddyCacheN(biddyRCCache,c->f)->expiry) && ((BiddyCacheN(biddyRCCache,c->f)->expiry) < biddySystemAge)) ||
+          (!BiddyCacheIsNull(c->g) && (BiddyCacheN(biddyRCCache,c->g)->expiry) && ((BiddyCacheN(biddyRCCache,c->g)->expiry) < biddySystemAge)) ||
+          (!BiddyCacheIsNull(c->h) && (BiddyCacheN(biddyRCCache,c->h)->expiry) && ((BiddyCacheN(biddyRCCache,c->h)->expiry) < biddySystemAge)) ||
+          ((BiddyCacheN(biddyRCCache,c->result)->expiry) && ((BiddyCacheN(biddyRCCache,c->result)->expiry) < biddySystemAge)))
+      {
+        c->result = BiddyCacheNull;
       }
+    }
+  }
+}
 
-      r = BiddyManagedTaggedFoaNode(MNG,v,e,t,tag,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      addOp3Cache(biddyRCCache,FF,GG,HH,r,cindex);
+/*******************************************************************************
+\brief Function replaceGarbage checks the given part of the Replace cache.
 
-    }
-#endif
+### Description
+    Used in BiddyReplaceGarbage via BiddyParallelFor.
+### Side effects
+### More info
+*******************************************************************************/
 
-  } else {
+static void
+replaceGarbage(Biddy_Manager MNG, void *data, unsigned int t, unsigned int lo,
+               unsigned int hi)
+{
+  unsigned int j;
+  BiddyKeywordCache *c;
 
-    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
-    BiddyRefresh(r);
+  (void)(data); // to avoid the unused warning
+  (void)(t); // to avoid the unused warning
 
+  for (j=lo; j<hi; j++) {
+    if (!BiddyIsNull(biddyReplaceCache.table[j].result)) {
+      c = &biddyReplaceCache.table[j];
+      if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
+          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
+      {
+        c->result = biddyNull;
+      }
+    }
   }
-
-  return r;
 }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedCreateMinterm.
+#endif
+
+#ifdef PARALLELAPPLY
+
+/*******************************************************************************
+\brief Functions applyAnd, applyOr, and applyXor are recursive calls which
+       may be performed by another thread.
 
 ### Description
+    Used in BiddyManagedAnd, BiddyManagedOr, and BiddyManagedXor via
+    BiddyParallelApply. Argument h is not used.
 ### Side effects
 ### More info
-    See Biddy_Managed_CreateMinterm.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedCreateMinterm(Biddy_Manager MNG, Biddy_Edge support,
-                          long long unsigned int x)
+static Biddy_Edge
+applyAnd(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
 {
-  long long unsigned int n;
-  Biddy_Edge tmp;
+  (void)(h); // to avoid the unused warning
 
-  assert( MNG != NULL );
-  assert( support != NULL );
+  return BiddyManagedAnd(MNG,f,g);
+}
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+static Biddy_Edge
+applyOr(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
+{
+  (void)(h); // to avoid the unused warning
 
-  n = 1;
-  tmp = support;
-  while (!BiddyIsTerminal(tmp)) {
+  return BiddyManagedOr(MNG,f,g);
+}
 
-    if (!(n<(2*n))) {
-      /* support has to many variables */
-      return biddyNull;
-    }
+static Biddy_Edge
+applyXor(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge h)
+{
+  (void)(h); // to avoid the unused warning
 
-    n = 2 * n;
-    tmp = BiddyT(tmp);
+  return BiddyManagedXor(MNG,f,g);
+}
+
+#endif
+
+/*******************************************************************************
+\brief Function pushApplyFrame puts a new frame on the explicit stack used by
+       iterative apply.
+
+### Description
+    The stack is enlarged if needed, thus pointers to existing frames
+    are not valid after this call.
+### Side effects
+### More info
+*******************************************************************************/
+
+static inline BiddyApplyFrame *
+pushApplyFrame(Biddy_Manager MNG, unsigned char op, Biddy_Edge f,
+               Biddy_Edge g, Biddy_Edge h)
+{
+  BiddyApplyFrame *fr;
+  unsigned int size;
+
+  if (biddyNodeTable.applystacktop == biddyNodeTable.applystacksize) {
+    size = biddyNodeTable.applystacksize ?
+           2 * biddyNodeTable.applystacksize : BIDDYAPPLYFRAMES;
+    if (!(fr = (BiddyApplyFrame *)
+          realloc(biddyNodeTable.applystack,size*sizeof(BiddyApplyFrame))))
+    {
+      fprintf(stderr,"pushApplyFrame: Out of memoy!\n");
+      exit(1);
+    }
+    biddyNodeTable.applystack = fr;
+    biddyNodeTable.applystacksize = size;
   }
 
-  return createMinterm(MNG,support,n,x);
+  fr = &biddyNodeTable.applystack[biddyNodeTable.applystacktop++];
+  fr->f = f;
+  fr->g = g;
+  fr->h = h;
+  fr->op = op;
+  fr->state = APPLYSTART;
+  fr->inv = FALSE;
+
+  return fr;
 }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedCreateFunction.
+/*******************************************************************************
+\brief Function applySimpleCase resolves simple cases in iterative apply.
 
 ### Description
+    Simple cases are the same as in the recursive implementation. If the
+    recursive implementation calls another operation, the operation and
+    the arguments in the given frame are changed instead. Returns biddyNull
+    if the frame must be calculated.
 ### Side effects
+    If Gt, Leq, or ExistAbstract must be called (OBDD only), the stack may be
+    reallocated and the given frame pointer is not valid anymore.
 ### More info
-    See Biddy_Managed_CreateFunction.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedCreateFunction(Biddy_Manager MNG, Biddy_Edge support,
-                           long long unsigned int x)
+static Biddy_Edge
+applySimpleCase(Biddy_Manager MNG, BiddyApplyFrame *fr)
 {
-  long long unsigned int n,m,q;
-  Biddy_Edge tmp;
+  Biddy_Edge f,g,h;
 
-  assert( MNG != NULL );
-  assert( support != NULL );
+  while (TRUE) {
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+    f = fr->f;
+    g = fr->g;
+    h = fr->h;
 
-  n = 1;
-  tmp = support;
-  while (!BiddyIsTerminal(tmp)) {
+    if (fr->op == APPLYAND) {
+      if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
+      if ((f == biddyZero) || (g == biddyZero)) {
+        return biddyZero;
+      } else if (f == biddyOne) {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else if ((g == biddyOne) || (f == g)) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else if ((biddyManagerType == BIDDYTYPEOBDDC) && BiddyIsEqvPointer(f,g)) {
+        return biddyZero;
+      }
+      return biddyNull;
+    }
 
-    if (!(n<(2*n))) {
-      /* support has to many variables */
+    else if (fr->op == APPLYOR) {
+      if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
+      if (f == biddyZero) {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else if (g == biddyZero) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else if ((f == biddyOne) || (g == biddyOne)) {
+        return biddyOne;
+      } else if (f == g) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else if ((biddyManagerType == BIDDYTYPEOBDDC) && BiddyIsEqvPointer(f,g)) {
+        return biddyOne;
+      }
+      return biddyNull;
+    }
+
+    else if (fr->op == APPLYXOR) {
+      if (biddyNodeTable.extendedstats) biddyNodeTable.xorrecursive++;
+      if (f == biddyZero) {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else if (g == biddyZero) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return f;
+      } else if (f == biddyOne) {
+        fr->op = APPLYNOT;
+        fr->f = g;
+        continue;
+      } else if (g == biddyOne) {
+        fr->op = APPLYNOT;
+        continue;
+      } else if (f == g) {
+        return biddyZero;
+      } else if ((biddyManagerType == BIDDYTYPEOBDDC) && BiddyIsEqvPointer(f,g)) {
+        return biddyOne;
+      }
       return biddyNull;
     }
 
-    n = 2 * n;
-    tmp = BiddyT(tmp);
-  }
+    else if (fr->op == APPLYNOT) {
+      if (f == biddyZero) {
+        return biddyOne;
+      } else if (f == biddyOne) {
+        return biddyZero;
+      } else if (biddyManagerType == BIDDYTYPEOBDDC) {
+        BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+        return BiddyInv(f);
+      }
+      return biddyNull;
+    }
 
-  m = 1;
-  q = n;
-  while (q>0) {
+    else if (fr->op == APPLYITE) {
+      if (biddyNodeTable.extendedstats) biddyNodeTable.iterecursive++;
+      if (f == biddyOne) {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else if (f == biddyZero) {
+        BiddyRefresh(h); /* return non-obsolete node even if the parameter is an obsolete node */
+        return h;
+      } else if (g == biddyOne) {
+        if (h == biddyOne) {
+          return biddyOne;
+        } else if (h == biddyZero) {
+          BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+          return f;
+        }
+        fr->op = APPLYOR;
+        fr->g = h;
+        continue;
+      } else if (g == biddyZero) {
+        if (h == biddyOne) {
+          fr->op = APPLYNOT;
+          continue;
+        } else if (h == biddyZero) {
+          return biddyZero;
+        }
+        /* Gt(h,f), FOR OBDDC IT IS CALCULATED AS And(h,Not(f)) */
+        if (biddyManagerType == BIDDYTYPEOBDDC) {
+          fr->op = APPLYAND;
+          fr->f = h;
+          fr->g = BiddyInv(f);
+          continue;
+        }
+        return BiddyManagedGt(MNG,h,f);
+      } else if (h == biddyOne) {
+        /* Leq(f,g), FOR OBDDC IT IS CALCULATED AS Not(And(f,Not(g))) */
+        if (biddyManagerType == BIDDYTYPEOBDDC) {
+          fr->op = APPLYAND;
+          fr->g = BiddyInv(g);
+          fr->inv = !fr->inv;
+          continue;
+        }
+        return BiddyManagedLeq(MNG,f,g);
+      } else if ((h == biddyZero) || (f == h)) {
+        fr->op = APPLYAND;
+        continue;
+      } else if (g == h) {
+        BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+        return g;
+      } else if (f == g) {
+        fr->op = APPLYOR;
+        fr->g = h;
+        continue;
+      }
+      if (biddyManagerType == BIDDYTYPEOBDDC) {
+        if (BiddyIsEqvPointer(g,h)) {
+          fr->op = APPLYXOR;
+          fr->g = h;
+          continue;
+        } else if (BiddyIsEqvPointer(f,g)) {
+          fr->op = APPLYAND;
+          fr->f = g;
+          fr->g = h;
+          continue;
+        } else if (BiddyIsEqvPointer(f,h)) {
+          fr->op = APPLYOR;
+          fr->f = g;
+          fr->g = h;
+          continue;
+        }
+      }
+      return biddyNull;
+    }
 
-    if (!(m<(2*m))) {
-      /* support has to many variables */
+    else if (fr->op == APPLYEXISTAND) {
+      if ((f == biddyZero) || (g == biddyZero)) {
+        return biddyZero;
+      } else if (BiddyIsTerminal(h)) {
+        fr->op = APPLYAND;
+        continue;
+      } else if (f == biddyOne) {
+        return BiddyManagedExistAbstract(MNG,g,h);
+      } else if ((g == biddyOne) || (f == g)) {
+        return BiddyManagedExistAbstract(MNG,f,h);
+      } else if ((biddyManagerType == BIDDYTYPEOBDDC) && BiddyIsEqvPointer(f,g)) {
+        return biddyZero;
+      }
       return biddyNull;
     }
 
-    m = 2 * m;
-    q--;
+    return biddyNull;
   }
-
-  return createFunction(MNG,support,n,m,x);
 }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedRandomFunction.
+/*******************************************************************************
+\brief Function applyIterative calculates And, Or, Xor, ITE, Not, or
+       ExistAndAbstract on OBDDs and OBDDCs without recursion.
 
 ### Description
+    Each frame on the explicit stack corresponds to one call of the
+    recursive implementation. A frame is processed in the same steps:
+    simple cases, normalization and cache lookup, the else successor,
+    the then successor, and finally FoaNode and cache insertion. The same
+    keys are used for OP and EA cache, thus results are shared with the
+    recursive implementation. Used if iterative apply is enabled, see
+    Biddy_SetIterativeApply.
 ### Side effects
+    The stack is shared by nested calls, each call uses the frames above
+    the ones used by its caller.
 ### More info
-    See Biddy_Managed_RandomFunction.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedRandomFunction(Biddy_Manager MNG, Biddy_Edge support, double ratio)
+static Biddy_Edge
+applyIterative(Biddy_Manager MNG, unsigned char op, Biddy_Edge f,
+               Biddy_Edge g, Biddy_Edge h)
 {
-  long long unsigned int n,m,x;
-  Biddy_Edge tmp,result;
-  Biddy_Boolean opposite;
+  BiddyApplyFrame *fr;
+  Biddy_Edge r, f0, g0, h0, cube;
+  Biddy_Variable topF, topG, topH, v, cv;
+  unsigned int base;
 
   assert( MNG != NULL );
-  assert( support != NULL );
-
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
   assert(
     (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
+    (biddyManagerType == BIDDYTYPEOBDDC)
   );
 
-  if ((ratio < 0.0) || (ratio > 1.0)) {
-    return biddyNull;
-  }
-
-  n = 1;
-  tmp = support;
-  while (!BiddyIsTerminal(tmp)) {
+  base = biddyNodeTable.applystacktop;
+  pushApplyFrame(MNG,op,f,g,h);
+  r = biddyNull;
 
-    if (!(n<(2*n))) {
-      /* support has to many variables */
-      return biddyNull;
-    }
+  while (TRUE) {
 
-    n = 2 * n;
-    tmp = BiddyT(tmp);
-  }
+    /* THE STACK MAY BE REALLOCATED, THUS THE POINTER IS OBTAINED EACH TIME */
+    fr = &biddyNodeTable.applystack[biddyNodeTable.applystacktop-1];
 
-  opposite = FALSE;
-  if (ratio > 0.5) {
-    ratio = 1.0 - ratio;
-    opposite = TRUE;
-  }
+    if (fr->state == APPLYSTART) {
 
-  m = (long long unsigned int) (0.5 + n * ratio);
+      /* A NEW FRAME, LOOKING FOR SIMPLE CASE */
+      r = applySimpleCase(MNG,fr);
+      fr = &biddyNodeTable.applystack[biddyNodeTable.applystacktop-1];
 
-  if (m == 0) {
-    if (opposite) {
-      return biddyOne;
-    } else {
-      return biddyZero;
-    }
-  }
+      if (r == biddyNull) {
 
-  result = biddyZero;
-  while (m != 0) {
+        f = fr->f;
+        g = fr->g;
+        h = fr->h;
+        fr->NN = FALSE;
 
-    /* DEBUGGING */
-    /*
-    printf("RANDOM: m=%llu\n",m);
-    */
+        /* NORMALIZATION OF COMPLEMENTED EDGES */
+        /* THE SAME AS IN THE RECURSIVE IMPLEMENTATION */
 
-    /* GENERATE RANDOM NUMBER */
-    x = rand();
+        if (fr->op == APPLYAND) {
+          if (((uintptr_t) f) < ((uintptr_t) g)) exchangeEdges(&f,&g);
+          if (biddyManagerType == BIDDYTYPEOBDDC) {
+            if (BiddyGetMark(f)) {
+              fr->NN = TRUE;
+              fr->FF = BiddyInv(f);
+              fr->GG = biddyOne;
+              fr->HH = BiddyInv(g);
+            } else if (BiddyGetMark(g)) {
+              fr->NN = TRUE;
+              fr->FF = f;
+              fr->GG = BiddyInv(g);
+              fr->HH = biddyOne;
+            } else {
+              fr->FF = f;
+              fr->GG = g;
+              fr->HH = biddyZero;
+            }
+          } else {
+            fr->FF = f;
+            fr->GG = g;
+            fr->HH = biddyZero;
+          }
+        }
 
-    /* DEBUGGING */
-    /*
-    printf("RANDOM NUMBER: x=%llu, n=%llu, RAND_MAX=%llu\n",x,n,RAND_MAX);
-    */
+        else if (fr->op == APPLYOR) {
+          if (((uintptr_t) f) < ((uintptr_t) g)) exchangeEdges(&f,&g);
+          if (biddyManagerType == BIDDYTYPEOBDDC) {
+            if (BiddyGetMark(f)) {
+              if (BiddyGetMark(g)) {
+                fr->NN = TRUE;
+                fr->FF = BiddyInv(f);
+                fr->GG = BiddyInv(g);
+                fr->HH = biddyZero;
+              } else {
+                fr->FF = BiddyInv(f);
+                fr->GG = g;
+                fr->HH = biddyOne;
+              }
+            } else {
+              fr->FF = f;
+              fr->GG = biddyOne;
+              fr->HH = g;
+            }
+          } else {
+            fr->FF = biddyZero;
+            fr->GG = f;
+            fr->HH = g;
+          }
+        }
 
-    x = (n*x)/RAND_MAX;
+        else if (fr->op == APPLYXOR) {
+          if (((uintptr_t) f) < ((uintptr_t) g)) exchangeEdges(&f,&g);
+          if (biddyManagerType == BIDDYTYPEOBDDC) {
+            fr->NN = (BiddyGetMark(f) != BiddyGetMark(g));
+            fr->FF = BiddyRegular(f);
+            fr->GG = BiddyRegular(g);
+            fr->HH = BiddyInv(fr->GG);
+          } else {
+            fr->FF = f;
+            fr->GG = biddyZero;
+            fr->HH = g;
+          }
+        }
 
-    /* DEBUGGING */
-    /*
-    printf("RANDOM NUMBER = %llu\n",x);
-    */
+        else if (fr->op == APPLYITE) {
+          if (biddyManagerType == BIDDYTYPEOBDDC) {
+            if (BiddyGetMark(f)) {
+              fr->NN = BiddyGetMark(h);
+              fr->FF = BiddyInv(f);
+              fr->GG = BiddyInvCond(h,fr->NN);
+              fr->HH = BiddyInvCond(g,fr->NN);
+            } else {
+              fr->NN = BiddyGetMark(g);
+              fr->FF = f;
+              fr->GG = BiddyInvCond(g,fr->NN);
+              fr->HH = BiddyInvCond(h,fr->NN);
+            }
+          } else {
+            fr->FF = f;
+            fr->GG = g;
+            fr->HH = h;
+          }
+        }
 
-    tmp = createMinterm(MNG,support,n,x);
-    tmp = BiddyManagedOr(MNG,result,tmp);
-    if (tmp != result) {
-      result = tmp;
-      m--;
-    }
+        else if (fr->op == APPLYNOT) {
+          /* FOR OBDDC, NOT IS A SIMPLE CASE */
+          fr->FF = f;
+          fr->GG = biddyZero;
+          fr->HH = biddyOne;
+        }
 
-  }
+        else if (fr->op == APPLYEXISTAND) {
+          if (((uintptr_t) f) > ((uintptr_t) g)) exchangeEdges(&f,&g);
+          fr->FF = f;
+          fr->GG = g;
+          fr->HH = h;
+        }
 
-  if (opposite) {
-    result = BiddyManagedNot(MNG,result);
-  }
+        /* IF RESULT IS NOT IN THE CACHE TABLE... */
+        fr->cindex = 0;
+        if (!findOp3Cache((fr->op == APPLYEXISTAND) ? biddyEACache : biddyOPCache,
+                          fr->FF,fr->GG,fr->HH,&r,&fr->cindex))
+        {
+
+          /* DETERMINING PARAMETERS FOR THE ELSE AND THE THEN SUCCESSOR */
+          /* COMPLEMENTED EDGES MUST BE TRANSFERED */
+          /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+
+          if (fr->op == APPLYNOT) {
+            v = BiddyV(f);
+            f0 = BiddyE(f);
+            fr->Fv = BiddyT(f);
+            g0 = h0 = fr->Gv = fr->Hv = biddyNull;
+          }
 
-  return result;
-}
+          else {
+            topF = BiddyV(f);
+            topG = BiddyV(g);
+            topH = 0; /* to avoid the uninitialized warning */
+            v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+            if (fr->op == APPLYITE) {
+              topH = BiddyV(h);
+              if (BiddyIsSmaller(biddyOrderingTable,topH,v)) v = topH;
+            }
+            if (topF == v) {
+              f0 = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
+              fr->Fv = BiddyInvCond(BiddyT(f),BiddyGetMark(f));
+            } else {
+              f0 = fr->Fv = f;
+            }
+            if (topG == v) {
+              g0 = BiddyInvCond(BiddyE(g),BiddyGetMark(g));
+              fr->Gv = BiddyInvCond(BiddyT(g),BiddyGetMark(g));
+            } else {
+              g0 = fr->Gv = g;
+            }
+            if (fr->op == APPLYITE) {
+              if (topH == v) {
+                h0 = BiddyInvCond(BiddyE(h),BiddyGetMark(h));
+                fr->Hv = BiddyInvCond(BiddyT(h),BiddyGetMark(h));
+              } else {
+                h0 = fr->Hv = h;
+              }
+            } else {
+              h0 = fr->Hv = h;
+            }
+          }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedRandomSet.
+          fr->v = v;
+          fr->state = APPLYELSE;
 
-### Description
-### Side effects
-### More info
-    See Biddy_Managed_RandomSet.
-*******************************************************************************/
+          if (fr->op == APPLYEXISTAND) {
+            cube = h;
+            cv = BiddyV(cube);
+            while (BiddyIsSmaller(biddyOrderingTable,cv,v)) {
+              cube = BiddyT(cube);
+              cv = BiddyV(cube);
+            }
+            if (v == cv) {
+              /* THE VARIABLE IS QUANTIFIED, SEE BiddyManagedExistAndAbstract */
+              cube = BiddyT(cube);
+              fr->state = APPLYQELSE;
+            }
+            h0 = fr->Hv = cube;
+          }
 
-Biddy_Edge
-BiddyManagedRandomSet(Biddy_Manager MNG, Biddy_Edge unit, double ratio)
-{
-  long long unsigned int n,m,x,z;
-  Biddy_Edge p,q,tmp,result;
-  Biddy_Boolean opposite;
-  Biddy_Variable one;
+          pushApplyFrame(MNG,fr->op,f0,g0,h0);
+          continue;
 
-  assert( MNG != NULL );
-  assert( unit != NULL );
+        }
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+        if (fr->NN) {
+          BiddyInvertMark(r);
+        }
 
-  if ((ratio < 0.0) || (ratio > 1.0)) {
-    return biddyNull;
-  }
+        /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+        BiddyRefresh(r);
 
-  n = 1;
-  p = unit;
-  while (!BiddyIsTerminal(p)) {
+      }
 
-    if (!(n<(2*n))) {
-      /* unit has to many variables */
-      return biddyNull;
     }
 
-    n = 2 * n;
-    p = BiddyT(p);
-  }
-
-  opposite = FALSE;
-  if (ratio > 0.5) {
-    ratio = 1.0 - ratio;
-    opposite = TRUE;
-  }
+    else if (fr->state == APPLYELSE) {
 
-  m = (long long unsigned int) (0.5 + n * ratio);
+      /* r IS THE RESULT FOR THE ELSE SUCCESSOR */
+      fr->E = r;
+      fr->state = APPLYTHEN;
+      pushApplyFrame(MNG,fr->op,fr->Fv,fr->Gv,fr->Hv);
+      continue;
 
-  if (m == 0) {
-    if (opposite) {
-      return biddyOne;
-    } else {
-      return biddyZero;
     }
-  }
-
-  /* DEBUGGING */
-  /*
-  printf("BASE SET:\n");
-  BiddyManagedPrintfSOP(MNG,BiddyManagedGetBaseSet(MNG));
-  BiddyManagedPrintfBDD(MNG,BiddyManagedGetBaseSet(MNG));
-  printf("BASE SET - CHANGED FIRST VARIABLE:\n");
-  BiddyManagedPrintfSOP(MNG,BiddyManagedChange(MNG,BiddyManagedGetBaseSet(MNG),1));
-  BiddyManagedPrintfBDD(MNG,BiddyManagedChange(MNG,BiddyManagedGetBaseSet(MNG),1));
-  */
-
-  result = biddyZero;
-  while (m != 0) {
 
-    /* GENERATE RANDOM NUMBER */
-    x = rand();
-    x = (n*x)/RAND_MAX;
+    else if (fr->state == APPLYTHEN) {
 
-    /* DEBUGGING */
-    /*
-    printf("RANDOM SET: m=%llu\n",m);
-    printf("RANDOM SET: x = %llu\n",x);
-    */
+      /* r IS THE RESULT FOR THE THEN SUCCESSOR */
+      r = BiddyManagedTaggedFoaNode(MNG,fr->v,fr->E,r,fr->v,TRUE);
+      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
 
-    p = unit;
-    z = n;
-    q = BiddyManagedGetBaseSet(MNG);
-    while (z != 1) {
-      one = BiddyV(p);
-      p = BiddyT(p);
-      if (x <= ((z - 0.5) / 2)) {
-        z = (long long unsigned int) (z + 0.5) / 2;
+      if (fr->op == APPLYEXISTAND) {
+        addOp3Cache(biddyEACache,fr->FF,fr->GG,fr->HH,r,fr->cindex);
+      } else if (fr->NN) {
+        addOp3Cache(biddyOPCache,fr->FF,fr->GG,fr->HH,BiddyInv(r),fr->cindex);
       } else {
-        z = (long long unsigned int) (z + 0.5) / 2;
-        x = x - z;
-        q = BiddyManagedChange(MNG,q,one);
+        addOp3Cache(biddyOPCache,fr->FF,fr->GG,fr->HH,r,fr->cindex);
       }
+
     }
 
-    tmp = BiddyManagedUnion(MNG,result,q);
-    if (tmp != result) {
-      result = tmp;
-      m--;
+    else if (fr->state == APPLYQELSE) {
+
+      /* r IS THE RESULT FOR THE ELSE SUCCESSOR OF QUANTIFIED VARIABLE */
+      /* IF IT IS biddyOne, f1, OR g1 THEN IT IS NOT CACHED */
+      if ((r != biddyOne) && (r != fr->Fv) && (r != fr->Gv)) {
+        if (r == BiddyInv(fr->Fv)) fr->Fv = biddyOne;
+        if (r == BiddyInv(fr->Gv)) fr->Gv = biddyOne;
+        fr->E = r;
+        fr->state = APPLYQTHEN;
+        pushApplyFrame(MNG,APPLYEXISTAND,fr->Fv,fr->Gv,fr->Hv);
+        continue;
+      }
+
     }
 
-    /* DEBUGGING */
-    /*
-    printf("q:\n");
-    BiddyManagedPrintfSOP(MNG,q);
-    BiddyManagedPrintfBDD(MNG,q);
-    printf("result:\n");
-    BiddyManagedPrintfSOP(MNG,result);
-    BiddyManagedPrintfBDD(MNG,result);
-    */
+    else if (fr->state == APPLYQTHEN) {
+
+      /* r IS THE RESULT FOR THE THEN SUCCESSOR OF QUANTIFIED VARIABLE */
+      fr->state = APPLYQOR;
+      pushApplyFrame(MNG,APPLYOR,fr->E,r,biddyNull);
+      continue;
+
+    }
 
-  }
+    else {
+
+      /* r IS THE RESULT OF Or FOR QUANTIFIED VARIABLE */
+      addOp3Cache(biddyEACache,fr->FF,fr->GG,fr->HH,r,fr->cindex);
+
+    }
+
+    /* r IS THE RESULT FOR THE FRAME ON THE TOP OF THE STACK */
+    if (fr->inv) r = BiddyInv(r);
+    if (--biddyNodeTable.applystacktop == base) break;
 
-  if (opposite) {
-    result = BiddyManagedNot(MNG,result);
   }
 
-  return result;
+  return r;
 }
 
-/***************************************************************************//*!
-\brief Function BiddyManagedExtractMinterm.
+/*******************************************************************************
+\brief Function applyN calculates And or Or of n functions.
 
 ### Description
+    The order of pairwise operations is given by the schedule:
+    BIDDYSCHEDULELINEAR folds the operands in the given order,
+    BIDDYSCHEDULETREE combines neighbours in rounds (balanced tree),
+    BIDDYSCHEDULESMALLEST always combines the two smallest operands, and
+    BIDDYSCHEDULESUPPORT combines the smallest operand with the operand
+    that shares the most variables with it (ties are broken by size).
+    Operands equal to the neutral element are skipped, the calculation is
+    stopped as soon as the dominant element is obtained.
 ### Side effects
+    Intermediate results are not preserved, they are removed by the next
+    GC after Biddy_Clean.
 ### More info
-    See Biddy_Managed_ExtractMinterm.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedExtractMinterm(Biddy_Manager MNG, Biddy_Edge support, Biddy_Edge f)
+static Biddy_Edge
+applyN(Biddy_Manager MNG, Biddy_Edge *f, unsigned int n, int schedule,
+       Biddy_Boolean conjunction)
 {
-  Biddy_Edge g,m,r;
-  Biddy_Variable v;
-  Biddy_Variable vs;
-
-  assert( MNG != NULL );
-  assert( f != NULL );
-  assert( support != biddyZero);
+  Biddy_Edge *q;
+  Biddy_Edge r,unit,dominant;
+  unsigned int *size,*snum;
+  Biddy_Variable **supp;
+  unsigned int i,j,m,a,b,ov,best;
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+  unit = conjunction ? biddyOne : biddyZero;
+  dominant = conjunction ? biddyZero : biddyOne;
 
-  if (f == biddyZero) return biddyZero;
+  if (!(q = (Biddy_Edge *) malloc((n+1) * sizeof(Biddy_Edge)))) {
+    fprintf(stderr,"applyN: Out of memoy!\n");
+    exit(1);
+  }
 
+  m = 0;
   r = biddyNull;
+  for (i=0; (i<n) && (r != dominant); i++) {
+    assert( BiddyIsOK(f[i]) == TRUE );
+    if (f[i] == dominant) r = dominant;
+    else if (f[i] != unit) q[m++] = f[i];
+  }
+  if ((r != dominant) && (m == 0)) r = unit;
+  if (r != biddyNull) m = 0;
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-
-    /* this generates the smallest minterm */
-
-    if (Biddy_IsTerminal(support)) return biddyOne;
+  if (m == 1) {
+    r = q[0];
+  }
 
-    v = BiddyV(f);
-    vs = BiddyV(support);
+  else if (m && (schedule == BIDDYSCHEDULELINEAR)) {
+    r = q[0];
+    for (i=1; (i<m) && (r != dominant); i++) {
+      r = conjunction ? BiddyManagedAnd(MNG,r,q[i]) : BiddyManagedOr(MNG,r,q[i]);
+    }
+  }
 
-    if (v != vs) {
-      m = BiddyManagedExtractMinterm(MNG,BiddyT(support),f);
-      r = BiddyManagedTaggedFoaNode(MNG,vs,m,biddyZero,vs,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-    } else {
-      g = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-      if (g == biddyZero) {
-        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),BiddyInvCond(BiddyT(f),BiddyGetMark(f)));
-        r = BiddyManagedTaggedFoaNode(MNG,vs,biddyZero,m,vs,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-      } else {
-        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),g);
-        r = BiddyManagedTaggedFoaNode(MNG,vs,m,biddyZero,vs,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+  else if (m && (schedule == BIDDYSCHEDULETREE)) {
+    /* EACH ROUND HALVES THE NUMBER OF OPERANDS */
+    while ((m > 1) && (r != dominant)) {
+      for (i=0, j=0; (i+1 < m) && (r != dominant); i+=2, j++) {
+        r = conjunction ? BiddyManagedAnd(MNG,q[i],q[i+1]) : BiddyManagedOr(MNG,q[i],q[i+1]);
+        q[j] = r;
       }
+      if (i < m) q[j++] = q[i];
+      m = j;
     }
+    if (r != dominant) r = q[0];
+  }
 
+  else if (m && (schedule == BIDDYSCHEDULESMALLEST)) {
+    /* MIN-HEAP ORDERED BY THE NUMBER OF NODES */
+    if (!(size = (unsigned int *) malloc(m * sizeof(unsigned int)))) {
+      fprintf(stderr,"applyN: Out of memoy!\n");
+      exit(1);
+    }
+    for (i=0; i<m; i++) {
+      size[i] = BiddyManagedCountNodes(MNG,q[i]);
+    }
+    for (i=m/2; i>0; i--) {
+      scheduleHeapDown(q,size,m,i-1);
+    }
+    while ((m > 1) && (r != dominant)) {
+      /* THE SMALLEST OPERAND IS REMOVED AND COMBINED WITH THE NEXT SMALLEST ONE */
+      r = q[0];
+      m--;
+      q[0] = q[m];
+      size[0] = size[m];
+      scheduleHeapDown(q,size,m,0);
+      r = conjunction ? BiddyManagedAnd(MNG,r,q[0]) : BiddyManagedOr(MNG,r,q[0]);
+      q[0] = r;
+      size[0] = BiddyManagedCountNodes(MNG,r);
+      scheduleHeapDown(q,size,m,0);
+    }
+    if (r != dominant) r = q[0];
+    free(size);
+  }
+
+  else if (m && (schedule == BIDDYSCHEDULESUPPORT)) {
+    if (!(size = (unsigned int *) malloc(m * sizeof(unsigned int))) ||
+        !(snum = (unsigned int *) malloc(m * sizeof(unsigned int))) ||
+        !(supp = (Biddy_Variable **) malloc(m * sizeof(Biddy_Variable *))))
+    {
+      fprintf(stderr,"applyN: Out of memoy!\n");
+      exit(1);
+    }
+    for (i=0; i<m; i++) {
+      size[i] = BiddyManagedCountNodes(MNG,q[i]);
+      supp[i] = scheduleSupport(MNG,q[i],&snum[i]);
+    }
+    while ((m > 1) && (r != dominant)) {
+      /* THE SMALLEST OPERAND */
+      a = 0;
+      for (i=1; i<m; i++) {
+        if (size[i] < size[a]) a = i;
+      }
+      /* THE OPERAND WITH THE MOST SHARED VARIABLES, TIES ARE BROKEN BY SIZE */
+      b = m;
+      best = 0;
+      for (i=0; i<m; i++) {
+        if (i == a) continue;
+        ov = scheduleOverlap(supp[a],snum[a],supp[i],snum[i]);
+        if ((b == m) || (ov > best) || ((ov == best) && (size[i] < size[b]))) {
+          b = i;
+          best = ov;
+        }
+      }
+      r = conjunction ? BiddyManagedAnd(MNG,q[a],q[b]) : BiddyManagedOr(MNG,q[a],q[b]);
+      q[a] = r;
+      size[a] = BiddyManagedCountNodes(MNG,r);
+      free(supp[a]);
+      supp[a] = scheduleSupport(MNG,r,&snum[a]);
+      free(supp[b]);
+      m--;
+      q[b] = q[m];
+      size[b] = size[m];
+      supp[b] = supp[m];
+      snum[b] = snum[m];
+    }
+    if (r != dominant) r = q[0];
+    for (i=0; i<m; i++) {
+      free(supp[i]);
+    }
+    free(supp);
+    free(snum);
+    free(size);
   }
 
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+  free(q);
 
-    /* this generates the smallest minterm */
-    /* argument support is not used for ZBDD and ZBDDC */
+  BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+  return r;
+}
 
-    if (Biddy_IsTerminal(f)) return f;
+/*******************************************************************************
+\brief Function scheduleHeapDown moves the i-th element of a min-heap down.
 
-    v = BiddyV(f);
+### Description
+    The heap is ordered by size, edges are moved together with their size.
+### Side effects
+### More info
+*******************************************************************************/
 
-    g = BiddyInvCond(BiddyE(f),BiddyGetMark(f));
-    if (g == biddyZero) {
-      m = BiddyManagedExtractMinterm(MNG,support,BiddyT(f));
-      r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,m,v,TRUE);
-      BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-    } else {
-      r = BiddyManagedExtractMinterm(MNG,support,g);
-    }
+static void
+scheduleHeapDown(Biddy_Edge *q, unsigned int *size, unsigned int m,
+                 unsigned int i)
+{
+  Biddy_Edge e;
+  unsigned int s,c;
 
+  e = q[i];
+  s = size[i];
+  while ((c = 2*i+1) < m) {
+    if ((c+1 < m) && (size[c+1] < size[c])) c++;
+    if (s <= size[c]) break;
+    q[i] = q[c];
+    size[i] = size[c];
+    i = c;
   }
+  q[i] = e;
+  size[i] = s;
+}
 
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
+/*******************************************************************************
+\brief Function scheduleSupport returns dependent variables of a function.
 
-    /* this generates the smallest minterm */
+### Description
+    Variables are returned in an allocated array sorted by their index.
+    The number of variables is returned in parameter num.
+### Side effects
+    Variables are selected by BiddyManagedDependentVariableNumber and
+    deselected here.
+### More info
+*******************************************************************************/
 
-    v = BiddyV(f);
-    vs = BiddyV(support);
+static Biddy_Variable *
+scheduleSupport(Biddy_Manager MNG, Biddy_Edge f, unsigned int *num)
+{
+  Biddy_Variable *s;
+  Biddy_Variable v;
+  unsigned int n;
 
-    if (Biddy_IsTerminal(f)) {
-      Biddy_SetTag(f,vs);
-      return f;
-    }
+  n = BiddyManagedDependentVariableNumber(MNG,f,TRUE);
+  if (!(s = (Biddy_Variable *) malloc((n+1) * sizeof(Biddy_Variable)))) {
+    fprintf(stderr,"scheduleSupport: Out of memoy!\n");
+    exit(1);
+  }
 
-    while (BiddyV(support) != v) {
-      support = BiddyT(support);
+  n = 0;
+  for (v=1; v<biddyVariableTable.num; v++) {
+    if (biddyVariableTable.table[v].selected) {
+      s[n++] = v;
+      biddyVariableTable.table[v].selected = FALSE;
     }
+  }
+  *num = n;
 
-    g = BiddyE(f);
-    if (g == biddyZero) {
-        m = BiddyManagedExtractMinterm(MNG,BiddyT(support),BiddyT(f));
-        r = BiddyManagedTaggedFoaNode(MNG,v,biddyZero,m,vs,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
-    } else {
-      r = BiddyManagedExtractMinterm(MNG,BiddyT(support),g);
-      Biddy_SetTag(r,vs);
-    }
+  return s;
+}
 
+/*******************************************************************************
+\brief Function scheduleOverlap counts variables in both sorted arrays.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+static unsigned int
+scheduleOverlap(Biddy_Variable *a, unsigned int na, Biddy_Variable *b,
+                unsigned int nb)
+{
+  unsigned int i,j,n;
+
+  i = j = n = 0;
+  while ((i < na) && (j < nb)) {
+    if (a[i] < b[j]) i++;
+    else if (a[i] > b[j]) j++;
+    else {
+      n++;
+      i++;
+      j++;
+    }
   }
-#endif
 
-  return r;
+  return n;
 }
 
+/*******************************************************************************
+\brief Function bfAndKey determines the key used for cache lookup in
+       breadth-first apply.
+
+### Description
+    The key is the same as in BiddyManagedAnd, thus results are shared.
+    Arguments must be ordered, ((uintptr_t) f) must not be smaller than
+    ((uintptr_t) g). Returns TRUE iff the complemented result is cached.
+### Side effects
+### More info
+*******************************************************************************/
+
+static inline Biddy_Boolean
+bfAndKey(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge g, Biddy_Edge *FF,
+         Biddy_Edge *GG, Biddy_Edge *HH)
+{
+  if (biddyManagerType == BIDDYTYPEOBDDC) {
+    if (BiddyGetMark(f)) {
+      *FF = BiddyInv(f);
+      *GG = biddyOne;
+      *HH = BiddyInv(g);
+      return TRUE;
+    } else if (BiddyGetMark(g)) {
+      *FF = f;
+      *GG = BiddyInv(g);
+      *HH = biddyOne;
+      return TRUE;
+    }
+  }
 
+  *FF = f;
+  *GG = g;
+  *HH = biddyZero;
+  return FALSE;
+}
 
-/***************************************************************************//*!
-\brief Function BiddyManagedDual.
+/*******************************************************************************
+\brief Function relationSchedule determines the order of partitions and
+       the variables quantified after each of them.
 
 ### Description
+    Greedy heuristic, similar to the one from IWLS95. In each step, the
+    partition with the largest ratio between the number of variables which
+    can be quantified after it and the number of all its variables which
+    are quantified is chosen. Ties are broken by the number of variables
+    which are not quantified and have not been introduced by the previous
+    partitions, and by the size of partitions. Variables which are
+    quantified but do not occur in any partition are quantified in the
+    first step.
 ### Side effects
+    Arrays in the given schedule are allocated.
 ### More info
-    See Biddy_Managed_Dual.
 *******************************************************************************/
 
-Biddy_Edge
-BiddyManagedDual(Biddy_Manager MNG, Biddy_Edge f, Biddy_Boolean neg)
+static void
+relationSchedule(Biddy_Manager MNG, Biddy_Variable **supp, unsigned int *nsupp,
+                 unsigned int *size, unsigned int n, Biddy_Boolean *quant,
+                 BiddyRelationSchedule *s)
 {
-  Biddy_Edge e, t;
+  unsigned int *cnt;
+  Biddy_Boolean *used,*intro;
   Biddy_Variable v;
-  Biddy_Edge r;
+  unsigned int i,j,p,q,w,x,best,bq,bw,bx,nq;
 
-  assert( MNG != NULL );
-  assert( f != NULL );
+  nq = 0;
+  for (v = 1; v < biddyVariableTable.num; v++) {
+    if (quant[v]) nq++;
+  }
 
-  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
-  assert(
-    (biddyManagerType == BIDDYTYPEOBDD) ||
-    (biddyManagerType == BIDDYTYPEOBDDC) ||
-    (biddyManagerType == BIDDYTYPEZBDD) ||
-    (biddyManagerType == BIDDYTYPEZBDDC) ||
-    (biddyManagerType == BIDDYTYPETZBDD)
-  );
+  if (!(s->order = (unsigned int *) malloc((n+1) * sizeof(unsigned int))) ||
+      !(s->qstart = (unsigned int *) malloc((n+2) * sizeof(unsigned int))) ||
+      !(s->qvar = (Biddy_Variable *) malloc((nq+1) * sizeof(Biddy_Variable))) ||
+      !(cnt = (unsigned int *) calloc(biddyVariableTable.num,sizeof(unsigned int))) ||
+      !(intro = (Biddy_Boolean *) calloc(biddyVariableTable.num,sizeof(Biddy_Boolean))) ||
+      !(used = (Biddy_Boolean *) calloc(n+1,sizeof(Biddy_Boolean))))
+  {
+    fprintf(stderr,"relationSchedule: Out of memoy!\n");
+    exit(1);
+  }
 
-  r = biddyNull;
+  for (p = 0; p < n; p++) {
+    for (j = 0; j < nsupp[p]; j++) cnt[supp[p][j]]++;
+  }
 
-  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
-    if (f == biddyZero) r = biddyOne;
-    else if (f == biddyOne) r = biddyZero;
-    else {
-      v = BiddyV(f);
-      e = BiddyManagedDual(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),neg);
-      t = BiddyManagedDual(MNG,BiddyT(f),neg);
-      if (neg) {
-        r = BiddyManagedTaggedFoaNode(MNG,v,t,e,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+  /* VARIABLES WHICH DO NOT OCCUR IN ANY PARTITION */
+  s->qstart[0] = 0;
+  nq = 0;
+  for (v = 1; v < biddyVariableTable.num; v++) {
+    if (quant[v] && !cnt[v]) s->qvar[nq++] = v;
+  }
+
+  for (i = 0; i < n; i++) {
+
+    /* CHOOSING THE NEXT PARTITION */
+    best = n;
+    bq = bw = bx = 0;
+    for (p = 0; p < n; p++) {
+      if (used[p]) continue;
+      q = w = x = 0;
+      for (j = 0; j < nsupp[p]; j++) {
+        v = supp[p][j];
+        if (quant[v]) {
+          w++;
+          if (cnt[v] == 1) q++;
+        } else if (!intro[v]) {
+          x++;
+        }
+      }
+      if (!w) w = 1;
+      if ((best == n) ||
+          (q * bw > bq * w) ||
+          ((q * bw == bq * w) && (x < bx)) ||
+          ((q * bw == bq * w) && (x == bx) && (size[p] < size[best])))
+      {
+        best = p;
+        bq = q;
+        bw = w;
+        bx = x;
+      }
+    }
+
+    /* VARIABLES WHICH DO NOT OCCUR IN THE REMAINING PARTITIONS */
+    used[best] = TRUE;
+    s->order[i] = best;
+    for (j = 0; j < nsupp[best]; j++) {
+      v = supp[best][j];
+      if (quant[v]) {
+        if (!(--cnt[v])) s->qvar[nq++] = v;
       } else {
-        r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
-        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        intro[v] = TRUE;
       }
     }
-  }
+    s->qstart[i+1] = nq;
 
-#ifndef COMPACT
-  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
   }
 
-  else if (biddyManagerType == BIDDYTYPETZBDD) {
-  }
-#endif
+  /* IF THERE ARE NO PARTITIONS, ALL VARIABLES ARE QUANTIFIED IN ONE STEP */
+  if (!n) s->qstart[1] = nq;
 
-  return r;
+  free(cnt);
+  free(intro);
+  free(used);
 }
 
-/*----------------------------------------------------------------------------*/
-/* Definition of other internal functions                                     */
-/*----------------------------------------------------------------------------*/
+/*******************************************************************************
+\brief Function relationCube returns the cube of the given variables.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+static Biddy_Edge
+relationCube(Biddy_Manager MNG, Biddy_Variable *v, unsigned int n)
+{
+  Biddy_Edge cube;
+  unsigned int i;
+
+  if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    cube = biddyTerminal; /* this is base set */
+    for (i = 0; i < n; i++) {
+      cube = BiddyManagedChange(MNG,cube,v[i]);
+    }
+  } else {
+    cube = biddyOne;
+    for (i = 0; i < n; i++) {
+      cube = BiddyManagedAnd(MNG,cube,biddyVariableTable.table[v[i]].variable);
+    }
+  }
+
+  return cube;
+}
 
 /*******************************************************************************
-\brief Function BiddyOPGarbage performs Garbage Collection for the OP cache.
+\brief Function relationImage conjoins the given set with all clusters and
+       quantifies variables as given by the schedule.
 
 ### Description
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyOPGarbage(Biddy_Manager MNG)
+static Biddy_Edge
+relationImage(Biddy_Manager MNG, BiddyRelation *r, BiddyRelationSchedule *s,
+              Biddy_Edge R)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  Biddy_Edge cube;
+  unsigned int i;
 
-  if (biddyOPCache.disabled) return;
-  if (*biddyOPCache.notusedyet) return;
+  if (!r->n) {
+    cube = relationCube(MNG,&s->qvar[0],s->qstart[1]);
+    return BiddyManagedExistAbstract(MNG,R,cube);
+  }
 
-  for (j=0; j<=biddyOPCache.size; j++) {
-    if (!BiddyIsNull(biddyOPCache.table[j].result)) {
-      c = &biddyOPCache.table[j];
-      /* VARIANT A */
-      /*
-      if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->g)->expiry) && ((BiddyN(c->g)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->h)->expiry) && ((BiddyN(c->h)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
-      */
-      /* VARIANT B */
-      /*
-      if (((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->g)->expiry) && ((BiddyN(c->g)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->h)->expiry) && ((BiddyN(c->h)->expiry) < biddySystemAge)))
-      */
-      /* VARIANT C */
-      /**/
-      if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->g)->expiry) && ((BiddyN(c->g)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->h)->expiry) && ((BiddyN(c->h)->expiry) < biddySystemAge)))
-      /**/
-      {
-        c->result = biddyNull;
-      }
-    }
+  for (i = 0; (i < r->n) && (R != biddyZero); i++) {
+    cube = relationCube(MNG,&s->qvar[s->qstart[i]],s->qstart[i+1]-s->qstart[i]);
+    R = BiddyManagedExistAndAbstract(MNG,R,r->cluster[s->order[i]],cube);
   }
+
+  return R;
 }
 
 /*******************************************************************************
-\brief Function BiddyOPGarbageNewVariable is used to clean the OP cache after
-        the adding new variable.
+\brief Function relationRename renames next state variables to current
+       state variables or vice versa.
 
 ### Description
-    This function is needed for BDD types where adding new variable below
-    the existing one changes the meaning of the existing formulae.
 ### Side effects
+    For OBDD, OBDDC, and TZBDD, values of variables are changed.
 ### More info
 *******************************************************************************/
 
-void
-BiddyOPGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+static Biddy_Edge
+relationRename(Biddy_Manager MNG, BiddyRelation *r, Biddy_Edge f,
+               Biddy_Boolean tocur)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  Biddy_Variable *from,*to;
+  char keyword[80];
+  unsigned int i;
 
-  if (biddyOPCache.disabled) return;
-  if (*biddyOPCache.notusedyet) return;
+  from = tocur ? r->next : r->cur;
+  to = tocur ? r->cur : r->next;
 
-  for (j=0; j<=biddyOPCache.size; j++) {
-    if (!BiddyIsNull(biddyOPCache.table[j].result)) {
-      c = &biddyOPCache.table[j];
-      if ((BiddyIsSmaller(biddyOrderingTable,BiddyN(c->f)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->g)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->h)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->result)->v,v)))
-      {
-        c->result = biddyNull;
-      }
+  if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    for (i = 0; i < r->m; i++) {
+      f = BiddyManagedCompose(MNG,f,biddyVariableTable.table[to[i]].variable,from[i]);
+    }
+  } else {
+    BiddyManagedResetVariablesValue(MNG);
+    for (i = 0; i < r->m; i++) {
+      BiddyManagedSetVariableValue(MNG,from[i],biddyVariableTable.table[to[i]].variable);
     }
+    sprintf(keyword,"%s_%s",r->name,tocur ? "image" : "preimage");
+    f = BiddyManagedReplaceByKeyword(MNG,f,(Biddy_String) keyword);
   }
+
+  return f;
 }
 
 /*******************************************************************************
-\brief Function BiddyOPGarbageDeleteAll deletes all entries in the OP cache.
+\brief Function saturate returns the set of states reachable from the given
+       set by firing events on the given level and below it.
 
 ### Description
+    Function f must not depend on current state variables above the given
+    level. Both successors are saturated first, then events on the given
+    level are fired until there are no new states. If new states are
+    obtained, the successors are saturated again.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyOPGarbageDeleteAll(Biddy_Manager MNG)
+static Biddy_Edge
+saturate(Biddy_Manager MNG, BiddySaturation *sat, Biddy_Edge f, unsigned int k)
 {
-  /*
-  unsigned int j;
-  BiddyOp3Cache *c;
-  */
+  Biddy_Edge r,old,x,E,T;
+  BiddySatCache *c;
+  unsigned int e;
 
-  if (biddyOPCache.disabled) return;
-  if (*biddyOPCache.notusedyet) return;
+  if ((f == biddyZero) || (k >= sat->last)) return f;
 
-  /**/
-  memset(biddyOPCache.table,0,(biddyOPCache.size+1)*sizeof(BiddyOp3Cache));
-  /**/
+  x = biddyVariableTable.table[sat->level[k]].variable;
+  c = &sat->cache[op3Hash(f,x,biddyZero,BIDDYSATCACHESIZE)];
+  if ((c->f == f) && (c->k == k)) return c->r;
 
-  /*
-  bzero(biddyOPCache.table, (biddyOPCache.size+1) * sizeof(BiddyOp3Cache));
-  */
+  E = saturate(MNG,sat,BiddyManagedRestrict(MNG,f,sat->level[k],FALSE),k+1);
+  T = saturate(MNG,sat,BiddyManagedRestrict(MNG,f,sat->level[k],TRUE),k+1);
+  r = BiddyManagedITE(MNG,x,T,E);
 
-  /*
-  for (j=0; j<=biddyOPCache.size; j++) {
-    if (!BiddyIsNull(biddyOPCache.table[j].result)) {
-      c = &biddyOPCache.table[j];
-      c->result = biddyNull;
+  if (sat->first[k]) {
+    while (TRUE) {
+      old = r;
+      for (e = sat->first[k]; e; e = sat->event[e].next) {
+        r = BiddyManagedOr(MNG,r,saturateImage(MNG,sat,&sat->event[e],r));
+      }
+      if (r == old) break;
+      E = saturate(MNG,sat,BiddyManagedRestrict(MNG,r,sat->level[k],FALSE),k+1);
+      T = saturate(MNG,sat,BiddyManagedRestrict(MNG,r,sat->level[k],TRUE),k+1);
+      r = BiddyManagedITE(MNG,x,T,E);
     }
   }
-  */
 
-  *biddyOPCache.notusedyet = TRUE;
+  /* the cache entry may have been overwritten by the recursive calls */
+  c = &sat->cache[op3Hash(f,x,biddyZero,BIDDYSATCACHESIZE)];
+  c->f = f;
+  c->k = k;
+  c->r = r;
+
+  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyEAGarbage performs Garbage Collection for the EA cache.
+\brief Function saturateImage returns the set of states reachable from the
+       given set by firing the given event once.
 
 ### Description
 ### Side effects
+    Values of variables are changed and restored.
 ### More info
 *******************************************************************************/
 
-void
-BiddyEAGarbage(Biddy_Manager MNG)
+static Biddy_Edge
+saturateImage(Biddy_Manager MNG, BiddySaturation *sat, BiddySatEvent *e,
+              Biddy_Edge f)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  unsigned int i;
 
-  if (biddyEACache.disabled) return;
-  if (*biddyEACache.notusedyet) return;
+  f = BiddyManagedExistAndAbstract(MNG,f,e->rel,e->cube);
+  if (f == biddyZero) return f;
 
-  for (j=0; j<=biddyEACache.size; j++) {
-    if (!BiddyIsNull(biddyEACache.table[j].result)) {
-      c = &biddyEACache.table[j];
-      if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->g)->expiry) && ((BiddyN(c->g)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->h)->expiry) && ((BiddyN(c->h)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
-      {
-        c->result = biddyNull;
-      }
-    }
+  for (i = 0; i < e->wnum; i++) {
+    BiddyManagedSetVariableValue(MNG,sat->next[e->write[i]],
+      biddyVariableTable.table[sat->cur[e->write[i]]].variable);
+  }
+  f = BiddyManagedReplaceByKeyword(MNG,f,e->keyword);
+  for (i = 0; i < e->wnum; i++) {
+    BiddyManagedSetVariableValue(MNG,sat->next[e->write[i]],biddyZero);
   }
+
+  return f;
 }
 
 /*******************************************************************************
-\brief Function BiddyEAGarbageNewVariable is used to clean the EA cache after
-        the adding new variable.
+\brief Function vectorCompose calculates a simultaneous substitution.
 
 ### Description
-    This function is needed for BDD types where adding new variable below
-    the existing one changes the meaning of the existing formulae.
+    Function subst[v] is used for variable v, variables with subst[v] ==
+    biddyNull are not changed. Subgraphs below the last substituted
+    variable are returned unchanged. Results are stored in Replace cache
+    using the given key.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyEAGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
+static Biddy_Edge
+vectorCompose(Biddy_Manager MNG, Biddy_Edge f, Biddy_Edge *subst,
+              Biddy_Variable last, const unsigned int key)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  Biddy_Edge e,t,h,r;
+  Biddy_Variable fv;
+  Biddy_Edge FF;
+  Biddy_Boolean NN;
+  unsigned int cindex;
 
-  if (biddyEACache.disabled) return;
-  if (*biddyEACache.notusedyet) return;
+  assert( MNG != NULL );
+  assert( f != NULL );
 
-  for (j=0; j<=biddyEACache.size; j++) {
-    if (!BiddyIsNull(biddyEACache.table[j].result)) {
-      c = &biddyEACache.table[j];
-      if ((BiddyIsSmaller(biddyOrderingTable,BiddyN(c->f)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->g)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->h)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->result)->v,v)))
-      {
-        c->result = biddyNull;
-      }
+  /* IMPLEMENTED FOR OBDD AND OBDDC */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC)
+  );
+
+  if (f == biddyZero) return f;
+
+  /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+  fv = BiddyV(f);
+  if (BiddyIsSmaller(biddyOrderingTable,last,fv)) return f;
+
+  r = biddyNull;
+
+  if (BiddyGetMark(f)) {
+    NN = TRUE;
+    FF = BiddyInv(f);
+  } else {
+    NN = FALSE;
+    FF = f;
+  }
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!findKeywordCache(biddyReplaceCache,FF,key,&r,&cindex))
+  {
+
+    if (!(h = subst[fv])) h = biddyVariableTable.table[fv].variable;
+
+    e = vectorCompose(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),subst,last,key);
+    t = vectorCompose(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),subst,last,key);
+    r = BiddyManagedITE(MNG,h,t,e);
+
+    if (NN) {
+      addKeywordCache(biddyReplaceCache,FF,key,BiddyInv(r),cindex);
+    } else {
+      addKeywordCache(biddyReplaceCache,FF,key,r,cindex);
+    }
+
+  } else {
+
+    if (NN) {
+      BiddyInvertMark(r);
     }
+
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
+
   }
+
+  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyEAGarbageDeleteAll deletes all entries in the EA cache.
+\brief Function restrictCubeLiterals finds literals in the given cube.
 
 ### Description
+    For each literal in the cube, lit[v] is set to biddyOne (positive
+    literal) or biddyZero (negative literal). Parameter top is the topmost
+    variable, it is used for ZBDD and ZBDDC, only. Return FALSE if the
+    given function is not a product of literals.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyEAGarbageDeleteAll(Biddy_Manager MNG)
+static Biddy_Boolean
+restrictCubeLiterals(Biddy_Manager MNG, Biddy_Edge cube, Biddy_Variable top,
+                     Biddy_Edge *lit)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  Biddy_Edge e,t;
+  Biddy_Variable cv;
 
-  if (biddyEACache.disabled) return;
-  if (*biddyEACache.notusedyet) return;
+#ifndef COMPACT
+  Biddy_Variable v;
+#endif
 
-  for (j=0; j<=biddyEACache.size; j++) {
-    c = &biddyEACache.table[j];
-    c->result = biddyNull;
+  if (cube == biddyZero) return FALSE;
+
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    while (!BiddyIsTerminal(cube)) {
+      cv = BiddyV(cube);
+      e = BiddyInvCond(BiddyE(cube),BiddyGetMark(cube));
+      t = BiddyInvCond(BiddyT(cube),BiddyGetMark(cube));
+      if (e == biddyZero) {
+        lit[cv] = biddyOne;
+        cube = t;
+      } else if (t == biddyZero) {
+        lit[cv] = biddyZero;
+        cube = e;
+      } else {
+        return FALSE;
+      }
+    }
   }
-  *biddyEACache.notusedyet = TRUE;
+
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    /* VARIABLES WHICH ARE SKIPPED IN THE CUBE ARE NEGATIVE LITERALS */
+    for (v = top; v != 0; v = biddyVariableTable.table[v].next) {
+      if (BiddyV(cube) != v) {
+        lit[v] = biddyZero;
+      } else {
+        e = BiddyInvCond(BiddyE(cube),BiddyGetMark(cube));
+        t = BiddyT(cube);
+        if (e == biddyZero) {
+          lit[v] = biddyOne;
+        } else if (e != t) {
+          return FALSE;
+        }
+        cube = t;
+      }
+    }
+  }
+
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* VARIABLES BETWEEN THE TAG AND THE TOP VARIABLE ARE NEGATIVE LITERALS */
+    while (TRUE) {
+      cv = BiddyV(cube);
+      for (v = BiddyGetTag(cube); v != cv; v = biddyVariableTable.table[v].next) {
+        lit[v] = biddyZero;
+      }
+      if (BiddyIsTerminal(cube)) break;
+      e = BiddyE(cube);
+      t = BiddyT(cube);
+      if (e == biddyZero) {
+        lit[cv] = biddyOne;
+      } else if (e != t) {
+        return FALSE;
+      }
+      cube = t;
+    }
+  }
+#endif
+
+  return (BiddyIsTerminal(cube) && (cube != biddyZero));
 }
 
 /*******************************************************************************
-\brief Function BiddyRCGarbage performs Garbage Collection for the RC cache.
+\brief Function restrictCube calculates a cofactor with respect to the
+       literals given in table lit.
 
 ### Description
+    Parameter v is the current variable, it is used for ZBDD and ZBDDC,
+    only. Subgraphs below the last variable from the cube are returned
+    unchanged. The cube is used as a part of the key in RC cache, for ZBDD
+    and ZBDDC, results are cached only if v is the top variable of f.
 ### Side effects
 ### More info
 *******************************************************************************/
 
-void
-BiddyRCGarbage(Biddy_Manager MNG)
+static Biddy_Edge
+restrictCube(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable v, Biddy_Edge *lit,
+             Biddy_Variable last, Biddy_Edge cube)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  Biddy_Edge e,t,r;
+  Biddy_Variable fv,w;
+  Biddy_Boolean cacheOK;
+  unsigned int cindex;
 
-  if (biddyRCCache.disabled) return;
-  if (*biddyRCCache.notusedyet) return;
+#ifndef COMPACT
+  Biddy_Variable tag;
+#endif
 
-  for (j=0; j<=biddyRCCache.size; j++) {
-    if (!BiddyIsNull(biddyRCCache.table[j].result)) {
-      c = &biddyRCCache.table[j];
-      if ((!BiddyIsNull(c->f) && (BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          (!BiddyIsNull(c->g) && (BiddyN(c->g)->expiry) && ((BiddyN(c->g)->expiry) < biddySystemAge)) ||
-          (!BiddyIsNull(c->h) && (BiddyN(c->h)->expiry) && ((BiddyN(c->h)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
-      {
-        c->result = biddyNull;
+  assert( MNG != NULL );
+  assert( f != NULL );
+
+  /* IMPLEMENTED FOR OBDD, OBDDC, ZBDD, ZBDDC, AND TZBDD */
+  assert(
+    (biddyManagerType == BIDDYTYPEOBDD) ||
+    (biddyManagerType == BIDDYTYPEOBDDC) ||
+    (biddyManagerType == BIDDYTYPEZBDD) ||
+    (biddyManagerType == BIDDYTYPEZBDDC) ||
+    (biddyManagerType == BIDDYTYPETZBDD)
+  );
+
+  if (f == biddyZero) return biddyZero;
+
+  /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+  fv = BiddyV(f);
+  if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+    cacheOK = TRUE;
+    w = fv;
+  }
+#ifndef COMPACT
+  else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+    cacheOK = (fv == v);
+    w = v;
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    cacheOK = TRUE;
+    w = BiddyGetTag(f);
+  }
+#endif
+  else {
+    return biddyNull;
+  }
+  if (BiddyIsSmaller(biddyOrderingTable,last,w)) {
+    r = f;
+    BiddyRefresh(r); /* return non-obsolete node even if the parameter is an obsolete node */
+    return r;
+  }
+
+  r = biddyNull;
+
+  /* IF RESULT IS NOT IN THE CACHE TABLE... */
+  cindex = 0;
+  if (!cacheOK || !findOp3Cache(biddyRCCache,f,cube,biddyNull,&r,&cindex))
+  {
+
+    if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
+      if (lit[fv] == biddyOne) {
+        r = restrictCube(MNG,BiddyInvCond(BiddyT(f),BiddyGetMark(f)),0,lit,last,cube);
+      } else if (lit[fv] == biddyZero) {
+        r = restrictCube(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),0,lit,last,cube);
+      } else {
+        e = restrictCube(MNG,BiddyE(f),0,lit,last,cube);
+        t = restrictCube(MNG,BiddyT(f),0,lit,last,cube);
+        r = BiddyInvCond(BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE),BiddyGetMark(f));
+        BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+      }
+    }
+
+#ifndef COMPACT
+    else if ((biddyManagerType == BIDDYTYPEZBDDC) || (biddyManagerType == BIDDYTYPEZBDD)) {
+      w = biddyVariableTable.table[v].next;
+      if (fv == v) {
+        if (lit[v] == biddyOne) {
+          t = restrictCube(MNG,BiddyT(f),w,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,v,t,t,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else if (lit[v] == biddyZero) {
+          e = restrictCube(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),w,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          e = restrictCube(MNG,BiddyInvCond(BiddyE(f),BiddyGetMark(f)),w,lit,last,cube);
+          t = restrictCube(MNG,BiddyT(f),w,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,v,e,t,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        /* VARIABLE v IS SKIPPED IN f, I.E. f DOES NOT CONTAIN COMBINATIONS WITH v */
+        if (lit[v] == biddyOne) {
+          r = biddyZero;
+        } else if (lit[v] == biddyZero) {
+          e = restrictCube(MNG,f,w,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,v,e,e,v,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        } else {
+          r = restrictCube(MNG,f,w,lit,last,cube);
+        }
+      }
+    }
+
+    else if (biddyManagerType == BIDDYTYPETZBDD) {
+      tag = BiddyGetTag(f);
+      if (fv == tag) {
+        if (lit[fv] == biddyOne) {
+          r = restrictCube(MNG,BiddyT(f),0,lit,last,cube);
+        } else if (lit[fv] == biddyZero) {
+          r = restrictCube(MNG,BiddyE(f),0,lit,last,cube);
+        } else {
+          e = restrictCube(MNG,BiddyE(f),0,lit,last,cube);
+          t = restrictCube(MNG,BiddyT(f),0,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,fv,e,t,fv,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
+      } else {
+        /* VARIABLE tag IS ZERO-SUPPRESSED IN f, I.E. f IS FALSE IF tag IS TRUE */
+        if (lit[tag] == biddyOne) {
+          r = biddyZero;
+        } else if (lit[tag] == biddyZero) {
+          r = restrictCube(MNG,BiddyManagedIncTag(MNG,f),0,lit,last,cube);
+        } else {
+          e = restrictCube(MNG,BiddyManagedIncTag(MNG,f),0,lit,last,cube);
+          r = BiddyManagedTaggedFoaNode(MNG,tag,e,biddyZero,tag,TRUE);
+          BiddyRefresh(r); /* FoaNode returns an obsolete node! */
+        }
       }
     }
-  }
-}
-
-/*******************************************************************************
-\brief Function BiddyRCGarbageNewVariable is used to clean the RC cache after
-        the adding new variable.
+#endif
 
-### Description
-    This function is needed for BDD types where adding new variable below
-    the existing one changes the meaning of the existing formulae.
-### Side effects
-### More info
-*******************************************************************************/
+    if (cacheOK) addOp3Cache(biddyRCCache,f,cube,biddyNull,r,cindex);
 
-void
-BiddyRCGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
-{
-  unsigned int j;
-  BiddyOp3Cache *c;
+  } else {
 
-  if (biddyRCCache.disabled) return;
-  if (*biddyRCCache.notusedyet) return;
+    /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    BiddyRefresh(r);
 
-  for (j=0; j<=biddyRCCache.size; j++) {
-    if (!BiddyIsNull(biddyRCCache.table[j].result)) {
-      c = &biddyRCCache.table[j];
-      if ((!BiddyIsNull(c->f) && BiddyIsSmaller(biddyOrderingTable,BiddyN(c->f)->v,v)) ||
-          (!BiddyIsNull(c->g) && BiddyIsSmaller(biddyOrderingTable,BiddyN(c->g)->v,v)) ||
-          (!BiddyIsNull(c->h) && BiddyIsSmaller(biddyOrderingTable,BiddyN(c->h)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->result)->v,v)))
-      {
-        c->result = biddyNull;
-      }
-    }
   }
+
+  return r;
 }
 
 /*******************************************************************************
-\brief Function BiddyRCGarbageDeleteAll deletes all entries in the RC cache.
+\brief Function bfAndRequest finds or creates a request for And in
+       breadth-first apply.
 
 ### Description
+    Simple cases and results found in the cache are returned in parameter
+    r, in this case 0 is returned. Otherwise, the index of the request is
+    returned. Equal requests are joined. A new request is added to the
+    queue of its top variable.
 ### Side effects
+    The table of requests may be reallocated, thus pointers to existing
+    requests are not valid after this call.
 ### More info
 *******************************************************************************/
 
-void
-BiddyRCGarbageDeleteAll(Biddy_Manager MNG)
+static unsigned int
+bfAndRequest(Biddy_Manager MNG, BiddyBFQueue *q, Biddy_Edge f, Biddy_Edge g,
+             Biddy_Edge *r)
 {
-  unsigned int j;
-  BiddyOp3Cache *c;
+  BiddyBFRequest *rq;
+  Biddy_Edge FF, GG, HH;
+  Biddy_Boolean NN;
+  Biddy_Variable topF, topG, v;
+  unsigned int i, h, cindex;
 
-  if (biddyRCCache.disabled) return;
-  if (*biddyRCCache.notusedyet) return;
+  if (biddyNodeTable.extendedstats) biddyNodeTable.andorrecursive++;
 
-  for (j=0; j<=biddyRCCache.size; j++) {
-    c = &biddyRCCache.table[j];
-    c->result = biddyNull;
+  /* LOOKING FOR SIMPLE CASE */
+  if ((f == biddyZero) || (g == biddyZero)) {
+    *r = biddyZero;
+    return 0;
+  } else if (f == biddyOne) {
+    BiddyRefresh(g); /* return non-obsolete node even if the parameter is an obsolete node */
+    *r = g;
+    return 0;
+  } else if ((g == biddyOne) || (f == g)) {
+    BiddyRefresh(f); /* return non-obsolete node even if the parameter is an obsolete node */
+    *r = f;
+    return 0;
+  } else if ((biddyManagerType == BIDDYTYPEOBDDC) && BiddyIsEqvPointer(f,g)) {
+    *r = biddyZero;
+    return 0;
   }
-  *biddyRCCache.notusedyet = TRUE;
-}
-
-/*******************************************************************************
-\brief Function BiddyReplaceGarbage performs Garbage Collection for the Replace
-        cache.
-
-### Description
-### Side effects
-### More info
-*******************************************************************************/
-
-void
-BiddyReplaceGarbage(Biddy_Manager MNG)
-{
-  unsigned int j;
-  BiddyKeywordCache *c;
 
-  if (biddyReplaceCache.disabled) return;
-  if (*biddyReplaceCache.notusedyet) return;
+  /* EQUAL REQUESTS ARE JOINED */
+  /* ARGUMENTS ARE ORDERED IN THE SAME WAY AS FOR CACHE LOOKUP */
+  if (((uintptr_t) f) < ((uintptr_t) g)) exchangeEdges(&f,&g);
+  h = op3Hash(f,g,biddyZero,q->hashsize);
+  for (i = q->hash[h]; i; i = q->table[i].hnext) {
+    if ((q->table[i].f == f) && (q->table[i].g == g)) return i;
+  }
 
-  for (j=0; j<=biddyReplaceCache.size; j++) {
-    if (!BiddyIsNull(biddyReplaceCache.table[j].result)) {
-      c = &biddyReplaceCache.table[j];
-      if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
-          ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
-      {
-        c->result = biddyNull;
-      }
+  /* IF THE RESULT IS IN THE CACHE TABLE, A REQUEST IS NOT NEEDED */
+  NN = bfAndKey(MNG,f,g,&FF,&GG,&HH);
+  cindex = 0;
+  if (findOp3Cache(biddyOPCache,FF,GG,HH,r,&cindex)) {
+    if (NN) {
+      BiddyInvertMark(*r);
     }
+    BiddyRefresh(*r); /* IF THE RESULT IS FROM CACHE TABLE, REFRESH IT! */
+    return 0;
   }
-}
-
-/*******************************************************************************
-\brief Function BiddyReplaceGarbageNewVariable is used to clean the Replace
-        cache after the adding new variable.
-
-### Description
-    This function is needed for BDD types where adding new variable below
-    the existing one changes the meaning of the existing formulae.
-### Side effects
-### More info
-*******************************************************************************/
-
-void
-BiddyReplaceGarbageNewVariable(Biddy_Manager MNG, Biddy_Variable v)
-{
-  unsigned int j;
-  BiddyKeywordCache *c;
-
-  if (biddyReplaceCache.disabled) return;
-  if (*biddyReplaceCache.notusedyet) return;
 
-  for (j=0; j<=biddyReplaceCache.size; j++) {
-    if (!BiddyIsNull(biddyReplaceCache.table[j].result)) {
-      c = &biddyReplaceCache.table[j];
-      if ((BiddyIsSmaller(biddyOrderingTable,BiddyN(c->f)->v,v)) ||
-          (BiddyIsSmaller(biddyOrderingTable,BiddyN(c->result)->v,v)))
-      {
-        c->result = biddyNull;
-      }
+  /* THE TABLE IS ENLARGED IF NEEDED, HASH TABLE HAS THE SAME SIZE */
+  if (q->num == q->size) {
+    q->size = 2 * q->size;
+    q->hashsize = q->size - 1;
+    free(q->hash);
+    if (!(rq = (BiddyBFRequest *) realloc(q->table,q->size * sizeof(BiddyBFRequest))) ||
+        !(q->hash = (unsigned int *) calloc(q->hashsize + 1,sizeof(unsigned int))))
+    {
+      fprintf(stderr,"bfAndRequest: Out of memoy!\n");
+      exit(1);
+    }
+    q->table = rq;
+    for (i = 1; i < q->num; i++) {
+      h = op3Hash(rq[i].f,rq[i].g,biddyZero,q->hashsize);
+      rq[i].hnext = q->hash[h];
+      q->hash[h] = i;
     }
+    h = op3Hash(f,g,biddyZero,q->hashsize);
   }
-}
-
-/*******************************************************************************
-\brief Function BiddyReplaceGarbageDeleteAll deletes all entries in the Replace
-        cache.
-
-### Description
-### Side effects
-### More info
-*******************************************************************************/
-
-void
-BiddyReplaceGarbageDeleteAll(Biddy_Manager MNG)
-{
-  unsigned int j;
-  BiddyKeywordCache *c;
 
-  if (biddyReplaceCache.disabled) return;
-  if (*biddyReplaceCache.notusedyet) return;
-
-  for (j=0; j<=biddyReplaceCache.size; j++) {
-    c = &biddyReplaceCache.table[j];
-    c->result = biddyNull;
+  /* A NEW REQUEST IS ADDED TO THE QUEUE OF ITS TOP VARIABLE */
+  /* CONSTANT VARIABLE MUST HAVE MAX ORDER */
+  topF = BiddyV(f);
+  topG = BiddyV(g);
+  v = BiddyIsSmaller(biddyOrderingTable,topF,topG) ? topF : topG;
+  i = q->num++;
+  rq = &q->table[i];
+  rq->f = f;
+  rq->g = g;
+  rq->E = rq->T = rq->r = biddyNull;
+  rq->e = rq->t = 0;
+  rq->next = 0;
+  rq->hnext = q->hash[h];
+  rq->cindex = cindex;
+  q->hash[h] = i;
+  if (q->last[v]) {
+    q->table[q->last[v]].next = i;
+  } else {
+    q->first[v] = i;
   }
-  *biddyReplaceCache.notusedyet = TRUE;
-}
+  q->last[v] = i;
 
-/*----------------------------------------------------------------------------*/
-/* Definition of static functions                                             */
-/*----------------------------------------------------------------------------*/
+  return i;
+}
 
 static Biddy_Edge
 replaceByKeyword(Biddy_Manager MNG, Biddy_Edge f, Biddy_Variable topv,
@@ -10572,10 +13946,12 @@ op3Hash(Biddy_Edge a, Biddy_Edge b, Biddy_Edge c, unsigned int size)
   /* rndc1 = 12582917, rndc2 = 4256249, >> 1,1,2,8, calls: 33415082 */
   /* rndc1 = 1982250849, rndc2 = 423214982, >> 0,0,0,16, calls: 33382146 */
   /* rndc1 = 1327958971, rndc2=516963069, >> 1,2,0,19, calls: 33374477 */
+  /* b and c are not shifted right, complement bits must not be lost, */
+  /* otherwise (a,b,c) and (a,b,NOT c) always collide (e.g. parity chains) */
   /**/
   {
   uintptr_t k;
-  k = ((((uintptr_t) b >> 1) + ((uintptr_t) c >> 2)) * 1327958971 + (uintptr_t) a) * 516963069;
+  k = ((((uintptr_t) b) + ((uintptr_t) c << 1)) * 1327958971 + (uintptr_t) a) * 516963069;
   hash = (k >> 19) & size;
   return hash;
   }
@@ -10690,26 +14066,63 @@ addOp3Cache(BiddyOp3CacheTable cache, Biddy_Edge a,
             Biddy_Edge b, Biddy_Edge c, Biddy_Edge r, unsigned int index)
 {
   BiddyOp3Cache *p;
+  unsigned int w;
+#ifdef COMPACTCACHE
+  BiddyOp3CacheTags *t;
+#endif
 
   if (cache.disabled) return;
 
   p = &cache.table[index];
-
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!BiddyIsNull(p->result)) {
-    /* THE CELL IS NOT EMPTY, THUS THIS IS OVERWRITING */
-    (*cache.overwrite)++;
-  }
+#ifdef COMPACTCACHE
+  t = cache.tags ? &cache.tags[index] : NULL;
 #endif
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  (*cache.insert)++;
+#ifdef PARALLELAPPLY
+  /* THE ENTRY MUST NOT BE READ WHILE IT IS PARTIALLY WRITTEN */
+  if (cache.lock) pthread_mutex_lock(&cache.lock[index & (BIDDYAPPLYCACHELOCKS-1)]);
 #endif
 
+  /* THE NEW ENTRY IS PLACED AT THE BEGINNING OF THE SET */
+  /* THE FIRST EMPTY ENTRY OR THE LAST ENTRY IS DROPPED */
+  w = 0;
+  while ((w < cache.ways-1) && BiddyCacheEntryValid(cache,&p[w])) w++;
+
+  if (cache.stats) {
+    if (BiddyCacheEntryValid(cache,&p[w])) {
+      /* THE CELL IS NOT EMPTY, THUS THIS IS OVERWRITING */
+      (*cache.overwrite)++;
+    }
+    (*cache.insert)++;
+  }
+
+  if (w) memmove(&p[1],&p[0],w*sizeof(BiddyOp3Cache));
+
+#ifdef COMPACTCACHE
+  p->f = BiddyCacheRef(cache,a);
+  p->g = BiddyCacheRef(cache,b);
+  p->h = BiddyCacheRef(cache,c);
+  p->result = BiddyCacheRef(cache,r);
+  if (t) {
+    if (w) memmove(&t[1],&t[0],w*sizeof(BiddyOp3CacheTags));
+    t->f = BiddyGetTag(a);
+    t->g = BiddyGetTag(b);
+    t->h = BiddyGetTag(c);
+    t->result = BiddyGetTag(r);
+  }
+#else
   p->f = a;
   p->g = b;
   p->h = c;
   p->result = r;
+#endif
+#ifdef LAZYCACHE
+  p->epoch = cache.epoch;
+#endif
+
+#ifdef PARALLELAPPLY
+  if (cache.lock) pthread_mutex_unlock(&cache.lock[index & (BIDDYAPPLYCACHELOCKS-1)]);
+#endif
 
   if (*cache.notusedyet) *cache.notusedyet = FALSE;
 }
@@ -10719,7 +14132,10 @@ addOp3Cache(BiddyOp3CacheTable cache, Biddy_Edge a,
        three-arguments operations.
 
 ### Description
+    All entries in the set are checked. The entry found is moved to the
+    beginning of the set.
 ### Side effects
+    The index of the set is returned in parameter index.
 ### More info
 *******************************************************************************/
 
@@ -10729,31 +14145,79 @@ findOp3Cache(BiddyOp3CacheTable cache, Biddy_Edge a,
 {
   Biddy_Boolean q;
   BiddyOp3Cache *p;
+  BiddyOp3Cache tmp;
+  unsigned int w;
+#ifdef COMPACTCACHE
+  BiddyOp3CacheTags *t;
+  BiddyOp3CacheTags tmptags;
+  BiddyCacheReference ra,rb,rc;
+#endif
 
   if (cache.disabled) return FALSE;
 
   q = FALSE;
 
-  *index = op3Hash(a,b,c,cache.size);
+  *index = op3Hash(a,b,c,cache.size) & ~(cache.ways-1);
   p = &cache.table[*index];
 
-#ifdef BIDDYEXTENDEDSTATS_YES
+#ifdef COMPACTCACHE
+  t = cache.tags ? &cache.tags[*index] : NULL;
+  ra = BiddyCacheRef(cache,a);
+  rb = BiddyCacheRef(cache,b);
+  rc = BiddyCacheRef(cache,c);
+#endif
+
   (*cache.search)++;
+
+#ifdef PARALLELAPPLY
+  if (cache.lock) pthread_mutex_lock(&cache.lock[*index & (BIDDYAPPLYCACHELOCKS-1)]);
 #endif
 
-  if ((p->f == a) &&
-      (p->g == b) &&
-      (p->h == c) &&
-      !BiddyIsNull(p->result)
-     )
-  {
-#ifdef BIDDYEXTENDEDSTATS_YES
-    (*cache.find)++;
+  for (w=0; w<cache.ways; w++) {
+#ifdef COMPACTCACHE
+    if ((p[w].f == ra) &&
+        (p[w].g == rb) &&
+        (p[w].h == rc) &&
+        BiddyCacheEntryValid(cache,&p[w]) &&
+        (!t || ((t[w].f == BiddyGetTag(a)) &&
+                (t[w].g == BiddyGetTag(b)) &&
+                (t[w].h == BiddyGetTag(c))))
+       )
+#else
+    if ((p[w].f == a) &&
+        (p[w].g == b) &&
+        (p[w].h == c) &&
+        BiddyCacheEntryValid(cache,&p[w])
+       )
 #endif
-    *r = p->result;
-    q = TRUE;
+    {
+      (*cache.find)++;
+#ifdef COMPACTCACHE
+      *r = BiddyCacheEdge(cache,p[w].result,t ? t[w].result : 0);
+#else
+      *r = p[w].result;
+#endif
+      q = TRUE;
+      if (w) {
+        tmp = p[w];
+        memmove(&p[1],&p[0],w*sizeof(BiddyOp3Cache));
+        p[0] = tmp;
+#ifdef COMPACTCACHE
+        if (t) {
+          tmptags = t[w];
+          memmove(&t[1],&t[0],w*sizeof(BiddyOp3CacheTags));
+          t[0] = tmptags;
+        }
+#endif
+      }
+      break;
+    }
   }
 
+#ifdef PARALLELAPPLY
+  if (cache.lock) pthread_mutex_unlock(&cache.lock[*index & (BIDDYAPPLYCACHELOCKS-1)]);
+#endif
+
   /* DEBUGGING */
   /*
   if (q) printf("OP3CACHE RETURNED: %p\n",(void *) *r);
@@ -10782,20 +14246,20 @@ addKeywordCache(BiddyKeywordCacheTable cache,
 
   p = &cache.table[index];
 
-#ifdef BIDDYEXTENDEDSTATS_YES
-  if (!BiddyIsNull(p->result)) {
-    /* THE CELL IS NOT EMPTY, THUS THIS IS OVERWRITING */
-    (*cache.overwrite)++;
+  if (cache.stats) {
+    if (BiddyCacheEntryValid(cache,p)) {
+      /* THE CELL IS NOT EMPTY, THUS THIS IS OVERWRITING */
+      (*cache.overwrite)++;
+    }
+    (*cache.insert)++;
   }
-#endif
-
-#ifdef BIDDYEXTENDEDSTATS_YES
-  (*cache.insert)++;
-#endif
 
   p->f = a;
   p->keyword = k;
   p->result = r;
+#ifdef LAZYCACHE
+  p->epoch = cache.epoch;
+#endif
 
   *cache.notusedyet = FALSE;
 }
@@ -10824,21 +14288,198 @@ findKeywordCache(BiddyKeywordCacheTable cache,
   *index = keywordHash(a,k,cache.size);
   p = &cache.table[*index];
 
-#ifdef BIDDYEXTENDEDSTATS_YES
   (*cache.search)++;
-#endif
 
   if ((p->f == a) &&
       (p->keyword == k) &&
-      !BiddyIsNull(p->result)
+      BiddyCacheEntryValid(cache,p)
      )
   {
-#ifdef BIDDYEXTENDEDSTATS_YES
     (*cache.find)++;
-#endif
     *r = p->result;
     q = TRUE;
   }
 
   return q;
 }
+
+/*******************************************************************************
+\brief Function resizedCacheSize returns the suggested size of a cache table.
+
+### Description
+    Cache table is doubled if there were enough look-ups since the previous
+    check, more than biddyNodeTable.cacheratio of them were hits, and
+    the table is smaller than the peak number of nodes. Cache table is halved
+    if there were only a few look-ups and the table is much larger than the
+    peak number of nodes, but it never becomes smaller than its initial size.
+### Side effects
+    If biddyNodeTable.cacheratio is 0.0 then the size is not changed.
+### More info
+*******************************************************************************/
+
+static unsigned int
+resizedCacheSize(Biddy_Manager MNG, unsigned int size, unsigned int initsize,
+                 unsigned long long int search, unsigned long long int find)
+{
+  if (biddyNodeTable.cacheratio <= 0.0) return size;
+
+  /* THE CACHE TABLE IS USEFUL BUT IT IS SMALL FOR THE PROBLEM */
+  if ((search > size) && (find > biddyNodeTable.cacheratio * search) &&
+      (size < biddyNodeTable.max) && (size < BIDDYCACHELIMITSIZE))
+  {
+    return 2 * size + 1;
+  }
+
+  /* THE CACHE TABLE IS RARELY USED AND IT IS LARGE FOR THE PROBLEM */
+  if ((search < size / 4) && (size / 4 > biddyNodeTable.max) &&
+      (size > initsize))
+  {
+    return size / 2;
+  }
+
+  return size;
+}
+
+/*******************************************************************************
+\brief Function resizeOp3Cache resizes the cache table for three-arguments
+       operations if this is suggested by its statistics.
+
+### Description
+    Used in BiddyOPGarbage, BiddyEAGarbage, and BiddyRCGarbage. Valid
+    entries are moved into the new table, entries with obsolete nodes are
+    dropped. If a set in the new table is full then the entry is dropped.
+### Side effects
+    Return TRUE iff the cache table has been resized (and cleaned). If there
+    is not enough memory for the new table then the table is not resized.
+### More info
+*******************************************************************************/
+
+static Biddy_Boolean
+resizeOp3Cache(Biddy_Manager MNG, BiddyOp3CacheTable *cache)
+{
+  BiddyOp3Cache *table,*c,*p;
+  unsigned long long int search,find;
+  unsigned int size,j,k,w;
+#ifdef COMPACTCACHE
+  BiddyOp3CacheTags *tags,*ct;
+#endif
+
+  search = *(cache->search) - cache->lastsearch;
+  find = *(cache->find) - cache->lastfind;
+  size = resizedCacheSize(MNG,cache->size,cache->initsize,search,find);
+
+  if (search > cache->size) {
+    cache->lastsearch = *(cache->search);
+    cache->lastfind = *(cache->find);
+  }
+
+  if (size == cache->size) return FALSE;
+
+  if (!(table = (BiddyOp3Cache *) BiddyAllocCacheTable((size+1)*sizeof(BiddyOp3Cache)))) {
+    return FALSE;
+  }
+#ifdef COMPACTCACHE
+  tags = NULL;
+  if (cache->tags &&
+      !(tags = (BiddyOp3CacheTags *) BiddyAllocCacheTable((size+1)*sizeof(BiddyOp3CacheTags))))
+  {
+    free(table);
+    return FALSE;
+  }
+#endif
+
+  for (j=0; j<=cache->size; j++) {
+    c = &cache->table[j];
+    if (!BiddyCacheEntryValid(*cache,c)) continue;
+    if ((!BiddyCacheIsNull(c->f) && (BiddyCacheN(*cache,c->f)->expiry) && ((BiddyCacheN(*cache,c->f)->expiry) < biddySystemAge)) ||
+        (!BiddyCacheIsNull(c->g) && (BiddyCacheN(*cache,c->g)->expiry) && ((BiddyCacheN(*cache,c->g)->expiry) < biddySystemAge)) ||
+        (!BiddyCacheIsNull(c->h) && (BiddyCacheN(*cache,c->h)->expiry) && ((BiddyCacheN(*cache,c->h)->expiry) < biddySystemAge)) ||
+        ((BiddyCacheN(*cache,c->result)->expiry) && ((BiddyCacheN(*cache,c->result)->expiry) < biddySystemAge)))
+    {
+      continue;
+    }
+#ifdef COMPACTCACHE
+    ct = cache->tags ? &cache->tags[j] : NULL;
+    k = op3Hash(BiddyCacheEdge(*cache,c->f,ct ? ct->f : 0),
+                BiddyCacheEdge(*cache,c->g,ct ? ct->g : 0),
+                BiddyCacheEdge(*cache,c->h,ct ? ct->h : 0),size) & ~(cache->ways-1);
+#else
+    k = op3Hash(c->f,c->g,c->h,size) & ~(cache->ways-1);
+#endif
+    p = &table[k];
+    for (w=0; (w < cache->ways) && !BiddyCacheIsNull(p[w].result); w++);
+    if (w < cache->ways) {
+      p[w] = *c;
+#ifdef COMPACTCACHE
+      if (ct) tags[k+w] = *ct;
+#endif
+    }
+  }
+
+  free(cache->table);
+  cache->table = table;
+#ifdef COMPACTCACHE
+  free(cache->tags);
+  cache->tags = tags;
+#endif
+  cache->size = size;
+  cache->lastsearch = *(cache->search);
+  cache->lastfind = *(cache->find);
+
+  return TRUE;
+}
+
+/*******************************************************************************
+\brief Function resizeKeywordCache resizes the cache table for
+       one-argument operations if this is suggested by its statistics.
+
+### Description
+    Used in BiddyReplaceGarbage. Valid entries are moved into the new table,
+    entries with obsolete nodes are dropped.
+### Side effects
+    Return TRUE iff the cache table has been resized (and cleaned). If there
+    is not enough memory for the new table then the table is not resized.
+### More info
+*******************************************************************************/
+
+static Biddy_Boolean
+resizeKeywordCache(Biddy_Manager MNG, BiddyKeywordCacheTable *cache)
+{
+  BiddyKeywordCache *table,*c;
+  unsigned long long int search,find;
+  unsigned int size,j;
+
+  search = *(cache->search) - cache->lastsearch;
+  find = *(cache->find) - cache->lastfind;
+  size = resizedCacheSize(MNG,cache->size,cache->initsize,search,find);
+
+  if (search > cache->size) {
+    cache->lastsearch = *(cache->search);
+    cache->lastfind = *(cache->find);
+  }
+
+  if (size == cache->size) return FALSE;
+
+  if (!(table = (BiddyKeywordCache *) BiddyAllocCacheTable((size+1)*sizeof(BiddyKeywordCache)))) {
+    return FALSE;
+  }
+
+  for (j=0; j<=cache->size; j++) {
+    c = &cache->table[j];
+    if (!BiddyCacheEntryValid(*cache,c)) continue;
+    if (((BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge)) ||
+        ((BiddyN(c->result)->expiry) && ((BiddyN(c->result)->expiry) < biddySystemAge)))
+    {
+      continue;
+    }
+    table[keywordHash(c->f,c->keyword,size)] = *c;
+  }
+
+  free(cache->table);
+  cache->table = table;
+  cache->size = size;
+  cache->lastsearch = *(cache->search);
+  cache->lastfind = *(cache->find);
+
+  return TRUE;
+}
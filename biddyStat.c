@@ -65,6 +65,8 @@ static void mintermCount(Biddy_Manager MNG, Biddy_Edge f, mpz_t max, mpz_t resul
 
 static unsigned int nodePlainNumber(Biddy_Manager MNG, Biddy_Edge f);
 
+static inline Biddy_Boolean findCountCache(Biddy_Manager MNG, Biddy_Edge f, int nvars, BiddyCountCache **c);
+
 static float calculateSD(unsigned long long int *data, unsigned int n);
 
 /*----------------------------------------------------------------------------*/
@@ -221,8 +223,9 @@ Biddy_Managed_SystemStat(Biddy_Manager MNG, unsigned int stat)
 
 ### Description
 ### Side effects
-    These statistics are counted only if Biddy is compiled using directive
-    BIDDYEXTENDEDSTATS_YES.
+    These statistics are counted only if extended statistics are enabled
+    with Biddy_SetExtendedStats (they are enabled by default if Biddy is
+    compiled using directive BIDDYEXTENDEDSTATS_YES).
 ### More info
     Macro Biddy_SystemLongStat() is defined for use with anonymous manager.
 *******************************************************************************/
@@ -319,8 +322,8 @@ Biddy_Managed_NodeTableNumVar(Biddy_Manager MNG, Biddy_Variable v)
 ### Description
     Return the number of nodes deleted by GC.
 ### Side effects
-    Obsolete nodes deleted by GC are counted only if Biddy is compiled using
-    directive BIDDYEXTENDEDSTATS_YES.
+    Obsolete nodes deleted by GC are counted only if extended statistics
+    are enabled with Biddy_SetExtendedStats.
 ### More info
     Macro Biddy_NodeTableGCObsoleteNumber() is defined for use with anonymous
     manager.
@@ -415,6 +418,8 @@ Biddy_Managed_ListUsed(Biddy_Manager MNG)
 \brief Function Biddy_Managed_ListMaxLength.
 
 ### Description
+    For NODETABLE_OPENADDRESSING, the length of the longest cluster of used
+    positions in Node table is returned.
 ### Side effects
 ### More info
     Macro Biddy_ListMaxLength() is defined for use with anonymous manager.
@@ -462,6 +467,8 @@ Biddy_Managed_ListMaxLength(Biddy_Manager MNG)
 \brief Function Biddy_Managed_ListAvgLength.
 
 ### Description
+    For NODETABLE_OPENADDRESSING, the average length of clusters of used
+    positions in Node table is returned.
 ### Side effects
 ### More info
     Macro Biddy_ListAvgLength() is defined for use with anonymous manager.
@@ -669,6 +676,8 @@ Biddy_Managed_CountComplementedEdges(Biddy_Manager MNG, Biddy_Edge f)
 ### Description
 ### Side effects
     TO DO: implement this using GNU Multiple Precision Arithmetic Library (GMP).
+    The result is kept in the count cache, thus repeated calls for the same
+    function do not traverse the graph.
 ### More info
     Macro Biddy_CountPaths(f) is defined for use with anonymous manager.
 *******************************************************************************/
@@ -729,6 +738,8 @@ Biddy_Managed_CountPaths(Biddy_Manager MNG, Biddy_Edge f)
     For OBDDs and TZBDDs, if (nvars == 0) the result may not be consistent
     with Biddy_PrintfMinterms because this call considers noticeable
     variables, while Biddy_PrintfMinterms considers all created variables.
+    The result is kept in the count cache, thus repeated calls for the same
+    function and the same nvars do not traverse the graph.
 ### More info
     Macro Biddy_CountMinterms(f,nvars) is defined for use with anonymous
     manager.
@@ -775,6 +786,61 @@ Biddy_Managed_CountMinterms(Biddy_Manager MNG, Biddy_Edge f, int nvars)
 }
 #endif
 
+/***************************************************************************//*!
+\brief Function Biddy_Managed_CountFormulaeMinterms counts minterms for all
+       formulae in the formula table.
+
+### Description
+    Parameter nvars has the same meaning as for Biddy_CountMinterms.
+    Function returns the number of counted formulae.
+### Side effects
+    Results are kept in the count cache, thus subsequent calls of
+    Biddy_CountMinterms for these formulae and the same nvars do not
+    traverse the graphs (unless the results have been overwritten or
+    removed by GC). Formulae representing the same function are counted once.
+### More info
+    Macro Biddy_CountFormulaeMinterms(nvars) is defined for use with anonymous
+    manager.
+*******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+unsigned int
+Biddy_Managed_CountFormulaeMinterms(Biddy_Manager MNG, int nvars)
+{
+  if (!MNG) MNG = biddyAnonymousManager;
+
+  if (biddyManagerType == BIDDYTYPEOBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEOBDDC) {
+    /* IMPLEMENTED */
+  }
+#ifndef COMPACT
+  else if (biddyManagerType == BIDDYTYPEZBDD) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPEZBDDC) {
+    /* IMPLEMENTED */
+  }
+  else if (biddyManagerType == BIDDYTYPETZBDD) {
+    /* IMPLEMENTED */
+  }
+#endif
+  else {
+    fprintf(stderr,"Biddy_Managed_CountFormulaeMinterms: Unsupported BDD type!\n");
+    return 0;
+  }
+
+  return BiddyManagedCountFormulaeMinterms(MNG,nvars);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
 /***************************************************************************//*!
 \brief Function Biddy_Managed_DensityOfFunction calculates the ratio of the
        number of on-set minterms to the number of all minterms.
@@ -1224,7 +1290,12 @@ BiddyManagedSystemStat(Biddy_Manager MNG, unsigned int stat)
     /* returns the size of node table */
     /* THE REAL SIZE OF NODE TABLE IS biddyNodeTable.size+2 */
     /* THE FIRST INDEX IS NOT USED, THUS WE HAVE biddyNodeTable.size+1 USEFUL ELEMENTS */
+    /* FOR NODETABLE_SUBTABLES, biddyNodeTable.size IS THE TOTAL SIZE OF ALL SUBTABLES */
+#ifdef NODETABLE_SUBTABLES
+    return biddyNodeTable.size;
+#else
     return biddyNodeTable.size+1;
+#endif
   }
 
   else if (stat == BIDDYSTATNODETABLEBLOCKNUMBER) {
@@ -1281,6 +1352,34 @@ BiddyManagedSystemStat(Biddy_Manager MNG, unsigned int stat)
     return biddyNodeTable.funxor;
   }
 
+  else if (stat == BIDDYSTATNODETABLECOMPACTNUMBER) {
+    return biddyNodeTable.compaction;
+  }
+
+  else if (stat == BIDDYSTATNODETABLECOMPACTTIME) {
+    return (1000*biddyNodeTable.compacttime)/(1*CLOCKS_PER_SEC);
+  }
+
+  else if (stat == BIDDYSTATNODETABLEGCMINORNUMBER) {
+    return biddyNodeTable.gcminor;
+  }
+
+  else if (stat == BIDDYSTATNODETABLEGCMINORTIME) {
+    return (1000*biddyNodeTable.gcminortime)/(1*CLOCKS_PER_SEC);
+  }
+
+  else if (stat == BIDDYSTATNODETABLEGCMAJORNUMBER) {
+    return biddyNodeTable.garbage - biddyNodeTable.gcminor;
+  }
+
+  else if (stat == BIDDYSTATNODETABLEGCMAJORTIME) {
+    return (1000*(biddyNodeTable.gctime-biddyNodeTable.gcminortime))/(1*CLOCKS_PER_SEC);
+  }
+
+  else if (stat == BIDDYSTATNODETABLEGCWALLTIME) {
+    return (1000*biddyNodeTable.gcwalltime)/(1*CLOCKS_PER_SEC);
+  }
+
   return 0;
 }
 
@@ -1299,8 +1398,12 @@ BiddyManagedSystemLongStat(Biddy_Manager MNG, unsigned int longstat)
   assert( MNG );
   assert( longstat || !longstat ); /* make compiler happy */
 
-#ifdef BIDDYEXTENDEDSTATS_YES
+  /* memory released by compactions is counted also without extended stats */
+  if (longstat == BIDDYLONGSTATNODETABLECOMPACTFREED) {
+    return biddyNodeTable.compactfreed;
+  }
 
+  /* other counters are updated only if extended stats are enabled */
   if (longstat == BIDDYLONGSTATNODETABLEFOANUMBER) {
     return biddyNodeTable.foa;
   }
@@ -1345,8 +1448,6 @@ BiddyManagedSystemLongStat(Biddy_Manager MNG, unsigned int longstat)
     return *(biddyOPCache.overwrite);
   }
 
-#endif
-
   return 0;
 }
 
@@ -1383,7 +1484,6 @@ BiddyManagedNodeTableGCObsoleteNumber(Biddy_Manager MNG)
 
   assert( MNG );
 
-#ifdef BIDDYEXTENDEDSTATS_YES
   unsigned int i;
   unsigned long long int sum;
 
@@ -1392,6 +1492,7 @@ BiddyManagedNodeTableGCObsoleteNumber(Biddy_Manager MNG)
     sum += biddyNodeTable.gcobsolete[i];
   }
   gcobsolete = sum;
+#ifdef BIDDYEXTENDEDSTATS_YES
   calculateSD(biddyNodeTable.gcobsolete,biddyNodeTable.garbage);
 #else
   calculateSD(NULL,0); // to avoid unused function warning
@@ -1413,15 +1514,28 @@ unsigned int
 BiddyManagedListUsed(Biddy_Manager MNG)
 {
   unsigned int i,n;
+#ifdef NODETABLE_SUBTABLES
+  Biddy_Variable v;
+#endif
 
   assert( MNG );
 
   n = 0;
+#ifdef NODETABLE_SUBTABLES
+  for (v=1; v<biddyVariableTable.num; v++) {
+    for (i=1; i<=BiddyChainSize(v)+1; i++) {
+      if (BiddyChainTable(v)[i] != NULL) {
+        n++;
+      }
+    }
+  }
+#else
   for (i=1; i<=biddyNodeTable.size+1; i++) {
     if (biddyNodeTable.table[i] != NULL) {
       n++;
     }
   }
+#endif
   return n;
 }
 
@@ -1439,6 +1553,9 @@ BiddyManagedListMaxLength(Biddy_Manager MNG)
 {
   unsigned int i,n,max;
   BiddyNode *sup;
+#ifdef NODETABLE_SUBTABLES
+  Biddy_Variable v;
+#endif
 
   /* DEBUG */
   /*
@@ -1447,15 +1564,46 @@ BiddyManagedListMaxLength(Biddy_Manager MNG)
 
   assert( MNG );
 
+#ifdef NODETABLE_OPENADDRESSING
+  /* WITH OPEN ADDRESSING, THE LENGTH OF A CLUSTER OF USED POSITIONS IS REPORTED */
+  (void)(sup); // to avoid the unused warning
+  max = n = 0;
+  for (i=1; i<=biddyNodeTable.size+1; i++) {
+    if (biddyNodeTable.table[i] != NULL) {
+      n++;
+      if (n > max) max = n;
+    } else {
+      n = 0;
+    }
+  }
+  return max;
+#endif
+
+#ifdef NODETABLE_SUBTABLES
+  max = 0;
+  for (v=1; v<biddyVariableTable.num; v++) {
+    for (i=1; i<=BiddyChainSize(v)+1; i++) {
+      n = 0;
+      sup = BiddyChainTable(v)[i];
+      while (sup != NULL) {
+        n++;
+        sup = BiddyNextInChain(sup);
+      }
+      if (n > max) max = n;
+    }
+  }
+  return max;
+#endif
+
   max = 0;
   for (i=1; i<=biddyNodeTable.size+1; i++) {
     if (biddyNodeTable.table[i] != NULL) {
       n = 0;
-      sup = biddyNodeTable.table[i];
+      sup = BiddyNodeTableEntry(i);
       while (sup != NULL) {
         n++;
-        assert( sup != sup->next );
-        sup = sup->next;
+        assert( sup != BiddyNextInChain(sup) );
+        sup = BiddyNextInChain(sup);
       }
       if (n > max) {
         max = n;
@@ -1474,7 +1622,7 @@ BiddyManagedListMaxLength(Biddy_Manager MNG)
   printf("MAX LIST (%u):\n",maxi);
   while (sup != NULL) {
     printf("v=%u, else=%p, then=%p\n",sup->v,(void*)sup->f,(void*)sup->t);
-    sup = sup->next;
+    sup = BiddyNextInChain(sup);
   }
   */
 
@@ -1496,19 +1644,54 @@ BiddyManagedListAvgLength(Biddy_Manager MNG)
   float sum;
   unsigned int i,n;
   BiddyNode *sup;
+#ifdef NODETABLE_SUBTABLES
+  Biddy_Variable v;
+#endif
 
   assert( MNG );
 
+#ifdef NODETABLE_OPENADDRESSING
+  /* WITH OPEN ADDRESSING, THE AVERAGE LENGTH OF CLUSTERS OF USED POSITIONS IS REPORTED */
+  (void)(sup); // to avoid the unused warning
+  sum = 0;
+  n = 0;
+  for (i=1; i<=biddyNodeTable.size+1; i++) {
+    if (biddyNodeTable.table[i] != NULL) {
+      if ((i == 1) || (biddyNodeTable.table[i-1] == NULL)) n++;
+      sum = sum + 1;
+    }
+  }
+  return (sum/n);
+#endif
+
+#ifdef NODETABLE_SUBTABLES
+  sum = 0;
+  n = 0;
+  for (v=1; v<biddyVariableTable.num; v++) {
+    for (i=1; i<=BiddyChainSize(v)+1; i++) {
+      if (BiddyChainTable(v)[i] != NULL) {
+        n++;
+        sup = BiddyChainTable(v)[i];
+        while (sup != NULL) {
+          sum = sum + 1;
+          sup = BiddyNextInChain(sup);
+        }
+      }
+    }
+  }
+  return (sum/n);
+#endif
+
   sum = 0;
   n = 0;
   for (i=1; i<=biddyNodeTable.size+1; i++) {
     if (biddyNodeTable.table[i] != NULL) {
       n++;
-      sup = biddyNodeTable.table[i];
+      sup = BiddyNodeTableEntry(i);
       while (sup != NULL) {
         sum = sum + 1;
-        assert( sup != sup->next );
-        sup = sup->next;
+        assert( sup != BiddyNextInChain(sup) );
+        sup = BiddyNextInChain(sup);
       }
     }
   }
@@ -1735,6 +1918,7 @@ BiddyManagedCountPaths(Biddy_Manager MNG, Biddy_Edge f)
 {
   unsigned long long int r1,r0;
   Biddy_Boolean rf;
+  BiddyCountCache *c;
 
   assert( MNG );
 
@@ -1742,10 +1926,16 @@ BiddyManagedCountPaths(Biddy_Manager MNG, Biddy_Edge f)
   if (f == biddyZero) return 0;
   if (BiddyIsTerminal(f)) return 1;
 
+  if (findCountCache(MNG,f,BIDDYCOUNTPATHS,&c)) return c->result.paths;
+
   BiddyCreateLocalInfo(MNG,f);
   pathCount(MNG,f,&r1,&r0,&rf); /* all nodes except terminal node are selected */
   BiddyDeleteLocalInfo(MNG,f);
 
+  c->f = f;
+  c->nvars = BIDDYCOUNTPATHS;
+  c->result.paths = r1;
+
   return r1;
 }
 
@@ -1761,17 +1951,23 @@ BiddyManagedCountPaths(Biddy_Manager MNG, Biddy_Edge f)
 double
 BiddyManagedCountMinterms(Biddy_Manager MNG, Biddy_Edge f, int nvars)
 {
-  int var,depvar;
+  int var,depvar,key;
   mpz_t max;
   mpz_t result;
   double resultd;
   Biddy_Boolean leftmost;
+  BiddyCountCache *c;
 
   assert( MNG );
 
   if (BiddyIsNull(f)) return 0;
   if (f == biddyZero) return 0;
 
+  /* THE RESULT FOR ALL CREATED VARIABLES IS CACHED USING THEIR NUMBER */
+  if (nvars == -1) nvars = biddyVariableTable.num-1; /* number of variables except variable 1 */
+  key = nvars;
+  if (findCountCache(MNG,f,key,&c)) return c->result.minterms;
+
   var = 0;
   depvar = 0;
   if ((biddyManagerType == BIDDYTYPEOBDDC) || (biddyManagerType == BIDDYTYPEOBDD)) {
@@ -1867,9 +2063,41 @@ BiddyManagedCountMinterms(Biddy_Manager MNG, Biddy_Edge f, int nvars)
   /* all nodes except terminal node are selected */
   BiddyDeleteLocalInfo(MNG,f);
 
+  c->f = f;
+  c->nvars = key;
+  c->result.minterms = resultd;
+
   return resultd;
 }
 
+/***************************************************************************//*!
+\brief Function BiddyManagedCountFormulaeMinterms.
+
+### Description
+### Side effects
+### More info
+    See Biddy_Managed_CountFormulaeMinterms.
+*******************************************************************************/
+
+unsigned int
+BiddyManagedCountFormulaeMinterms(Biddy_Manager MNG, int nvars)
+{
+  unsigned int i,n;
+  BiddyFormula *formula;
+
+  assert( MNG );
+
+  n = 0;
+  for (i = 0; i < biddyFormulaTable.size; i++) {
+    formula = &biddyFormulaTable.table[i];
+    if (formula->deleted || BiddyIsNull(formula->f)) continue;
+    BiddyManagedCountMinterms(MNG,formula->f,nvars);
+    n++;
+  }
+
+  return n;
+}
+
 /***************************************************************************//*!
 \brief Function BiddyManagedDensityOfFunction.
 
@@ -2262,8 +2490,12 @@ BiddyManagedReadMemoryInUse(Biddy_Manager MNG)
 
   /* node table */
   n += sizeof(BiddyNodeTable) +
-       biddyNodeTable.blocknumber * sizeof(BiddyNode *) +
+       biddyNodeTable.blocknumber * (sizeof(BiddyNode *) + sizeof(unsigned int)) +
        (biddyNodeTable.size+2) * sizeof(BiddyNode *);
+#ifdef NODETABLE_SUBTABLES
+  /* biddyNodeTable.size includes all subtables, each of them has one additional element */
+  n += (biddyVariableTable.num - 1) * sizeof(BiddyNode *);
+#endif
 
   /* variable table */
   n += sizeof(BiddyVariableTable) +
@@ -2300,18 +2532,27 @@ BiddyManagedReadMemoryInUse(Biddy_Manager MNG)
   /* OP cache */
   n += sizeof(BiddyOp3CacheTable) +
        (biddyOPCache.size+1) * sizeof(BiddyOp3Cache);
+#ifdef COMPACTCACHE
+  if (biddyOPCache.tags) n += (biddyOPCache.size+1) * sizeof(BiddyOp3CacheTags);
+#endif
   n += sizeof(Biddy_Boolean); /* notusedyet */
   n += 4 * sizeof(unsigned long long int); /* counters */
 
   /* EA cache */
   n += sizeof(BiddyOp3CacheTable) +
        (biddyEACache.size+1) * sizeof(BiddyOp3Cache);
+#ifdef COMPACTCACHE
+  if (biddyEACache.tags) n += (biddyEACache.size+1) * sizeof(BiddyOp3CacheTags);
+#endif
   n += sizeof(Biddy_Boolean); /* notusedyet */
   n += 4 * sizeof(unsigned long long int); /* counters */
 
   /* RC cache */
   n += sizeof(BiddyOp3CacheTable) +
        (biddyRCCache.size+1) * sizeof(BiddyOp3Cache);
+#ifdef COMPACTCACHE
+  if (biddyRCCache.tags) n += (biddyRCCache.size+1) * sizeof(BiddyOp3CacheTags);
+#endif
   n += sizeof(Biddy_Boolean); /* notusedyet */
   n += 4 * sizeof(unsigned long long int); /* counters */
 
@@ -2323,6 +2564,15 @@ BiddyManagedReadMemoryInUse(Biddy_Manager MNG)
   n += sizeof(Biddy_Boolean); /* notusedyet */
   n += 4 * sizeof(unsigned long long int); /* counters */
 
+  /* COUNT cache */
+  n += sizeof(BiddyCountCacheTable) +
+       (biddyCountCache.size+1) * sizeof(BiddyCountCache);
+
+  /* COPY cache */
+  n += sizeof(BiddyCopyCacheTable);
+  if (biddyCopyCache.table) n += (biddyCopyCache.size+1) * sizeof(BiddyKeywordCache);
+  n += biddyCopyCache.targetNum * sizeof(BiddyCopyTarget);
+
   return n;
 }
 
@@ -2401,202 +2651,225 @@ BiddyManagedPrintInfo(Biddy_Manager MNG, FILE *f)
   fprintf(f,"Peak number of live BDD nodes: %u\n",biddyNodeTable.max);
   fprintf(f,"Number of live BDD nodes: %u\n",biddyNodeTable.num);
   fprintf(f,"Garbage collections so far: %u (node table resizing was used in %u of them)\n",biddyNodeTable.garbage,biddyNodeTable.nodetableresize);
-#ifdef BIDDYEXTENDEDSTATS_YES
+  if (biddyNodeTable.extendedstats) {
 #ifdef MINGW
-  fprintf(f,"Total number of obsolete nodes deleted: %I64u\n",BiddyManagedNodeTableGCObsoleteNumber(MNG));
+    fprintf(f,"Total number of obsolete nodes deleted: %I64u\n",BiddyManagedNodeTableGCObsoleteNumber(MNG));
 #else
-  fprintf(f,"Total number of obsolete nodes deleted: %llu\n",BiddyManagedNodeTableGCObsoleteNumber(MNG));
-#endif
+    fprintf(f,"Total number of obsolete nodes deleted: %llu\n",BiddyManagedNodeTableGCObsoleteNumber(MNG));
 #endif
+  }
   fprintf(f,"Total time for garbage collections so far: %.3fs\n",biddyNodeTable.gctime / (1.0 * CLOCKS_PER_SEC));
+  if (biddyNodeTable.gcthreads > 1) {
+    fprintf(f,"Number of threads used for garbage collections: %u\n",biddyNodeTable.gcthreads);
+  }
+  fprintf(f,"Total wall clock time for garbage collections so far: %.3fs\n",biddyNodeTable.gcwalltime / (1.0 * CLOCKS_PER_SEC));
+#ifdef PARALLELAPPLY
+  if (biddyApplyPool) {
+    fprintf(f,"Number of threads used for operations: %u\n",biddyApplyPool->threads);
+  }
+#endif
+  if (biddyNodeTable.generational) {
+    fprintf(f,"Number of minor / major garbage collections: %u / %u\n",
+            biddyNodeTable.gcminor,biddyNodeTable.garbage-biddyNodeTable.gcminor);
+    fprintf(f,"Time for minor / major garbage collections: %.3fs / %.3fs\n",
+            biddyNodeTable.gcminortime / (1.0 * CLOCKS_PER_SEC),
+            (biddyNodeTable.gctime - biddyNodeTable.gcminortime) / (1.0 * CLOCKS_PER_SEC));
+  }
   fprintf(f,"Dynamic reorderings so far: %u\n",biddyNodeTable.sifting);
   fprintf(f,"Node swaps in dynamic reorderings: %u\n",biddyNodeTable.swap);
   fprintf(f,"Total time for dynamic reorderings so far: %.3fs\n",biddyNodeTable.drtime / (1.0 * CLOCKS_PER_SEC));
+  fprintf(f,"Compactions so far: %u\n",biddyNodeTable.compaction);
+#ifdef MINGW
+  fprintf(f,"Memory released by compactions: %I64u bytes\n",biddyNodeTable.compactfreed);
+#else
+  fprintf(f,"Memory released by compactions: %llu bytes\n",biddyNodeTable.compactfreed);
+#endif
+  fprintf(f,"Total time for compactions so far: %.3fs\n",biddyNodeTable.compacttime / (1.0 * CLOCKS_PER_SEC));
   fprintf(f,"**** Node Table stats ****\n");
-  fprintf(f,"Number of buckets in Node table: %u\n",biddyNodeTable.size+1);
+  fprintf(f,"Number of buckets in Node table: %u\n",BiddyManagedSystemStat(MNG,BIDDYSTATNODETABLESIZE));
   fprintf(f,"Used buckets in Node table: %u (%.2f%%)\n",
                                    BiddyManagedListUsed(MNG),
-                                   (100.0*BiddyManagedListUsed(MNG)/(biddyNodeTable.size+1)));
+                                   (100.0*BiddyManagedListUsed(MNG)/BiddyManagedSystemStat(MNG,BIDDYSTATNODETABLESIZE)));
   fprintf(f,"Max bucket's size in Node table: %u\n",BiddyManagedListMaxLength(MNG));
   fprintf(f,"Avg bucket's size in Node table: %f\n",BiddyManagedListAvgLength(MNG));
-#ifdef BIDDYEXTENDEDSTATS_YES
+  if (biddyNodeTable.extendedstats) {
 #ifdef MINGW
-  fprintf(f, "Number of ITE calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funite,biddyNodeTable.iterecursive);
-  fprintf(f, "Number of AND or OR calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funandor,biddyNodeTable.andorrecursive);
-  fprintf(f, "Number of XOR calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funxor,biddyNodeTable.xorrecursive);
-  fprintf(f, "Number of node table FOA calls: %I64u\n",biddyNodeTable.foa);
-  fprintf(f, "Number of node table insertions: %I64u\n",biddyNodeTable.add);
-  fprintf(f, "Number of compared nodes: %I64u (%.2f per findNodeTable call)\n",
-                                   biddyNodeTable.compare,
-                                   biddyNodeTable.find ?
-                                   (1.0*biddyNodeTable.compare/biddyNodeTable.find):0);
+    fprintf(f, "Number of ITE calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funite,biddyNodeTable.iterecursive);
+    fprintf(f, "Number of AND or OR calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funandor,biddyNodeTable.andorrecursive);
+    fprintf(f, "Number of XOR calls: %u (internal and recursive calls: %I64u)\n",biddyNodeTable.funxor,biddyNodeTable.xorrecursive);
+    fprintf(f, "Number of node table FOA calls: %I64u\n",biddyNodeTable.foa);
+    fprintf(f, "Number of node table insertions: %I64u\n",biddyNodeTable.add);
+    fprintf(f, "Number of compared nodes: %I64u (%.2f per findNodeTable call)\n",
+                                     biddyNodeTable.compare,
+                                     biddyNodeTable.find ?
+                                     (1.0*biddyNodeTable.compare/biddyNodeTable.find):0);
 #else
-  fprintf(f, "Number of ITE calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funite,biddyNodeTable.iterecursive);
-  fprintf(f, "Number of AND and OR calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funandor,biddyNodeTable.andorrecursive);
-  fprintf(f, "Number of XOR calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funxor,biddyNodeTable.xorrecursive);
-  fprintf(f, "Number of node table FOA calls: %llu\n",biddyNodeTable.foa);
-  fprintf(f, "Number of node table insertions: %llu\n",biddyNodeTable.add);
-  fprintf(f, "Number of compared nodes: %llu (%.2f per findNodeTable call)\n",
-                                   biddyNodeTable.compare,
-                                   biddyNodeTable.find ?
-                                   (1.0*biddyNodeTable.compare/biddyNodeTable.find):0);
-#endif
+    fprintf(f, "Number of ITE calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funite,biddyNodeTable.iterecursive);
+    fprintf(f, "Number of AND and OR calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funandor,biddyNodeTable.andorrecursive);
+    fprintf(f, "Number of XOR calls: %u (internal and recursive calls: %llu)\n",biddyNodeTable.funxor,biddyNodeTable.xorrecursive);
+    fprintf(f, "Number of node table FOA calls: %llu\n",biddyNodeTable.foa);
+    fprintf(f, "Number of node table insertions: %llu\n",biddyNodeTable.add);
+    fprintf(f, "Number of compared nodes: %llu (%.2f per findNodeTable call)\n",
+                                     biddyNodeTable.compare,
+                                     biddyNodeTable.find ?
+                                     (1.0*biddyNodeTable.compare/biddyNodeTable.find):0);
 #endif
+  }
   fprintf(f,"**** OP cache stats ****\n");
   fprintf(f,"Size of OP cache: %u\n",biddyOPCache.size);
 #ifdef MINGW
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of OP cache look-ups: %I64u\n",*(biddyOPCache.search));
-  fprintf(f, "Number of OP cache hits: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyOPCache.find),
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.find))/(*(biddyOPCache.search))):0);
-  fprintf(f,"Number of OP cache insertions: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyOPCache.insert),
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.insert))/(*(biddyOPCache.search))):0);
-  fprintf(f, "Number of OP cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyOPCache.overwrite),
-                                   (*(biddyOPCache.insert)) ?
-                                   (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.insert))):0,
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of OP cache look-ups: %I64u\n",*(biddyOPCache.search));
+    fprintf(f, "Number of OP cache hits: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyOPCache.find),
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.find))/(*(biddyOPCache.search))):0);
+    fprintf(f,"Number of OP cache insertions: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyOPCache.insert),
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.insert))/(*(biddyOPCache.search))):0);
+    fprintf(f, "Number of OP cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyOPCache.overwrite),
+                                     (*(biddyOPCache.insert)) ?
+                                     (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.insert))):0,
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.search))):0);
+  }
 #else
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of OP cache look-ups: %llu\n",*(biddyOPCache.search));
-  fprintf(f, "Number of OP cache hits: %llu (%.2f%% of all calls)\n",
-                                   *(biddyOPCache.find),
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.find))/(*(biddyOPCache.search))):0);
-  fprintf(f,"Number of OP cache insertions: %llu (%.2f%% of all calls)\n",
-                                   *(biddyOPCache.insert),
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.insert))/(*(biddyOPCache.search))):0);
-  fprintf(f, "Number of OP cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyOPCache.overwrite),
-                                   (*(biddyOPCache.insert)) ?
-                                   (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.insert))):0,
-                                   *(biddyOPCache.search) ?
-                                   (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of OP cache look-ups: %llu\n",*(biddyOPCache.search));
+    fprintf(f, "Number of OP cache hits: %llu (%.2f%% of all calls)\n",
+                                     *(biddyOPCache.find),
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.find))/(*(biddyOPCache.search))):0);
+    fprintf(f,"Number of OP cache insertions: %llu (%.2f%% of all calls)\n",
+                                     *(biddyOPCache.insert),
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.insert))/(*(biddyOPCache.search))):0);
+    fprintf(f, "Number of OP cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyOPCache.overwrite),
+                                     (*(biddyOPCache.insert)) ?
+                                     (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.insert))):0,
+                                     *(biddyOPCache.search) ?
+                                     (100.0*(*(biddyOPCache.overwrite))/(*(biddyOPCache.search))):0);
+  }
 #endif
   fprintf(f,"**** EA cache stats ****\n");
   fprintf(f,"Size of EA cache: %u\n",biddyEACache.size);
 #ifdef MINGW
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of EA cache look-ups: %I64u\n",*(biddyEACache.search));
-  fprintf(f, "Number of EA cache hits: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyEACache.find),
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.find))/(*(biddyEACache.search))):0);
-  fprintf(f,"Number of EA cache insertions: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyEACache.insert),
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.insert))/(*(biddyEACache.search))):0);
-  fprintf(f, "Number of EA cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyEACache.overwrite),
-                                   (*(biddyEACache.insert)) ?
-                                   (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.insert))):0,
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of EA cache look-ups: %I64u\n",*(biddyEACache.search));
+    fprintf(f, "Number of EA cache hits: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyEACache.find),
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.find))/(*(biddyEACache.search))):0);
+    fprintf(f,"Number of EA cache insertions: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyEACache.insert),
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.insert))/(*(biddyEACache.search))):0);
+    fprintf(f, "Number of EA cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyEACache.overwrite),
+                                     (*(biddyEACache.insert)) ?
+                                     (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.insert))):0,
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.search))):0);
+  }
 #else
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of EA cache look-ups: %llu\n",*(biddyEACache.search));
-  fprintf(f, "Number of EA cache hits: %llu (%.2f%% of all calls)\n",
-                                   *(biddyEACache.find),
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.find))/(*(biddyEACache.search))):0);
-  fprintf(f,"Number of EA cache insertions: %llu (%.2f%% of all calls)\n",
-                                   *(biddyEACache.insert),
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.insert))/(*(biddyEACache.search))):0);
-  fprintf(f, "Number of EA cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyEACache.overwrite),
-                                   (*(biddyEACache.insert)) ?
-                                   (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.insert))):0,
-                                   (*(biddyEACache.search)) ?
-                                   (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of EA cache look-ups: %llu\n",*(biddyEACache.search));
+    fprintf(f, "Number of EA cache hits: %llu (%.2f%% of all calls)\n",
+                                     *(biddyEACache.find),
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.find))/(*(biddyEACache.search))):0);
+    fprintf(f,"Number of EA cache insertions: %llu (%.2f%% of all calls)\n",
+                                     *(biddyEACache.insert),
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.insert))/(*(biddyEACache.search))):0);
+    fprintf(f, "Number of EA cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyEACache.overwrite),
+                                     (*(biddyEACache.insert)) ?
+                                     (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.insert))):0,
+                                     (*(biddyEACache.search)) ?
+                                     (100.0*(*(biddyEACache.overwrite))/(*(biddyEACache.search))):0);
+  }
 #endif
   fprintf(f,"**** RC cache stats ****\n");
   fprintf(f,"Size of RC cache: %u\n",biddyRCCache.size);
 #ifdef MINGW
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of RC cache look-ups: %I64u\n",*(biddyRCCache.search));
-  fprintf(f, "Number of RC cache hits: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyRCCache.find),
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.find))/(*(biddyRCCache.search))):0);
-  fprintf(f,"Number of RC cache insertions: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyRCCache.insert),
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.insert))/(*(biddyRCCache.search))):0);
-  fprintf(f, "Number of RC cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyRCCache.overwrite),
-                                   (*(biddyRCCache.insert)) ?
-                                   (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.insert))):0,
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of RC cache look-ups: %I64u\n",*(biddyRCCache.search));
+    fprintf(f, "Number of RC cache hits: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyRCCache.find),
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.find))/(*(biddyRCCache.search))):0);
+    fprintf(f,"Number of RC cache insertions: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyRCCache.insert),
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.insert))/(*(biddyRCCache.search))):0);
+    fprintf(f, "Number of RC cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyRCCache.overwrite),
+                                     (*(biddyRCCache.insert)) ?
+                                     (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.insert))):0,
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.search))):0);
+  }
 #else
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of RC cache look-ups: %llu\n",*(biddyRCCache.search));
-  fprintf(f, "Number of RC cache hits: %llu (%.2f%% of all calls)\n",
-                                   *(biddyRCCache.find),
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.find))/(*(biddyRCCache.search))):0);
-  fprintf(f,"Number of RC cache insertions: %llu (%.2f%% of all calls)\n",
-                                   *(biddyRCCache.insert),
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.insert))/(*(biddyRCCache.search))):0);
-  fprintf(f, "Number of RC cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyRCCache.overwrite),
-                                   (*(biddyRCCache.insert)) ?
-                                   (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.insert))):0,
-                                   (*(biddyRCCache.search)) ?
-                                   (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of RC cache look-ups: %llu\n",*(biddyRCCache.search));
+    fprintf(f, "Number of RC cache hits: %llu (%.2f%% of all calls)\n",
+                                     *(biddyRCCache.find),
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.find))/(*(biddyRCCache.search))):0);
+    fprintf(f,"Number of RC cache insertions: %llu (%.2f%% of all calls)\n",
+                                     *(biddyRCCache.insert),
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.insert))/(*(biddyRCCache.search))):0);
+    fprintf(f, "Number of RC cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyRCCache.overwrite),
+                                     (*(biddyRCCache.insert)) ?
+                                     (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.insert))):0,
+                                     (*(biddyRCCache.search)) ?
+                                     (100.0*(*(biddyRCCache.overwrite))/(*(biddyRCCache.search))):0);
+  }
 #endif
   fprintf(f,"**** Replace cache stats ****\n");
   fprintf(f,"Size of Replace cache: %u\n",biddyReplaceCache.size);
 #ifdef MINGW
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of Replace cache look-ups: %I64u\n",*(biddyReplaceCache.search));
-  fprintf(f, "Number of Replace cache hits: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.find),
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.find))/(*(biddyReplaceCache.search))):0);
-  fprintf(f,"Number of Replace cache insertions: %I64u (%.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.insert),
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.insert))/(*(biddyReplaceCache.search))):0);
-  fprintf(f, "Number of Replace cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.overwrite),
-                                   (*(biddyReplaceCache.insert)) ?
-                                   (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.insert))):0,
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of Replace cache look-ups: %I64u\n",*(biddyReplaceCache.search));
+    fprintf(f, "Number of Replace cache hits: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.find),
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.find))/(*(biddyReplaceCache.search))):0);
+    fprintf(f,"Number of Replace cache insertions: %I64u (%.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.insert),
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.insert))/(*(biddyReplaceCache.search))):0);
+    fprintf(f, "Number of Replace cache collisions: %I64u (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.overwrite),
+                                     (*(biddyReplaceCache.insert)) ?
+                                     (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.insert))):0,
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.search))):0);
+  }
 #else
-#ifdef BIDDYEXTENDEDSTATS_YES
-  fprintf(f, "Number of Replace cache look-ups: %llu\n",*(biddyReplaceCache.search));
-  fprintf(f, "Number of Replace cache hits: %llu (%.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.find),
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.find))/(*(biddyReplaceCache.search))):0);
-  fprintf(f,"Number of Replace cache insertions: %llu (%.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.insert),
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.insert))/(*(biddyReplaceCache.search))):0);
-  fprintf(f, "Number of Replace cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
-                                   *(biddyReplaceCache.overwrite),
-                                   (*(biddyReplaceCache.insert)) ?
-                                   (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.insert))):0,
-                                   (*(biddyReplaceCache.search)) ?
-                                   (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.search))):0);
-#endif
+  if (biddyNodeTable.extendedstats) {
+    fprintf(f, "Number of Replace cache look-ups: %llu\n",*(biddyReplaceCache.search));
+    fprintf(f, "Number of Replace cache hits: %llu (%.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.find),
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.find))/(*(biddyReplaceCache.search))):0);
+    fprintf(f,"Number of Replace cache insertions: %llu (%.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.insert),
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.insert))/(*(biddyReplaceCache.search))):0);
+    fprintf(f, "Number of Replace cache collisions: %llu (%.2f%% of all insertions, %.2f%% of all calls)\n",
+                                     *(biddyReplaceCache.overwrite),
+                                     (*(biddyReplaceCache.insert)) ?
+                                     (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.insert))):0,
+                                     (*(biddyReplaceCache.search)) ?
+                                     (100.0*(*(biddyReplaceCache.overwrite))/(*(biddyReplaceCache.search))):0);
+  }
 #endif
   fprintf(f,"**** END OF STATS ****\n");
 }
@@ -2605,6 +2878,46 @@ BiddyManagedPrintInfo(Biddy_Manager MNG, FILE *f)
 /* Definition of other internal functions                                     */
 /*----------------------------------------------------------------------------*/
 
+/*******************************************************************************
+\brief Function BiddyCountGarbage performs Garbage Collection for the Count
+       cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyCountGarbage(Biddy_Manager MNG)
+{
+  unsigned int j;
+  BiddyCountCache *c;
+
+  for (j=0; j<=biddyCountCache.size; j++) {
+    c = &biddyCountCache.table[j];
+    if (!BiddyIsNull(c->f) &&
+        (BiddyN(c->f)->expiry) && ((BiddyN(c->f)->expiry) < biddySystemAge))
+    {
+      c->f = biddyNull;
+    }
+  }
+}
+
+/*******************************************************************************
+\brief Function BiddyCountGarbageDeleteAll deletes all entries in the Count
+       cache.
+
+### Description
+### Side effects
+### More info
+*******************************************************************************/
+
+void
+BiddyCountGarbageDeleteAll(Biddy_Manager MNG)
+{
+  memset(biddyCountCache.table,0,(biddyCountCache.size+1)*sizeof(BiddyCountCache));
+}
+
 /*******************************************************************************
 \brief Function BiddyNodeNumber.
 
@@ -3251,6 +3564,34 @@ nodePlainNumber(Biddy_Manager MNG, Biddy_Edge f)
   return n;
 }
 
+/*******************************************************************************
+\brief Function findCountCache looks for the result in the Count cache.
+
+### Description
+    Count cache is direct-mapped, the entry is given in parameter c.
+### Side effects
+    If the result is not found then the caller should store it into the
+    returned entry.
+### More info
+*******************************************************************************/
+
+static inline Biddy_Boolean
+findCountCache(Biddy_Manager MNG, Biddy_Edge f, int nvars, BiddyCountCache **c)
+{
+  uintptr_t key;
+
+  key = ((uintptr_t) f >> 3) + (uintptr_t)(nvars + 2) * 1327958971;
+  *c = &biddyCountCache.table[key & biddyCountCache.size];
+
+  biddyCountCache.search++;
+  if (((*c)->f == f) && ((*c)->nvars == nvars)) {
+    biddyCountCache.find++;
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
 /*******************************************************************************
 \brief Function calculateSD.
 